@@ -0,0 +1,51 @@
+# cmake process file to generate the list of kernel event hooks from ntwmi.h
+# Parameters
+#   HEADER_FILE                - The header that defines the hooks, ntwmi.h
+#   OUTPUT_HEADER_FILE         - The path of header file to store the hook list.
+# Usage:
+# cmake -DHEADER_FILE=ntwmi.h -DOUTPUT_HEADER_FILE=win-polyfill-etl-hook-table.h \
+# -P generate_etl_hook_table.cmake
+#
+# Every definition of the form
+#   #define WMI_LOG_TYPE_<name> (EVENT_TRACE_GROUP_<group> | <type>)
+#   #define PERFINFO_LOG_TYPE_<name> (EVENT_TRACE_GROUP_<group> | <type>)
+# becomes a PHNT_ETL_HOOK(<macro>) row, in header order. Only the names are listed, the
+# values come from the macros when the table is compiled. Hooks of a group the header
+# does not define (EVENT_TRACE_GROUP_TBD) are left out.
+
+cmake_minimum_required(VERSION 3.17)
+
+file(STRINGS "${HEADER_FILE}" GROUP_LINES REGEX "^#define[ \t]+EVENT_TRACE_GROUP_")
+set(GROUPS "")
+foreach(LINE IN LISTS GROUP_LINES)
+  if (LINE MATCHES "^#define[ \t]+(EVENT_TRACE_GROUP_[A-Z0-9_]+)[ \t]")
+    list(APPEND GROUPS "${CMAKE_MATCH_1}")
+  endif()
+endforeach()
+
+file(STRINGS "${HEADER_FILE}" LINES REGEX "^#define[ \t]+(WMI|PERFINFO)_LOG_TYPE_")
+
+set(RESULT "/* Auto generated by cmake/generate_etl_hook_table.cmake, do not edit */\n\n")
+string(APPEND RESULT "// No include guard, included by win-polyfill-etl-dispatch.h once per pass.\n")
+set(LAST_GROUP "")
+set(COUNT 0)
+foreach(LINE IN LISTS LINES)
+  if (NOT LINE MATCHES
+      "^#define[ \t]+([A-Z]+_LOG_TYPE_[A-Za-z0-9_]+)[ \t]+\\((EVENT_TRACE_GROUP_[A-Z0-9_]+)[ \t]*\\|[ \t]*[A-Za-z0-9_]+\\)")
+    continue()
+  endif()
+  set(NAME "${CMAKE_MATCH_1}")
+  set(GROUP "${CMAKE_MATCH_2}")
+  if (NOT "${GROUP}" IN_LIST GROUPS)
+    continue()
+  endif()
+  if (NOT "${GROUP}" STREQUAL "${LAST_GROUP}")
+    string(APPEND RESULT "\n// ${GROUP}\n")
+    set(LAST_GROUP "${GROUP}")
+  endif()
+  string(APPEND RESULT "PHNT_ETL_HOOK(${NAME})\n")
+  math(EXPR COUNT "${COUNT} + 1")
+endforeach()
+
+file(WRITE "${OUTPUT_HEADER_FILE}" "${RESULT}")
+message(STATUS "${COUNT} hooks written to ${OUTPUT_HEADER_FILE}")
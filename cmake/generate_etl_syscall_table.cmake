@@ -0,0 +1,37 @@
+# cmake process file to generate the list of system service names from ntzwapi.h
+# Parameters
+#   HEADER_FILE                - The header that declares the services, ntzwapi.h
+#   OUTPUT_HEADER_FILE         - The path of header file to store the service list.
+# Usage:
+# cmake -DHEADER_FILE=ntzwapi.h -DOUTPUT_HEADER_FILE=win-polyfill-etl-syscall-table.h \
+# -P generate_etl_syscall_table.cmake
+#
+# Every declaration line of the form
+#   Zw<name>(
+# becomes a PHNT_ETL_SYSCALL(Nt<name>) row, sorted by name, so the row of a service is
+# its id in etl_syscall_map files and stays put as long as no service is added before
+# it. Duplicates are listed once.
+
+cmake_minimum_required(VERSION 3.17)
+
+file(STRINGS "${HEADER_FILE}" LINES REGEX "^Zw[A-Za-z0-9_]+\\($")
+
+set(NAMES "")
+foreach(LINE IN LISTS LINES)
+  if (LINE MATCHES "^Zw([A-Za-z0-9_]+)\\($")
+    list(APPEND NAMES "Nt${CMAKE_MATCH_1}")
+  endif()
+endforeach()
+list(REMOVE_DUPLICATES NAMES)
+list(SORT NAMES)
+
+set(RESULT "/* Auto generated by cmake/generate_etl_syscall_table.cmake, do not edit */\n\n")
+string(APPEND RESULT "// No include guard, included by win-polyfill-etl-syscall.h.\n\n")
+set(COUNT 0)
+foreach(NAME IN LISTS NAMES)
+  string(APPEND RESULT "PHNT_ETL_SYSCALL(${NAME})\n")
+  math(EXPR COUNT "${COUNT} + 1")
+endforeach()
+
+file(WRITE "${OUTPUT_HEADER_FILE}" "${RESULT}")
+message(STATUS "${COUNT} services written to ${OUTPUT_HEADER_FILE}")
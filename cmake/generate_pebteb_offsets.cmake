@@ -0,0 +1,393 @@
+# cmake process file to generate the PEB/TEB field offset table from the versioned definitions
+# Parameters
+#   HEADER_DIR                 - The directory contains the headers
+#   HEADER_FILES               - The headers to scan, in the form STRUCT=file, e.g. PEB=win-polyfill-peb.h
+#   OUTPUT_HEADER_FILE         - The path of header file to store the offset table.
+# Usage:
+# cmake -DHEADER_DIR=. -DHEADER_FILES=PEB=win-polyfill-peb.h;TEB=win-polyfill-teb.h \
+# -DOUTPUT_HEADER_FILE=win-polyfill-pebteb-offsets-table.h -P generate_pebteb_offsets.cmake
+#
+# Every member that is preceded by a comment of the form
+#   // <x86 offset|none> <x64 offset|none> (<versions>)
+# gets one row per version range. The versions are written as in the headers, e.g. "all",
+# "3.51 and higher", "4.0 only", "3.10 to early 5.2", "late 5.1; 6.1 and higher".
+#
+# A comment before a union or struct limits the versions of the members inside it, and a
+# comment inside an #ifdef _WIN64 branch only gives the offset of that architecture. The
+# rows of a member are then split at every version boundary and merged again, so no two
+# rows of a member overlap. Two comments that give different offsets for the same version
+# and architecture stop the generation.
+
+cmake_policy(SET CMP0057 NEW)
+
+# Windows versions in release order: label, build number, service pack of the "late" build.
+# The early and late builds of 5.1, 5.2 and 6.0 differ only by service pack (5.1 SP2, 5.2 SP1
+# and 6.0 SP1), which is why the table is keyed by build * 16 + service pack.
+set(PEBTEB_VERSIONS
+  "3.10:511:0"
+  "3.50:807:0"
+  "3.51:1057:0"
+  "4.0:1381:0"
+  "5.0:2195:0"
+  "5.1:2600:2"
+  "5.2:3790:1"
+  "6.0:6000:1"
+  "6.1:7600:0"
+  "6.2:9200:0"
+  "6.3:9600:0"
+  "10.0:10240:0"
+  "1511:10586:0"
+  "1607:14393:0"
+  "1703:15063:0"
+  "1709:16299:0"
+  "1803:17134:0"
+  "1809:17763:0"
+  "1903:18362:0"
+  "1909:18363:0"
+  "2004:19041:0"
+  "10.0.22000:22000:0"
+  # NTDDI_WIN11_ZN was first released with 24H2
+  "NTDDI_WIN11_ZN:26100:0"
+)
+set(PEBTEB_KEY_MAX 4294967295)
+
+# early/late/end key of a version label, the end key is the early key of the next version
+function(pebteb_version_key LABEL KIND OUT)
+  set(PREVIOUS_FOUND FALSE)
+  foreach(VERSION IN LISTS PEBTEB_VERSIONS)
+    string(REPLACE ":" ";" VERSION "${VERSION}")
+    list(GET VERSION 0 VERSION_LABEL)
+    list(GET VERSION 1 VERSION_BUILD)
+    list(GET VERSION 2 VERSION_LATE_SP)
+    if (PREVIOUS_FOUND)
+      math(EXPR KEY "${VERSION_BUILD} * 16")
+      set(${OUT} ${KEY} PARENT_SCOPE)
+      return()
+    endif()
+    if ("${VERSION_LABEL}" STREQUAL "${LABEL}")
+      if ("${KIND}" STREQUAL "early")
+        math(EXPR KEY "${VERSION_BUILD} * 16")
+      elseif ("${KIND}" STREQUAL "late")
+        # 6.0 SP1 is the only late version with its own build number
+        if ("${LABEL}" STREQUAL "6.0")
+          math(EXPR KEY "6001 * 16")
+        else()
+          math(EXPR KEY "${VERSION_BUILD} * 16 + ${VERSION_LATE_SP}")
+        endif()
+      else()
+        set(PREVIOUS_FOUND TRUE)
+        continue()
+      endif()
+      set(${OUT} ${KEY} PARENT_SCOPE)
+      return()
+    endif()
+  endforeach()
+  if (PREVIOUS_FOUND)
+    set(${OUT} ${PEBTEB_KEY_MAX} PARENT_SCOPE)
+    return()
+  endif()
+  message(FATAL_ERROR "Unknown Windows version '${LABEL}'")
+endfunction()
+
+function(pebteb_format_key KEY OUT)
+  if ("${KEY}" STREQUAL "${PEBTEB_KEY_MAX}")
+    set(${OUT} "build_key_max" PARENT_SCOPE)
+  else()
+    math(EXPR BUILD "${KEY} / 16")
+    math(EXPR SERVICE_PACK "${KEY} % 16")
+    set(${OUT} "build_key(${BUILD},@SP@${SERVICE_PACK})" PARENT_SCOPE)
+  endif()
+endfunction()
+
+function(pebteb_range_start QUALIFIER LABEL OUT)
+  if ("${QUALIFIER}" STREQUAL "late")
+    pebteb_version_key("${LABEL}" late KEY)
+  else()
+    pebteb_version_key("${LABEL}" early KEY)
+  endif()
+  set(${OUT} ${KEY} PARENT_SCOPE)
+endfunction()
+
+function(pebteb_range_end QUALIFIER LABEL OUT)
+  if ("${QUALIFIER}" STREQUAL "early")
+    pebteb_version_key("${LABEL}" late KEY)
+  else()
+    pebteb_version_key("${LABEL}" end KEY)
+  endif()
+  set(${OUT} ${KEY} PARENT_SCOPE)
+endfunction()
+
+# "<first> <end>" half-open key ranges of one comment
+function(pebteb_parse_versions VERSIONS OUT)
+  set(RANGES "")
+  string(REPLACE "@SEMI@ " "|" VERSIONS "${VERSIONS}")
+  string(REPLACE "|" ";" VERSIONS "${VERSIONS}")
+  foreach(VERSION IN LISTS VERSIONS)
+    if ("${VERSION}" STREQUAL "all")
+      set(FIRST 0)
+      set(LAST ${PEBTEB_KEY_MAX})
+    elseif ("${VERSION}" MATCHES "^((early|late) )?([^ ]+) and higher$")
+      pebteb_range_start("${CMAKE_MATCH_2}" "${CMAKE_MATCH_3}" FIRST)
+      set(LAST ${PEBTEB_KEY_MAX})
+    elseif ("${VERSION}" MATCHES "^((early|late) )?([^ ]+)( only)?$")
+      pebteb_range_start("${CMAKE_MATCH_2}" "${CMAKE_MATCH_3}" FIRST)
+      pebteb_range_end("${CMAKE_MATCH_2}" "${CMAKE_MATCH_3}" LAST)
+    elseif ("${VERSION}" MATCHES "^((early|late) )?([^ ]+) to ((early|late) )?([^ ]+)$")
+      set(LAST_QUALIFIER "${CMAKE_MATCH_5}")
+      set(LAST_LABEL "${CMAKE_MATCH_6}")
+      pebteb_range_start("${CMAKE_MATCH_2}" "${CMAKE_MATCH_3}" FIRST)
+      pebteb_range_end("${LAST_QUALIFIER}" "${LAST_LABEL}" LAST)
+    else()
+      message(FATAL_ERROR "Unknown version range '${VERSION}'")
+    endif()
+    list(APPEND RANGES "${FIRST}:${LAST}")
+  endforeach()
+  set(${OUT} "${RANGES}" PARENT_SCOPE)
+endfunction()
+
+# The parts of the "<first>:<end>" ranges A that are also in B
+function(pebteb_intersect A B OUT)
+  set(RANGES "")
+  foreach(RANGE_A IN LISTS A)
+    string(REPLACE ":" ";" RANGE_A "${RANGE_A}")
+    list(GET RANGE_A 0 FIRST_A)
+    list(GET RANGE_A 1 LAST_A)
+    foreach(RANGE_B IN LISTS B)
+      string(REPLACE ":" ";" RANGE_B "${RANGE_B}")
+      list(GET RANGE_B 0 FIRST)
+      list(GET RANGE_B 1 LAST)
+      if (FIRST_A GREATER FIRST)
+        set(FIRST ${FIRST_A})
+      endif()
+      if (LAST_A LESS LAST)
+        set(LAST ${LAST_A})
+      endif()
+      if (FIRST LESS LAST)
+        list(APPEND RANGES "${FIRST}:${LAST}")
+      endif()
+    endforeach()
+  endforeach()
+  set(${OUT} "${RANGES}" PARENT_SCOPE)
+endfunction()
+
+# Appends the disjoint rows of one member to ROWS_STRING and sets ROW_COUNT, from the
+# "<arch> <first> <end> <offset>" entries in ENTRIES
+function(pebteb_emit_rows FIELD_NAME ENTRIES)
+  # Keys are zero padded to sort as strings, list(SORT) compares numbers only since 3.18
+  set(KEYS "")
+  foreach(ENTRY IN LISTS ENTRIES)
+    string(REPLACE " " ";" ENTRY "${ENTRY}")
+    foreach(INDEX 1 2)
+      list(GET ENTRY ${INDEX} KEY)
+      string(LENGTH "${KEY}" KEY_LENGTH)
+      math(EXPR PAD_LENGTH "10 - ${KEY_LENGTH}")
+      string(REPEAT "0" ${PAD_LENGTH} PAD)
+      list(APPEND KEYS "${PAD}${KEY}")
+    endforeach()
+  endforeach()
+  list(REMOVE_DUPLICATES KEYS)
+  list(SORT KEYS)
+
+  set(ROWS "")
+  set(PREVIOUS "")
+  foreach(KEY IN LISTS KEYS)
+    math(EXPR KEY "${KEY}")
+    if (NOT "${PREVIOUS}" STREQUAL "")
+      # The offsets of [PREVIOUS, KEY), every entry covers all or none of it
+      foreach(ARCH x86 x64)
+        set(OFFSET_${ARCH} "none")
+      endforeach()
+      foreach(ENTRY IN LISTS ENTRIES)
+        string(REPLACE " " ";" ENTRY "${ENTRY}")
+        list(GET ENTRY 0 ARCH)
+        list(GET ENTRY 1 FIRST)
+        list(GET ENTRY 2 LAST)
+        list(GET ENTRY 3 OFFSET)
+        if (FIRST GREATER PREVIOUS OR NOT LAST GREATER PREVIOUS)
+          continue()
+        endif()
+        if (DEFINED SEEN_${ARCH} AND NOT "${OFFSET_${ARCH}}" STREQUAL "${OFFSET}")
+          pebteb_format_key(${PREVIOUS} FIRST)
+          string(REPLACE "@SP@" " " FIRST "${FIRST}")
+          message(FATAL_ERROR "${FIELD_NAME} has both ${OFFSET_${ARCH}} and ${OFFSET} "
+            "as ${ARCH} offset at ${FIRST}")
+        endif()
+        set(SEEN_${ARCH} TRUE)
+        set(OFFSET_${ARCH} "${OFFSET}")
+      endforeach()
+      unset(SEEN_x86)
+      unset(SEEN_x64)
+      if (NOT "${OFFSET_x86} ${OFFSET_x64}" STREQUAL "none none")
+        list(LENGTH ROWS ROW_COUNT)
+        if (ROW_COUNT GREATER 0)
+          list(GET ROWS -1 LAST_ROW)
+          string(REPLACE " " ";" LAST_ROW "${LAST_ROW}")
+          list(GET LAST_ROW 0 LAST_FIRST)
+          list(GET LAST_ROW 1 LAST_END)
+          list(GET LAST_ROW 2 LAST_X86)
+          list(GET LAST_ROW 3 LAST_X64)
+        endif()
+        if (ROW_COUNT GREATER 0 AND LAST_END EQUAL PREVIOUS AND
+            "${LAST_X86} ${LAST_X64}" STREQUAL "${OFFSET_x86} ${OFFSET_x64}")
+          list(REMOVE_AT ROWS -1)
+          list(APPEND ROWS "${LAST_FIRST} ${KEY} ${OFFSET_x86} ${OFFSET_x64}")
+        else()
+          list(APPEND ROWS "${PREVIOUS} ${KEY} ${OFFSET_x86} ${OFFSET_x64}")
+        endif()
+      endif()
+    endif()
+    set(PREVIOUS ${KEY})
+  endforeach()
+
+  foreach(ROW IN LISTS ROWS)
+    string(REPLACE " " ";" ROW "${ROW}")
+    list(GET ROW 0 ROW_FIRST)
+    list(GET ROW 1 ROW_LAST)
+    list(GET ROW 2 ROW_X86)
+    list(GET ROW 3 ROW_X64)
+    pebteb_format_key(${ROW_FIRST} ROW_FIRST)
+    pebteb_format_key(${ROW_LAST} ROW_LAST)
+    if ("${ROW_X86}" STREQUAL "none")
+      set(ROW_X86 "field_offset_none")
+    endif()
+    if ("${ROW_X64}" STREQUAL "none")
+      set(ROW_X64 "field_offset_none")
+    endif()
+    string(APPEND ROWS_STRING "    {${ROW_FIRST}, ${ROW_LAST}, ${ROW_X86}, ${ROW_X64}}, // ${FIELD_NAME}\n")
+  endforeach()
+  list(LENGTH ROWS ROW_COUNT)
+  set(ROWS_STRING "${ROWS_STRING}" PARENT_SCOPE)
+  set(ROW_COUNT ${ROW_COUNT} PARENT_SCOPE)
+endfunction()
+
+string(RANDOM TMP_NAME)
+set(OUTPUT_HEADER_FILE_TMP "${OUTPUT_HEADER_FILE}-${TMP_NAME}.tmp")
+file(WRITE ${OUTPUT_HEADER_FILE_TMP} "/* Auto generated by cmake/generate_pebteb_offsets.cmake, do not edit */\n\n#pragma once\n\nnamespace phnt\n{\n")
+
+foreach(HEADER IN LISTS HEADER_FILES)
+  string(REPLACE "=" ";" HEADER "${HEADER}")
+  list(GET HEADER 0 STRUCT_NAME)
+  list(GET HEADER 1 HEADER_FILE)
+  string(TOLOWER "${STRUCT_NAME}" STRUCT_NAME_LOWER)
+
+  # Semicolons and brackets are list syntax in cmake, hide them before splitting the lines.
+  file(READ ${HEADER_DIR}/${HEADER_FILE} headerString)
+  string(REPLACE ";" "@SEMI@" headerString "${headerString}")
+  string(REPLACE "[" "@LB@" headerString "${headerString}")
+  string(REPLACE "]" "@RB@" headerString "${headerString}")
+  string(REPLACE "\r" "" headerString "${headerString}")
+  string(REPLACE "\n" ";" headerLines "${headerString}")
+
+  set(IN_STRUCT FALSE)
+  set(PENDING FALSE)
+  set(FIELDS "")
+  # Versions of the innermost union or struct, one entry per open brace with its ranges
+  # separated by commas
+  set(SCOPES "")
+  set(SCOPE "0:${PEBTEB_KEY_MAX}")
+  set(NEXT_SCOPE "${SCOPE}")
+  set(ARCHS x86 x64)
+  foreach(LINE IN LISTS headerLines)
+    if ("${LINE}" MATCHES "^typedef struct _${STRUCT_NAME}$")
+      set(IN_STRUCT TRUE)
+      continue()
+    endif()
+    if (NOT IN_STRUCT)
+      continue()
+    endif()
+    if ("${LINE}" MATCHES "^} ${STRUCT_NAME},")
+      break()
+    endif()
+    if ("${LINE}" MATCHES "^ *{$")
+      string(REPLACE ";" "," SCOPE_ENTRY "${NEXT_SCOPE}")
+      list(APPEND SCOPES "${SCOPE_ENTRY}")
+      set(SCOPE "${NEXT_SCOPE}")
+      set(PENDING FALSE)
+      continue()
+    elseif ("${LINE}" MATCHES "^ *}")
+      list(REMOVE_AT SCOPES -1)
+      list(LENGTH SCOPES SCOPE_DEPTH)
+      if (SCOPE_DEPTH GREATER 0)
+        list(GET SCOPES -1 SCOPE)
+        string(REPLACE "," ";" SCOPE "${SCOPE}")
+      endif()
+      set(NEXT_SCOPE "${SCOPE}")
+      set(PENDING FALSE)
+      continue()
+    elseif ("${LINE}" MATCHES "^#ifdef _WIN64")
+      set(ARCHS x64)
+    elseif ("${LINE}" MATCHES "^#ifndef _WIN64")
+      set(ARCHS x86)
+    elseif ("${LINE}" MATCHES "^#else")
+      if ("${ARCHS}" STREQUAL "x86")
+        set(ARCHS x64)
+      elseif ("${ARCHS}" STREQUAL "x64")
+        set(ARCHS x86)
+      endif()
+    elseif ("${LINE}" MATCHES "^#endif")
+      set(ARCHS x86 x64)
+    endif()
+    if ("${LINE}" MATCHES "^ *// (0x[0-9A-Fa-f]+|none) (0x[0-9A-Fa-f]+|none) \\(([^)]*)\\)")
+      set(PENDING TRUE)
+      set(PENDING_x86 "${CMAKE_MATCH_1}")
+      set(PENDING_x64 "${CMAKE_MATCH_2}")
+      set(PENDING_ARCHS ${ARCHS})
+      # "(6.0 and higher (x64))" only repeats which #ifdef branch it is in
+      string(REGEX REPLACE " \\((x86|x64)$" "" PENDING_VERSIONS "${CMAKE_MATCH_3}")
+    elseif ("${LINE}" MATCHES "^ *//" OR "${LINE}" MATCHES "^#" OR "${LINE}" STREQUAL "")
+      # comments and conditionals between the offset comment and the member
+    elseif (PENDING AND "${LINE}" MATCHES "^ *[A-Za-z_]" AND
+            NOT "${LINE}" MATCHES "^ *(union|struct)( |$)" AND
+            "${LINE}" MATCHES "([A-Za-z_][A-Za-z0-9_]*)(@LB@[^@]*@RB@)?( *: *[0-9]+)? *@SEMI@")
+      set(FIELD_NAME "${CMAKE_MATCH_1}")
+      if (NOT "${FIELD_NAME}" IN_LIST FIELDS)
+        list(APPEND FIELDS "${FIELD_NAME}")
+        set(ENTRIES_${FIELD_NAME} "")
+      endif()
+      pebteb_parse_versions("${PENDING_VERSIONS}" RANGES)
+      pebteb_intersect("${RANGES}" "${SCOPE}" RANGES)
+      foreach(RANGE IN LISTS RANGES)
+        string(REPLACE ":" " " RANGE "${RANGE}")
+        foreach(ARCH IN LISTS PENDING_ARCHS)
+          list(APPEND ENTRIES_${FIELD_NAME} "${ARCH} ${RANGE} ${PENDING_${ARCH}}")
+        endforeach()
+      endforeach()
+      set(PENDING FALSE)
+    elseif (PENDING AND "${LINE}" MATCHES "^ *(union|struct)$")
+      # The offsets are the ones of its first member, only the versions carry over
+      pebteb_parse_versions("${PENDING_VERSIONS}" RANGES)
+      pebteb_intersect("${RANGES}" "${SCOPE}" NEXT_SCOPE)
+      set(PENDING FALSE)
+    else()
+      set(PENDING FALSE)
+    endif()
+  endforeach()
+
+  file(APPEND ${OUTPUT_HEADER_FILE_TMP} "\nenum class ${STRUCT_NAME_LOWER}_field : USHORT\n{\n")
+  foreach(FIELD_NAME IN LISTS FIELDS)
+    file(APPEND ${OUTPUT_HEADER_FILE_TMP} "    ${FIELD_NAME},\n")
+  endforeach()
+  file(APPEND ${OUTPUT_HEADER_FILE_TMP} "    MaximumField\n}@SEMI@\n")
+
+  # Rows grouped by member, in member order, with the first row and row count per member.
+  set(INDEX_STRING "")
+  set(ROWS_STRING "")
+  set(ROW_INDEX 0)
+  foreach(FIELD_NAME IN LISTS FIELDS)
+    pebteb_emit_rows(${FIELD_NAME} "${ENTRIES_${FIELD_NAME}}")
+    string(APPEND INDEX_STRING "    {${ROW_INDEX}, ${ROW_COUNT}}, // ${FIELD_NAME}\n")
+    math(EXPR ROW_INDEX "${ROW_INDEX} + ${ROW_COUNT}")
+  endforeach()
+  file(APPEND ${OUTPUT_HEADER_FILE_TMP} "\nconstexpr field_offset_range ${STRUCT_NAME_LOWER}_field_offset_ranges[] = {\n${ROWS_STRING}}@SEMI@\n")
+  file(APPEND ${OUTPUT_HEADER_FILE_TMP} "\nconstexpr field_offset_index ${STRUCT_NAME_LOWER}_field_offset_indexes[] = {\n${INDEX_STRING}}@SEMI@\n")
+endforeach()
+
+file(APPEND ${OUTPUT_HEADER_FILE_TMP} "\n} // namespace phnt\n")
+
+file(READ ${OUTPUT_HEADER_FILE_TMP} outputString)
+string(REPLACE "@SEMI@" ";" outputString "${outputString}")
+string(REPLACE "@SP@" " " outputString "${outputString}")
+string(REPLACE "@LB@" "[" outputString "${outputString}")
+string(REPLACE "@RB@" "]" outputString "${outputString}")
+file(WRITE ${OUTPUT_HEADER_FILE_TMP} "${outputString}")
+file(RENAME ${OUTPUT_HEADER_FILE_TMP} ${OUTPUT_HEADER_FILE})
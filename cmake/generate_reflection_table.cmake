@@ -0,0 +1,308 @@
+# cmake process file to generate the structure reflection table from the headers
+# Parameters
+#   HEADER_DIR                 - The directory contains the headers
+#   HEADER_FILES               - The headers to scan, in include order
+#   OUTPUT_HEADER_FILE         - The path of header file to store the reflection table.
+# Usage:
+# cmake -DHEADER_DIR=. -DHEADER_FILES=phnt_ntdef.h;ntwmi.h \
+# -DOUTPUT_HEADER_FILE=win-polyfill-reflection-table.h -P generate_reflection_table.cmake
+#
+# The table only lists structures and member names, in the form
+#   PHNT_REFLECT_BEGIN(WMI_BUFFER_HEADER)
+#   PHNT_REFLECT_FIELD(BufferSize, "ULONG")
+#   PHNT_REFLECT_BITFIELD(Flags, "USHORT")
+#   PHNT_REFLECT_END(WMI_BUFFER_HEADER)
+# together with the conditional directives around them, so that offsets and sizes are
+# computed by the compiler for the target being built, see win-polyfill-reflection.h.
+# The headers are expected in the phnt style: one member per line, braces on their own
+# lines and anonymous structures and unions closed by "};".
+
+cmake_minimum_required(VERSION 3.17)
+
+set(REFLECT_DIRECTIVE_REGEX "^#[ \t]*(if|ifdef|ifndef|elif|else|endif)([^A-Za-z_0-9].*)?$")
+set(REFLECT_IDENTIFIER_REGEX "[A-Za-z_][A-Za-z_0-9]*")
+
+# Reads a header without comments and line continuations, ";", "[" and "]" are escaped
+# so that the result can be handled as a list of lines.
+function(reflect_read_header FILE_PATH OUT)
+  file(READ "${FILE_PATH}" CONTENT)
+  string(REPLACE "\r" "" CONTENT "${CONTENT}")
+  string(ASCII 239 187 191 BOM)
+  string(FIND "${CONTENT}" "${BOM}" BOM_INDEX)
+  if (BOM_INDEX EQUAL 0)
+    string(SUBSTRING "${CONTENT}" 3 -1 CONTENT)
+  endif()
+  set(STRIPPED "")
+  while (TRUE)
+    string(FIND "${CONTENT}" "/*" COMMENT_BEGIN)
+    if (COMMENT_BEGIN EQUAL -1)
+      break()
+    endif()
+    string(SUBSTRING "${CONTENT}" 0 ${COMMENT_BEGIN} BEFORE)
+    math(EXPR COMMENT_BEGIN "${COMMENT_BEGIN} + 2")
+    string(SUBSTRING "${CONTENT}" ${COMMENT_BEGIN} -1 CONTENT)
+    # A "/*" after "//" is part of a line comment
+    string(FIND "${BEFORE}" "\n" LAST_NEWLINE REVERSE)
+    math(EXPR LAST_NEWLINE "${LAST_NEWLINE} + 1")
+    string(SUBSTRING "${BEFORE}" ${LAST_NEWLINE} -1 LAST_LINE)
+    string(FIND "${LAST_LINE}" "//" LINE_COMMENT)
+    if (NOT LINE_COMMENT EQUAL -1)
+      string(APPEND STRIPPED "${BEFORE}/*")
+      continue()
+    endif()
+    string(FIND "${CONTENT}" "*/" COMMENT_END)
+    if (COMMENT_END EQUAL -1)
+      set(CONTENT "")
+      break()
+    endif()
+    string(SUBSTRING "${CONTENT}" 0 ${COMMENT_END} COMMENT)
+    string(REGEX REPLACE "[^\n]" "" COMMENT "${COMMENT}")
+    math(EXPR COMMENT_END "${COMMENT_END} + 2")
+    string(SUBSTRING "${CONTENT}" ${COMMENT_END} -1 CONTENT)
+    string(APPEND STRIPPED "${BEFORE} ${COMMENT}")
+  endwhile()
+  string(APPEND STRIPPED "${CONTENT}")
+  string(REGEX REPLACE "//[^\n]*" "" STRIPPED "${STRIPPED}")
+  string(REGEX REPLACE "\\\\\n" " " STRIPPED "${STRIPPED}")
+  string(REPLACE ";" "@SEMI@" STRIPPED "${STRIPPED}")
+  string(REPLACE "[" "@LB@" STRIPPED "${STRIPPED}")
+  string(REPLACE "]" "@RB@" STRIPPED "${STRIPPED}")
+  string(REPLACE "\n" ";" STRIPPED "${STRIPPED}")
+  set(${OUT} "${STRIPPED}" PARENT_SCOPE)
+endfunction()
+
+# Appends the table lines of one member declaration (without the trailing ";") to OUT
+function(reflect_member DECLARATION OUT)
+  set(ITEMS ${${OUT}})
+  string(REGEX REPLACE "[ \t]+" " " DECLARATION "${DECLARATION}")
+  string(STRIP "${DECLARATION}" DECLARATION)
+  # SAL annotations
+  string(REGEX REPLACE "_[A-Z][A-Za-z_]*_\\([^()]*(\\([^()]*\\)[^()]*)*\\) ?" "" DECLARATION "${DECLARATION}")
+  string(REGEX REPLACE "(^| )_[A-Z][A-Za-z_]*_ " "\\1" DECLARATION "${DECLARATION}")
+  if ("${DECLARATION}" MATCHES "^(static|typedef|friend|using) ")
+    return()
+  endif()
+
+  # Function pointer, e.g. "VOID (NTAPI *Routine)(PVOID)"
+  if ("${DECLARATION}" MATCHES "^([^(]*)\\([A-Za-z_ ]*\\* ?(${REFLECT_IDENTIFIER_REGEX}) ?\\)")
+    string(STRIP "${CMAKE_MATCH_1}" TYPE)
+    list(APPEND ITEMS "PHNT_REFLECT_FIELD(${CMAKE_MATCH_2}, \"${TYPE}(*)\")")
+    set(${OUT} ${ITEMS} PARENT_SCOPE)
+    return()
+  endif()
+
+  string(REPLACE "," "\n" DECLARATORS "${DECLARATION}")
+  string(REPLACE "\n" ";" DECLARATORS "${DECLARATORS}")
+  set(TYPE "")
+  foreach(DECLARATOR IN LISTS DECLARATORS)
+    string(STRIP "${DECLARATOR}" DECLARATOR)
+    # Unnamed bit-field, e.g. "UCHAR : 6"
+    if ("${TYPE}" STREQUAL "" AND "${DECLARATOR}" MATCHES "^${REFLECT_IDENTIFIER_REGEX} ?:")
+      return()
+    endif()
+    set(WIDTH "")
+    if ("${DECLARATOR}" MATCHES "^([^:]*[^: ]) ?: ?(.+)$")
+      set(DECLARATOR "${CMAKE_MATCH_1}")
+      set(WIDTH "${CMAKE_MATCH_2}")
+    endif()
+    if ("${TYPE}" STREQUAL "")
+      if (NOT "${DECLARATOR}" MATCHES "^(.*[^A-Za-z_0-9])(${REFLECT_IDENTIFIER_REGEX}) ?((@LB@[^@]*@RB@ ?)*)$")
+        message(WARNING "reflection: unhandled member \"${DECLARATION}\"")
+        return()
+      endif()
+      set(NAME "${CMAKE_MATCH_2}")
+      set(ARRAY "${CMAKE_MATCH_3}")
+      string(STRIP "${CMAKE_MATCH_1}" TYPE)
+      # The pointer of the first declarator is not part of the type of the others
+      string(REGEX REPLACE "[ *]+$" "" BASE_TYPE "${TYPE}")
+    else()
+      if (NOT "${DECLARATOR}" MATCHES "^([* ]*)(${REFLECT_IDENTIFIER_REGEX}) ?((@LB@[^@]*@RB@ ?)*)$")
+        message(WARNING "reflection: unhandled member \"${DECLARATION}\"")
+        return()
+      endif()
+      set(NAME "${CMAKE_MATCH_2}")
+      set(ARRAY "${CMAKE_MATCH_3}")
+      string(STRIP "${BASE_TYPE} ${CMAKE_MATCH_1}" TYPE)
+    endif()
+    if ("${TYPE}" STREQUAL "" OR "${TYPE}" MATCHES "^(struct|union|enum|const|volatile)$")
+      continue()
+    endif()
+    string(REGEX REPLACE " ?\\*" "*" TYPE "${TYPE}")
+    string(REGEX REPLACE "^WIN_POLYFILL_POINTER\\((.*)\\)$" "\\1" TYPE "${TYPE}")
+    if (NOT "${WIDTH}" STREQUAL "")
+      list(APPEND ITEMS "PHNT_REFLECT_BITFIELD(${NAME}, \"${TYPE}\")")
+    elseif ("${ARRAY}" MATCHES "@LB@ ?@RB@")
+      list(APPEND ITEMS "PHNT_REFLECT_FLEXIBLE_FIELD(${NAME}, \"${TYPE}\")")
+    else()
+      list(APPEND ITEMS "PHNT_REFLECT_FIELD(${NAME}, \"${TYPE}\")")
+    endif()
+  endforeach()
+  set(${OUT} ${ITEMS} PARENT_SCOPE)
+endfunction()
+
+# Removes the conditional blocks without a structure
+function(reflect_prune_directives OUT)
+  set(ITEMS ${${OUT}})
+  # Conditional blocks that end up empty
+  string(REPLACE ";" "\n" TEXT "${ITEMS}")
+  set(TEXT "\n${TEXT}\n")
+  set(PREVIOUS "")
+  while (NOT "${TEXT}" STREQUAL "${PREVIOUS}")
+    set(PREVIOUS "${TEXT}")
+    string(REGEX REPLACE "\n#(if|ifdef|ifndef)[^\n]*\n(#(elif|else)[^\n]*\n)*#endif[^\n]*\n" "\n" TEXT "${TEXT}")
+    string(REGEX REPLACE "\n#(elif|else)[^\n]*\n#endif" "\n#endif" TEXT "${TEXT}")
+  endwhile()
+  string(STRIP "${TEXT}" TEXT)
+  string(REPLACE "\n" ";" ITEMS "${TEXT}")
+  set(${OUT} ${ITEMS} PARENT_SCOPE)
+endfunction()
+
+set(OUTPUT_TEXT "/* Auto generated by cmake/generate_reflection_table.cmake, do not edit */\n\n")
+string(APPEND OUTPUT_TEXT "// No include guard, included by win-polyfill-reflection.h once per pass.\n")
+set(STRUCT_COUNT 0)
+foreach(HEADER_FILE IN LISTS HEADER_FILES)
+  reflect_read_header("${HEADER_DIR}/${HEADER_FILE}" LINES)
+
+  # LEVEL_<n>_ITEMS are the table lines of the structure or union being parsed at depth n,
+  # LEVEL_<n>_TAG the tag of the outermost one.
+  set(FILE_ITEMS "")
+  set(GUARDS "")
+  set(LEVEL 0)
+  set(EXPECT_BRACE FALSE)
+  set(PENDING "")
+  foreach(LINE IN LISTS LINES)
+    string(STRIP "${LINE}" LINE)
+    if ("${LINE}" STREQUAL "")
+      continue()
+    endif()
+
+    if ("${LINE}" MATCHES "^#")
+      string(REGEX REPLACE "^#[ \t]*" "#" LINE "${LINE}")
+      string(REGEX REPLACE "[ \t]+" " " LINE "${LINE}")
+      if ("${LINE}" MATCHES "${REFLECT_DIRECTIVE_REGEX}")
+        if (LEVEL EQUAL 0)
+          if ("${LINE}" MATCHES "^#(ifndef |if !defined ?\\(? ?)(${REFLECT_IDENTIFIER_REGEX})")
+            list(LENGTH FILE_ITEMS GUARD_INDEX)
+            list(APPEND GUARDS "${CMAKE_MATCH_2}:${GUARD_INDEX}")
+          endif()
+          list(APPEND FILE_ITEMS "${LINE}")
+        else()
+          list(APPEND LEVEL_${LEVEL}_ITEMS "${LINE}")
+        endif()
+      elseif (LEVEL EQUAL 0 AND "${LINE}" MATCHES "^#define (${REFLECT_IDENTIFIER_REGEX})$")
+        # Include guard, or a block guarded the same way. The macro is defined once the
+        # header has been included whoever defined it, so the table tests for it instead.
+        set(GUARD_MACRO "${CMAKE_MATCH_1}")
+        foreach(GUARD IN LISTS GUARDS)
+          if ("${GUARD}" MATCHES "^${GUARD_MACRO}:([0-9]+)$")
+            list(REMOVE_AT FILE_ITEMS ${CMAKE_MATCH_1})
+            list(INSERT FILE_ITEMS ${CMAKE_MATCH_1} "#ifdef ${GUARD_MACRO}")
+          endif()
+        endforeach()
+      endif()
+      continue()
+    endif()
+    set(GUARDS "")
+
+    if (EXPECT_BRACE)
+      set(EXPECT_BRACE FALSE)
+      if ("${LINE}" STREQUAL "{")
+        math(EXPR LEVEL "${LEVEL} + 1")
+        set(LEVEL_${LEVEL}_ITEMS "")
+        set(LEVEL_${LEVEL}_TAG "${NEXT_TAG}")
+        continue()
+      endif()
+    endif()
+
+    if (LEVEL EQUAL 0)
+      # Structure definitions, not forward declarations
+      if ("${LINE}" MATCHES "^(typedef )?(DECLSPEC_[A-Z_]+(\\([^)]*\\))? )?(struct|union)( DECLSPEC_[A-Z_]+(\\([^)]*\\))?)?( (${REFLECT_IDENTIFIER_REGEX}))?( ?{)?$")
+        set(NEXT_TAG "${CMAKE_MATCH_8}")
+        if ("${CMAKE_MATCH_9}" STREQUAL "")
+          set(EXPECT_BRACE TRUE)
+        else()
+          set(LEVEL 1)
+          set(LEVEL_1_ITEMS "")
+          set(LEVEL_1_TAG "${NEXT_TAG}")
+        endif()
+      endif()
+      continue()
+    endif()
+
+    # Nested structure or union
+    if ("${LINE}" MATCHES "^(struct|union)( ${REFLECT_IDENTIFIER_REGEX})?( ?{)?$")
+      set(NEXT_TAG "")
+      if ("${CMAKE_MATCH_3}" STREQUAL "")
+        set(EXPECT_BRACE TRUE)
+      else()
+        math(EXPR LEVEL "${LEVEL} + 1")
+        set(LEVEL_${LEVEL}_ITEMS "")
+      endif()
+      continue()
+    endif()
+
+    if ("${LINE}" MATCHES "^}")
+      string(REGEX REPLACE "^} ?" "" DECLARATOR "${LINE}")
+      string(REGEX REPLACE " ?@SEMI@$" "" DECLARATOR "${DECLARATOR}")
+      math(EXPR PARENT "${LEVEL} - 1")
+      if (PARENT EQUAL 0)
+        # "} NAME, *PNAME;" or "};" of "struct _NAME"
+        string(REGEX MATCH "^${REFLECT_IDENTIFIER_REGEX}" NAME "${DECLARATOR}")
+        if ("${NAME}" STREQUAL "")
+          set(NAME "${LEVEL_1_TAG}")
+        endif()
+        if (NOT "${NAME}" STREQUAL "")
+          list(APPEND FILE_ITEMS "PHNT_REFLECT_BEGIN(${NAME})")
+          list(APPEND FILE_ITEMS ${LEVEL_1_ITEMS})
+          list(APPEND FILE_ITEMS "PHNT_REFLECT_END(${NAME})")
+          math(EXPR STRUCT_COUNT "${STRUCT_COUNT} + 1")
+        endif()
+      elseif ("${DECLARATOR}" STREQUAL "")
+        # Anonymous, the members belong to the enclosing structure
+        list(APPEND LEVEL_${PARENT}_ITEMS ${LEVEL_${LEVEL}_ITEMS})
+      elseif ("${DECLARATOR}" MATCHES "^DUMMY(STRUCT|UNION)NAME[0-9]*$")
+        # Anonymous where the SDK defines the name as empty, a member of that name otherwise
+        list(APPEND LEVEL_${PARENT}_ITEMS "#ifdef ${DECLARATOR}" ${LEVEL_${LEVEL}_ITEMS} "#else")
+        string(TOLOWER "${CMAKE_MATCH_1}" KIND)
+        list(APPEND LEVEL_${PARENT}_ITEMS "PHNT_REFLECT_FIELD(${DECLARATOR}, \"${KIND}\")")
+        list(APPEND LEVEL_${PARENT}_ITEMS "#endif")
+      else()
+        set(LEVEL_${PARENT}_ITEMS_SAVED ${LEVEL_${PARENT}_ITEMS})
+        reflect_member("struct ${DECLARATOR}" LEVEL_${PARENT}_ITEMS_SAVED)
+        set(LEVEL_${PARENT}_ITEMS ${LEVEL_${PARENT}_ITEMS_SAVED})
+      endif()
+      set(LEVEL ${PARENT})
+      continue()
+    endif()
+
+    # Members, possibly spread over several lines
+    string(APPEND PENDING " ${LINE}")
+    string(REGEX REPLACE "[^(]" "" OPEN "${PENDING}")
+    string(REGEX REPLACE "[^)]" "" CLOSE "${PENDING}")
+    string(LENGTH "${OPEN}" OPEN)
+    string(LENGTH "${CLOSE}" CLOSE)
+    if (OPEN EQUAL CLOSE AND "${PENDING}" MATCHES "@SEMI@$")
+      string(REGEX REPLACE " ?@SEMI@$" "" PENDING "${PENDING}")
+      reflect_member("${PENDING}" LEVEL_${LEVEL}_ITEMS)
+      set(PENDING "")
+    endif()
+  endforeach()
+
+  reflect_prune_directives(FILE_ITEMS)
+  if (NOT "${FILE_ITEMS}" STREQUAL "")
+    string(APPEND OUTPUT_TEXT "\n// ${HEADER_FILE}\n")
+    foreach(ITEM IN LISTS FILE_ITEMS)
+      if ("${ITEM}" MATCHES "^PHNT_REFLECT_(FIELD|BITFIELD|FLEXIBLE_FIELD)")
+        string(APPEND OUTPUT_TEXT "    ${ITEM}\n")
+      else()
+        string(APPEND OUTPUT_TEXT "${ITEM}\n")
+      endif()
+    endforeach()
+  endif()
+endforeach()
+
+string(REPLACE "@SEMI@" ";" OUTPUT_TEXT "${OUTPUT_TEXT}")
+string(REPLACE "@LB@" "[" OUTPUT_TEXT "${OUTPUT_TEXT}")
+string(REPLACE "@RB@" "]" OUTPUT_TEXT "${OUTPUT_TEXT}")
+message(STATUS "reflection: ${STRUCT_COUNT} structures")
+file(WRITE "${OUTPUT_HEADER_FILE}" "${OUTPUT_TEXT}")
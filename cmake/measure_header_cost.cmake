@@ -0,0 +1,133 @@
+# cmake process file to measure the parse cost of each header
+# Parameters
+#   COMPILER                   - The C++ compiler
+#   COMPILER_FRONTEND          - MSVC or GNU, the command line syntax of the compiler
+#   INCLUDE_DIRS               - The include directories
+#   DEFINITIONS                - The preprocessor definitions
+#   HEADER_FILES               - The headers to measure, each one in its own translation unit
+#   REPEAT                     - The number of compilations per header, the fastest one counts;
+#                                before CMake 3.23, the seconds to compile each header for, the
+#                                mean counts
+#   OUTPUT_FILE                - The path of the csv file to store the result
+# Usage:
+# cmake -DCOMPILER=g++ -DCOMPILER_FRONTEND=GNU -DINCLUDE_DIRS=.;layout \
+# -DDEFINITIONS=PHNT_MODE=PHNT_MODE_LAYOUT -DHEADER_FILES=ntpebteb.h;ntwmi.h \
+# -DREPEAT=3 -DOUTPUT_FILE=header-cost.csv -P measure_header_cost.cmake
+#
+# Every translation unit includes phnt_ntdef.h and then the header, so the first row,
+# phnt_ntdef.h alone, is the baseline. The preprocessed line count is exact and suits
+# tracking in CI, the time depends on the machine. string(TIMESTAMP) has microseconds
+# (%f) from CMake 3.23 on; older versions only have whole seconds, so they compile each
+# header over whole seconds and divide by the number of compilations.
+
+cmake_minimum_required(VERSION 3.17)
+
+if (NOT DEFINED REPEAT)
+  set(REPEAT 3)
+endif()
+
+set(ARGS "")
+if ("${COMPILER_FRONTEND}" STREQUAL "MSVC")
+  list(APPEND ARGS /nologo /TP)
+  foreach(DIR IN LISTS INCLUDE_DIRS)
+    list(APPEND ARGS "/I${DIR}")
+  endforeach()
+  foreach(DEFINITION IN LISTS DEFINITIONS)
+    list(APPEND ARGS "/D${DEFINITION}")
+  endforeach()
+  set(SYNTAX_ARGS /Zs)
+  set(PREPROCESS_ARGS /EP)
+else()
+  list(APPEND ARGS -x c++)
+  foreach(DIR IN LISTS INCLUDE_DIRS)
+    list(APPEND ARGS "-I${DIR}")
+  endforeach()
+  foreach(DEFINITION IN LISTS DEFINITIONS)
+    list(APPEND ARGS "-D${DEFINITION}")
+  endforeach()
+  set(SYNTAX_ARGS -fsyntax-only)
+  set(PREPROCESS_ARGS -E -P)
+endif()
+
+get_filename_component(WORK_DIR "${OUTPUT_FILE}" DIRECTORY)
+set(SOURCE_FILE "${WORK_DIR}/header-cost.cpp")
+
+macro(check_syntax)
+  execute_process(
+    COMMAND "${COMPILER}" ${ARGS} ${SYNTAX_ARGS} "${SOURCE_FILE}"
+    OUTPUT_QUIET
+    ERROR_VARIABLE ERRORS
+    RESULT_VARIABLE EXIT_CODE
+  )
+  if (NOT EXIT_CODE EQUAL 0)
+    message(WARNING "${HEADER_FILE} does not compile on its own:\n${ERRORS}")
+    set(BEST "error")
+  endif()
+endmacro()
+
+set(RESULT "header,preprocessed_lines,milliseconds\n")
+set(REPORT "")
+list(PREPEND HEADER_FILES phnt_ntdef.h)
+list(REMOVE_DUPLICATES HEADER_FILES)
+foreach(HEADER_FILE IN LISTS HEADER_FILES)
+  file(WRITE "${SOURCE_FILE}" "#include <phnt_ntdef.h>\n#include <${HEADER_FILE}>\n")
+
+  execute_process(
+    COMMAND "${COMPILER}" ${ARGS} ${PREPROCESS_ARGS} "${SOURCE_FILE}"
+    OUTPUT_VARIABLE PREPROCESSED
+    ERROR_VARIABLE ERRORS
+    RESULT_VARIABLE EXIT_CODE
+  )
+  if (NOT EXIT_CODE EQUAL 0)
+    message(WARNING "${HEADER_FILE} does not preprocess on its own:\n${ERRORS}")
+    string(APPEND RESULT "${HEADER_FILE},error,error\n")
+    continue()
+  endif()
+  string(REGEX REPLACE "\n[ \t\r]*\n" "\n" PREPROCESSED "${PREPROCESSED}")
+  string(REGEX REPLACE "[^\n]" "" PREPROCESSED "${PREPROCESSED}")
+  string(LENGTH "${PREPROCESSED}" LINES)
+
+  set(BEST "")
+  if (CMAKE_VERSION VERSION_LESS 3.23)
+    # Start on a second boundary and compile until REPEAT more seconds have passed
+    string(TIMESTAMP START "%s")
+    string(TIMESTAMP NOW "%s")
+    while (NOW EQUAL START)
+      string(TIMESTAMP NOW "%s")
+    endwhile()
+    set(START ${NOW})
+    math(EXPR STOP "${START} + ${REPEAT}")
+    set(RUNS 0)
+    while (NOW LESS STOP)
+      check_syntax()
+      if ("${BEST}" STREQUAL "error")
+        break()
+      endif()
+      math(EXPR RUNS "${RUNS} + 1")
+      string(TIMESTAMP NOW "%s")
+    endwhile()
+    if (NOT "${BEST}" STREQUAL "error")
+      math(EXPR BEST "(${NOW} - ${START}) * 1000 / ${RUNS}")
+    endif()
+  else()
+    foreach(RUN RANGE 1 ${REPEAT})
+      string(TIMESTAMP START "%s%f")
+      check_syntax()
+      string(TIMESTAMP END "%s%f")
+      if ("${BEST}" STREQUAL "error")
+        break()
+      endif()
+      math(EXPR ELAPSED "(${END} - ${START}) / 1000")
+      if ("${BEST}" STREQUAL "" OR ELAPSED LESS BEST)
+        set(BEST ${ELAPSED})
+      endif()
+    endforeach()
+  endif()
+
+  string(APPEND RESULT "${HEADER_FILE},${LINES},${BEST}\n")
+  string(APPEND REPORT "  ${HEADER_FILE}: ${LINES} lines, ${BEST} ms\n")
+endforeach()
+file(REMOVE "${SOURCE_FILE}")
+
+file(WRITE "${OUTPUT_FILE}" "${RESULT}")
+message(STATUS "Header parse cost, written to ${OUTPUT_FILE}\n${REPORT}")
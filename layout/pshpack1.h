@@ -0,0 +1,7 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+// Layout mode replacement for the Windows SDK pshpack1.h, no include guard on purpose.
+#pragma pack(push, 1)
@@ -15,6 +15,7 @@
 
 // Thread execution
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -42,6 +43,7 @@ NtSetSystemEnvironmentValue(
     _In_ PUNICODE_STRING VariableName,
     _In_ PUNICODE_STRING VariableValue
     );
+#endif
 
 #define EFI_VARIABLE_NON_VOLATILE 0x00000001
 #define EFI_VARIABLE_BOOTSERVICE_ACCESS 0x00000002
@@ -52,6 +54,7 @@ NtSetSystemEnvironmentValue(
 #define EFI_VARIABLE_APPEND_WRITE 0x00000040
 #define EFI_VARIABLE_ENHANCED_AUTHENTICATED_ACCESS 0x00000080
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -73,6 +76,7 @@ NtSetSystemEnvironmentValueEx(
     _In_ ULONG ValueLength, // 0 = delete variable
     _In_ ULONG Attributes // EFI_VARIABLE_*
     );
+#endif
 
 typedef enum _SYSTEM_ENVIRONMENT_INFORMATION_CLASS
 {
@@ -99,6 +103,7 @@ typedef struct _VARIABLE_NAME_AND_VALUE
     //BYTE Value[ANYSIZE_ARRAY];
 } VARIABLE_NAME_AND_VALUE, *PVARIABLE_NAME_AND_VALUE;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -107,6 +112,7 @@ NtEnumerateSystemEnvironmentValuesEx(
     _Out_ PVOID Buffer,
     _Inout_ PULONG BufferLength
     );
+#endif
 
 // EFI
 
@@ -169,6 +175,7 @@ typedef struct _EFI_DRIVER_ENTRY_LIST
 
 #if (PHNT_VERSION >= PHNT_WINXP)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -286,6 +293,7 @@ NtSetDriverEntryOrder(
     _In_reads_(Count) PULONG Ids,
     _In_ ULONG Count
     );
+#endif
 
 #endif
 
@@ -299,6 +307,7 @@ typedef enum _FILTER_BOOT_OPTION_OPERATION
 
 #if (PHNT_VERSION >= PHNT_WIN8)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -309,6 +318,7 @@ NtFilterBootOption(
     _In_reads_bytes_opt_(DataSize) PVOID Data,
     _In_ ULONG DataSize
     );
+#endif
 
 #endif
 
@@ -337,6 +347,7 @@ typedef struct _EVENT_BASIC_INFORMATION
     LONG EventState;
 } EVENT_BASIC_INFORMATION, *PEVENT_BASIC_INFORMATION;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -405,11 +416,13 @@ NtQueryEvent(
     _In_ ULONG EventInformationLength,
     _Out_opt_ PULONG ReturnLength
     );
+#endif
 
 // Event Pair
 
 #define EVENT_PAIR_ALL_ACCESS (STANDARD_RIGHTS_REQUIRED | SYNCHRONIZE)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -469,6 +482,7 @@ NTAPI
 NtSetHighWaitLowEventPair(
     _In_ HANDLE EventPairHandle
     );
+#endif
 
 // Mutant
 
@@ -498,6 +512,7 @@ typedef struct _MUTANT_OWNER_INFORMATION
     CLIENT_ID ClientId;
 } MUTANT_OWNER_INFORMATION, *PMUTANT_OWNER_INFORMATION;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -535,6 +550,7 @@ NtQueryMutant(
     _In_ ULONG MutantInformationLength,
     _Out_opt_ PULONG ReturnLength
     );
+#endif
 
 // Semaphore
 
@@ -561,6 +577,7 @@ typedef struct _SEMAPHORE_BASIC_INFORMATION
     LONG MaximumCount;
 } SEMAPHORE_BASIC_INFORMATION, *PSEMAPHORE_BASIC_INFORMATION;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -600,6 +617,7 @@ NtQuerySemaphore(
     _In_ ULONG SemaphoreInformationLength,
     _Out_opt_ PULONG ReturnLength
     );
+#endif
 
 // Timer
 
@@ -653,6 +671,7 @@ typedef struct _TIMER_SET_COALESCABLE_TIMER_INFO
 } TIMER_SET_COALESCABLE_TIMER_INFO, *PTIMER_SET_COALESCABLE_TIMER_INFO;
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -684,8 +703,10 @@ NtSetTimer(
     _In_opt_ LONG Period,
     _Out_opt_ PBOOLEAN PreviousState
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN7)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -696,7 +717,9 @@ NtSetTimerEx(
     _In_ ULONG TimerSetInformationLength
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -715,9 +738,11 @@ NtQueryTimer(
     _In_ ULONG TimerInformationLength,
     _Out_opt_ PULONG ReturnLength
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN8)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -733,11 +758,13 @@ NtSetIRTimer(
     _In_ HANDLE TimerHandle,
     _In_opt_ PLARGE_INTEGER DueTime
     );
+#endif
 
 #endif
 
 #if (PHNT_VERSION >= PHNT_THRESHOLD)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -748,6 +775,7 @@ NtCreateTimer2(
     _In_ ULONG Attributes, // TIMER_TYPE
     _In_ ACCESS_MASK DesiredAccess
     );
+#endif
 
 #endif
 
@@ -762,6 +790,7 @@ typedef PVOID PT2_CANCEL_PARAMETERS;
 
 #if (PHNT_VERSION >= PHNT_THRESHOLD)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -779,6 +808,7 @@ NtCancelTimer2(
     _In_ HANDLE TimerHandle,
     _In_ PT2_CANCEL_PARAMETERS Parameters
     );
+#endif
 
 #endif
 
@@ -787,6 +817,7 @@ NtCancelTimer2(
 #define PROFILE_CONTROL 0x0001
 #define PROFILE_ALL_ACCESS (STANDARD_RIGHTS_REQUIRED | PROFILE_CONTROL)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -801,8 +832,10 @@ NtCreateProfile(
     _In_ KPROFILE_SOURCE ProfileSource,
     _In_ KAFFINITY Affinity
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN7)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -819,7 +852,9 @@ NtCreateProfileEx(
     _In_reads_(GroupCount) PGROUP_AFFINITY GroupAffinity
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -849,6 +884,7 @@ NtSetIntervalProfile(
     _In_ ULONG Interval,
     _In_ KPROFILE_SOURCE Source
     );
+#endif
 
 // Keyed Event
 
@@ -857,6 +893,7 @@ NtSetIntervalProfile(
 #define KEYEDEVENT_ALL_ACCESS \
     (STANDARD_RIGHTS_REQUIRED | KEYEDEVENT_WAIT | KEYEDEVENT_WAKE)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -895,10 +932,12 @@ NtWaitForKeyedEvent(
     _In_ BOOLEAN Alertable,
     _In_opt_ PLARGE_INTEGER Timeout
     );
+#endif
 
 // UMS
 
 #if (PHNT_VERSION >= PHNT_WIN7)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -906,6 +945,7 @@ NtUmsThreadYield(
     _In_ PVOID SchedulerParam
     );
 #endif
+#endif
 
 // WNF
 
@@ -968,6 +1008,7 @@ typedef struct _WNF_DELIVERY_DESCRIPTOR
 
 #if (PHNT_VERSION >= PHNT_WIN8)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1048,11 +1089,13 @@ NTAPI
 NtUnsubscribeWnfStateChange(
     _In_ PCWNF_STATE_NAME StateName
     );
+#endif
 
 #endif
 
 #if (PHNT_VERSION >= PHNT_THRESHOLD)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1071,6 +1114,7 @@ NTAPI
 NtSetWnfProcessNotificationEvent(
     _In_ HANDLE NotificationEvent
     );
+#endif
 
 #endif
 
@@ -1152,6 +1196,7 @@ typedef struct _WORKER_FACTORY_BASIC_INFORMATION
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1210,6 +1255,7 @@ NTAPI
 NtWorkerFactoryWorkerReady(
     _In_ HANDLE WorkerFactoryHandle
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN8)
 
@@ -1224,6 +1270,7 @@ typedef struct _WORKER_FACTORY_DEFERRED_WORK
     ULONG Flags;
 } WORKER_FACTORY_DEFERRED_WORK, *PWORKER_FACTORY_DEFERRED_WORK;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1234,9 +1281,11 @@ NtWaitForWorkViaWorkerFactory(
     _Out_ PULONG PacketsReturned,
     _In_ PWORKER_FACTORY_DEFERRED_WORK DeferredWork
     );
+#endif
 
 #else
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1244,6 +1293,7 @@ NtWaitForWorkViaWorkerFactory(
     _In_ HANDLE WorkerFactoryHandle,
     _Out_ PFILE_IO_COMPLETION_INFORMATION MiniPacket
     );
+#endif
 
 #endif
 
@@ -1251,6 +1301,7 @@ NtWaitForWorkViaWorkerFactory(
 
 // Time
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1293,9 +1344,11 @@ NtQueryPerformanceCounter(
     _Out_ PLARGE_INTEGER PerformanceCounter,
     _Out_opt_ PLARGE_INTEGER PerformanceFrequency
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_REDSTONE2)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1314,9 +1367,11 @@ NtConvertBetweenAuxiliaryCounterAndPerformanceCounter(
     _Out_opt_ PLARGE_INTEGER ConversionError
     );
 #endif
+#endif
 
 // LUIDs
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -1342,6 +1397,7 @@ NtAllocateUuids(
     _Out_ PULONG Sequence,
     _Out_ PCHAR Seed
     );
+#endif
 
 // System Information
 
@@ -3925,13 +3981,6 @@ typedef struct _SYSTEM_ISOLATED_USER_MODE_INFORMATION
     ULONGLONG Spare1;
 } SYSTEM_ISOLATED_USER_MODE_INFORMATION, *PSYSTEM_ISOLATED_USER_MODE_INFORMATION;
 
-// private
-typedef struct _SYSTEM_SINGLE_MODULE_INFORMATION
-{
-    PVOID TargetModuleAddress;
-    RTL_PROCESS_MODULE_INFORMATION_EX ExInfo;
-} SYSTEM_SINGLE_MODULE_INFORMATION, *PSYSTEM_SINGLE_MODULE_INFORMATION;
-
 // private
 typedef struct _SYSTEM_INTERRUPT_CPU_SET_INFORMATION
 {
@@ -4534,6 +4583,7 @@ typedef struct _SYSTEM_OSL_RAMDISK_INFORMATION
 
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -4543,8 +4593,10 @@ NtQuerySystemInformation(
     _In_ ULONG SystemInformationLength,
     _Out_opt_ PULONG ReturnLength
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN7)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -4557,7 +4609,9 @@ NtQuerySystemInformationEx(
     _Out_opt_ PULONG ReturnLength
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -4566,6 +4620,7 @@ NtSetSystemInformation(
     _In_reads_bytes_opt_(SystemInformationLength) PVOID SystemInformation,
     _In_ ULONG SystemInformationLength
     );
+#endif
 
 // SysDbg APIs
 
@@ -4752,6 +4807,7 @@ typedef struct _SYSDBG_KD_PULL_REMOTE_FILE
     UNICODE_STRING ImageFileName;
 } SYSDBG_KD_PULL_REMOTE_FILE, *PSYSDBG_KD_PULL_REMOTE_FILE;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -4763,6 +4819,7 @@ NtSystemDebugControl(
     _In_ ULONG OutputBufferLength,
     _Out_opt_ PULONG ReturnLength
     );
+#endif
 
 // Hard errors
 
@@ -4796,6 +4853,7 @@ typedef enum _HARDERROR_RESPONSE
 
 #define HARDERROR_OVERRIDE_ERRORMODE 0x10000000
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -4807,6 +4865,7 @@ NtRaiseHardError(
     _In_ ULONG ValidResponseOptions,
     _Out_ PULONG Response
     );
+#endif
 
 //
 // Kernel-user shared data
@@ -5555,6 +5614,7 @@ C_ASSERT(sizeof(KUSER_SHARED_DATA) == 0xa80);
 
 #define USER_SHARED_DATA ((KUSER_SHARED_DATA * const)0x7ffe0000)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 FORCEINLINE
 ULONGLONG
 NtGetTickCount64(
@@ -5616,9 +5676,11 @@ NtGetTickCount(
 
 #endif
 }
+#endif
 
 // Locale
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5641,9 +5703,11 @@ NTAPI
 NtQueryInstallUILanguage(
     _Out_ LANGID *InstallUILanguageId
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 // private
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5652,7 +5716,9 @@ NtFlushInstallUILanguage(
     _In_ ULONG SetComittedFlag
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5666,9 +5732,11 @@ NTAPI
 NtSetDefaultUILanguage(
     _In_ LANGID DefaultUILanguageId
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 // private
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5676,6 +5744,7 @@ NtIsUILanguageComitted(
     VOID
     );
 #endif
+#endif
 
 // NLS
 
@@ -5683,6 +5752,7 @@ NtIsUILanguageComitted(
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5703,9 +5773,11 @@ NtGetNlsSectionPtr(
     _Out_ PVOID *SectionPointer,
     _Out_ PULONG SectionSize
     );
+#endif
 
 #if (PHNT_VERSION < PHNT_WIN7) || defined(PHNT_ENABLE_ALL)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5721,9 +5793,11 @@ NTAPI
 NtReleaseCMFViewOwnership(
     VOID
     );
+#endif
 
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5744,6 +5818,7 @@ NtGetMUIRegistryInfo(
     _Inout_ PULONG DataSize,
     _Out_ PVOID Data
     );
+#endif
 
 #endif
 
@@ -5751,6 +5826,7 @@ NtGetMUIRegistryInfo(
 
 // Global atoms
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5759,12 +5835,14 @@ NtAddAtom(
     _In_ ULONG Length,
     _Out_opt_ PRTL_ATOM Atom
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN8)
 
 #define ATOM_FLAG_GLOBAL 0x2
 
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5774,9 +5852,11 @@ NtAddAtomEx(
     _Out_opt_ PRTL_ATOM Atom,
     _In_ ULONG Flags
     );
+#endif
 
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5792,6 +5872,7 @@ NTAPI
 NtDeleteAtom(
     _In_ RTL_ATOM Atom
     );
+#endif
 
 typedef enum _ATOM_INFORMATION_CLASS
 {
@@ -5813,6 +5894,7 @@ typedef struct _ATOM_TABLE_INFORMATION
     _Field_size_(NumberOfAtoms) RTL_ATOM Atoms[1];
 } ATOM_TABLE_INFORMATION, *PATOM_TABLE_INFORMATION;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5823,6 +5905,7 @@ NtQueryInformationAtom(
     _In_ ULONG AtomInformationLength,
     _Out_opt_ PULONG ReturnLength
     );
+#endif
 
 // Global flags
 
@@ -5906,6 +5989,7 @@ NtQueryInformationAtom(
 
 // Licensing
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5925,6 +6009,7 @@ NTAPI
 NtSetDefaultHardErrorPort(
     _In_ HANDLE DefaultHardErrorPort
     );
+#endif
 
 typedef enum _SHUTDOWN_ACTION
 {
@@ -5934,6 +6019,7 @@ typedef enum _SHUTDOWN_ACTION
     ShutdownRebootForRecovery // since WIN11
 } SHUTDOWN_ACTION;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5947,11 +6033,13 @@ NTAPI
 NtDisplayString(
     _In_ PUNICODE_STRING String
     );
+#endif
 
 // Boot graphics
 
 #if (PHNT_VERSION >= PHNT_WIN7)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5959,6 +6047,7 @@ NtDrawText(
     _In_ PUNICODE_STRING Text
     );
 #endif
+#endif
 
 #endif // (PHNT_MODE != PHNT_MODE_KERNEL)
 
@@ -7,6 +7,8 @@
 #ifndef _NTIMAGE_H
 #define _NTIMAGE_H
 
+#include "phnt_ntdef.h"
+
 #include <pshpack4.h>
 
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
@@ -127,6 +127,7 @@ typedef enum _KPROFILE_SOURCE
 
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -135,8 +136,10 @@ NtCallbackReturn(
     _In_ ULONG OutputLength,
     _In_ NTSTATUS Status
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_VISTA)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -144,7 +147,9 @@ NtFlushProcessWriteBuffers(
     VOID
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -168,6 +173,7 @@ NTAPI
 NtYieldExecution(
     VOID
     );
+#endif
 
 #endif
 
@@ -9,7 +9,9 @@
 
 #include "phnt_ntdef.h"
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 #include <libloaderapi.h>
+#endif
 
 // DLLs
 
@@ -281,6 +283,7 @@ typedef struct _LDR_DATA_TABLE_ENTRY
 
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -307,10 +310,12 @@ LdrGetDllHandle(
     _In_ PUNICODE_STRING DllName,
     _Out_ PVOID *DllHandle
     );
+#endif
 
 #define LDR_GET_DLL_HANDLE_EX_UNCHANGED_REFCOUNT 0x00000001
 #define LDR_GET_DLL_HANDLE_EX_PIN 0x00000002
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -321,9 +326,11 @@ LdrGetDllHandleEx(
     _In_ PUNICODE_STRING DllName,
     _Out_ PVOID *DllHandle
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN7)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -332,9 +339,11 @@ LdrGetDllHandleByMapping(
     _Out_ PVOID *DllHandle
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN7)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -344,9 +353,11 @@ LdrGetDllHandleByName(
     _Out_ PVOID *DllHandle
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN8)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -382,9 +393,11 @@ LdrSetDllDirectory(
     _In_ PUNICODE_STRING DllDirectory
     );
 #endif
+#endif
 
 #define LDR_ADDREF_DLL_PIN 0x00000001
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -402,12 +415,14 @@ LdrGetProcedureAddress(
     _In_opt_ ULONG ProcedureNumber,
     _Out_ PVOID *ProcedureAddress
     );
+#endif
 
 // rev
 #define LDR_GET_PROCEDURE_ADDRESS_DONT_RECORD_FORWARDER 0x00000001
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 // private
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -419,7 +434,9 @@ LdrGetProcedureAddressEx(
     _In_ ULONG Flags
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -428,9 +445,11 @@ LdrGetKnownDllSectionHandle(
     _In_ BOOLEAN KnownDlls32,
     _Out_ PHANDLE Section
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_THRESHOLD)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -443,6 +462,7 @@ LdrGetProcedureAddressForCaller(
     _In_ PVOID *Callback
     );
 #endif
+#endif
 
 #define LDR_LOCK_LOADER_LOCK_FLAG_RAISE_ON_ERRORS 0x00000001
 #define LDR_LOCK_LOADER_LOCK_FLAG_TRY_ONLY 0x00000002
@@ -451,6 +471,7 @@ LdrGetProcedureAddressForCaller(
 #define LDR_LOCK_LOADER_LOCK_DISPOSITION_LOCK_ACQUIRED 1
 #define LDR_LOCK_LOADER_LOCK_DISPOSITION_LOCK_NOT_ACQUIRED 2
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -459,9 +480,11 @@ LdrLockLoaderLock(
     _Out_opt_ ULONG *Disposition,
     _Out_opt_ PVOID *Cookie
     );
+#endif
 
 #define LDR_UNLOCK_LOADER_LOCK_FLAG_RAISE_ON_ERRORS 0x00000001
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -502,8 +525,10 @@ LdrProcessRelocationBlock(
     _In_ PUSHORT NextOffset,
     _In_ LONG_PTR Diff
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN8)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 PIMAGE_BASE_RELOCATION
 NTAPI
@@ -515,7 +540,9 @@ LdrProcessRelocationBlockEx(
     _In_ LONG_PTR Diff
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 BOOLEAN
 NTAPI
@@ -524,12 +551,14 @@ LdrVerifyMappedImageMatchesChecksum(
     _In_ SIZE_T NumberOfBytes,
     _In_ ULONG FileLength
     );
+#endif
 
 typedef VOID (NTAPI *PLDR_IMPORT_MODULE_CALLBACK)(
     _In_ PVOID Parameter,
     _In_ PSTR ModuleName
     );
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -539,6 +568,7 @@ LdrVerifyImageMatchesChecksum(
     _In_ PVOID ImportCallbackParameter,
     _Out_opt_ PUSHORT ImageCharacteristics
     );
+#endif
 
 // private
 typedef struct _LDR_IMPORT_CALLBACK_INFO
@@ -569,6 +599,7 @@ typedef struct _LDR_VERIFY_IMAGE_INFO
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 // private
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -577,9 +608,11 @@ LdrVerifyImageMatchesChecksumEx(
     _Inout_ PLDR_VERIFY_IMAGE_INFO VerifyInfo
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 // private
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -589,6 +622,7 @@ LdrQueryModuleServiceTags(
     _Inout_ PULONG BufferSize
     );
 #endif
+#endif
 
 // begin_msdn:"DLL Load Notification"
 
@@ -627,6 +661,7 @@ typedef VOID (NTAPI *PLDR_DLL_NOTIFICATION_FUNCTION)(
 
 #if (PHNT_VERSION >= PHNT_VISTA)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -643,18 +678,21 @@ NTAPI
 LdrUnregisterDllNotification(
     _In_ PVOID Cookie
     );
+#endif
 
 #endif
 
 // end_msdn
 
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 PUNICODE_STRING
 NTAPI
 LdrStandardizeSystemPath(
     _In_ PUNICODE_STRING SystemPath
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WINBLUE)
 typedef struct _LDR_FAILURE_DATA
@@ -664,6 +702,7 @@ typedef struct _LDR_FAILURE_DATA
     WCHAR AdditionalInfo[0x20];
 } LDR_FAILURE_DATA, *PLDR_FAILURE_DATA;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 PLDR_FAILURE_DATA
 NTAPI
@@ -671,6 +710,7 @@ LdrGetFailureData(
     VOID
     );
 #endif
+#endif
 
 // private
 typedef struct _PS_MITIGATION_OPTIONS_MAP
@@ -720,7 +760,7 @@ typedef struct _PS_SYSTEM_DLL_INIT_BLOCK
 } PS_SYSTEM_DLL_INIT_BLOCK, *PPS_SYSTEM_DLL_INIT_BLOCK;
 
 // rev
-#if (PHNT_VERSION >= PHNT_THRESHOLD)
+#if (PHNT_VERSION >= PHNT_THRESHOLD) && (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI PS_SYSTEM_DLL_INIT_BLOCK LdrSystemDllInitBlock;
 #endif
 
@@ -731,6 +771,7 @@ NTSYSAPI PS_SYSTEM_DLL_INIT_BLOCK LdrSystemDllInitBlock;
 typedef struct _ACTIVATION_CONTEXT *PACTIVATION_CONTEXT;
 
 // private
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -761,9 +802,11 @@ LdrGetFileNameFromLoadAsDataTable(
     _In_ PVOID Module,
     _Out_ PVOID *pFileNamePrt
     );
+#endif
 
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -782,6 +825,7 @@ LdrAccessResource(
     _Out_opt_ PVOID *ResourceBuffer,
     _Out_opt_ ULONG *ResourceLength
     );
+#endif
 
 typedef struct _LDR_RESOURCE_INFO
 {
@@ -795,6 +839,7 @@ typedef struct _LDR_RESOURCE_INFO
 #define RESOURCE_LANGUAGE_LEVEL 2
 #define RESOURCE_DATA_LEVEL 3
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -825,6 +870,7 @@ LdrFindResourceDirectory_U(
     _In_ ULONG Level,
     _Out_ PIMAGE_RESOURCE_DIRECTORY *ResourceDirectory
     );
+#endif
 
 // private
 typedef struct _LDR_ENUM_RESOURCE_ENTRY
@@ -847,6 +893,7 @@ typedef struct _LDR_ENUM_RESOURCE_ENTRY
 #define NAME_FROM_RESOURCE_ENTRY(RootDirectory, Entry) \
     ((Entry)->NameIsString ? (ULONG_PTR)((ULONG_PTR)(RootDirectory) + (ULONG_PTR)((Entry)->NameOffset)) : (Entry)->Id)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -905,6 +952,7 @@ LdrUnloadAlternateResourceModuleEx(
     _In_ PVOID DllHandle,
     _In_ ULONG Flags
     );
+#endif
 
 #endif // (PHNT_MODE != PHNT_MODE_KERNEL)
 
@@ -956,8 +1004,16 @@ typedef struct _RTL_PROCESS_MODULE_INFORMATION_EX
     PVOID DefaultBase;
 } RTL_PROCESS_MODULE_INFORMATION_EX, *PRTL_PROCESS_MODULE_INFORMATION_EX;
 
+// private, SystemSingleModuleInformation of ntexapi.h
+typedef struct _SYSTEM_SINGLE_MODULE_INFORMATION
+{
+    PVOID TargetModuleAddress;
+    RTL_PROCESS_MODULE_INFORMATION_EX ExInfo;
+} SYSTEM_SINGLE_MODULE_INFORMATION, *PSYSTEM_SINGLE_MODULE_INFORMATION;
+
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -966,6 +1022,7 @@ LdrQueryProcessModuleInformation(
     _In_opt_ ULONG Size,
     _Out_ PULONG ReturnedSize
     );
+#endif
 
 typedef VOID (NTAPI *PLDR_ENUM_CALLBACK)(
     _In_ PLDR_DATA_TABLE_ENTRY ModuleInformation,
@@ -973,6 +1030,7 @@ typedef VOID (NTAPI *PLDR_ENUM_CALLBACK)(
     _Out_ BOOLEAN *Stop
     );
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -1027,6 +1085,7 @@ LdrQueryImageFileExecutionOptionsEx(
     _Out_opt_ PULONG ReturnedLength,
     _In_ BOOLEAN Wow64
     );
+#endif
 
 // private
 typedef struct _DELAYLOAD_PROC_DESCRIPTOR
@@ -1066,6 +1125,7 @@ typedef PVOID (NTAPI *PDELAYLOAD_FAILURE_SYSTEM_ROUTINE)(
 
 #if (PHNT_VERSION >= PHNT_THRESHOLD)
 // rev from QueryOptionalDelayLoadedAPI
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -1076,9 +1136,11 @@ LdrQueryOptionalDelayLoadedAPI(
     _Reserved_ ULONG Flags
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_WIN8)
 // rev from ResolveDelayLoadedAPI
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 PVOID
 NTAPI
@@ -1126,8 +1188,10 @@ LdrRemoveDllDirectory(
     _In_ DLL_DIRECTORY_COOKIE Cookie
     );
 #endif
+#endif
 
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 DECLSPEC_NORETURN
 NTSYSAPI
 VOID
@@ -1135,8 +1199,10 @@ NTAPI
 LdrShutdownProcess(
     VOID
     );
+#endif
 
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 DECLSPEC_NORETURN
 NTSYSAPI
 VOID
@@ -1144,9 +1210,11 @@ NTAPI
 LdrShutdownThread(
     VOID
     );
+#endif
 
 #if (PHNT_VERSION >= PHNT_WINBLUE)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -1162,9 +1230,11 @@ LdrControlFlowGuardEnforced(
     VOID
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_19H1)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 BOOLEAN
 NTAPI
@@ -1172,9 +1242,11 @@ LdrIsModuleSxsRedirected(
     _In_ PVOID DllHandle
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_THRESHOLD)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -1182,6 +1254,7 @@ LdrUpdatePackageSearchPath(
     _In_ PWSTR SearchPath
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_THRESHOLD)
 
@@ -1208,6 +1281,7 @@ typedef struct _LDR_SOFTWARE_ENCLAVE
 } LDR_SOFTWARE_ENCLAVE, *PLDR_SOFTWARE_ENCLAVE;
 
 // rev from CreateEnclave
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 NTSTATUS
 NTAPI
@@ -1262,6 +1336,7 @@ LdrLoadEnclaveModule(
     _In_opt_ PWSTR DllPath,
     _In_ PUNICODE_STRING DllName
     );
+#endif
 
 #endif
 
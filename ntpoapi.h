@@ -7,6 +7,8 @@
 #ifndef _NTPOAPI_H
 #define _NTPOAPI_H
 
+#include "phnt_ntdef.h"
+
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
 // POWER_INFORMATION_LEVEL
 // Note: We don't use an enum for these values to minimize conflicts with the Windows SDK. (dmex)
@@ -729,6 +731,7 @@ typedef struct _POWER_INTERNAL_BOOTAPP_DIAGNOSTIC
 
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -739,9 +742,11 @@ NtPowerInformation(
     _Out_writes_bytes_opt_(OutputBufferLength) PVOID OutputBuffer,
     _In_ ULONG OutputBufferLength
     );
+#endif
 
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -749,8 +754,10 @@ NtSetThreadExecutionState(
     _In_ EXECUTION_STATE NewFlags, // ES_* flags
     _Out_ EXECUTION_STATE *PreviousFlags
     );
+#endif
 
 #if (PHNT_VERSION < PHNT_WIN7) || defined(PHNT_ENABLE_ALL)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -758,7 +765,9 @@ NtRequestWakeupLatency(
     _In_ LATENCY_TIME latency
     );
 #endif
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -792,5 +801,6 @@ NTAPI
 NtIsSystemResumeAutomatic(
     VOID
     );
+#endif
 
 #endif
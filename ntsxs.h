@@ -14,7 +14,7 @@
 
 #define ACTIVATION_CONTEXT_FLAG_NO_INHERIT 0x00000001
 
-#if (PHNT_MODE == PHNT_MODE_KERNEL)
+#if (PHNT_MODE == PHNT_MODE_KERNEL) || (PHNT_MODE == PHNT_MODE_LAYOUT)
 typedef enum _ACTCTX_REQUESTED_RUN_LEVEL
 {
     ACTCTX_RUN_LEVEL_UNSPECIFIED = 0,
@@ -8,8 +8,11 @@
 #define _NTWMI_H
 
 #include "phnt_ntdef.h"
+#include <ntpoapi.h>
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 #include <evntrace.h>
+#endif
 
 EXTERN_C_START
 
@@ -5591,6 +5594,7 @@ typedef struct _EVENT_DESCRIPTOR
 typedef const EVENT_DESCRIPTOR* PCEVENT_DESCRIPTOR;
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 ULONG
 NTAPI
@@ -5599,9 +5603,11 @@ EtwSetMark(
     _In_ PETW_SET_MARK_INFORMATION MarkInfo,
     _In_ ULONG Size
     );
+#endif
 
 typedef struct _EVENT_DATA_DESCRIPTOR EVENT_DATA_DESCRIPTOR, *PEVENT_DATA_DESCRIPTOR;
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 ULONG
 NTAPI
@@ -5631,7 +5637,9 @@ NTAPI
 EtwEventUnregister(
     _In_ REGHANDLE RegHandle
     );
+#endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 typedef enum _EVENT_INFO_CLASS EVENT_INFO_CLASS;
 
 NTSYSAPI
@@ -5817,6 +5825,7 @@ EtwQueryRealtimeConsumer(
     _Out_ PULONG BuffersLostCount
     );
 #endif
+#endif
 
 // public TRACE_PROVIDER_INSTANCE_INFO
 typedef struct _ETW_TRACE_PROVIDER_INSTANCE_INFO
@@ -5885,6 +5894,7 @@ typedef enum _ETWTRACECONTROLCODE
 } ETWTRACECONTROLCODE;
 
 #if (PHNT_VERSION >= PHNT_VISTA)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5897,8 +5907,10 @@ NtTraceControl(
     _Out_ PULONG ReturnLength
     );
 #endif
+#endif
 
 #if (PHNT_VERSION >= PHNT_WINXP)
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSCALLAPI
 NTSTATUS
 NTAPI
@@ -5909,6 +5921,7 @@ NtTraceEvent(
     _In_ PVOID Fields
     );
 #endif
+#endif
 
 // private
 typedef struct _TELEMETRY_COVERAGE_POINT
@@ -5921,6 +5934,7 @@ typedef struct _TELEMETRY_COVERAGE_POINT
 
 #if (PHNT_VERSION >= PHNT_REDSTONE3)
 // rev
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 NTSYSAPI
 BOOLEAN
 NTAPI
@@ -5928,6 +5942,7 @@ EtwCheckCoverage(
     _Inout_ PTELEMETRY_COVERAGE_POINT CoveragePoint
     );
 #endif
+#endif
 
 EXTERN_C_END
 
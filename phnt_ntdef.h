@@ -10,6 +10,7 @@
 // Mode
 #define PHNT_MODE_KERNEL 0
 #define PHNT_MODE_USER 1
+#define PHNT_MODE_LAYOUT 2 // structures only, no prototypes, no Windows SDK (win-polyfill-layout.h)
 
 // Version
 #define PHNT_WIN2K 50
@@ -51,7 +52,11 @@
 //#define PHNT_NO_INLINE_INIT_STRING
 
 #if (PHNT_MODE != PHNT_MODE_KERNEL)
+#if (PHNT_MODE == PHNT_MODE_LAYOUT)
+#include "win-polyfill-layout.h"
+#else
 #include "win-polyfill-arch.h"
+#endif
 
 #if defined(__clang__)
 _Pragma("clang diagnostic ignored \"-Wpragma-pack\"")
@@ -89,12 +94,14 @@ _Pragma("clang diagnostic ignored \"-Wmicrosoft-anon-tag\"")
 #endif
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 #ifndef UMDF_USING_NTSTATUS
 #define UMDF_USING_NTSTATUS
 #endif
 #include <ntstatus.h>
 
 #include <windef.h>
+#endif
 
 typedef double DOUBLE;
 typedef GUID *PGUID;
@@ -104,6 +111,7 @@ typedef GUID *PGUID;
 typedef const GUID* PCGUID;
 #endif
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 #undef RtlMoveMemory
 #undef RtlZeroMemory
 #undef RtlFillMemory
@@ -145,6 +153,7 @@ RtlFillMemory(
    SIZE_T Length,
    int Fill
 );
+#endif // (PHNT_MODE != PHNT_MODE_LAYOUT)
 
 #ifndef _NTDEF_
 #define _NTDEF_
@@ -0,0 +1,2217 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test.h"
+
+#include "win-polyfill-etl-ccswap.h"
+#include "win-polyfill-etl-cswitch.h"
+#include "win-polyfill-etl-diskio.h"
+#include "win-polyfill-etl-dispatch.h"
+#include "win-polyfill-etl-dpc.h"
+#include "win-polyfill-etl-fault.h"
+#include "win-polyfill-etl-fileio.h"
+#include "win-polyfill-etl-handle.h"
+#include "win-polyfill-etl-hash.h"
+#include "win-polyfill-etl-heap.h"
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-index.h"
+#include "win-polyfill-etl-merge.h"
+#include "win-polyfill-etl-network.h"
+#include "win-polyfill-etl-profile.h"
+#include "win-polyfill-etl-registry.h"
+#include "win-polyfill-etl-stack.h"
+#include "win-polyfill-etl-syscall.h"
+#include "win-polyfill-etl-threadpool.h"
+#include "win-polyfill-etl-waitchain.h"
+
+#include <string.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Builds a trace in memory, buffer by buffer, the way the kernel logger lays it out.
+class trace_writer
+{
+  public:
+    explicit trace_writer(ULONG BufferSize = 0x400) : BufferSize(BufferSize) {}
+
+    void begin_buffer(USHORT processor, USHORT flags = ETW_BUFFER_FLAG_PROC_INDEX)
+    {
+        Start = Data.size();
+        Data.resize(Start + BufferSize, 0xFF);
+        WMI_BUFFER_HEADER header = {};
+        header.BufferSize = BufferSize;
+        header.BufferFlag = flags;
+        header.BufferType = ETW_BUFFER_TYPE_GENERIC;
+        header.ClientContext.ProcessorIndex = processor;
+        memcpy(&Data[Start], &header, sizeof(header));
+        Offset = sizeof(WMI_BUFFER_HEADER);
+    }
+
+    void end_buffer(LONGLONG flush_time = 0)
+    {
+        WMI_BUFFER_HEADER header;
+        memcpy(&header, &Data[Start], sizeof(header));
+        header.Offset = Offset;
+        header.SavedOffset = Offset;
+        header.TimeStamp.QuadPart = flush_time;
+        header.SequenceNumber = Sequence++;
+        memcpy(&Data[Start], &header, sizeof(header));
+    }
+
+    void system_event(
+        USHORT hook_id,
+        ULONG thread_id,
+        ULONG process_id,
+        LONGLONG time_stamp,
+        const void *payload = nullptr,
+        ULONG payload_size = 0)
+    {
+        SYSTEM_TRACE_HEADER header = {};
+        header.Marker = SYSTEM_TRACE_MARKER64 | 2;
+        header.Packet.Size = (USHORT)(sizeof(header) + payload_size);
+        header.Packet.HookId = hook_id;
+        header.ThreadId = thread_id;
+        header.ProcessId = process_id;
+        header.SystemTime.QuadPart = time_stamp;
+        append(&header, sizeof(header), payload, payload_size);
+    }
+
+    void perfinfo_event(
+        USHORT hook_id,
+        LONGLONG time_stamp,
+        const void *payload = nullptr,
+        ULONG payload_size = 0)
+    {
+        PERFINFO_TRACE_HEADER header = {};
+        header.Marker = PERFINFO_TRACE_MARKER64;
+        header.Packet.Size =
+            (USHORT)(FIELD_OFFSET(PERFINFO_TRACE_HEADER, Data) + payload_size);
+        header.Packet.HookId = hook_id;
+        header.TS = time_stamp;
+        append(&header, FIELD_OFFSET(PERFINFO_TRACE_HEADER, Data), payload, payload_size);
+    }
+
+    // PERFINFO_LOG_TYPE_STACKWALK of the event at time_stamp, 64-bit frames innermost first
+    void stack_walk(
+        ULONG thread_id,
+        ULONG process_id,
+        LONGLONG time_stamp,
+        const std::vector<uint64_t> &frames)
+    {
+        std::vector<UCHAR> data(
+            FIELD_OFFSET(STACK_WALK_EVENT_DATA, Addresses) + frames.size() * 8);
+        memcpy(&data[0], &time_stamp, sizeof(time_stamp));
+        memcpy(&data[8], &process_id, sizeof(process_id));
+        memcpy(&data[12], &thread_id, sizeof(thread_id));
+        memcpy(&data[16], frames.data(), frames.size() * 8);
+        system_event(
+            PERFINFO_LOG_TYPE_STACKWALK,
+            thread_id,
+            process_id,
+            time_stamp,
+            data.data(),
+            (ULONG)data.size());
+    }
+
+    void event_header_event(
+        ULONG thread_id,
+        ULONG process_id,
+        LONGLONG time_stamp,
+        const void *payload = nullptr,
+        ULONG payload_size = 0)
+    {
+        UCHAR header[phnt::etl_event_header_size] = {};
+        USHORT size = (USHORT)(sizeof(header) + payload_size);
+        USHORT type = EVENT_HEADER_EVENT64;
+        memcpy(header + 0x00, &size, sizeof(size));
+        memcpy(header + 0x02, &type, sizeof(type));
+        memcpy(header + 0x08, &thread_id, sizeof(thread_id));
+        memcpy(header + 0x0C, &process_id, sizeof(process_id));
+        memcpy(header + 0x10, &time_stamp, sizeof(time_stamp));
+        append(header, sizeof(header), payload, payload_size);
+    }
+
+    std::vector<UCHAR> Data;
+
+  private:
+    void
+    append(const void *header, ULONG header_size, const void *payload, ULONG payload_size)
+    {
+        ULONG size = header_size + payload_size;
+        assert(Offset + size <= BufferSize);
+        memcpy(&Data[Start + Offset], header, header_size);
+        if (payload_size)
+        {
+            memcpy(&Data[Start + Offset + header_size], payload, payload_size);
+        }
+        Offset += ALIGN_POT(size, phnt::etl_record_alignment);
+    }
+
+    ULONG BufferSize;
+    size_t Start = 0;
+    ULONG Offset = 0;
+    LONGLONG Sequence = 0;
+};
+
+static void check_etl_reader()
+{
+    const ULONG payload[3] = {0x11, 0x22, 0x33};
+    trace_writer writer;
+    writer.begin_buffer(3);
+    writer.system_event(
+        EVENT_TRACE_GROUP_PROCESS | EVENT_TRACE_TYPE_START, 8, 4, 100, payload, 12);
+    writer.perfinfo_event(EVENT_TRACE_GROUP_PERFINFO | 0x2E, 110, payload, 8);
+    writer.end_buffer();
+    writer.begin_buffer(0x105);
+    writer.event_header_event(12, 16, 120, payload, 4);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    assert(reader.buffer_count() == 2);
+    assert(!reader.truncated());
+    assert(reader.buffer(0).processor_index() == 3);
+    assert(reader.buffer(1).processor_index() == 0x105);
+
+    std::vector<phnt::etl_event> events;
+    bool valid = reader.for_each_event(
+        [&](const phnt::etl_event &event) { events.push_back(event); });
+    assert(valid);
+    assert(events.size() == 3);
+
+    assert(events[0].HeaderType == TRACE_HEADER_TYPE_SYSTEM64);
+    assert(events[0].PointerSize == 8);
+    assert(events[0].HookId == (EVENT_TRACE_GROUP_PROCESS | EVENT_TRACE_TYPE_START));
+    assert(events[0].Version == 2);
+    assert(events[0].ThreadId == 8 && events[0].ProcessId == 4);
+    assert(events[0].TimeStamp == 100);
+    assert(events[0].PayloadSize == 12);
+    assert(memcmp(events[0].Payload, payload, 12) == 0);
+    assert(events[0].Data == writer.Data.data() + sizeof(WMI_BUFFER_HEADER));
+
+    assert(events[1].HeaderType == TRACE_HEADER_TYPE_PERFINFO64);
+    assert(events[1].ThreadId == phnt::etl_no_id);
+    assert(events[1].TimeStamp == 110);
+    assert(events[1].PayloadSize == 8);
+    assert(events[1].ProcessorIndex == 3);
+
+    assert(events[2].HeaderType == TRACE_HEADER_TYPE_EVENT_HEADER64);
+    assert(events[2].ThreadId == 12 && events[2].ProcessId == 16);
+    assert(events[2].TimeStamp == 120);
+    assert(events[2].PayloadSize == 4);
+    assert(events[2].ProcessorIndex == 0x105);
+}
+
+static void check_etl_reader_malformed()
+{
+    trace_writer writer;
+    writer.begin_buffer(0);
+    writer.system_event(EVENT_TRACE_GROUP_THREAD, 1, 1, 1);
+    writer.end_buffer();
+    writer.begin_buffer(1);
+    writer.system_event(EVENT_TRACE_GROUP_THREAD, 2, 2, 2);
+    writer.end_buffer();
+
+    // A record that runs past Offset spoils its own buffer only
+    SYSTEM_TRACE_HEADER header;
+    memcpy(&header, &writer.Data[sizeof(WMI_BUFFER_HEADER)], sizeof(header));
+    header.Packet.Size = 0x400;
+    memcpy(&writer.Data[sizeof(WMI_BUFFER_HEADER)], &header, sizeof(header));
+    // A partial buffer at the end of the file is left out
+    writer.Data.resize(writer.Data.size() + 0x100, 0);
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    assert(reader.buffer_count() == 2);
+    assert(reader.truncated());
+    ULONG count = 0;
+    bool valid = reader.for_each_event([&](const phnt::etl_event &event) {
+        assert(event.ThreadId == 2);
+        ++count;
+    });
+    assert(!valid);
+    assert(count == 1);
+}
+
+static void check_etl_reader_parallel()
+{
+    const ULONG buffers = 64;
+    const ULONG events_per_buffer = 20;
+    trace_writer writer;
+    for (ULONG i = 0; i < buffers; ++i)
+    {
+        writer.begin_buffer((USHORT)(i % 4));
+        for (ULONG j = 0; j < events_per_buffer; ++j)
+        {
+            writer.system_event(
+                EVENT_TRACE_GROUP_THREAD, i, j, i * events_per_buffer + j);
+        }
+        writer.end_buffer();
+    }
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    unsigned workers = reader.worker_count(4);
+    assert(workers == 4);
+    std::vector<uint64_t> sums(workers);
+    std::vector<ULONG> counts(workers);
+    reader.for_each_buffer_parallel(
+        [&](const phnt::etl_buffer &buffer, unsigned worker) {
+            buffer.for_each_event([&](const phnt::etl_event &event) {
+                assert(event.ThreadId == buffer.index());
+                sums[worker] += (uint64_t)event.TimeStamp;
+                ++counts[worker];
+            });
+        },
+        workers);
+
+    ULONGLONG sum = 0;
+    ULONG count = 0;
+    for (unsigned i = 0; i < workers; ++i)
+    {
+        sum += sums[i];
+        count += counts[i];
+    }
+    const ULONG total = buffers * events_per_buffer;
+    assert(count == total);
+    assert(sum == (ULONGLONG)total * (total - 1) / 2);
+}
+
+static void check_etl_dispatch()
+{
+    using phnt::etl_get_hook;
+    using phnt::etl_get_payload;
+    using payload = phnt::etl_payload;
+    const UCHAR native = sizeof(PVOID);
+
+    static_assert(
+        etl_get_payload(PERFINFO_LOG_TYPE_CONTEXTSWAP, 2, 4) == payload::WMI_CONTEXTSWAP);
+    const phnt::etl_hook_info &hook = etl_get_hook(PERFINFO_LOG_TYPE_CONTEXTSWAP);
+    assert(strcmp(hook.Name, "PERFINFO_LOG_TYPE_CONTEXTSWAP") == 0);
+    assert(hook.HookId == PERFINFO_LOG_TYPE_CONTEXTSWAP);
+    assert(etl_get_hook(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGOPEN).Name);
+    assert(etl_get_hook(EVENT_TRACE_GROUP_THREAD | 0xFF).Name == nullptr);
+    assert(etl_get_hook(0xFF00).Name == nullptr);
+
+    // The largest listed version at or below the event version wins
+    assert(etl_get_payload(WMI_LOG_TYPE_IO_READ, 1, native) == payload::None);
+    assert(
+        etl_get_payload(WMI_LOG_TYPE_IO_READ, 2, native) ==
+        payload::ETW_DISKIO_READWRITE_V2);
+    assert(
+        etl_get_payload(WMI_LOG_TYPE_IO_READ, 3, native) ==
+        payload::ETW_DISKIO_READWRITE_V3);
+    assert(
+        etl_get_payload(WMI_LOG_TYPE_IO_READ, 9, native) ==
+        payload::ETW_DISKIO_READWRITE_V3);
+
+    // Pointer layouts only match traces of their pointer size
+    assert(
+        etl_get_payload(WMI_LOG_TYPE_PROCESS_CREATE, 4, 8) ==
+        payload::WMI_PROCESS_INFORMATION64);
+    assert(
+        etl_get_payload(WMI_LOG_TYPE_PROCESS_CREATE, 4, 4) ==
+        (native == 4 ? payload::WMI_PROCESS_INFORMATION : payload::None));
+    assert(
+        etl_get_payload(WMI_LOG_TYPE_IMAGE_LOAD, 3, 4) ==
+        payload::WMI_IMAGELOAD_INFORMATION32);
+    assert(
+        etl_get_payload(WMI_LOG_TYPE_IMAGE_LOAD, 3, 8) ==
+        payload::WMI_IMAGELOAD_INFORMATION64);
+    const char *name = phnt::etl_payloads[(ULONG)payload::WMI_CONTEXTSWAP].Name;
+    assert(strcmp(name, "WMI_CONTEXTSWAP") == 0);
+
+    WMI_CONTEXTSWAP cswitch = {};
+    cswitch.NewThreadId = 20;
+    cswitch.OldThreadId = 10;
+    cswitch.OldThreadWaitReason = 6;
+    trace_writer writer;
+    writer.begin_buffer(0);
+    writer.system_event(
+        PERFINFO_LOG_TYPE_CONTEXTSWAP, 0, 0, 1, &cswitch, sizeof(cswitch));
+    writer.system_event(PERFINFO_LOG_TYPE_CONTEXTSWAP, 0, 0, 2, &cswitch, 8);
+    writer.system_event(WMI_LOG_TYPE_IO_READ, 0, 0, 3, &cswitch, sizeof(cswitch));
+    writer.end_buffer();
+
+    std::vector<phnt::etl_event> events;
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    reader.for_each_event([&](const phnt::etl_event &event) { events.push_back(event); });
+    assert(events.size() == 3);
+
+    WMI_CONTEXTSWAP decoded;
+    bool read = phnt::etl_read_payload(events[0], decoded);
+    assert(read);
+    assert(decoded.NewThreadId == 20 && decoded.OldThreadId == 10);
+    assert(decoded.OldThreadWaitReason == 6);
+    // Too short for the structure
+    read = phnt::etl_read_payload(events[1], decoded);
+    assert(!read);
+    // Not the structure of the hook
+    read = phnt::etl_read_payload(events[2], decoded);
+    assert(!read);
+}
+
+static void check_etl_merger()
+{
+    // Two buffers per processor, the file interleaves them and each processor runs on
+    // its own clock stride; processor 2 logs at the same times as processor 0.
+    const USHORT processors[] = {2, 0, 5};
+    const ULONG events_per_buffer = 10;
+    trace_writer writer;
+    for (ULONG b = 0; b < 2; ++b)
+    {
+        for (USHORT processor : processors)
+        {
+            writer.begin_buffer(processor);
+            LONGLONG stride = processor == 5 ? 3 : 2;
+            for (ULONG j = 0; j < events_per_buffer; ++j)
+            {
+                LONGLONG time = (b * events_per_buffer + j) * stride;
+                writer.system_event(EVENT_TRACE_GROUP_THREAD, processor, j, time);
+            }
+            writer.end_buffer();
+        }
+    }
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_merger merger(reader);
+    assert(merger.stream_count() == 3);
+    std::vector<phnt::etl_event> events;
+    bool valid = merger.for_each_event(
+        [&](const phnt::etl_event &event) { events.push_back(event); });
+    assert(valid);
+    assert(events.size() == 2 * events_per_buffer * 3);
+    for (size_t i = 1; i < events.size(); ++i)
+    {
+        const phnt::etl_event &a = events[i - 1];
+        const phnt::etl_event &b = events[i];
+        assert(a.TimeStamp <= b.TimeStamp);
+        // Ties in processor order
+        assert(a.TimeStamp != b.TimeStamp || a.ProcessorIndex < b.ProcessorIndex);
+        assert(b.ThreadId == b.ProcessorIndex);
+    }
+    assert(events.back().TimeStamp == (2 * events_per_buffer - 1) * 3);
+
+    phnt::etl_event event;
+    assert(!merger.next(event));
+}
+
+static void check_etl_time_index()
+{
+    auto process =
+        [](trace_writer &writer, USHORT hook, ULONG process_id, ULONG parent_id) {
+            WMI_PROCESS_INFORMATION64 info = {};
+            info.ProcessId = process_id;
+            info.ParentId = parent_id;
+            writer.system_event(hook, 0, process_id, 0, &info, sizeof(info));
+        };
+    auto thread =
+        [](trace_writer &writer, USHORT hook, ULONG thread_id, ULONG process_id) {
+            WMI_THREAD_INFORMATION info = {process_id, thread_id};
+            writer.system_event(hook, thread_id, process_id, 0, &info, sizeof(info));
+        };
+
+    trace_writer writer;
+    for (ULONG b = 0; b < 8; ++b)
+    {
+        writer.begin_buffer((USHORT)(b % 2));
+        switch (b)
+        {
+        case 0:
+            process(writer, WMI_LOG_TYPE_PROCESS_DC_START, 4, 0);
+            thread(writer, WMI_LOG_TYPE_THREAD_DC_START, 8, 4);
+            break;
+        case 2:
+            thread(writer, WMI_LOG_TYPE_THREAD_CREATE, 12, 4);
+            break;
+        case 3:
+            thread(writer, WMI_LOG_TYPE_THREAD_DELETE, 8, 4);
+            break;
+        case 5:
+            process(writer, WMI_LOG_TYPE_PROCESS_CREATE, 100, 4);
+            thread(writer, WMI_LOG_TYPE_THREAD_CREATE, 104, 100);
+            break;
+        }
+        writer.end_buffer((b + 1) * 100);
+    }
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_time_index index = phnt::etl_time_index::build(reader, 2);
+    const std::vector<phnt::etl_index_entry> &entries = index.entries();
+    assert(entries.size() == 4);
+    assert(entries[1].BufferIndex == 2);
+    assert(entries[1].FileOffset == reader.buffer_offset(2));
+    assert(entries[1].SequenceNumber == 2);
+    assert(entries[1].TimeStamp == 300);
+
+    assert(entries[0].ProcessCount == 0 && entries[0].ThreadCount == 0);
+    assert(entries[1].ProcessCount == 1 && index.processes(entries[1])[0].ProcessId == 4);
+    assert(entries[1].ThreadCount == 1 && index.threads(entries[1])[0].ThreadId == 8);
+    assert(entries[2].ThreadCount == 1 && index.threads(entries[2])[0].ThreadId == 12);
+    assert(entries[3].ProcessCount == 2 && entries[3].ThreadCount == 2);
+    assert(index.processes(entries[3])[1].ProcessId == 100);
+    assert(index.processes(entries[3])[1].ParentId == 4);
+    assert(index.threads(entries[3])[1].ThreadId == 104);
+    assert(index.threads(entries[3])[1].ProcessId == 100);
+
+    // Every buffer before the entry was flushed before the time sought
+    assert(index.seek(50) == &entries[0]);
+    assert(index.seek(300) == &entries[0]);
+    assert(index.seek(301) == &entries[1]);
+    assert(index.seek(100000) == &entries[3]);
+
+    std::vector<UCHAR> sidecar = index.save();
+    phnt::etl_time_index loaded;
+    bool valid = loaded.load(sidecar.data(), sidecar.size());
+    assert(valid);
+    assert(loaded.matches(reader));
+    assert(loaded.entries().size() == 4);
+    assert(loaded.seek(301)->BufferIndex == 2);
+    assert(loaded.threads(loaded.entries()[3])[1].ThreadId == 104);
+    valid = loaded.load(sidecar.data(), sidecar.size() - 1);
+    assert(!valid);
+
+    // A first row that wraps the sum with the count back into the arrays
+    ULONGLONG wrapped = ~0ULL;
+    memcpy(
+        sidecar.data() + sizeof(phnt::etl_index_header) + sizeof(phnt::etl_index_entry) +
+            offsetof(phnt::etl_index_entry, FirstProcess),
+        &wrapped,
+        sizeof(wrapped));
+    valid = loaded.load(sidecar.data(), sidecar.size());
+    assert(!valid);
+}
+
+static void check_etl_cswitch_timeline()
+{
+    auto cswitch = [](trace_writer &writer,
+                      LONGLONG time,
+                      ULONG new_thread,
+                      ULONG old_thread,
+                      UCHAR state,
+                      UCHAR reason,
+                      ULONG wait_ticks) {
+        WMI_CONTEXTSWAP info = {};
+        info.NewThreadId = new_thread;
+        info.OldThreadId = old_thread;
+        info.OldThreadState = state;
+        info.OldThreadWaitReason = reason;
+        info.NewThreadWaitTime = wait_ticks;
+        writer.system_event(
+            PERFINFO_LOG_TYPE_CONTEXTSWAP, 0, 0, time, &info, sizeof(info));
+    };
+
+    // Thread 100 runs on processor 0 and blocks on a queue, processor 1 readies it and
+    // preempts thread 200 for it.
+    trace_writer writer;
+    writer.begin_buffer(0);
+    cswitch(writer, 10, 100, 0, Running, Executive, 7);
+    cswitch(writer, 20, 0, 100, Waiting, WrQueue, 0);
+    writer.end_buffer();
+    writer.begin_buffer(1);
+    cswitch(writer, 12, 200, 0, Running, Executive, 0);
+    ETW_READY_THREAD_EVENT ready = {};
+    ready.ThreadId = 100;
+    writer.system_event(PERFINFO_LOG_TYPE_READY_THREAD, 0, 0, 25, &ready, sizeof(ready));
+    cswitch(writer, 30, 100, 200, Ready, Executive, 1);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_merger merger(reader);
+    phnt::etl_cswitch_timeline timeline;
+    bool valid = merger.for_each_event(
+        [&](const phnt::etl_event &event) { timeline.consume(event); });
+    assert(valid);
+    timeline.finish(40);
+
+    const phnt::etl_thread_intervals &intervals = timeline.intervals();
+    assert(intervals.size() == 6);
+    auto find = [&](ULONG thread_id, UCHAR state) {
+        for (size_t i = 0; i < intervals.size(); ++i)
+        {
+            if (intervals.ThreadId[i] == thread_id && intervals.State[i] == state)
+            {
+                return i;
+            }
+        }
+        return intervals.size();
+    };
+    size_t wait = find(100, Waiting);
+    assert(wait < intervals.size());
+    assert(intervals.Start[wait] == 20 && intervals.End[wait] == 25);
+    assert(intervals.WaitReason[wait] == WrQueue && intervals.Processor[wait] == 0);
+    size_t ready_interval = find(100, Ready);
+    assert(ready_interval < intervals.size());
+    assert(intervals.Start[ready_interval] == 25 && intervals.End[ready_interval] == 30);
+    size_t run = find(200, Running);
+    assert(run < intervals.size());
+    assert(intervals.Start[run] == 12 && intervals.End[run] == 30);
+    assert(intervals.Processor[run] == 1);
+    // Preempted, still ready at the end
+    assert(find(200, Ready) == intervals.size());
+
+    const phnt::etl_interval_stats *waits = timeline.wait_stats();
+    assert(waits[WrQueue].Count == 1 && waits[WrQueue].Total == 5);
+    assert(waits[Executive].Count == 0);
+    assert(timeline.ready_stats().Count == 1 && timeline.ready_stats().Max == 5);
+
+    ULONG threads = 0;
+    timeline.for_each_thread([&](const phnt::etl_thread_times &times) {
+        ++threads;
+        if (times.ThreadId == 100)
+        {
+            assert(times.Running == 20 && times.Waiting == 5 && times.Ready == 5);
+            // The wait before the trace is only known from NewThreadWaitTime
+            assert(times.Switches == 2 && times.WaitTicks == 8);
+        }
+        else if (times.ThreadId == 200)
+        {
+            assert(times.Running == 18 && times.Switches == 1);
+        }
+        else
+        {
+            assert(times.ThreadId == 0 && times.Running == 20);
+        }
+    });
+    assert(threads == 3);
+}
+
+static void check_etl_ccswap()
+{
+    auto batch = [](std::vector<UCHAR> &data, LONGLONG first_time) {
+        PERFINFO_CCSWAP_BUFFER buffer = {};
+        buffer.FirstTimeStamp = first_time;
+        buffer.TidTable[0] = 100;
+        buffer.TidTable[1] = 200;
+        buffer.ThreadBasePriority[1] = 8;
+        data.assign((const UCHAR *)&buffer, (const UCHAR *)(&buffer + 1));
+    };
+    auto packet = [](std::vector<UCHAR> &data, uint64_t bits, size_t size) {
+        const UCHAR *bytes = (const UCHAR *)&bits;
+        data.insert(data.end(), bytes, bytes + size);
+    };
+    const uint64_t ready = (uint64_t)MaximumWaitReason + Ready;
+
+    std::vector<UCHAR> first;
+    batch(first, 1000);
+    // Full: 10 ticks, thread 100 waits on a queue, priority 9, wait time 77
+    packet(
+        first,
+        PerfCSwapFull | (10ull << 2) | (0ull << 32) | ((uint64_t)WrQueue << 36) |
+            (9ull << 42) | (77ull << 47),
+        8);
+    // Idle short: 5 ticks
+    packet(first, PerfCSwapIdleShort | (5 << 2), 2);
+    // Lite: thread 200 preempted, priority increment 2, 20 ticks
+    packet(first, PerfCSwapLite | (1 << 2) | (2 << 6) | (ready << 9) | (20ull << 15), 4);
+    // Idle: 100000 ticks
+    packet(first, PerfCSwapIdle | (100000ull << 2), 4);
+
+    std::vector<UCHAR> second;
+    batch(second, 200000);
+    packet(second, PerfCSwapLite | (0 << 2) | ((uint64_t)WrQueue << 9) | (1ull << 15), 4);
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(3);
+    writer.system_event(
+        PERFINFO_LOG_TYPE_CONTEXTSWAP_BATCH,
+        0,
+        0,
+        1000,
+        first.data(),
+        (ULONG)first.size());
+    writer.system_event(
+        PERFINFO_LOG_TYPE_CONTEXTSWAP_BATCH,
+        0,
+        0,
+        200000,
+        second.data(),
+        (ULONG)second.size());
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_ccswap_decoder decoder;
+    std::vector<phnt::etl_ccswap_record> records;
+    auto add = [&](const phnt::etl_ccswap_record &record) { records.push_back(record); };
+    reader.for_each_event([&](const phnt::etl_event &event) {
+        bool valid = decoder.consume(event, add);
+        assert(valid);
+    });
+    // The last switch waits for the next batch of the processor
+    assert(records.size() == 4);
+    decoder.flush(add);
+    assert(records.size() == 5);
+
+    assert(records[0].TimeStamp == 1010 && records[0].ProcessorIndex == 3);
+    assert(records[0].Switch.OldThreadId == 100 && records[0].Switch.NewThreadId == 0);
+    assert(records[0].Switch.OldThreadState == Waiting);
+    assert(records[0].Switch.OldThreadWaitReason == WrQueue);
+    assert(records[0].Switch.OldThreadPriority == 9);
+    assert(records[0].Switch.NewThreadWaitTime == 77);
+    assert(records[1].TimeStamp == 1015 && records[1].Switch.OldThreadId == 0);
+    assert(records[1].Switch.NewThreadId == 200);
+    assert(records[2].TimeStamp == 1035 && records[2].Switch.OldThreadId == 200);
+    assert(records[2].Switch.OldThreadState == Ready);
+    assert(records[2].Switch.OldThreadPriority == 10);
+    assert(records[3].TimeStamp == 101035 && records[3].Switch.NewThreadId == 100);
+    assert(records[4].TimeStamp == 200001 && records[4].Switch.OldThreadId == 100);
+    assert(records[4].Switch.NewThreadId == phnt::etl_no_thread);
+
+    phnt::etl_cswitch_timeline timeline;
+    for (const phnt::etl_ccswap_record &record : records)
+    {
+        timeline.context_switch(record.ProcessorIndex, record.TimeStamp, record.Switch);
+    }
+    // Thread 100 waits from its switch out in the first batch to its switch in
+    assert(timeline.wait_stats()[WrQueue].Count == 1);
+    assert(timeline.wait_stats()[WrQueue].Total == 101035 - 1010);
+    assert(timeline.intervals().size() == 5);
+
+    // Ends inside the last packet
+    bool valid = decoder.decode(0, first.data(), (ULONG)first.size() - 1, add);
+    assert(!valid);
+    assert(decoder.malformed() == 1);
+    assert(records.size() == 5);
+}
+
+static void check_etl_stack_store()
+{
+    auto stack = [](trace_writer &writer, LONGLONG time, ULONG thread_id, uint64_t top) {
+        writer.system_event(EVENT_TRACE_GROUP_THREAD, thread_id, 1, time);
+        writer.stack_walk(thread_id, 1, time, {top, 0x2000, 0x3000});
+    };
+
+    trace_writer writer;
+    writer.begin_buffer(0);
+    stack(writer, 100, 7, 0x1000);
+    stack(writer, 200, 8, 0x1000);
+    stack(writer, 300, 7, 0x1004);
+    writer.end_buffer();
+
+    phnt::etl_stack_store store(64);
+    phnt::etl_stack_attachments attachments;
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    ULONG stacks = 0;
+    reader.for_each_event([&](const phnt::etl_event &event) {
+        stacks += attachments.consume(store, event);
+    });
+    attachments.sort();
+    assert(stacks == 3 && attachments.size() == 3);
+    assert(store.size() == 2 && store.frame_count() == 6);
+    ULONG first = attachments.find(100, 7);
+    assert(first != phnt::etl_no_stack);
+    assert(attachments.find(200, 8) == first);
+    assert(attachments.find(300, 7) != first);
+    assert(attachments.find(300, 8) == phnt::etl_no_stack);
+    phnt::etl_stack frames = store.frames(first);
+    assert(frames.Count == 3 && frames.Frames[0] == 0x1000 && frames.Frames[2] == 0x3000);
+    // Not searched again until the next sort()
+    attachments.add(50, 7, first);
+    assert(attachments.find(100, 7) == phnt::etl_no_stack);
+
+    // A full store refuses new stacks and keeps its ids
+    phnt::etl_stack_store full(2);
+    uint64_t call[3] = {0x1000, 0x2000, 0x3000};
+    ULONG kept = full.intern(call, 1);
+    assert(kept != phnt::etl_no_stack && full.intern(call, 2) != phnt::etl_no_stack);
+    for (int i = 0; i < 3; ++i)
+    {
+        assert(full.intern(call, 3) == phnt::etl_no_stack);
+    }
+    assert(full.size() == 2 && full.intern(call, 1) == kept);
+
+    // Workers interning the same stacks get the same ids
+    phnt::etl_stack_store shared(1024);
+    const ULONG distinct = 97;
+    std::vector<std::vector<ULONG>> ids(4, std::vector<ULONG>(distinct));
+    std::vector<std::thread> workers;
+    for (size_t w = 0; w < ids.size(); ++w)
+    {
+        workers.emplace_back([&, w]() {
+            for (ULONG round = 0; round < 50; ++round)
+            {
+                for (ULONG k = 0; k < distinct; ++k)
+                {
+                    uint64_t frames[4] = {k, k * 3, 0x7FF000, 1};
+                    ids[w][k] = shared.intern(frames, 1 + k % 4);
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    for (ULONG k = 0; k < distinct; ++k)
+    {
+        assert(ids[0][k] != phnt::etl_no_stack);
+        for (size_t w = 1; w < ids.size(); ++w)
+        {
+            assert(ids[w][k] == ids[0][k]);
+        }
+        phnt::etl_stack interned = shared.frames(ids[0][k]);
+        assert(interned.Count == 1 + k % 4 && interned.Frames[0] == k);
+    }
+}
+
+static void check_etl_profile()
+{
+    auto image = [](trace_writer &writer,
+                    USHORT hook,
+                    LONGLONG time,
+                    ULONG process_id,
+                    uint64_t base,
+                    uint64_t size,
+                    const char16_t *name) {
+        WMI_IMAGELOAD_INFORMATION64 info = {};
+        info.ImageBase64 = base;
+        info.ImageSize64 = size;
+        info.ProcessId = process_id;
+        std::vector<UCHAR> data(FIELD_OFFSET(WMI_IMAGELOAD_INFORMATION64, FileName));
+        memcpy(data.data(), &info, data.size());
+        const UCHAR *bytes = (const UCHAR *)name;
+        size_t length = std::char_traits<char16_t>::length(name) + 1;
+        data.insert(data.end(), bytes, bytes + length * sizeof(char16_t));
+        writer.system_event(hook, 0, process_id, time, data.data(), (ULONG)data.size());
+    };
+    auto sample = [](trace_writer &writer, LONGLONG time, ULONG thread_id, uint64_t ip) {
+        UCHAR data[8 + 8] = {};
+        USHORT count = 1;
+        memcpy(data, &ip, sizeof(ip));
+        memcpy(data + 8, &thread_id, sizeof(thread_id));
+        memcpy(data + 12, &count, sizeof(count));
+        writer.system_event(
+            PERFINFO_LOG_TYPE_SAMPLED_PROFILE, 0, 0, time, data, sizeof(data));
+    };
+    const uint64_t kernel = 0xFFFF800000000000ull;
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    image(
+        writer,
+        WMI_LOG_TYPE_IMAGE_DC_START,
+        0,
+        0,
+        kernel,
+        0x100000,
+        u"\\SystemRoot\\system32\\ntoskrnl.exe");
+    WMI_THREAD_INFORMATION thread = {100, 7};
+    writer.system_event(WMI_LOG_TYPE_THREAD_DC_START, 7, 100, 0, &thread, sizeof(thread));
+    image(writer, WMI_LOG_TYPE_IMAGE_LOAD, 10, 100, 0x10000, 0x1000, u"C:\\a.dll");
+    sample(writer, 20, 7, 0x10010);
+    writer.stack_walk(7, 100, 20, {0x10010, kernel + 0x200});
+    sample(writer, 30, 7, 0x10010);
+    image(writer, WMI_LOG_TYPE_IMAGE_UNLOAD, 50, 100, 0x10000, 0x1000, u"C:\\a.dll");
+    image(writer, WMI_LOG_TYPE_IMAGE_LOAD, 60, 100, 0x10000, 0x2000, u"C:\\b.dll");
+    sample(writer, 70, 7, 0x10010);
+    sample(writer, 80, 7, kernel + 0x100);
+    sample(writer, 90, 7, 0x5);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_image_map images;
+    phnt::etl_stack_store stacks(64);
+    phnt::etl_stack_attachments attachments;
+    phnt::etl_merger first_pass(reader);
+    first_pass.for_each_event([&](const phnt::etl_event &event) {
+        images.consume(event);
+        attachments.consume(stacks, event);
+    });
+    attachments.sort();
+    assert(images.size() == 3);
+    assert(strcmp(images.image(0).module(), "ntoskrnl.exe") == 0);
+    assert(images.image(1).Unload == 50);
+    assert(images.find(100, 40, 0x10FFF) == 1);
+    assert(images.find(100, 55, 0x10010) == phnt::etl_no_image);
+    assert(images.find(100, 70, 0x11FFF) == 2);
+    assert(images.find(4, 70, kernel + 0x10) == 0);
+
+    // Reloads at one base are found by load time, not by walking over each other
+    phnt::etl_image_map reloads;
+    for (LONGLONG i = 0; i < 1000; ++i)
+    {
+        reloads.load(5, 0x20000, 0x1000 + (uint64_t)i, i * 10, "c.dll");
+        reloads.unload(5, 0x20000, i * 10 + 5);
+    }
+    assert(reloads.find(5, 4994, 0x20010) == 499);
+    assert(reloads.find(5, 4997, 0x20010) == phnt::etl_no_image);
+    assert(reloads.find(5, 9990, 0x21000 + 998) == 999);
+    assert(reloads.find(5, 0, 0x21000) == phnt::etl_no_image);
+
+    phnt::etl_profile profile(images, stacks, &attachments);
+    phnt::etl_merger second_pass(reader);
+    second_pass.for_each_event(
+        [&](const phnt::etl_event &event) { profile.consume(event); });
+    assert(profile.unresolved() == 1);
+
+    std::map<std::string, uint64_t> rvas;
+    profile.for_each_rva([&](const phnt::etl_image &image, ULONG rva, uint64_t samples) {
+        char text[64];
+        snprintf(text, sizeof(text), "%s!0x%lx", image.module(), (unsigned long)rva);
+        rvas[text] += samples;
+    });
+    assert(rvas.size() == 3);
+    assert(rvas["a.dll!0x10"] == 2 && rvas["b.dll!0x10"] == 1);
+    assert(rvas["ntoskrnl.exe!0x100"] == 1);
+
+    std::map<std::string, uint64_t> folded;
+    profile.for_each_folded(
+        [&](const std::string &stack, uint64_t samples) { folded[stack] += samples; });
+    assert(folded.size() == 5);
+    assert(folded["pid 100;ntoskrnl.exe!0x200;a.dll!0x10"] == 1);
+    assert(folded["pid 100;a.dll!0x10"] == 1);
+    assert(folded["pid 100;b.dll!0x10"] == 1);
+    assert(folded["pid 100;ntoskrnl.exe!0x100"] == 1);
+    assert(folded["pid 100;0x5"] == 1);
+
+    // Samples without a stack do not fill the store
+    phnt::etl_stack_store full(1);
+    phnt::etl_profile addresses(images, full);
+    for (uint64_t ip = 0x10; ip < 0x20; ++ip)
+    {
+        addresses.sample(7, 20, ip, 2);
+    }
+    assert(full.size() == 0);
+    size_t lines = 0;
+    addresses.for_each_folded([&](const std::string &, uint64_t samples) {
+        assert(samples == 2);
+        ++lines;
+    });
+    assert(lines == 16);
+}
+
+static void check_etl_histogram()
+{
+    const uint64_t values[] = {0, 1, 31, 32, 33, 34, 1000, 123456789, UINT64_MAX};
+    for (uint64_t value : values)
+    {
+        ULONG bucket = phnt::etl_histogram::bucket(value);
+        assert(bucket < phnt::etl_histogram_buckets);
+        uint64_t limit = phnt::etl_histogram::bucket_limit(bucket);
+        assert(limit >= value);
+        // Within 1/16 of the value
+        assert(limit - value <= value / 16);
+        assert(bucket == 0 || phnt::etl_histogram::bucket_limit(bucket - 1) < value);
+    }
+    assert(phnt::etl_histogram::bucket(UINT64_MAX) == phnt::etl_histogram_buckets - 1);
+
+    phnt::etl_histogram a, b;
+    for (uint64_t i = 1; i <= 100; ++i)
+    {
+        (i % 2 ? a : b).add(i * 10);
+    }
+    a.merge(b);
+    assert(a.count() == 100 && a.min_value() == 10 && a.max_value() == 1000);
+    assert(a.mean() == 505.0);
+    uint64_t median = a.percentile(50);
+    assert(median >= 500 && median <= 500 + 500 / 16);
+    assert(a.percentile(100) == 1000);
+    assert(phnt::etl_histogram().percentile(99) == 0);
+}
+
+static void check_etl_diskio()
+{
+    auto request = [](trace_writer &writer,
+                      USHORT hook,
+                      LONGLONG time,
+                      uint64_t irp,
+                      ULONG thread_id) {
+        UCHAR data[12];
+        memcpy(data, &irp, 8);
+        memcpy(data + 8, &thread_id, 4);
+        writer.system_event(hook, thread_id, 0, time, data, sizeof(data));
+    };
+    auto complete = [](trace_writer &writer,
+                       USHORT hook,
+                       LONGLONG time,
+                       ULONG disk,
+                       uint64_t file,
+                       uint64_t irp,
+                       uint64_t response) {
+        ETW_DISKIO_READWRITE_V3 io = {};
+        io.DiskNumber = disk;
+        io.Size = 0x1000;
+        memcpy(&io.FileObject, &file, 8);
+        memcpy(&io.IrpAddress, &irp, 8);
+        io.HighResResponseTime = response;
+        io.IssuingThreadId = 9;
+        writer.system_event(hook, 0, 0, time, &io, sizeof(io));
+    };
+
+    trace_writer writer;
+    writer.begin_buffer(0);
+    WMI_THREAD_INFORMATION thread = {100, 8};
+    writer.system_event(WMI_LOG_TYPE_THREAD_DC_START, 8, 100, 0, &thread, sizeof(thread));
+    request(writer, WMI_LOG_TYPE_IO_READ_INIT, 10, 0xA000, 8);
+    request(writer, WMI_LOG_TYPE_IO_WRITE_INIT, 15, 0xB000, 8);
+    complete(writer, WMI_LOG_TYPE_IO_WRITE, 35, 1, 0xF2, 0xB000, 999);
+    complete(writer, WMI_LOG_TYPE_IO_READ, 110, 0, 0xF1, 0xA000, 999);
+    // The request is in a buffer the other decoder read
+    complete(writer, WMI_LOG_TYPE_IO_READ, 200, 0, 0xF1, 0xC000, 7);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_diskio_latency latency, other;
+    reader.for_each_event([&](const phnt::etl_event &event) { latency.consume(event); });
+    assert(latency.unpaired() == 1);
+    assert(
+        latency.disks().at(0).count() == 2 && latency.disks().at(0).max_value() == 100);
+    assert(latency.disks().at(0).min_value() == 7);
+    assert(latency.disks().at(1).max_value() == 20);
+    assert(latency.processes().at(100).count() == 2);
+    // IssuingThreadId 9 of the unpaired completion has no known process
+    assert(latency.processes().at(phnt::etl_no_process).count() == 1);
+    assert(latency.files().at(0xF1).count() == 2);
+
+    other.merge(latency);
+    other.merge(latency);
+    assert(other.disks().at(0).count() == 4 && other.unpaired() == 2);
+}
+
+static void check_etl_file_resolver()
+{
+    // Payloads of 64 bit pointers and ULONGs, an optional UTF-16 name at the end
+    struct payload
+    {
+        std::vector<UCHAR> Data;
+        payload &ptr(uint64_t value)
+        {
+            const UCHAR *bytes = (const UCHAR *)&value;
+            Data.insert(Data.end(), bytes, bytes + 8);
+            return *this;
+        }
+        payload &ulong(ULONG value)
+        {
+            const UCHAR *bytes = (const UCHAR *)&value;
+            Data.insert(Data.end(), bytes, bytes + 4);
+            return *this;
+        }
+        payload &name(const char16_t *text)
+        {
+            const UCHAR *bytes = (const UCHAR *)text;
+            size_t length = std::char_traits<char16_t>::length(text) + 1;
+            Data.insert(Data.end(), bytes, bytes + length * sizeof(char16_t));
+            return *this;
+        }
+    };
+    trace_writer writer(0x1000);
+    auto event = [&](USHORT hook, LONGLONG time, const payload &data) {
+        writer.system_event(hook, 0, 0, time, data.Data.data(), (ULONG)data.Data.size());
+    };
+    auto end = [&](LONGLONG time, uint64_t irp, uint64_t extra) {
+        event(
+            PERFINFO_LOG_TYPE_FILE_IO_OPERATION_END,
+            time,
+            payload().ptr(irp).ptr(extra).ulong(0));
+    };
+    auto read_write = [&](USHORT hook,
+                          LONGLONG time,
+                          uint64_t irp,
+                          uint64_t file_object,
+                          uint64_t file_key) {
+        event(
+            hook,
+            time,
+            payload().ptr(0).ptr(irp).ptr(file_object).ptr(file_key).ulong(0).ulong(16));
+    };
+
+    writer.begin_buffer(0);
+    event(PERFINFO_LOG_TYPE_FILENAME_RUNDOWN, 0, payload().ptr(0xA1).name(u"C:\\a.txt"));
+    read_write(PERFINFO_LOG_TYPE_FILE_IO_READ, 10, 1, 0xF1, 0xA1);
+    end(15, 1, 4096);
+    event(
+        PERFINFO_LOG_TYPE_FILE_IO_CREATE,
+        20,
+        payload().ptr(2).ptr(0xF2).ulong(0).ulong(0).ulong(0).ulong(0).name(
+            u"C:\\b.txt"));
+    end(22, 2, 0);
+    read_write(PERFINFO_LOG_TYPE_FILE_IO_WRITE, 30, 3, 0xF2, 0x999);
+    end(40, 3, 100);
+    event(
+        PERFINFO_LOG_TYPE_FILE_IO_CLOSE, 50, payload().ptr(4).ptr(0xF2).ptr(0).ulong(0));
+    end(51, 4, 0);
+    // The address of the closed object is reused by a file never named
+    read_write(PERFINFO_LOG_TYPE_FILE_IO_WRITE, 60, 5, 0xF2, 0);
+    end(61, 5, 7);
+    event(PERFINFO_LOG_TYPE_FILENAME_DELETE, 70, payload().ptr(0xA1));
+    read_write(PERFINFO_LOG_TYPE_FILE_IO_READ, 80, 6, 0xF1, 0xA1);
+    event(PERFINFO_LOG_TYPE_FILENAME, 90, payload().ptr(0xC1).name(u"C:\\c.txt"));
+    event(PERFINFO_LOG_TYPE_FILENAME_SAME, 91, payload().ptr(0xC1).ptr(0xC2));
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_file_resolver files;
+    reader.for_each_event([&](const phnt::etl_event &event) { files.consume(event); });
+    assert(files.name(0xC2) == "C:\\c.txt");
+    assert(files.name(0xA1).empty() && files.name(0xF2).empty());
+    assert(files.pending() == 1);
+
+    std::map<std::string, phnt::etl_file_stats> paths;
+    files.for_each_path([&](std::string_view path, const phnt::etl_file_stats &stats) {
+        paths[std::string(path)] = stats;
+    });
+    const size_t read = (size_t)phnt::etl_file_op::Read;
+    const size_t write = (size_t)phnt::etl_file_op::Write;
+    const size_t create = (size_t)phnt::etl_file_op::Create;
+    const size_t other = (size_t)phnt::etl_file_op::Other;
+    assert(paths.size() == 3);
+    const phnt::etl_file_stats &a = paths["C:\\a.txt"];
+    assert(a.Count[read] == 1 && a.Duration[read] == 5 && a.ReadBytes == 4096);
+    const phnt::etl_file_stats &b = paths["C:\\b.txt"];
+    assert(b.Count[create] == 1 && b.Duration[create] == 2);
+    assert(b.Count[write] == 1 && b.Duration[write] == 10 && b.WriteBytes == 100);
+    assert(b.Count[other] == 1 && b.Duration[other] == 1);
+    const phnt::etl_file_stats &unknown = paths[""];
+    assert(unknown.Count[write] == 1 && unknown.WriteBytes == 7);
+    assert(unknown.Count[read] == 1 && unknown.Duration[read] == 0);
+    // Interned once however many events carry it
+    assert(files.names().size() == 4);
+}
+
+static void check_etl_hash_map()
+{
+    // Thread ids, multiples of 4, through three doublings and many backward shifts
+    phnt::etl_hash_map<ULONG, ULONG> map(0xFFFFFFFF);
+    for (ULONG i = 0; i < 5000; ++i)
+    {
+        auto inserted = map.insert(i * 4);
+        assert(inserted.second && inserted.first == 0);
+        inserted.first = i;
+    }
+    assert(map.size() == 5000);
+    assert(!map.insert(8).second && map.insert(8).first == 2);
+    for (ULONG i = 0; i < 5000; i += 2)
+    {
+        assert(map.erase(i * 4));
+    }
+    assert(!map.erase(0) && !map.erase(3) && !map.find(0xFFFFFFFF));
+    assert(map.erase_if([](ULONG, ULONG value) { return value % 4 == 1; }) == 1250);
+    assert(map.size() == 1250);
+    for (ULONG i = 0; i < 5000; ++i)
+    {
+        const ULONG *value = map.find(i * 4);
+        assert(i % 4 == 3 ? value && *value == i : !value);
+    }
+    size_t visited = 0;
+    map.for_each([&](ULONG key, ULONG value) {
+        assert(key == value * 4);
+        ++visited;
+    });
+    assert(visited == 1250);
+}
+
+static void check_etl_heap()
+{
+    auto event = [](trace_writer &writer,
+                    USHORT hook,
+                    LONGLONG time,
+                    ULONG process_id,
+                    std::vector<uint64_t> fields) {
+        writer.system_event(
+            hook,
+            1,
+            process_id,
+            time,
+            fields.data(),
+            (ULONG)(fields.size() * sizeof(uint64_t)));
+    };
+    auto stack = [](trace_writer &writer, LONGLONG time, uint64_t frame) {
+        writer.stack_walk(1, 10, time, {frame});
+    };
+    const uint64_t heap = 0x10000;
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    event(writer, PERFINFO_LOG_TYPE_HEAP_CREATE, 0, 10, {heap, 2, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_HEAP_ALLOC, 10, 10, {heap, 100, 0x1000, 0});
+    stack(writer, 10, 0xA);
+    event(writer, PERFINFO_LOG_TYPE_HEAP_ALLOC, 20, 10, {heap, 50, 0x2000, 0});
+    stack(writer, 20, 0xB);
+    // Same address in another process
+    event(writer, PERFINFO_LOG_TYPE_HEAP_ALLOC, 25, 11, {heap, 8, 0x1000, 0});
+    event(writer, PERFINFO_LOG_TYPE_HEAP_FREE, 30, 10, {heap, 0x2000, 0});
+    event(
+        writer,
+        PERFINFO_LOG_TYPE_HEAP_REALLOC,
+        40,
+        10,
+        {heap, 0x3000, 0x1000, 200, 100, 0});
+    event(writer, PERFINFO_LOG_TYPE_HEAP_FREE, 50, 10, {heap, 0x9000, 0});
+    event(writer, PERFINFO_LOG_TYPE_HEAP_ALLOC, 60, 10, {heap, 30, 0x4000, 0});
+    stack(writer, 60, 0xA);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_stack_store stacks(64);
+    phnt::etl_stack_attachments attachments;
+    reader.for_each_event(
+        [&](const phnt::etl_event &event) { attachments.consume(stacks, event); });
+    attachments.sort();
+    phnt::etl_heap_tracker heaps(&attachments);
+    reader.for_each_event([&](const phnt::etl_event &event) { heaps.consume(event); });
+
+    assert(heaps.heaps().size() == 2 && heaps.live_blocks() == 3);
+    const phnt::etl_heap_stats &stats = heaps.heaps()[0];
+    assert(stats.ProcessId == 10 && stats.Flags == 2);
+    assert(stats.Allocs == 3 && stats.Frees == 1 && stats.UnknownFrees == 1);
+    assert(stats.LiveBlocks == 2 && stats.LiveBytes == 230 && stats.PeakBytes == 230);
+    assert(stats.Lifetimes.count() == 1 && stats.Lifetimes.max_value() == 10);
+    // Ages at 100 of the blocks born at 10 (moved by the realloc), 25 and 60
+    phnt::etl_histogram ages = heaps.live_ages(100);
+    assert(ages.count() == 3 && ages.min_value() == 40 && ages.max_value() == 90);
+
+    std::vector<std::pair<ULONG, uint64_t>> outstanding;
+    heaps.for_each_outstanding(
+        [&](ULONG process_id, ULONG stack_id, uint64_t bytes, uint64_t blocks) {
+            assert(blocks == 1 || process_id == 10);
+            if (stack_id != phnt::etl_no_stack)
+            {
+                assert(stacks.frames(stack_id).Frames[0] == 0xA);
+            }
+            outstanding.push_back({process_id, bytes});
+        });
+    assert(outstanding.size() == 2);
+    assert(outstanding[0].first == 10 && outstanding[0].second == 230);
+    assert(outstanding[1].first == 11 && outstanding[1].second == 8);
+
+    // Destroying the heap drops its blocks, the table keeps working
+    trace_writer destroy(0x1000);
+    destroy.begin_buffer(0);
+    for (uint64_t i = 1; i <= 2000; ++i)
+    {
+        event(destroy, PERFINFO_LOG_TYPE_HEAP_ALLOC, 100, 12, {heap, 16, i * 16, 0});
+        if (i % 50 == 0)
+        {
+            destroy.end_buffer();
+            destroy.begin_buffer(0);
+        }
+    }
+    event(destroy, PERFINFO_LOG_TYPE_HEAP_DESTROY, 200, 12, {heap});
+    destroy.end_buffer();
+    phnt::etl_reader destroy_reader(destroy.Data.data(), destroy.Data.size());
+    destroy_reader.for_each_event(
+        [&](const phnt::etl_event &event) { heaps.consume(event); });
+    assert(heaps.live_blocks() == 3);
+    assert(heaps.heaps().back().Destroyed && heaps.heaps().back().Allocs == 2000);
+    assert(heaps.heaps().back().PeakBytes == 2000 * 16);
+}
+
+static void check_etl_flow_table()
+{
+    auto tcp4 = [](trace_writer &writer,
+                   USHORT hook,
+                   LONGLONG time,
+                   ULONG process_id,
+                   ULONG size,
+                   USHORT remote_port) {
+        static const UCHAR remote[4] = {10, 0, 0, 2};
+        static const UCHAR local[4] = {10, 0, 0, 1};
+        WMI_TCPIP_V4 data = {};
+        data.ProcessId = process_id;
+        data.TransferSize = size;
+        memcpy(data.DestinationAddress, remote, sizeof(remote));
+        memcpy(data.SourceAddress, local, sizeof(local));
+        data.DestinationPort = (USHORT)(remote_port >> 8 | remote_port << 8);
+        data.SourcePort = 0x3930;
+        writer.system_event(hook, 0, process_id, time, &data, sizeof(data));
+    };
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_RECONNECT, 0, 20, 0, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_RECONNECT, 5, 20, 0, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_CONNECT, 30, 20, 0, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_SEND, 40, 20, 1000, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_RETRANSMIT, 50, 20, 0, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_RETRANSMIT, 55, 20, 0, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_FULLACK, 70, 20, 0, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_RECEIVE, 80, 20, 300, 443);
+    tcp4(writer, WMI_LOG_TYPE_TCPIP_SEND, 90, 20, 10, 80);
+    {
+        WMI_TCPIP_V6 data = {};
+        data.ProcessId = 21;
+        data.TransferSize = 500;
+        data.DestinationAddress[15] = 1;
+        data.SourceAddress[15] = 1;
+        writer.system_event(
+            WMI_LOG_TYPE_TCPIP_SEND_IPV6, 0, 21, 100, &data, sizeof(data));
+        writer.system_event(
+            WMI_LOG_TYPE_TCPIP_DISCONNECT_IPV6, 0, 21, 110, &data, sizeof(data));
+    }
+    {
+        WMI_UDP_V4 data = {20, 64, {8, 8, 8, 8}, {10, 0, 0, 1}, 0x3500, 0x3930};
+        writer.system_event(WMI_LOG_TYPE_UDP_SEND, 0, 20, 120, &data, sizeof(data));
+        writer.system_event(WMI_LOG_TYPE_UDP_RECEIVE, 0, 20, 130, &data, sizeof(data));
+    }
+    {
+        // Proto and FailureCode, without addresses
+        USHORT data[2] = {6, 0x2741};
+        writer.system_event(WMI_LOG_TYPE_TCPIP_FAIL, 0, 20, 140, data, sizeof(data));
+        writer.system_event(WMI_LOG_TYPE_TCPIP_FAIL_IPV6, 0, 21, 150, data, sizeof(data));
+    }
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_flow_table flows;
+    reader.for_each_event([&](const phnt::etl_event &event) { flows.consume(event); });
+    assert(flows.size() == 4);
+
+    std::vector<phnt::etl_flow_key> keys;
+    flows.for_each_flow([&](const phnt::etl_flow_key &key, const phnt::etl_flow_stats &) {
+        keys.push_back(key);
+    });
+    const phnt::etl_flow_key &https = keys[0];
+    assert(https.ipv4() && https.Protocol == 6);
+    assert(https.LocalPort == 0x3039 && https.RemotePort == 443);
+    assert(https.RemoteAddress[12] == 10 && https.RemoteAddress[15] == 2);
+    const phnt::etl_flow_stats *stats = flows.find(https);
+    assert(stats && stats->ProcessId == 20);
+    assert(
+        stats->SendBytes == 1000 && stats->SendPackets == 1 &&
+        stats->ReceiveBytes == 300);
+    assert(stats->Connects == 1 && stats->Reconnects == 2 && stats->Retransmits == 2);
+    assert(stats->FirstTimeStamp == 0 && stats->LastTimeStamp == 80);
+    assert(!keys[2].ipv4() && flows.find(keys[2])->Disconnects == 1);
+    assert(keys[3].Protocol == 17 && flows.find(keys[3])->SendBytes == 64);
+    assert(flows.find(keys[3])->ReceivePackets == 1);
+
+    // From the first RECONNECT and the first RETRANSMIT
+    assert(flows.connect_delays().count() == 1);
+    assert(flows.connect_delays().max_value() == 30);
+    assert(flows.retransmit_delays().count() == 1);
+    assert(flows.retransmit_delays().max_value() == 20);
+
+    const phnt::etl_flow_stats &process = flows.processes().at(20);
+    assert(process.SendBytes == 1074 && process.SendPackets == 3);
+    assert(process.ReceiveBytes == 364 && process.Connects == 1);
+    assert(flows.processes().at(21).SendBytes == 500);
+    assert(process.Failures == 1 && flows.processes().at(21).Failures == 1);
+    assert(flows.failures().size() == 1 && flows.failures().at(0x2741) == 2);
+
+    // The table grows and still finds every flow
+    trace_writer many(0x1000);
+    many.begin_buffer(0);
+    for (ULONG i = 0; i < 5000; ++i)
+    {
+        if (i % 64 == 63)
+        {
+            many.end_buffer();
+            many.begin_buffer(0);
+        }
+        tcp4(many, WMI_LOG_TYPE_TCPIP_SEND, 200 + i, 30, 1, (USHORT)(1000 + i));
+    }
+    many.end_buffer();
+    phnt::etl_reader many_reader(many.Data.data(), many.Data.size());
+    many_reader.for_each_event(
+        [&](const phnt::etl_event &event) { flows.consume(event); });
+    assert(flows.size() == 5004);
+    ULONG found = 0;
+    flows.for_each_flow([&](const phnt::etl_flow_key &key, const phnt::etl_flow_stats &) {
+        found += flows.find(key) != nullptr;
+    });
+    assert(found == 5004 && flows.processes().at(30).SendPackets == 5000);
+}
+
+static void check_etl_fault_analyzer()
+{
+    auto fault = [](trace_writer &writer,
+                    USHORT hook,
+                    LONGLONG time,
+                    ULONG thread_id,
+                    ULONG process_id,
+                    uint64_t address) {
+        uint64_t data[2] = {address, 0x401000};
+        writer.system_event(hook, thread_id, process_id, time, data, sizeof(data));
+    };
+    auto done = [](trace_writer &writer,
+                   LONGLONG time,
+                   ULONG thread_id,
+                   uint64_t address,
+                   uint64_t file_object,
+                   ULONG bytes) {
+        UCHAR data[8 + 8 + 8 + 4 + 4] = {};
+        memcpy(data + 8, &address, 8);
+        memcpy(data + 16, &file_object, 8);
+        memcpy(data + 24, &thread_id, 4);
+        memcpy(data + 28, &bytes, 4);
+        writer.system_event(PERFINFO_LOG_TYPE_HARDFAULT, 0, 0, time, data, sizeof(data));
+    };
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    {
+        WMI_THREAD_INFORMATION thread = {40, 9};
+        writer.system_event(
+            WMI_LOG_TYPE_THREAD_DC_START, 9, 40, 0, &thread, sizeof(thread));
+        std::vector<UCHAR> name(8);
+        uint64_t file_key = 0xF1;
+        memcpy(name.data(), &file_key, 8);
+        const char16_t path[] = u"C:\\app.exe";
+        name.insert(name.end(), (const UCHAR *)path, (const UCHAR *)path + sizeof(path));
+        writer.system_event(
+            PERFINFO_LOG_TYPE_FILENAME_RUNDOWN, 0, 0, 0, name.data(), (ULONG)name.size());
+    }
+    fault(writer, WMI_LOG_TYPE_PAGE_FAULT_DEMAND_ZERO, 5, 8, 40, 0x10000);
+    fault(writer, WMI_LOG_TYPE_PAGE_FAULT_TRANSITION, 12, 8, 40, 0x11000);
+    fault(writer, WMI_LOG_TYPE_PAGE_FAULT_HARD_PAGE_FAULT, 15, 8, 40, 0x400123);
+    done(writer, 45, 8, 0x400000, 0xF1, 4096);
+    fault(writer, WMI_LOG_TYPE_PAGE_FAULT_COPY_ON_WRITE, 50, 9, 41, 0x20000);
+    // Its fault was before the trace; the process comes from the thread rundown
+    done(writer, 60, 9, 0x500000, 0xF2, 8192);
+    fault(writer, WMI_LOG_TYPE_PAGE_FAULT_HARD_PAGE_FAULT, 70, 8, 40, 0x600000);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_file_resolver files;
+    phnt::etl_fault_analyzer faults(files, 10);
+    reader.for_each_event([&](const phnt::etl_event &event) {
+        files.consume(event);
+        faults.consume(event);
+    });
+    const size_t hard = (size_t)phnt::etl_fault_kind::Hard;
+    const size_t transition = (size_t)phnt::etl_fault_kind::Transition;
+    assert(faults.pending() == 1);
+
+    const phnt::etl_fault_stats &app = faults.processes().at(40);
+    assert(app.Faults[hard] == 3 && app.Faults[transition] == 1);
+    assert(app.Faults[(size_t)phnt::etl_fault_kind::DemandZero] == 1);
+    assert(app.HardBytes == 12288 && app.StallTime == 30);
+    const phnt::etl_fault_stats &other = faults.processes().at(41);
+    assert(other.Faults[(size_t)phnt::etl_fault_kind::CopyOnWrite] == 1);
+    assert(other.Faults[hard] == 0);
+
+    std::map<std::string, phnt::etl_fault_stats> paths;
+    faults.for_each_file([&](std::string_view path, const phnt::etl_fault_stats &stats) {
+        paths[std::string(path)] = stats;
+    });
+    assert(paths.size() == 2);
+    assert(
+        paths["C:\\app.exe"].Faults[hard] == 1 && paths["C:\\app.exe"].StallTime == 30);
+    assert(paths[""].HardBytes == 8192 && paths[""].StallTime == 0);
+
+    const phnt::etl_fault_heatmap &heatmap = faults.heatmap();
+    assert(heatmap.Start == 0 && heatmap.BucketWidth == 10);
+    assert(heatmap.Buckets.size() == 8);
+    assert(heatmap.Buckets[0].Faults[(size_t)phnt::etl_fault_kind::DemandZero] == 1);
+    assert(
+        heatmap.Buckets[1].Faults[transition] == 1 &&
+        heatmap.Buckets[1].Faults[hard] == 1);
+    assert(heatmap.Buckets[4].StallTime == 30);
+    assert(heatmap.Buckets[6].Faults[hard] == 1 && heatmap.Buckets[7].Faults[hard] == 1);
+}
+
+static void check_etl_threadpool()
+{
+    auto event = [](trace_writer &writer,
+                    USHORT hook,
+                    LONGLONG time,
+                    ULONG thread_id,
+                    std::vector<uint64_t> fields,
+                    ULONG last = 0) {
+        std::vector<UCHAR> data(
+            (const UCHAR *)fields.data(), (const UCHAR *)(fields.data() + fields.size()));
+        if (hook == PERFINFO_LOG_TYPE_TP_CALLBACK_CANCEL ||
+            hook == PERFINFO_LOG_TYPE_TP_POOL_TH_MIN_SET ||
+            hook == PERFINFO_LOG_TYPE_TP_POOL_TH_MAX_SET)
+        {
+            data.insert(data.end(), (const UCHAR *)&last, (const UCHAR *)(&last + 1));
+        }
+        writer.system_event(hook, thread_id, 50, time, data.data(), (ULONG)data.size());
+    };
+    const uint64_t pool = 0xA000, work = 0xB000, other = 0xC000;
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    event(writer, PERFINFO_LOG_TYPE_TP_POOL_CREATE, 0, 1, {pool});
+    event(writer, PERFINFO_LOG_TYPE_TP_POOL_TH_MIN_SET, 1, 1, {pool}, 2);
+    event(writer, PERFINFO_LOG_TYPE_TP_POOL_TH_MAX_SET, 2, 1, {pool}, 8);
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE, 10, 1, {pool, work, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE, 12, 1, {pool, work, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_START, 30, 2, {pool, work, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_STOP, 35, 2, {pool, work, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_START, 40, 3, {pool, work, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_STOP, 100, 3, {pool, work, 0, 0, 0});
+    // Queued before the trace
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_START, 110, 2, {pool, other, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_STOP, 111, 2, {pool, other, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE, 120, 1, {pool, other, 0, 0, 0});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE, 121, 1, {pool, other, 0, 0, 0});
+    event(
+        writer, PERFINFO_LOG_TYPE_TP_CALLBACK_CANCEL, 122, 1, {pool, other, 0, 0, 0}, 1);
+    event(writer, PERFINFO_LOG_TYPE_TP_POOL_TH_MAX_SET, 130, 1, {pool}, 16);
+    event(writer, PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION_BEGIN, 140, 2, {0xD000});
+    event(writer, PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION_END, 147, 2, {0xD000});
+    event(writer, PERFINFO_LOG_TYPE_TP_POOL_CLOSE, 150, 1, {pool});
+    event(writer, PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE, 160, 1, {pool, work, 0, 0, 0});
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_threadpool_analyzer threadpool;
+    reader.for_each_event(
+        [&](const phnt::etl_event &event) { threadpool.consume(event); });
+
+    // The closed pool and a new one at the same address
+    assert(threadpool.pools().size() == 2);
+    const phnt::etl_threadpool_stats &stats = threadpool.pools()[0];
+    assert(stats.ProcessId == 50 && stats.PoolId == pool);
+    assert(stats.Created == 0 && stats.Closed == 150);
+    assert(stats.Enqueued == 4 && stats.Started == 3 && stats.Cancelled == 1);
+    assert(stats.QueueDelays.count() == 2);
+    assert(stats.QueueDelays.min_value() == 20 && stats.QueueDelays.max_value() == 28);
+    assert(stats.ExecutionTimes.count() == 3);
+    assert(
+        stats.ExecutionTimes.min_value() == 1 && stats.ExecutionTimes.max_value() == 60);
+    assert(stats.Limits.size() == 3);
+    assert(stats.Limits[0].MinThreads == 2 && stats.Limits[0].MaxThreads == 0);
+    assert(stats.Limits[1].MinThreads == 2 && stats.Limits[1].MaxThreads == 8);
+    assert(stats.Limits[2].TimeStamp == 130 && stats.Limits[2].MaxThreads == 16);
+    assert(
+        threadpool.pools()[1].Created == INT64_MIN &&
+        threadpool.pools()[1].Enqueued == 1);
+    // The first enqueue of other and the one after the close
+    assert(threadpool.queued() == 2);
+    assert(threadpool.timer_expirations().count() == 1);
+    assert(threadpool.timer_expirations().max_value() == 7);
+}
+
+static void check_etl_handle_tracker()
+{
+    auto event = [](trace_writer &writer,
+                    USHORT hook,
+                    LONGLONG time,
+                    ULONG process_id,
+                    uint64_t object,
+                    std::vector<ULONG> fields,
+                    USHORT type) {
+        std::vector<UCHAR> data((const UCHAR *)&object, (const UCHAR *)(&object + 1));
+        data.insert(
+            data.end(),
+            (const UCHAR *)fields.data(),
+            (const UCHAR *)(fields.data() + fields.size()));
+        if (hook == PERFINFO_LOG_TYPE_DUPLICATE_HANDLE)
+        {
+            // ObjectType sits before SourceProcessId
+            data.insert(data.end() - 4, (const UCHAR *)&type, (const UCHAR *)(&type + 1));
+        }
+        else
+        {
+            data.insert(data.end(), (const UCHAR *)&type, (const UCHAR *)(&type + 1));
+        }
+        writer.system_event(hook, 1, process_id, time, data.data(), (ULONG)data.size());
+    };
+    auto type_name = [](trace_writer &writer, USHORT type, const wchar_t *name) {
+        std::vector<UCHAR> data(4);
+        memcpy(data.data(), &type, sizeof(type));
+        for (; *name; ++name)
+        {
+            data.push_back((UCHAR)*name);
+            data.push_back(0);
+        }
+        data.insert(data.end(), 2, 0);
+        writer.system_event(
+            PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_START,
+            1,
+            4,
+            0,
+            data.data(),
+            (ULONG)data.size());
+    };
+    auto stack =
+        [](trace_writer &writer, LONGLONG time, ULONG process_id, uint64_t frame) {
+            writer.stack_walk(1, process_id, time, {frame});
+        };
+    const uint64_t file = 0xF000, event_object = 0xE000, key = 0xD000;
+    const USHORT file_type = 37, event_type = 16, key_type = 40;
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    type_name(writer, file_type, L"File");
+    type_name(writer, event_type, L"Event");
+    // Open before the trace
+    event(
+        writer,
+        PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_START,
+        0,
+        4,
+        key,
+        {20, 0x10},
+        key_type);
+    event(writer, PERFINFO_LOG_TYPE_CREATE_OBJECT, 10, 20, file, {}, file_type);
+    event(writer, PERFINFO_LOG_TYPE_CREATE_HANDLE, 10, 20, file, {0x40}, file_type);
+    stack(writer, 10, 20, 0xA);
+    event(writer, PERFINFO_LOG_TYPE_REFERENCE_OBJECT, 11, 20, file, {0, 2}, 0);
+    event(writer, PERFINFO_LOG_TYPE_DEREFERENCE_OBJECT, 12, 20, file, {0, 1}, 0);
+    // Into process 21 as handle 0x80
+    event(
+        writer,
+        PERFINFO_LOG_TYPE_DUPLICATE_HANDLE,
+        20,
+        20,
+        file,
+        {0x40, 0x80, 21, 20},
+        file_type);
+    stack(writer, 20, 20, 0xB);
+    event(
+        writer,
+        PERFINFO_LOG_TYPE_CREATE_HANDLE,
+        30,
+        20,
+        event_object,
+        {0x44},
+        event_type);
+    event(
+        writer,
+        PERFINFO_LOG_TYPE_CREATE_HANDLE,
+        31,
+        20,
+        event_object,
+        {0x48},
+        event_type);
+    event(
+        writer,
+        PERFINFO_LOG_TYPE_CREATE_HANDLE,
+        32,
+        20,
+        event_object,
+        {ETW_KERNEL_HANDLE_MASK | 0x4},
+        event_type);
+    event(writer, PERFINFO_LOG_TYPE_CLOSE_HANDLE, 40, 20, file, {0x40}, file_type);
+    event(
+        writer, PERFINFO_LOG_TYPE_CLOSE_HANDLE, 41, 20, event_object, {0x44}, event_type);
+    event(writer, PERFINFO_LOG_TYPE_CLOSE_HANDLE, 42, 20, key, {0x99C}, key_type);
+    event(writer, PERFINFO_LOG_TYPE_CLOSE_HANDLE, 43, 20, key, {0x10}, key_type);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_stack_store stacks(64);
+    phnt::etl_stack_attachments attachments;
+    reader.for_each_event(
+        [&](const phnt::etl_event &event) { attachments.consume(stacks, event); });
+    attachments.sort();
+    phnt::etl_handle_tracker handles(&attachments);
+    reader.for_each_event([&](const phnt::etl_event &event) { handles.consume(event); });
+
+    // 0x80 in 21, 0x48 in 20 and the kernel handle
+    assert(handles.live_handles() == 3);
+    const phnt::etl_handle_stats &process = handles.processes().at(20);
+    assert(process.Created == 3 && process.Closed == 3 && process.UnknownCloses == 1);
+    assert(process.LiveHandles == 1 && process.PeakHandles == 4);
+    assert(handles.processes().at(21).Duplicated == 1);
+    assert(handles.processes().at(21).LiveHandles == 1);
+    assert(
+        handles.processes().at(phnt::etl_handle_tracker::system_process).LiveHandles ==
+        1);
+
+    const phnt::etl_object_refs *refs = handles.object(file);
+    assert(refs && refs->Created && refs->ObjectType == file_type);
+    assert(refs->Handles == 1 && refs->References == 1);
+    assert(handles.object(event_object)->Handles == 2);
+    assert(handles.object(key)->Handles == 0);
+    assert(!handles.object(0x1234));
+
+    std::vector<std::string> outstanding;
+    handles.for_each_outstanding(
+        [&](ULONG process_id, std::string_view type, ULONG stack_id, uint64_t count) {
+            assert(count == 1);
+            if (process_id == 21)
+            {
+                assert(type == "File" && stacks.frames(stack_id).Frames[0] == 0xB);
+            }
+            else
+            {
+                assert(type == "Event");
+            }
+            outstanding.push_back(std::string(type));
+        });
+    assert(outstanding.size() == 3);
+
+    // The tables grow and shrink without losing entries
+    trace_writer churn(0x1000);
+    churn.begin_buffer(0);
+    for (ULONG i = 1; i <= 3000; ++i)
+    {
+        event(
+            churn,
+            PERFINFO_LOG_TYPE_CREATE_HANDLE,
+            100,
+            30,
+            0x100000 + i * 16,
+            {i * 4},
+            event_type);
+        if (i % 50 == 0)
+        {
+            churn.end_buffer();
+            churn.begin_buffer(0);
+        }
+    }
+    for (ULONG i = 1; i <= 3000; i += 2)
+    {
+        event(
+            churn,
+            PERFINFO_LOG_TYPE_CLOSE_HANDLE,
+            200,
+            30,
+            0x100000 + i * 16,
+            {i * 4},
+            event_type);
+        event(
+            churn,
+            PERFINFO_LOG_TYPE_DELETE_OBJECT,
+            200,
+            30,
+            0x100000 + i * 16,
+            {},
+            event_type);
+        if (i % 50 == 49)
+        {
+            churn.end_buffer();
+            churn.begin_buffer(0);
+        }
+    }
+    churn.end_buffer();
+    phnt::etl_reader churn_reader(churn.Data.data(), churn.Data.size());
+    churn_reader.for_each_event(
+        [&](const phnt::etl_event &event) { handles.consume(event); });
+    assert(handles.live_handles() == 3 + 1500);
+    assert(handles.processes().at(30).PeakHandles == 3000);
+    for (ULONG i = 1; i <= 3000; ++i)
+    {
+        const phnt::etl_object_refs *object = handles.object(0x100000 + i * 16);
+        assert((object != nullptr) == (i % 2 == 0));
+        assert(!object || object->Handles == 1);
+    }
+}
+
+static void check_etl_dpc()
+{
+    auto run = [](trace_writer &writer,
+                  USHORT hook,
+                  LONGLONG start,
+                  LONGLONG end,
+                  uint64_t routine,
+                  USHORT vector = 0) {
+        UCHAR data[8 + 8 + 4] = {};
+        memcpy(data, &start, sizeof(start));
+        memcpy(data + 8, &routine, sizeof(routine));
+        memcpy(data + 17, &vector, sizeof(vector));
+        writer.perfinfo_event(
+            hook, end, data, hook == PERFINFO_LOG_TYPE_INTERRUPT ? 20 : 16);
+    };
+    auto queue = [](trace_writer &writer,
+                    USHORT hook,
+                    LONGLONG time,
+                    uint64_t first,
+                    uint64_t second) {
+        uint64_t data[2] = {first, second};
+        writer.perfinfo_event(hook, time, data, sizeof(data));
+    };
+    const uint64_t dpc = 0xFFFFF80000001000, isr = 0xFFFFF80000002000;
+    const uint64_t timer = 0xFFFFF80000003000, key = 0xFFFF800000100000;
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    queue(writer, PERFINFO_LOG_TYPE_DPC_ENQUEUE, 100, key, 0);
+    writer.perfinfo_event(PERFINFO_LOG_TYPE_CLOCK_INTERRUPT, 150);
+    writer.perfinfo_event(PERFINFO_LOG_TYPE_CLOCK_INTERRUPT, 306);
+    writer.end_buffer();
+    writer.begin_buffer(1);
+    run(writer, PERFINFO_LOG_TYPE_INTERRUPT, 90, 95, isr, 0x51);
+    // Queued on processor 0, runs on 1
+    queue(writer, PERFINFO_LOG_TYPE_DPC_EXECUTION, 130, dpc, key);
+    run(writer, PERFINFO_LOG_TYPE_DPC, 130, 170, dpc);
+    run(writer, PERFINFO_LOG_TYPE_DPC, 200, 210, dpc);
+    run(writer, PERFINFO_LOG_TYPE_TIMERDPC, 300, 301, timer);
+    writer.perfinfo_event(PERFINFO_LOG_TYPE_CLOCK_INTERRUPT, 310);
+    writer.end_buffer();
+    writer.begin_buffer(0);
+    run(writer, PERFINFO_LOG_TYPE_DPC, 400, 500, dpc);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_dpc_analyzer dpcs;
+    reader.for_each_event([&](const phnt::etl_event &event) { dpcs.consume(event); });
+
+    assert(dpcs.routines().size() == 3 && dpcs.processors().size() == 2);
+    const phnt::etl_dpc_routine_stats *routine = dpcs.routine(dpc);
+    assert(routine && routine->Kind == phnt::etl_dpc_kind::Dpc);
+    assert(routine->TotalTime == 150 && routine->ExecutionTimes.count() == 3);
+    assert(routine->ExecutionTimes.min_value() == 10);
+    assert(routine->ExecutionTimes.max_value() == 100);
+    assert(routine->ExecutionTimes.percentile(50) >= 40);
+    assert(routine->QueueDelays.count() == 1 && routine->QueueDelays.max_value() == 30);
+    assert(routine->ProcessorTime.size() == 2);
+    assert(routine->ProcessorTime[0] == 100 && routine->ProcessorTime[1] == 50);
+    const phnt::etl_dpc_routine_stats *interrupt = dpcs.routine(isr);
+    assert(interrupt && interrupt->Kind == phnt::etl_dpc_kind::Interrupt);
+    assert(interrupt->Vector == 0x51 && interrupt->TotalTime == 5);
+    assert(dpcs.routine(timer)->Kind == phnt::etl_dpc_kind::TimerDpc);
+    assert(!dpcs.routine(key));
+
+    const phnt::etl_dpc_processor_stats &cpu0 = dpcs.processors()[0];
+    const phnt::etl_dpc_processor_stats &cpu1 = dpcs.processors()[1];
+    assert(cpu0.DpcTimes.count() == 1 && cpu0.QueueDelays.count() == 0);
+    assert(cpu1.DpcTimes.count() == 3 && cpu1.InterruptTimes.count() == 1);
+    assert(cpu1.QueueDelays.count() == 1);
+    assert(cpu0.ClockInterrupts == 2 && cpu0.ClockIntervals.max_value() == 156);
+    assert(cpu1.ClockInterrupts == 1 && cpu1.ClockIntervals.count() == 0);
+
+    // Two decoders merge into the totals of one
+    phnt::etl_dpc_analyzer first, second, merged;
+    int index = 0;
+    reader.for_each_event([&](const phnt::etl_event &event) {
+        (index++ % 2 ? first : second).consume(event);
+    });
+    merged.merge(first);
+    merged.merge(second);
+    assert(merged.routine(dpc)->TotalTime == 150);
+    assert(merged.routine(dpc)->ProcessorTime[0] == 100);
+    assert(merged.processors()[1].DpcTimes.count() == 3);
+    assert(merged.processors()[0].ClockInterrupts == 2);
+}
+
+static void check_etl_wait_graph()
+{
+    auto cswitch = [](trace_writer &writer,
+                      LONGLONG time,
+                      ULONG new_thread,
+                      ULONG old_thread,
+                      UCHAR state,
+                      UCHAR reason) {
+        WMI_CONTEXTSWAP info = {};
+        info.NewThreadId = new_thread;
+        info.OldThreadId = old_thread;
+        info.OldThreadState = state;
+        info.OldThreadWaitReason = reason;
+        writer.system_event(
+            PERFINFO_LOG_TYPE_CONTEXTSWAP, 0, 0, time, &info, sizeof(info));
+    };
+    auto ready = [](trace_writer &writer,
+                    LONGLONG time,
+                    ULONG readier,
+                    ULONG readied,
+                    UCHAR flags = 0) {
+        ETW_READY_THREAD_EVENT info = {};
+        info.ThreadId = readied;
+        info.Flags = flags;
+        writer.system_event(
+            PERFINFO_LOG_TYPE_READY_THREAD, readier, 0, time, &info, sizeof(info));
+    };
+    auto thread = [](trace_writer &writer, ULONG process_id, ULONG thread_id) {
+        WMI_THREAD_INFORMATION info = {process_id, thread_id};
+        writer.system_event(WMI_LOG_TYPE_THREAD_DC_START, 0, 0, 0, &info, sizeof(info));
+    };
+
+    // 300 readies 200 out of its wait, 200 readies 100 and is preempted for it
+    trace_writer writer;
+    writer.begin_buffer(0);
+    thread(writer, 1000, 100);
+    thread(writer, 2000, 200);
+    thread(writer, 3000, 300);
+    cswitch(writer, 10, 100, 0, Running, Executive);
+    cswitch(writer, 20, 0, 100, Waiting, WrQueue);
+    writer.end_buffer();
+    writer.begin_buffer(1);
+    cswitch(writer, 2, 200, 0, Running, Executive);
+    cswitch(writer, 5, 0, 200, Waiting, UserRequest);
+    cswitch(writer, 12, 200, 0, Running, Executive);
+    ready(writer, 25, 200, 100);
+    cswitch(writer, 30, 100, 200, Ready, Executive);
+    writer.end_buffer();
+    writer.begin_buffer(2);
+    cswitch(writer, 1, 300, 0, Running, Executive);
+    ready(writer, 11, 300, 200);
+    // From a DPC, no thread to follow
+    ready(writer, 15, 300, 500, 1);
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_merger merger(reader);
+    phnt::etl_wait_graph graph;
+    bool valid = merger.for_each_event(
+        [&](const phnt::etl_event &event) { graph.consume(event); });
+    assert(valid);
+    graph.finish(40);
+
+    std::vector<phnt::etl_path_segment> path = graph.critical_path(100, 0, 40);
+    struct expected
+    {
+        ULONG ThreadId;
+        ULONG ProcessId;
+        int64_t Start;
+        int64_t End;
+        UCHAR State;
+    };
+    const expected segments[] = {
+        {300, 3000, 0, 1, Initialized},
+        {300, 3000, 1, 11, Running},
+        {200, 2000, 11, 12, Ready},
+        {200, 2000, 12, 25, Running},
+        {100, 1000, 25, 30, Ready},
+        {100, 1000, 30, 40, Running},
+    };
+    assert(path.size() == sizeof(segments) / sizeof(segments[0]));
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        assert(path[i].ThreadId == segments[i].ThreadId);
+        assert(path[i].ProcessId == segments[i].ProcessId);
+        assert(path[i].Start == segments[i].Start && path[i].End == segments[i].End);
+        assert(path[i].State == segments[i].State);
+    }
+    assert(path[3].Processor == 1 && path[1].Processor == 2);
+
+    // Ending inside the wait, nothing readied it yet
+    path = graph.critical_path(100, 15, 22);
+    assert(path.size() == 2);
+    assert(path[0].State == Running && path[0].Start == 15 && path[0].End == 20);
+    assert(path[1].State == Waiting && path[1].WaitReason == WrQueue);
+    assert(path[1].Start == 20 && path[1].End == 22);
+
+    std::vector<ULONG> wakees;
+    graph.for_each_wakee(300, 0, 40, [&](const phnt::etl_ready_edge &edge) {
+        wakees.push_back(edge.Readied);
+    });
+    assert(wakees.size() == 1 && wakees[0] == 200);
+    graph.for_each_wakee(
+        300, 12, 40, [&](const phnt::etl_ready_edge &) { assert(false); });
+    ULONG wakers = 0;
+    graph.for_each_waker(500, 0, 40, [&](const phnt::etl_ready_edge &edge) {
+        assert(edge.Readier == phnt::etl_no_thread && edge.TimeStamp == 15);
+        ++wakers;
+    });
+    graph.for_each_waker(100, 0, 40, [&](const phnt::etl_ready_edge &edge) {
+        assert(edge.Readier == 200 && edge.TimeStamp == 25);
+        ++wakers;
+    });
+    assert(wakers == 2);
+}
+
+static void check_etl_syscall()
+{
+    auto cswitch = [](trace_writer &writer, LONGLONG time, ULONG new_thread) {
+        WMI_CONTEXTSWAP info = {};
+        info.NewThreadId = new_thread;
+        info.OldThreadState = Waiting;
+        writer.system_event(
+            PERFINFO_LOG_TYPE_CONTEXTSWAP, 0, 0, time, &info, sizeof(info));
+    };
+    auto enter = [](trace_writer &writer, LONGLONG time, uint64_t service) {
+        writer.perfinfo_event(
+            PERFINFO_LOG_TYPE_SYSCALL_ENTER, time, &service, sizeof(service));
+    };
+    auto exit = [](trace_writer &writer, LONGLONG time, ULONG status) {
+        writer.perfinfo_event(
+            PERFINFO_LOG_TYPE_SYSCALL_EXIT, time, &status, sizeof(status));
+    };
+    const uint64_t kernel = 0xFFFFF80000000000;
+
+    // The table is sorted and takes both prefixes
+    assert(phnt::etl_syscall_count > 400);
+    USHORT close = phnt::etl_syscall_id("NtClose");
+    assert(close != phnt::etl_no_syscall && phnt::etl_syscall_id("ZwClose") == close);
+    assert(std::string(phnt::etl_syscall_names[close]) == "NtClose");
+    assert(phnt::etl_syscall_id("NtNotAService") == phnt::etl_no_syscall);
+
+    phnt::etl_syscall_map built(0x100000);
+    assert(built.add(0x2000, "ZwCreateFile", 0x55));
+    assert(built.add(0x1000, "NtClose", 0xF));
+    assert(!built.add(0x3000, "NtNotAService"));
+    std::vector<UCHAR> file = built.save();
+    assert(file.size() == sizeof(phnt::etl_syscall_map_header) + 2 * 8);
+    phnt::etl_syscall_map map;
+    assert(map.load(file.data(), file.size()));
+    assert(!map.load(file.data(), file.size() - 1));
+    // Written with another service table of the same size
+    std::vector<UCHAR> renamed = file;
+    renamed[offsetof(phnt::etl_syscall_map_header, NameHash)] ^= 1;
+    assert(!map.load(renamed.data(), renamed.size()));
+    assert(map.header().ImageSize == 0x100000 && map.service(0x1000) == close);
+    assert(map.service_of_number(0x55) == phnt::etl_syscall_id("NtCreateFile"));
+    assert(map.service(0x1001) == phnt::etl_no_syscall);
+
+    trace_writer writer;
+    writer.begin_buffer(0);
+    WMI_THREAD_INFORMATION thread = {100, 7};
+    writer.system_event(WMI_LOG_TYPE_THREAD_DC_START, 0, 0, 0, &thread, sizeof(thread));
+    cswitch(writer, 5, 7);
+    enter(writer, 10, kernel + 0x1000);
+    exit(writer, 15, 0);
+    enter(writer, 20, kernel + 0x2000);
+    exit(writer, 50, 0xC0000008);
+    enter(writer, 60, kernel + 0x5000);
+    exit(writer, 61, 0);
+    writer.end_buffer();
+    writer.begin_buffer(1);
+    cswitch(writer, 5, 8);
+    enter(writer, 12, kernel + 0x1000);
+    // Thread 8 waits in the call, thread 9 returns from one made before the trace
+    cswitch(writer, 13, 9);
+    exit(writer, 14, 0);
+    cswitch(writer, 16, 8);
+    exit(writer, 18, 0);
+    enter(writer, 20, 0x7000);
+    exit(writer, 21, 0);
+    writer.end_buffer();
+
+    phnt::etl_image_map images;
+    images.load(0, kernel, 0x100000, INT64_MIN, "\\SystemRoot\\system32\\ntoskrnl.exe");
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_merger merger(reader);
+    phnt::etl_syscall_profiler profiler(&images, &map);
+    bool valid = merger.for_each_event(
+        [&](const phnt::etl_event &event) { profiler.consume(event); });
+    assert(valid);
+
+    assert(profiler.unmatched() == 1 && profiler.services().size() == 4);
+    std::map<std::string, const phnt::etl_syscall_stats *> services;
+    for (const phnt::etl_syscall_stats &stats : profiler.services())
+    {
+        services[profiler.name(stats)] = &stats;
+    }
+    const phnt::etl_syscall_stats *stats = services.at("NtClose");
+    assert(stats->Calls == 2 && stats->Failures == 0 && stats->TotalTime == 11);
+    assert(stats->Latencies.min_value() == 5 && stats->Latencies.max_value() == 6);
+    stats = services.at("NtCreateFile");
+    assert(stats->Calls == 1 && stats->Failures == 1 && stats->TotalTime == 30);
+    assert(services.at("ntoskrnl.exe+0x5000")->Calls == 1);
+    assert(services.at("0x7000")->Calls == 1);
+
+    uint64_t known = 0, unknown = 0;
+    profiler.for_each_process([&](ULONG process_id,
+                                  const phnt::etl_syscall_stats &,
+                                  uint64_t calls,
+                                  uint64_t time) {
+        (process_id == 100 ? known : unknown) += calls;
+        assert(process_id == 100 || process_id == phnt::etl_no_process);
+        assert(time <= 30);
+    });
+    assert(known == 3 && unknown == 2);
+
+    // Without the map, or with the map of another build, the RVA is shown
+    phnt::etl_syscall_map other(0x200000);
+    other.add(0x1000, "NtClose");
+    phnt::etl_syscall_profiler unnamed(&images, &other);
+    phnt::etl_merger again(reader);
+    again.for_each_event([&](const phnt::etl_event &event) { unnamed.consume(event); });
+    assert(!unnamed.services().empty());
+    assert(unnamed.name(unnamed.services()[0]) == "ntoskrnl.exe+0x1000");
+}
+
+static void check_etl_registry()
+{
+    // WMI_REGISTRY of 64 bit pointers: InitialTime, Status, Index, Kcb and Name
+    auto registry = [](trace_writer &writer,
+                       UCHAR type,
+                       LONGLONG start,
+                       LONGLONG end,
+                       ULONG status,
+                       uint64_t kcb,
+                       const char16_t *name) {
+        std::vector<UCHAR> data(24);
+        memcpy(data.data(), &start, sizeof(start));
+        memcpy(data.data() + 8, &status, sizeof(status));
+        memcpy(data.data() + 16, &kcb, sizeof(kcb));
+        const UCHAR *text = (const UCHAR *)name;
+        size_t length = std::char_traits<char16_t>::length(name) + 1;
+        data.insert(data.end(), text, text + length * sizeof(char16_t));
+        writer.system_event(
+            EVENT_TRACE_GROUP_REGISTRY | type,
+            1,
+            4,
+            end,
+            data.data(),
+            (ULONG)data.size());
+    };
+    auto notify = [](trace_writer &writer,
+                     USHORT hook,
+                     LONGLONG time,
+                     uint64_t notification,
+                     uint64_t kcb) {
+        uint64_t data[2] = {notification, kcb};
+        writer.system_event(hook, 1, 4, time, data, sizeof(data));
+    };
+    const uint64_t software = 0xA0, windows = 0xB0, user = 0xC0, lost = 0xD0;
+    const ULONG not_found = 0xC0000034;
+
+    trace_writer writer(0x1000);
+    writer.begin_buffer(0);
+    registry(
+        writer,
+        EVENT_TRACE_TYPE_REGKCBRUNDOWNBEGIN,
+        0,
+        0,
+        0,
+        software,
+        u"\\REGISTRY\\MACHINE\\SOFTWARE");
+    registry(
+        writer, EVENT_TRACE_TYPE_REGOPEN, 10, 15, 0, software, u"Microsoft\\Windows");
+    // Shares the Microsoft component without case, the edge is split
+    registry(
+        writer,
+        EVENT_TRACE_TYPE_REGOPEN,
+        20,
+        22,
+        not_found,
+        software,
+        u"microsoft\\Office");
+    registry(
+        writer,
+        EVENT_TRACE_TYPE_REGKCBCREATE,
+        23,
+        23,
+        0,
+        windows,
+        u"\\REGISTRY\\MACHINE\\SOFTWARE\\Microsoft\\Windows");
+    registry(writer, EVENT_TRACE_TYPE_REGQUERYVALUE, 30, 40, 0, windows, u"Version");
+    notify(writer, PERFINFO_LOG_TYPE_REG_NOTIF_REGISTER, 41, 0xE0, windows);
+    notify(writer, PERFINFO_LOG_TYPE_REG_NOTIF_DELIVER, 42, 0xE0, 0);
+    // Named by the rundown at the end of the trace
+    registry(writer, EVENT_TRACE_TYPE_REGSETVALUE, 50, 51, 0, user, u"Value");
+    registry(writer, EVENT_TRACE_TYPE_REGQUERYVALUE, 52, 54, 0, lost, u"Value");
+    registry(writer, EVENT_TRACE_TYPE_REGKCBDELETE, 55, 55, 0, lost, u"");
+    registry(
+        writer, EVENT_TRACE_TYPE_REGQUERY, 56, 57, 0, 0, u"\\REGISTRY\\MACHINE\\SYSTEM");
+    WMI_TXR txr = {};
+    txr.InitialTime = 60;
+    std::vector<UCHAR> commit((const UCHAR *)&txr, (const UCHAR *)txr.Hive);
+    const char16_t hive[] = u"\\REGISTRY\\MACHINE\\SOFTWARE";
+    commit.insert(commit.end(), (const UCHAR *)hive, (const UCHAR *)hive + sizeof(hive));
+    writer.system_event(
+        EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGCOMMIT,
+        1,
+        4,
+        70,
+        commit.data(),
+        (ULONG)commit.size());
+    // The address of the deleted KCB is reused by another key
+    registry(writer, EVENT_TRACE_TYPE_REGKCBDELETE, 80, 80, 0, windows, u"");
+    registry(
+        writer,
+        EVENT_TRACE_TYPE_REGKCBCREATE,
+        81,
+        81,
+        0,
+        windows,
+        u"\\REGISTRY\\MACHINE\\SYSTEM\\Setup");
+    registry(writer, EVENT_TRACE_TYPE_REGQUERY, 82, 90, 0, windows, u"");
+    registry(
+        writer,
+        EVENT_TRACE_TYPE_REGKCBRUNDOWNEND,
+        100,
+        100,
+        0,
+        user,
+        u"\\REGISTRY\\USER\\S-1-5-18");
+    writer.end_buffer();
+
+    phnt::etl_reader reader(writer.Data.data(), writer.Data.size());
+    phnt::etl_registry_analyzer keys;
+    reader.for_each_event([&](const phnt::etl_event &event) { keys.consume(event); });
+    keys.finish();
+
+    const size_t open = (size_t)phnt::etl_registry_op::Open;
+    const size_t query = (size_t)phnt::etl_registry_op::Query;
+    const size_t query_value = (size_t)phnt::etl_registry_op::QueryValue;
+    phnt::etl_registry_stats stats = keys.rollup("\\REGISTRY\\MACHINE\\SOFTWARE");
+    assert(stats.Count[open] == 2 && stats.Failures[open] == 1);
+    assert(stats.Duration[open] == 7 && stats.MaxDuration[open] == 5);
+    assert(stats.Count[query_value] == 1 && stats.Duration[query_value] == 10);
+    assert(stats.Count[(size_t)phnt::etl_registry_op::Commit] == 1);
+    assert(stats.Duration[(size_t)phnt::etl_registry_op::Commit] == 10);
+    assert(stats.Count[(size_t)phnt::etl_registry_op::NotifyRegister] == 1);
+    assert(stats.Count[(size_t)phnt::etl_registry_op::NotifyDeliver] == 1);
+    stats = keys.rollup("registry\\machine\\software\\MICROSOFT\\");
+    assert(stats.Count[open] == 2 && stats.Count[query_value] == 1);
+    // Whole components only
+    stats = keys.rollup("\\REGISTRY\\MACHINE\\SOFT");
+    assert(stats.Count[open] == 0 && stats.Count[query_value] == 0);
+    stats = keys.rollup("\\REGISTRY\\MACHINE\\SYSTEM");
+    assert(stats.Count[query] == 2 && stats.Duration[query] == 9);
+    assert(
+        keys.rollup("\\REGISTRY\\USER").Count[(size_t)phnt::etl_registry_op::SetValue] ==
+        1);
+    stats = keys.rollup("");
+    assert(stats.Count[open] == 2 && stats.Count[query_value] == 2);
+    assert(stats.Count[query] == 2);
+
+    std::map<std::string, phnt::etl_registry_stats> paths;
+    keys.for_each_key([&](const std::string &path, const phnt::etl_registry_stats &key) {
+        paths[path] = key;
+    });
+    assert(paths.size() == 7);
+    assert(
+        paths.at("\\REGISTRY\\MACHINE\\SOFTWARE\\Microsoft\\Windows").Count[open] == 1);
+    assert(paths.at("\\REGISTRY\\MACHINE\\SOFTWARE\\Microsoft\\Office").Count[open] == 1);
+    // The KCB deleted without a name
+    assert(paths.at("").Count[query_value] == 1);
+    assert(keys.name(windows) == "\\REGISTRY\\MACHINE\\SYSTEM\\Setup");
+    assert(keys.name(lost).empty());
+    assert(keys.latencies(phnt::etl_registry_op::Open).count() == 2);
+    assert(keys.latencies(phnt::etl_registry_op::Open).max_value() == 5);
+
+    // The split left a node at the shared prefix
+    const phnt::etl_registry_tree &tree = keys.tree();
+    ULONG microsoft = tree.find("\\REGISTRY\\MACHINE\\SOFTWARE\\MICROSOFT");
+    assert(microsoft != phnt::etl_no_id);
+    assert(tree.path(microsoft) == "\\REGISTRY\\MACHINE\\SOFTWARE\\Microsoft");
+    ULONG children = 0;
+    tree.for_each_child(microsoft, [&](ULONG) { ++children; });
+    assert(children == 2);
+    assert(tree.find("\\REGISTRY\\MACHINE\\HARDWARE") == phnt::etl_no_id);
+}
+
+static void check_etl_file(const char *path)
+{
+    trace_writer writer;
+    writer.begin_buffer(0);
+    writer.system_event(EVENT_TRACE_GROUP_THREAD, 1, 2, 3);
+    writer.end_buffer();
+    FILE *file = fopen(path, "wb");
+    assert(file);
+    fwrite(writer.Data.data(), 1, writer.Data.size(), file);
+    fclose(file);
+
+    phnt::etl_file mapped(path);
+    assert(mapped.is_open());
+    assert(mapped.size() == writer.Data.size());
+    phnt::etl_reader reader(mapped.data(), mapped.size());
+    ULONG count = 0;
+    reader.for_each_event([&](const phnt::etl_event &event) {
+        assert(event.TimeStamp == 3);
+        ++count;
+    });
+    assert(count == 1);
+    remove(path);
+}
+
+// etl-test file.etl
+// The file is scratch space for the mapping check.
+int main(int argc, char *argv[])
+{
+    check_etl_reader();
+    check_etl_reader_malformed();
+    check_etl_reader_parallel();
+    check_etl_dispatch();
+    check_etl_merger();
+    check_etl_time_index();
+    check_etl_cswitch_timeline();
+    check_etl_ccswap();
+    check_etl_stack_store();
+    check_etl_profile();
+    check_etl_histogram();
+    check_etl_diskio();
+    check_etl_file_resolver();
+    check_etl_hash_map();
+    check_etl_heap();
+    check_etl_flow_table();
+    check_etl_fault_analyzer();
+    check_etl_threadpool();
+    check_etl_handle_tracker();
+    check_etl_dpc();
+    check_etl_wait_graph();
+    check_etl_syscall();
+    check_etl_registry();
+    check_etl_file(argc > 1 ? argv[1] : "etl-test.etl");
+    printf("etl-test passed\n");
+    return 0;
+}
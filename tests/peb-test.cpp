@@ -8,8 +8,10 @@
 #include "ntpebteb.h"
 
 #include "ntldr.h"
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 #include "ntpsapi.h"
 #include "ntrtl.h"
+#endif
 
 void check_peb_BitField()
 {
@@ -95,6 +97,7 @@ void test_peb_LDR_DATA_TABLE_ENTRY()
     check_offsetof(offsetof(LDR_DATA_TABLE_ENTRY, SigningLevel), 0xA4, 0x011C);
 }
 
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
 void test_PEB_LDR_DATA()
 {
     check_offsetof(offsetof(PEB_LDR_DATA, Length), 0x00, 0x00);
@@ -175,6 +178,7 @@ void test_RTL_USER_PROCESS_PARAMETERS()
         0x0448,
         alignof(RTL_USER_PROCESS_PARAMETERS));
 }
+#endif
 
 void check_peb_CrossProcessFlags()
 {
@@ -222,10 +226,6 @@ void check_peb_CrossProcessFlags()
 
 void test_peb()
 {
-    printf("alignof(LARGE_INTEGER):0x%x\n", (int)alignof(LARGE_INTEGER));
-    printf("alignof(PEB):0x%x\n", (int)alignof(PEB));
-    printf("sizeof(PEB):0x%x\n", (int)sizeof(PEB));
-
     {
         PEB peb{};
         peb.InheritedAddressSpace = 1;
@@ -242,9 +242,15 @@ void test_peb()
 #endif
     check_offsetof(offsetof(PEB, Mutant), 0x04, 0x08);
     check_offsetof(offsetof(PEB, ImageBaseAddress), 0x08, 0x10);
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
     test_PEB_LDR_DATA();
+#else
+    test_peb_LDR_DATA_TABLE_ENTRY();
+#endif
     check_offsetof(offsetof(PEB, Ldr), 0x0C, 0x18);
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
     test_RTL_USER_PROCESS_PARAMETERS();
+#endif
     check_offsetof(offsetof(PEB, ProcessParameters), 0x10, 0x20);
     check_offsetof(offsetof(PEB, SubSystemData), 0x14, 0x28);
     check_offsetof(offsetof(PEB, ProcessHeap), 0x18, 0x30);
@@ -0,0 +1,174 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test.h"
+
+#include "win-polyfill-reflection.h"
+
+#ifndef TEST_LAYOUT_SPEC
+#include <string.h>
+#endif
+
+template <class T> constexpr const phnt::field_info &find_field(const char *name)
+{
+    const phnt::field_info *field = phnt::struct_info<T>::fields;
+    for (; field->Name; ++field)
+    {
+        const char *a = field->Name;
+        const char *b = name;
+        while (*a && *a == *b)
+        {
+            ++a;
+            ++b;
+        }
+        if (*a == *b)
+        {
+            break;
+        }
+    }
+    return *field;
+}
+
+// Only static_asserts, which the compile-only layout build checks without calling it
+[[maybe_unused]] static void check_reflection_offsets()
+{
+    check_offsetof(find_field<PEB>("Ldr").Offset, 0x0C, 0x18);
+    check_offsetof(find_field<PEB>("SessionId").Offset, 0x01D4, 0x02C0);
+    check_offsetof(find_field<TEB>("ProcessEnvironmentBlock").Offset, 0x30, 0x60);
+    check_offsetof(find_field<LDR_DATA_TABLE_ENTRY>("DdagNode").Offset, 0x50, 0x98);
+    check_offsetof(find_field<WMI_BUFFER_HEADER>("TimeStamp").Offset, 0x10, 0x10);
+    check_offsetof(find_field<WMI_BUFFER_HEADER>("BufferType").Offset, 0x36, 0x36);
+    check_sizeof(find_field<PEB>("ProcessHeaps").Size, 4, 8, 1);
+    check_sizeof(find_field<UNICODE_STRING>("Buffer").Size, 4, 8, 1);
+    check_sizeof(find_field<TEB>("TlsSlots").Size, 0x100, 0x200, 1);
+    static_assert(find_field<RTL_BALANCED_NODE>("Red").SetBits, "Red is a bit-field");
+    static_assert(find_field<PEB>("Missing").Name == nullptr, "Missing is not a member");
+}
+
+// Instantiates every struct_info<T>::visit
+[[maybe_unused]] static ULONG visit_all_structs()
+{
+    ULONG count = 0;
+    phnt::for_each_struct([&](auto info) {
+        typedef decltype(info) info_type;
+        static const typename info_type::type value = {};
+        info_type::visit(value, [&](const phnt::field_info &, const auto &) { ++count; });
+    });
+    return count;
+}
+
+#ifndef TEST_LAYOUT_SPEC
+
+static void write_json(FILE *file)
+{
+    fprintf(file, "{\"pointer_size\":%u,\"structs\":[", (unsigned)sizeof(PVOID));
+    const char *struct_separator = "";
+    phnt::for_each_struct([&](auto info) {
+        typedef decltype(info) info_type;
+        fprintf(
+            file,
+            "%s\n{\"name\":\"%s\",\"size\":%u,\"fields\":[",
+            struct_separator,
+            info_type::name,
+            (unsigned)sizeof(typename info_type::type));
+        struct_separator = ",";
+        for (ULONG i = 0; i < info_type::field_count; ++i)
+        {
+            const phnt::field_info &field = info_type::fields[i];
+            phnt::field_bits_info bits =
+                phnt::field_bits<typename info_type::type>(field);
+            fprintf(
+                file,
+                "%s{\"name\":\"%s\",\"type\":\"%s\",\"offset\":%u,\"size\":%u",
+                i ? "," : "",
+                field.Name,
+                field.Type,
+                (unsigned)(field.SetBits ? bits.BitOffset / 8 : field.Offset),
+                (unsigned)field.Size);
+            if (field.SetBits)
+            {
+                fprintf(
+                    file,
+                    ",\"bit_offset\":%u,\"bit_width\":%u",
+                    (unsigned)(bits.BitOffset % 8),
+                    (unsigned)bits.BitWidth);
+            }
+            fprintf(file, "}");
+        }
+        fprintf(file, "]}");
+    });
+    fprintf(file, "\n]}\n");
+}
+
+static void check_reflection_bits()
+{
+    phnt::field_bits_info red =
+        phnt::field_bits<RTL_BALANCED_NODE>(find_field<RTL_BALANCED_NODE>("Red"));
+    phnt::field_bits_info balance =
+        phnt::field_bits<RTL_BALANCED_NODE>(find_field<RTL_BALANCED_NODE>("Balance"));
+    assert(red.BitOffset == sizeof(PVOID) * 2 * 8);
+    assert(red.BitWidth == 1);
+    // Red and Balance share a union
+    assert(balance.BitOffset == red.BitOffset);
+    assert(balance.BitWidth == 2);
+
+    phnt::field_bits_info is_protected =
+        phnt::field_bits<PEB>(find_field<PEB>("IsProtectedProcess"));
+    assert(is_protected.BitOffset == 0x03 * 8 + 1);
+    assert(is_protected.BitWidth == 1);
+
+    phnt::field_bits_info ldr = phnt::field_bits<PEB>(find_field<PEB>("Ldr"));
+    assert(ldr.BitOffset == FIELD_OFFSET(PEB, Ldr) * 8);
+    assert(ldr.BitWidth == sizeof(PVOID) * 8);
+}
+
+static void check_reflection_visit()
+{
+    WMI_BUFFER_HEADER header = {};
+    header.BufferSize = 0x10000;
+    header.BufferType = 4;
+    ULONG buffer_size = 0;
+    ULONG fields = 0;
+    phnt::struct_info<WMI_BUFFER_HEADER>::visit(
+        header, [&](const phnt::field_info &field, const auto &value) {
+            assert(&field == &phnt::struct_info<WMI_BUFFER_HEADER>::fields[fields]);
+            if (field.Offset == FIELD_OFFSET(WMI_BUFFER_HEADER, BufferSize))
+            {
+                memcpy(&buffer_size, (const void *)&value, sizeof(buffer_size));
+            }
+            ++fields;
+        });
+    assert(fields == phnt::struct_info<WMI_BUFFER_HEADER>::field_count);
+    assert(buffer_size == 0x10000);
+
+    ULONG structs = 0;
+    phnt::for_each_struct([&](auto) { ++structs; });
+    assert(structs > 500);
+    assert(visit_all_structs() > structs);
+}
+
+// reflection-test [file.json]
+// Checks the table, and writes it as JSON for the target ABI when a file is given.
+int main(int argc, char *argv[])
+{
+    check_reflection_offsets();
+    check_reflection_bits();
+    check_reflection_visit();
+    if (argc > 1)
+    {
+        FILE *file = fopen(argv[1], "w");
+        if (!file)
+        {
+            fprintf(stderr, "reflection-test: cannot open %s\n", argv[1]);
+            return 1;
+        }
+        write_json(file);
+        fclose(file);
+    }
+    printf("reflection-test passed\n");
+    return 0;
+}
+
+#endif
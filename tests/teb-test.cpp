@@ -4,9 +4,6 @@
 
 void test_teb()
 {
-    printf("alignof(TEB):0x%x\n", (int)alignof(TEB));
-    printf("sizeof(TEB):0x%x\n", (int)sizeof(TEB));
-
     check_offsetof(offsetof(TEB, nt_3_10_p2.SystemReserved1), 0xCC, 0x0110);
     check_offsetof(offsetof(TEB, ReservedForDebuggerInstrumentation), 0xCC, 0x0110);
     check_offsetof(offsetof(TEB, SystemReserved1), 0x010C, 0x0190);
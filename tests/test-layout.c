@@ -0,0 +1,24 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "phnt_ntdef.h"
+
+#include "ntkeapi.h"
+#include "ntldr.h"
+#include "ntexapi.h"
+#include "ntpoapi.h"
+#include "ntimage.h"
+#include "ntpebteb.h"
+#include "ntwmi.h"
+
+ULONG layout_sizeof_peb_c(void)
+{
+    return sizeof(PEB);
+}
+
+ULONG layout_sizeof_teb_c(void)
+{
+    return sizeof(TEB);
+}
@@ -0,0 +1,120 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test.h"
+
+#include "ntkeapi.h"
+#include "ntldr.h"
+#include "ntexapi.h"
+#include "ntpoapi.h"
+#include "ntimage.h"
+#include "ntpebteb.h"
+#include "ntwmi.h"
+#include "win-polyfill-basic-pebteb.h"
+#include "win-polyfill-pebteb-offsets.h"
+
+#include <string.h>
+
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
+#error "layout-test must be built with PHNT_MODE_LAYOUT"
+#endif
+
+extern "C" ULONG layout_sizeof_peb_c(void);
+extern "C" ULONG layout_sizeof_teb_c(void);
+
+static void check_base_types()
+{
+    check_sizeof(sizeof(ULONG), 4, 4, 1);
+    check_sizeof(sizeof(WCHAR), 2, 2, 1);
+    check_sizeof(sizeof(HANDLE), 4, 8, 1);
+    check_sizeof(sizeof(LARGE_INTEGER), 8, 8, 1);
+    check_sizeof(sizeof(LIST_ENTRY), 8, 16, 1);
+    check_sizeof(sizeof(UNICODE_STRING), 8, 16, 1);
+    check_offsetof(offsetof(UNICODE_STRING, Buffer), 4, 8);
+    check_sizeof(sizeof(RTL_CRITICAL_SECTION), 0x18, 0x28, 1);
+}
+
+static void check_peb_teb()
+{
+    assert(layout_sizeof_peb_c() == sizeof(PEB));
+    assert(layout_sizeof_teb_c() == sizeof(TEB));
+    check_offsetof(offsetof(PEB, ImageBaseAddress), 0x08, 0x10);
+    check_offsetof(offsetof(PEB, Ldr), 0x0c, 0x18);
+    check_offsetof(offsetof(PEB, ProcessParameters), 0x10, 0x20);
+    check_offsetof(offsetof(PEB, NumberOfProcessors), 0x64, 0xb8);
+    check_offsetof(offsetof(TEB, ProcessEnvironmentBlock), 0x30, 0x60);
+    check_offsetof(offsetof(TEB, LastErrorValue), 0x34, 0x68);
+}
+
+static void check_wmi_buffer_overlay()
+{
+    // A flushed buffer header as it is found in an .etl file, read in place.
+    alignas(8) unsigned char raw[sizeof(WMI_BUFFER_HEADER)] = {};
+    const ULONG buffer_size = 0x10000;
+    const LONGLONG time_stamp = 0x01d9a0b0c0d0e0f0;
+    const USHORT buffer_type = 0x0102;
+    memcpy(raw + 0x00, &buffer_size, sizeof(buffer_size));
+    memcpy(raw + 0x10, &time_stamp, sizeof(time_stamp));
+    memcpy(raw + 0x36, &buffer_type, sizeof(buffer_type));
+
+    const WMI_BUFFER_HEADER *header = (const WMI_BUFFER_HEADER *)raw;
+    assert(header->BufferSize == buffer_size);
+    assert(header->TimeStamp.QuadPart == time_stamp);
+    assert(header->BufferType == buffer_type);
+}
+
+static void check_basic_pebteb_overlay()
+{
+    // A 32-bit and a 64-bit PEB as found in process snapshots, read by the same
+    // program whatever its own bitness.
+    alignas(8) unsigned char raw32[sizeof(phnt::basic_PEB<phnt::Ptr32>)] = {};
+    alignas(8) unsigned char raw64[sizeof(phnt::basic_PEB<phnt::Ptr64>)] = {};
+    const ULONG ldr32 = 0x77f01c40;
+    const ULONGLONG ldr64 = 0x00007ffc12345678;
+    const ULONG session_id = 3;
+    memcpy(raw32 + 0x0c, &ldr32, sizeof(ldr32));
+    memcpy(raw32 + 0x1d4, &session_id, sizeof(session_id));
+    memcpy(raw64 + 0x18, &ldr64, sizeof(ldr64));
+    memcpy(raw64 + 0x2c0, &session_id, sizeof(session_id));
+
+    const phnt::basic_PEB<phnt::Ptr32> *peb32 =
+        (const phnt::basic_PEB<phnt::Ptr32> *)raw32;
+    const phnt::basic_PEB<phnt::Ptr64> *peb64 =
+        (const phnt::basic_PEB<phnt::Ptr64> *)raw64;
+    assert(peb32->Ldr == ldr32);
+    assert(peb32->SessionId == session_id);
+    assert(peb64->Ldr == ldr64);
+    assert(peb64->SessionId == session_id);
+}
+
+static void check_pebteb_offsets(ULONG build, ULONG service_pack)
+{
+    // Offsets looked up at run time, as for a target whose build is only known then.
+    assert(phnt::field_offset<phnt::Ptr32>(build, phnt::peb_field::Ldr) == 0x0c);
+    assert(phnt::field_offset<phnt::Ptr64>(build, phnt::peb_field::Ldr) == 0x18);
+    assert(
+        phnt::field_offset<phnt::Ptr32>(build, phnt::peb_field::AtlThunkSListPtr32, 2) ==
+        0x34);
+    assert(
+        phnt::field_offset<phnt::Ptr32>(
+            build, phnt::peb_field::AtlThunkSListPtr32, service_pack) == -1);
+    assert(
+        phnt::field_offset<phnt::Ptr32>(
+            build, phnt::teb_field::ProcessEnvironmentBlock) == 0x30);
+    assert(
+        phnt::field_offset<phnt::Ptr64>(
+            build, phnt::teb_field::ProcessEnvironmentBlock) == 0x60);
+}
+
+int main()
+{
+    check_base_types();
+    check_peb_teb();
+    check_wmi_buffer_overlay();
+    check_basic_pebteb_overlay();
+    check_pebteb_offsets(2600, 1);
+    printf("layout-test passed\n");
+    return 0;
+}
@@ -33,6 +33,11 @@ int main()
 {
     auto teb = NtCurrentTeb();
     get_windows_version(teb);
+    printf("alignof(LARGE_INTEGER):0x%x\n", (int)alignof(LARGE_INTEGER));
+    printf("alignof(PEB):0x%x\n", (int)alignof(PEB));
+    printf("sizeof(PEB):0x%x\n", (int)sizeof(PEB));
+    printf("alignof(TEB):0x%x\n", (int)alignof(TEB));
+    printf("sizeof(TEB):0x%x\n", (int)sizeof(TEB));
     test_teb();
     test_peb();
     return 0;
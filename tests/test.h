@@ -1,8 +1,16 @@
 ﻿#pragma once
-#include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
+
+#ifdef TEST_LAYOUT_SPEC
+// Compile-only build for a foreign ABI without a C runtime, only the static_assert
+// checks below are of interest there.
+#define TEST_ASSERT(e) ((void)sizeof(e))
+#else
+#include <assert.h>
 #include <stdio.h>
+#define TEST_ASSERT(e) assert(e)
+#endif
 
 #include "phnt_ntdef.h"
 
@@ -10,50 +18,47 @@
 
 #define tail_offsetof(s, m) (offsetof(s, m) + sizeof(s::m))
 
-static void
-check_offsetof(size_t offset, size_t expected_offset_x86, size_t expected_offset_x64)
+constexpr bool check_layout(
+    size_t value,
+    [[maybe_unused]] size_t expected_value_x86,
+    [[maybe_unused]] size_t expected_value_x64)
 {
 #ifndef _WIN64
-    if (expected_offset_x86 != SIZE_MAX)
-        assert(offset == expected_offset_x86);
+    return expected_value_x86 == SIZE_MAX || value == expected_value_x86;
 #else
-    if (expected_offset_x64 != SIZE_MAX)
-        assert(offset == expected_offset_x64);
+    return expected_value_x64 == SIZE_MAX || value == expected_value_x64;
 #endif
 }
 
-static void check_sizeof(
-    size_t size,
-    size_t expected_sizeof_x86,
-    size_t expected_sizeof_x64,
-    size_t alignment)
-{
-    size = ALIGN_POT(size, alignment);
-#ifndef _WIN64
-    if (expected_sizeof_x86 != SIZE_MAX)
-        assert(size == expected_sizeof_x86);
-#else
-    if (expected_sizeof_x64 != SIZE_MAX)
-        assert(size == expected_sizeof_x64);
-#endif
-}
+// Layout checks are static_assert so that they hold in release builds and can be
+// verified for both x86 and x64 by compiling for each, see tests/CMakeLists.txt.
+#define check_offsetof(offset, expected_offset_x86, expected_offset_x64)                 \
+    static_assert(                                                                       \
+        check_layout((offset), (expected_offset_x86), (expected_offset_x64)),            \
+        #offset)
+
+#define check_sizeof(size, expected_sizeof_x86, expected_sizeof_x64, alignment)          \
+    static_assert(                                                                       \
+        check_layout(                                                                    \
+            ALIGN_POT((size), (alignment)), (expected_sizeof_x86), (expected_sizeof_x64)),\
+        #size)
 
 static void check_uchar_mask(void *ptr, size_t uchar_offset, UCHAR mask)
 {
     UCHAR b = ((UCHAR *)ptr)[uchar_offset];
-    assert((b & mask) == mask);
+    TEST_ASSERT((b & mask) == mask);
 }
 
 static void check_ulong_mask(void *ptr, size_t ulong_offset, ULONG mask)
 {
     ULONG b = *(ULONG *)((UCHAR *)ptr + ulong_offset);
-    assert((b & mask) == mask);
+    TEST_ASSERT((b & mask) == mask);
 }
 
 static void check_ulong_mask_both(
     void *ptr,
-    size_t ulong_offset_x86,
-    size_t ulong_offset_x64,
+    [[maybe_unused]] size_t ulong_offset_x86,
+    [[maybe_unused]] size_t ulong_offset_x64,
     ULONG mask)
 {
 #ifndef _WIN64
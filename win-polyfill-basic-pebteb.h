@@ -0,0 +1,291 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Pointer-width templated PEB/TEB/LDR_DATA_TABLE_ENTRY==
+//
+// basic_PEB<Ptr32>, basic_TEB<Ptr32> and basic_LDR_DATA_TABLE_ENTRY<Ptr32> are the
+// x86 layouts, the Ptr64 instantiations are the x64 layouts, whatever the bitness
+// of the program including this header. They are not hand-written: the versioned
+// definitions from win-polyfill-peb.h, win-polyfill-teb.h and
+// win-polyfill-ldr-data-table-entry.h are included once more per pointer width,
+// with _WIN64 set to match and every pointer member stored as an integer of that
+// width (as WOW64_POINTER does in ntwow64.h). A 64-bit analyzer can then read a
+// 32-bit process snapshot in place, and the other way round.
+
+#ifndef __cplusplus
+#error "win-polyfill-basic-pebteb.h requires C++"
+#endif
+
+#include "ntpebteb.h"
+#include "ntldr.h"
+
+namespace phnt
+{
+
+    struct Ptr32
+    {
+        typedef ULONG type;
+    };
+
+    struct Ptr64
+    {
+        typedef ULONGLONG type;
+    };
+
+    // Embedded structures whose size depends on the pointer width.
+
+    template <class Ptr> struct basic_LIST_ENTRY
+    {
+        typename Ptr::type Flink;
+        typename Ptr::type Blink;
+    };
+
+    template <class Ptr> struct basic_UNICODE_STRING
+    {
+        USHORT Length;
+        USHORT MaximumLength;
+        typename Ptr::type Buffer;
+    };
+
+    template <class Ptr> struct basic_RTL_BALANCED_NODE
+    {
+        union
+        {
+            typename Ptr::type Children[2];
+            struct
+            {
+                typename Ptr::type Left;
+                typename Ptr::type Right;
+            };
+        };
+        union
+        {
+            UCHAR Red : 1;
+            UCHAR Balance : 2;
+            typename Ptr::type ParentValue;
+        };
+    };
+
+    template <class Ptr> struct basic_NT_TIB
+    {
+        typename Ptr::type ExceptionList;
+        typename Ptr::type StackBase;
+        typename Ptr::type StackLimit;
+        typename Ptr::type SubSystemTib;
+        union
+        {
+            typename Ptr::type FiberData;
+            ULONG Version;
+        };
+        typename Ptr::type ArbitraryUserPointer;
+        typename Ptr::type Self;
+    };
+
+    template <class Ptr> struct basic_CLIENT_ID
+    {
+        typename Ptr::type UniqueProcess;
+        typename Ptr::type UniqueThread;
+    };
+
+    template <class Ptr> struct basic_GDI_TEB_BATCH
+    {
+        ULONG Offset;
+        typename Ptr::type HDC;
+        ULONG Buffer[GDI_BATCH_BUFFER_SIZE];
+    };
+
+    template <class Ptr> struct basic_ACTIVATION_CONTEXT_STACK
+    {
+        union
+        {
+            struct
+            {
+                ULONG Flags;
+                ULONG NextCookieSequenceNumber;
+                typename Ptr::type ActiveFrame;
+                basic_LIST_ENTRY<Ptr> FrameListCache;
+            } nt_5_0;
+            struct
+            {
+                typename Ptr::type ActiveFrame;
+                basic_LIST_ENTRY<Ptr> FrameListCache;
+                ULONG Flags;
+                ULONG NextCookieSequenceNumber;
+                ULONG StackId;
+            };
+        };
+    };
+
+    template <class Ptr> struct basic_GROUP_AFFINITY
+    {
+        typename Ptr::type Mask;
+        USHORT Group;
+        USHORT Reserved[3];
+    };
+
+    template <class Ptr> struct basic_pebteb;
+
+    template <class Ptr> using basic_PEB = typename basic_pebteb<Ptr>::PEB;
+    template <class Ptr> using basic_TEB = typename basic_pebteb<Ptr>::TEB;
+    template <class Ptr>
+    using basic_LDR_DATA_TABLE_ENTRY = typename basic_pebteb<Ptr>::LDR_DATA_TABLE_ENTRY;
+
+} // namespace phnt
+
+#pragma push_macro("_WIN64")
+#pragma push_macro("WIN_POLYFILL_POINTER")
+#undef WIN_POLYFILL_POINTER
+#define WIN_POLYFILL_POINTER(Type) PVOID
+#define WIN_POLYFILL_BASIC_PASS
+
+#undef _WIN64
+namespace phnt
+{
+    namespace ptr32
+    {
+        typedef Ptr32::type PVOID, HANDLE, ULONG_PTR, KAFFINITY;
+        typedef basic_LIST_ENTRY<Ptr32> LIST_ENTRY;
+        typedef basic_UNICODE_STRING<Ptr32> UNICODE_STRING;
+        typedef basic_RTL_BALANCED_NODE<Ptr32> RTL_BALANCED_NODE;
+        typedef basic_NT_TIB<Ptr32> NT_TIB;
+        typedef basic_CLIENT_ID<Ptr32> CLIENT_ID;
+        typedef basic_GDI_TEB_BATCH<Ptr32> GDI_TEB_BATCH;
+        typedef basic_ACTIVATION_CONTEXT_STACK<Ptr32> ACTIVATION_CONTEXT_STACK;
+        typedef basic_GROUP_AFFINITY<Ptr32> GROUP_AFFINITY;
+
+#include "win-polyfill-ldr-data-table-entry.h"
+#include "win-polyfill-peb.h"
+#include "win-polyfill-teb.h"
+    } // namespace ptr32
+
+} // namespace phnt
+
+#define _WIN64
+namespace phnt
+{
+    namespace ptr64
+    {
+        typedef Ptr64::type PVOID, HANDLE, ULONG_PTR, KAFFINITY;
+        typedef basic_LIST_ENTRY<Ptr64> LIST_ENTRY;
+        typedef basic_UNICODE_STRING<Ptr64> UNICODE_STRING;
+        typedef basic_RTL_BALANCED_NODE<Ptr64> RTL_BALANCED_NODE;
+        typedef basic_NT_TIB<Ptr64> NT_TIB;
+        typedef basic_CLIENT_ID<Ptr64> CLIENT_ID;
+        typedef basic_GDI_TEB_BATCH<Ptr64> GDI_TEB_BATCH;
+        typedef basic_ACTIVATION_CONTEXT_STACK<Ptr64> ACTIVATION_CONTEXT_STACK;
+        typedef basic_GROUP_AFFINITY<Ptr64> GROUP_AFFINITY;
+
+#include "win-polyfill-ldr-data-table-entry.h"
+#include "win-polyfill-peb.h"
+#include "win-polyfill-teb.h"
+    } // namespace ptr64
+
+} // namespace phnt
+
+#undef WIN_POLYFILL_BASIC_PASS
+#pragma pop_macro("WIN_POLYFILL_POINTER")
+#pragma pop_macro("_WIN64")
+
+namespace phnt
+{
+
+    template <> struct basic_pebteb<Ptr32>
+    {
+        typedef ptr32::PEB PEB;
+        typedef ptr32::TEB TEB;
+        typedef ptr32::LDR_DATA_TABLE_ENTRY LDR_DATA_TABLE_ENTRY;
+    };
+
+    template <> struct basic_pebteb<Ptr64>
+    {
+        typedef ptr64::PEB PEB;
+        typedef ptr64::TEB TEB;
+        typedef ptr64::LDR_DATA_TABLE_ENTRY LDR_DATA_TABLE_ENTRY;
+    };
+
+    // Offsets as documented next to each member, checked for both instantiations.
+
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, Mutant) == 0x04);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, Ldr) == 0x0C);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, ProcessParameters) == 0x10);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, ApiSetMap) == 0x38);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, NumberOfProcessors) == 0x64);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, ProcessHeaps) == 0x90);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, LoaderLock) == 0xA0);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, PostProcessInitRoutine) == 0x14C);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, SessionId) == 0x1D4);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, ActivationContextData) == 0x1F8);
+    C_ASSERT(FIELD_OFFSET(ptr32::PEB, LeapSecondData) == 0x470);
+
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, ClientId) == 0x20);
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, ProcessEnvironmentBlock) == 0x30);
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, LastErrorValue) == 0x34);
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, ActivationContextStackPointer) == 0x1A8);
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, GdiTebBatch) == 0x1D4);
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, TlsSlots) == 0xE10);
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, TlsExpansionSlots) == 0xF94);
+    C_ASSERT(FIELD_OFFSET(ptr32::TEB, ActiveFrame) == 0xFB0);
+
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, DllBase) == 0x18);
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, FullDllName) == 0x24);
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, BaseDllName) == 0x2C);
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, HashLinks) == 0x3C);
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, DdagNode) == 0x50);
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, LoadTime) == 0x88);
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, LoadReason) == 0x94);
+    C_ASSERT(FIELD_OFFSET(ptr32::LDR_DATA_TABLE_ENTRY, HotPatchState) == 0xB0);
+
+    C_ASSERT(sizeof(ptr32::PEB) == 0x488);
+    C_ASSERT(sizeof(ptr32::TEB) == 0x1038);
+    C_ASSERT(sizeof(ptr32::LDR_DATA_TABLE_ENTRY) == 0xB8);
+
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, Mutant) == 0x08);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, Ldr) == 0x18);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, ProcessParameters) == 0x20);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, ApiSetMap) == 0x68);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, NumberOfProcessors) == 0xB8);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, ProcessHeaps) == 0xF0);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, LoaderLock) == 0x110);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, PostProcessInitRoutine) == 0x230);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, SessionId) == 0x2C0);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, ActivationContextData) == 0x2F8);
+    C_ASSERT(FIELD_OFFSET(ptr64::PEB, LeapSecondData) == 0x7B8);
+
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, ClientId) == 0x40);
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, ProcessEnvironmentBlock) == 0x60);
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, LastErrorValue) == 0x68);
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, ActivationContextStackPointer) == 0x2C8);
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, GdiTebBatch) == 0x2F0);
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, TlsSlots) == 0x1480);
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, TlsExpansionSlots) == 0x1780);
+    C_ASSERT(FIELD_OFFSET(ptr64::TEB, ActiveFrame) == 0x17C0);
+
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, DllBase) == 0x30);
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, FullDllName) == 0x48);
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, BaseDllName) == 0x58);
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, HashLinks) == 0x70);
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, DdagNode) == 0x98);
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, LoadTime) == 0x100);
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, LoadReason) == 0x10C);
+    C_ASSERT(FIELD_OFFSET(ptr64::LDR_DATA_TABLE_ENTRY, HotPatchState) == 0x130);
+
+    C_ASSERT(sizeof(ptr64::PEB) == 0x7D0);
+    C_ASSERT(sizeof(ptr64::TEB) == 0x1878);
+    C_ASSERT(sizeof(ptr64::LDR_DATA_TABLE_ENTRY) == 0x138);
+
+// The instantiation of the host pointer width is the native structure.
+#ifdef _WIN64
+    C_ASSERT(sizeof(basic_PEB<Ptr64>) == sizeof(::PEB));
+    C_ASSERT(sizeof(basic_TEB<Ptr64>) == sizeof(::TEB));
+    C_ASSERT(sizeof(basic_LDR_DATA_TABLE_ENTRY<Ptr64>) == sizeof(::LDR_DATA_TABLE_ENTRY));
+#else
+    C_ASSERT(sizeof(basic_PEB<Ptr32>) == sizeof(::PEB));
+    C_ASSERT(sizeof(basic_TEB<Ptr32>) == sizeof(::TEB));
+    C_ASSERT(sizeof(basic_LDR_DATA_TABLE_ENTRY<Ptr32>) == sizeof(::LDR_DATA_TABLE_ENTRY));
+#endif
+
+} // namespace phnt
@@ -0,0 +1,251 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Compact context switch decoder==
+//
+// With PERF_COMPACT_CSWITCH the kernel logs context switches in batches
+// (PERFINFO_LOG_TYPE_CONTEXTSWAP_BATCH): a PERFINFO_CCSWAP_BUFFER with the first time
+// stamp and a 16 entry thread id and base priority table, then packets of 2, 4 or 8
+// bytes that store the time since the previous packet and the switching out thread.
+// etl_ccswap_decoder expands them into WMI_CONTEXTSWAP records with absolute time
+// stamps, the shape etl_cswitch_timeline::context_switch takes.
+//
+//   etl_ccswap_decoder::consume(event, f)         decodes a batch event, other events
+//                                                 are ignored
+//   etl_ccswap_decoder::decode(processor, data, size, f)
+//                                                 decodes the payload of a batch
+//   etl_ccswap_decoder::flush(f)                  the last switch of every processor
+//
+// f is called with an etl_ccswap_record for each switch, in time order per processor.
+// Packets only name the thread switching out, the thread switching in is the one the
+// next packet switches out, so the last record of a batch waits for the next batch of
+// its processor and flush() gives it NewThreadId etl_no_thread. The idle packets
+// switch out thread 0.
+//
+// OldThreadStateWr holds the wait reason of a thread switched out in the Waiting
+// state, and MaximumWaitReason + KTHREAD_STATE for the other states. The priority of
+// the new thread is not in the packets and stays 0.
+//
+// A batch is decoded in three scalar passes over small columns: the packet lengths
+// chain so the first pass only finds where each packet starts, the second extracts the
+// fields of every packet independently and the third adds up the time deltas. Only
+// the first and the last pass carry a dependency from one packet to the next, the
+// iterations of the second can overlap in the processor.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-ccswap.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#include "win-polyfill-etl-cswitch.h"
+
+namespace phnt
+{
+
+    struct etl_ccswap_record
+    {
+        LONGLONG TimeStamp;
+        USHORT ProcessorIndex;
+        WMI_CONTEXTSWAP Switch;
+    };
+
+    // Bytes of each PERFINFO_CCSWAP_TYPE packet
+    inline constexpr UCHAR etl_ccswap_packet_size[4] = {
+        sizeof(PERFINFO_CCSWAP_IDLE_SHORT),
+        sizeof(PERFINFO_CCSWAP_IDLE),
+        sizeof(PERFINFO_CCSWAP_LITE),
+        sizeof(PERFINFO_CCSWAP)};
+
+    class etl_ccswap_decoder
+    {
+      public:
+        // False if the event is a malformed batch
+        template <class F> bool consume(const etl_event &event, F &&f)
+        {
+            if (etl_get_payload(event) != etl_payload::PERFINFO_CCSWAP_BUFFER)
+            {
+                return true;
+            }
+            return decode(event.ProcessorIndex, event.Payload, event.PayloadSize, f);
+        }
+
+        // False if the payload is too short or ends inside a packet, nothing is decoded
+        template <class F>
+        bool decode(USHORT ProcessorIndex, const UCHAR *Data, ULONG Size, F &&f)
+        {
+            PERFINFO_CCSWAP_BUFFER buffer;
+            if (Size < sizeof(buffer))
+            {
+                ++Malformed;
+                return false;
+            }
+            memcpy(&buffer, Data, sizeof(buffer));
+
+            // Pass 1: where the packets start
+            Offsets.clear();
+            ULONG offset = sizeof(buffer);
+            while (offset + sizeof(USHORT) <= Size)
+            {
+                ULONG size = etl_ccswap_packet_size[Data[offset] & 3];
+                if (offset + size > Size)
+                {
+                    ++Malformed;
+                    return false;
+                }
+                Offsets.push_back(offset);
+                offset += size;
+            }
+            if (offset != Size)
+            {
+                ++Malformed;
+                return false;
+            }
+
+            // Pass 2: the fields of each packet, read as one 64 bit little endian word
+            size_t count = Offsets.size();
+            Times.resize(count);
+            Records.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint64_t bits = 0;
+                const UCHAR *packet = Data + Offsets[i];
+                memcpy(&bits, packet, etl_ccswap_packet_size[packet[0] & 3]);
+                Times[i] = (int64_t)unpack(bits, buffer, Records[i]);
+            }
+
+            // Pass 3: absolute time stamps
+            int64_t time = buffer.FirstTimeStamp;
+            for (size_t i = 0; i < count; ++i)
+            {
+                time += Times[i];
+                Times[i] = time;
+            }
+
+            if (ProcessorIndex >= Pending.size())
+            {
+                Pending.resize(ProcessorIndex + 1);
+            }
+            pending_switch &pending = Pending[ProcessorIndex];
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (pending.Valid)
+                {
+                    pending.Record.Switch.NewThreadId = Records[i].OldThreadId;
+                    f(static_cast<const etl_ccswap_record &>(pending.Record));
+                }
+                pending.Record.TimeStamp = Times[i];
+                pending.Record.ProcessorIndex = ProcessorIndex;
+                pending.Record.Switch = Records[i];
+                pending.Valid = true;
+            }
+            return true;
+        }
+
+        template <class F> void flush(F &&f)
+        {
+            for (pending_switch &pending : Pending)
+            {
+                if (pending.Valid)
+                {
+                    pending.Record.Switch.NewThreadId = etl_no_thread;
+                    f(static_cast<const etl_ccswap_record &>(pending.Record));
+                    pending.Valid = false;
+                }
+            }
+        }
+
+        // Batches rejected by decode
+        ULONG malformed() const { return Malformed; }
+
+      private:
+        struct pending_switch
+        {
+            etl_ccswap_record Record = {};
+            bool Valid = false;
+        };
+
+        static uint32_t field(uint64_t bits, unsigned shift, unsigned width)
+        {
+            return (uint32_t)(bits >> shift) & ((1u << width) - 1);
+        }
+
+        // Fills Switch but NewThreadId, returns the time delta
+        static uint32_t unpack(
+            uint64_t bits,
+            const PERFINFO_CCSWAP_BUFFER &buffer,
+            WMI_CONTEXTSWAP &Switch)
+        {
+            const unsigned type_bits = PERFINFO_CCSWAP_BIT_TYPE;
+            Switch = {};
+            uint32_t state_wr;
+            uint32_t delta;
+            switch (field(bits, 0, type_bits))
+            {
+            case PerfCSwapIdleShort:
+                Switch.OldThreadState = Ready;
+                return field(bits, type_bits, PERFINFO_CCSWAP_BIT_SHORT_TS);
+            case PerfCSwapIdle:
+                Switch.OldThreadState = Ready;
+                return field(bits, type_bits, PERFINFO_CCSWAP_BIT_FULL_TS);
+            case PerfCSwapLite:
+            {
+                unsigned shift = type_bits;
+                uint32_t index = field(bits, shift, PERFINFO_CCSWAP_BIT_TID);
+                shift += PERFINFO_CCSWAP_BIT_TID;
+                uint32_t increment = field(bits, shift, PERFINFO_CCSWAP_BIT_PRI_INC);
+                shift += PERFINFO_CCSWAP_BIT_PRI_INC;
+                state_wr = field(bits, shift, PERFINFO_CCSWAP_BIT_STATE_WR);
+                shift += PERFINFO_CCSWAP_BIT_STATE_WR;
+                delta = field(bits, shift, PERFINFO_CCSWAP_BIT_SMALL_TS);
+                Switch.OldThreadId = buffer.TidTable[index];
+                Switch.OldThreadPriority =
+                    (CHAR)(buffer.ThreadBasePriority[index] + increment);
+                break;
+            }
+            default:
+            {
+                unsigned shift = type_bits;
+                delta = field(bits, shift, PERFINFO_CCSWAP_BIT_FULL_TS);
+                shift += PERFINFO_CCSWAP_BIT_FULL_TS;
+                uint32_t index = field(bits, shift, PERFINFO_CCSWAP_BIT_TID);
+                shift += PERFINFO_CCSWAP_BIT_TID;
+                state_wr = field(bits, shift, PERFINFO_CCSWAP_BIT_STATE_WR);
+                shift += PERFINFO_CCSWAP_BIT_STATE_WR;
+                Switch.OldThreadPriority =
+                    (CHAR)field(bits, shift, PERFINFO_CCSWAP_BIT_PRIORITY);
+                shift += PERFINFO_CCSWAP_BIT_PRIORITY;
+                Switch.NewThreadWaitTime =
+                    field(bits, shift, PERFINFO_CCSWAP_BIT_WAIT_TIME);
+                Switch.OldThreadId = buffer.TidTable[index];
+                break;
+            }
+            }
+            if (state_wr < MaximumWaitReason)
+            {
+                Switch.OldThreadState = Waiting;
+                Switch.OldThreadWaitReason = (UCHAR)state_wr;
+            }
+            else
+            {
+                Switch.OldThreadState = (UCHAR)(state_wr - MaximumWaitReason);
+            }
+            return delta;
+        }
+
+        std::vector<ULONG> Offsets;
+        std::vector<int64_t> Times;
+        std::vector<WMI_CONTEXTSWAP> Records;
+        std::vector<pending_switch> Pending;
+        ULONG Malformed = 0;
+    };
+
+    C_ASSERT(sizeof(PERFINFO_CCSWAP) == sizeof(uint64_t));
+
+} // namespace phnt
@@ -0,0 +1,314 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Thread timeline from context switches==
+//
+// A per-processor state machine over WMI_CONTEXTSWAP (and ETW_READY_THREAD_EVENT)
+// records that cuts the life of every thread into intervals:
+//
+//   Running   on a processor, from the switch in to the switch out
+//   Waiting   switched out in KTHREAD_STATE Waiting, by OldThreadWaitReason
+//   Ready     switched out while runnable (preempted) or readied from a wait, until
+//             the next switch in; the scheduling latency
+//
+// Intervals are stored by column (etl_thread_intervals) and summed per KWAIT_REASON
+// and per thread as they close. Threads are found in an etl_hash_map, so a switch
+// costs two probes and a few appends, without a map or a vector per thread.
+//
+//   etl_cswitch_timeline::consume(event)   feeds a decoded event, in time order
+//   etl_cswitch_timeline::finish(time)     closes the intervals still running
+//   etl_cswitch_timeline::intervals()      the columns
+//   etl_cswitch_timeline::wait_stats()     per KWAIT_REASON, MaximumWaitReason entries
+//
+// Events must come in time order across processors, as etl_merger hands them out: a
+// wait starts on one processor and ends on another. The idle threads (ThreadId 0)
+// only get Running intervals. A switch to etl_no_thread ends the Running interval of
+// the old thread and leaves the processor unknown until its next switch.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-cswitch.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <vector>
+
+#include "win-polyfill-etl-dispatch.h"
+#include "win-polyfill-etl-hash.h"
+#include "ntkeapi.h"
+
+namespace phnt
+{
+
+    // Not a thread id the kernel hands out, marks the free slots of the thread table
+    inline constexpr ULONG etl_no_thread = 0xFFFFFFFF;
+
+    struct etl_thread_intervals
+    {
+        std::vector<ULONG> ThreadId;
+        std::vector<int64_t> Start;
+        std::vector<int64_t> End;
+        // Running: the processor; Waiting and Ready: the processor the thread left
+        std::vector<USHORT> Processor;
+        // KTHREAD_STATE: Running, Waiting or Ready
+        std::vector<UCHAR> State;
+        // KWAIT_REASON of Waiting intervals, MaximumWaitReason otherwise
+        std::vector<UCHAR> WaitReason;
+
+        size_t size() const { return ThreadId.size(); }
+    };
+
+    struct etl_interval_stats
+    {
+        uint64_t Count;
+        uint64_t Total;
+        uint64_t Max;
+
+        void add(uint64_t duration)
+        {
+            ++Count;
+            Total += duration;
+            Max = duration > Max ? duration : Max;
+        }
+    };
+
+    struct etl_thread_times
+    {
+        ULONG ThreadId;
+        // Switches in
+        ULONG Switches;
+        uint64_t Running;
+        uint64_t Waiting;
+        uint64_t Ready;
+        // NewThreadWaitTime summed over the switches in, in clock ticks as the kernel
+        // counts them. Unlike Waiting it includes waits that began before the trace.
+        uint64_t WaitTicks;
+    };
+
+    class etl_cswitch_timeline
+    {
+      public:
+        // Without KeepIntervals only the sums are kept
+        explicit etl_cswitch_timeline(bool KeepIntervals = true)
+            : KeepIntervals(KeepIntervals)
+        {
+        }
+
+        void consume(const etl_event &event)
+        {
+            WMI_CONTEXTSWAP cswitch;
+            ETW_READY_THREAD_EVENT ready;
+            if (etl_read_payload(event, cswitch))
+            {
+                context_switch(event.ProcessorIndex, event.TimeStamp, cswitch);
+            }
+            else if (etl_read_payload(event, ready))
+            {
+                ready_thread(event.TimeStamp, ready.ThreadId);
+            }
+        }
+
+        void context_switch(
+            USHORT ProcessorIndex,
+            LONGLONG TimeStamp,
+            const WMI_CONTEXTSWAP &Switch)
+        {
+            if (ProcessorIndex >= Processors.size())
+            {
+                Processors.resize(ProcessorIndex + 1);
+            }
+            processor_state &processor = Processors[ProcessorIndex];
+            if (processor.Known)
+            {
+                emit(
+                    processor.ThreadId,
+                    processor.Since,
+                    TimeStamp,
+                    ProcessorIndex,
+                    Running,
+                    MaximumWaitReason);
+                thread(processor.ThreadId).Times.Running +=
+                    etl_elapsed(processor.Since, TimeStamp);
+            }
+
+            if (Switch.OldThreadId != 0)
+            {
+                thread_state &old_thread = thread(Switch.OldThreadId);
+                old_thread.Since = TimeStamp;
+                old_thread.Processor = ProcessorIndex;
+                if (Switch.OldThreadState == Waiting)
+                {
+                    old_thread.State = Waiting;
+                    old_thread.WaitReason = Switch.OldThreadWaitReason < MaximumWaitReason
+                                                ? Switch.OldThreadWaitReason
+                                                : (UCHAR)MaximumWaitReason;
+                }
+                else if (Switch.OldThreadState == Terminated)
+                {
+                    old_thread.State = Terminated;
+                }
+                else
+                {
+                    old_thread.State = Ready;
+                }
+            }
+
+            if (Switch.NewThreadId == etl_no_thread)
+            {
+                processor.Known = false;
+                return;
+            }
+            thread_state &new_thread = thread(Switch.NewThreadId);
+            if (Switch.NewThreadId != 0)
+            {
+                close(new_thread, TimeStamp);
+            }
+            new_thread.State = Running;
+            new_thread.Since = TimeStamp;
+            new_thread.Processor = ProcessorIndex;
+            ++new_thread.Times.Switches;
+            new_thread.Times.WaitTicks += Switch.NewThreadWaitTime;
+
+            processor.ThreadId = Switch.NewThreadId;
+            processor.Since = TimeStamp;
+            processor.Known = true;
+        }
+
+        // A waiting thread became ready to run
+        void ready_thread(LONGLONG TimeStamp, ULONG ThreadId)
+        {
+            thread_state &ready = thread(ThreadId);
+            if (ready.State == Waiting)
+            {
+                close(ready, TimeStamp);
+                ready.State = Ready;
+                ready.Since = TimeStamp;
+            }
+        }
+
+        // Closes the Running intervals at TimeStamp, open waits stay open
+        void finish(LONGLONG TimeStamp)
+        {
+            for (size_t i = 0; i < Processors.size(); ++i)
+            {
+                processor_state &processor = Processors[i];
+                if (processor.Known)
+                {
+                    emit(
+                        processor.ThreadId,
+                        processor.Since,
+                        TimeStamp,
+                        (USHORT)i,
+                        Running,
+                        MaximumWaitReason);
+                    thread(processor.ThreadId).Times.Running +=
+                        etl_elapsed(processor.Since, TimeStamp);
+                    processor.Since = TimeStamp;
+                }
+            }
+        }
+
+        const etl_thread_intervals &intervals() const { return Intervals; }
+
+        // Waits by KWAIT_REASON, the last entry for reasons past the enum
+        const etl_interval_stats *wait_stats() const { return Waits; }
+
+        // From switch out or ready to switch in
+        const etl_interval_stats &ready_stats() const { return Readies; }
+
+        template <class F> void for_each_thread(F &&f) const
+        {
+            Threads.for_each([&](ULONG, const thread_state &thread) {
+                f(static_cast<const etl_thread_times &>(thread.Times));
+            });
+        }
+
+      private:
+        struct processor_state
+        {
+            ULONG ThreadId = 0;
+            int64_t Since = 0;
+            bool Known = false;
+        };
+
+        struct thread_state
+        {
+            etl_thread_times Times = {etl_no_thread, 0, 0, 0, 0, 0};
+            int64_t Since = 0;
+            USHORT Processor = 0;
+            // KTHREAD_STATE, Initialized until the first switch
+            UCHAR State = Initialized;
+            UCHAR WaitReason = MaximumWaitReason;
+        };
+
+        void close(thread_state &state, LONGLONG TimeStamp)
+        {
+            uint64_t length = etl_elapsed(state.Since, TimeStamp);
+            if (state.State == Waiting)
+            {
+                emit(
+                    state.Times.ThreadId,
+                    state.Since,
+                    TimeStamp,
+                    state.Processor,
+                    Waiting,
+                    state.WaitReason);
+                Waits[state.WaitReason].add(length);
+                state.Times.Waiting += length;
+            }
+            else if (state.State == Ready)
+            {
+                emit(
+                    state.Times.ThreadId,
+                    state.Since,
+                    TimeStamp,
+                    state.Processor,
+                    Ready,
+                    MaximumWaitReason);
+                Readies.add(length);
+                state.Times.Ready += length;
+            }
+        }
+
+        void emit(
+            ULONG ThreadId,
+            int64_t Start,
+            int64_t End,
+            USHORT ProcessorIndex,
+            UCHAR State,
+            UCHAR WaitReason)
+        {
+            if (!KeepIntervals)
+            {
+                return;
+            }
+            Intervals.ThreadId.push_back(ThreadId);
+            Intervals.Start.push_back(Start);
+            Intervals.End.push_back(End);
+            Intervals.Processor.push_back(ProcessorIndex);
+            Intervals.State.push_back(State);
+            Intervals.WaitReason.push_back(WaitReason);
+        }
+
+        thread_state &thread(ULONG ThreadId)
+        {
+            auto inserted = Threads.insert(ThreadId);
+            if (inserted.second)
+            {
+                inserted.first.Times.ThreadId = ThreadId;
+            }
+            return inserted.first;
+        }
+
+        bool KeepIntervals;
+        etl_thread_intervals Intervals;
+        etl_interval_stats Waits[MaximumWaitReason + 1] = {};
+        etl_interval_stats Readies = {};
+        std::vector<processor_state> Processors;
+        etl_hash_map<ULONG, thread_state> Threads{etl_no_thread};
+    };
+
+} // namespace phnt
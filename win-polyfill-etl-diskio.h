@@ -0,0 +1,170 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Disk I/O latency==
+//
+// Pairs the disk requests (WMI_DISKIO_READWRITE_INIT, logged by
+// WMI_LOG_TYPE_IO_READ_INIT and WMI_LOG_TYPE_IO_WRITE_INIT) with their completions
+// (ETW_DISKIO_READWRITE_V2 and ETW_DISKIO_READWRITE_V3) by IRP address, and records
+// the latency in etl_histogram per disk, per issuing process and per file object.
+//
+//   etl_diskio_latency::consume(event)   thread, request and completion events
+//   etl_diskio_latency::merge(other)     adds the histograms of another decoder
+//   etl_diskio_latency::disks()          histograms by DiskNumber
+//   etl_diskio_latency::processes()      by process of the issuing thread
+//   etl_diskio_latency::files()          by FileObject
+//
+// The latency is the time between the request and the completion when both are
+// seen, HighResResponseTime of the completion otherwise, in the clock of the trace.
+// The issuing thread comes from the request, or from IssuingThreadId of a version 3
+// completion. Decoders that run on separate buffers pair only what they see and fall
+// back to HighResResponseTime for the rest, so their results merge without loss.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-diskio.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <unordered_map>
+
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    class etl_diskio_latency
+    {
+      public:
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG pointer_size = event.PointerSize;
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_THREAD_CREATE:
+            case WMI_LOG_TYPE_THREAD_DC_START:
+                Threads.consume(event);
+                break;
+            case WMI_LOG_TYPE_IO_READ_INIT:
+            case WMI_LOG_TYPE_IO_WRITE_INIT:
+            case WMI_LOG_TYPE_IO_FLUSH_INIT:
+                // WMI_DISKIO_READWRITE_INIT: Irp, IssuingThreadId
+                if (event.PayloadSize >= pointer_size + sizeof(ULONG))
+                {
+                    uint64_t irp = etl_load_pointer(event.Payload, pointer_size);
+                    ULONG thread_id = etl_load<ULONG>(event.Payload + pointer_size);
+                    Pending[irp] = {event.TimeStamp, thread_id};
+                }
+                break;
+            case WMI_LOG_TYPE_IO_FLUSH:
+                // ETW_DISKIO_FLUSH_BUFFERS_V2 and _V3: IrpAddress after 16 bytes
+                if (event.PayloadSize >= 16 + pointer_size)
+                {
+                    Pending.erase(etl_load_pointer(event.Payload + 16, pointer_size));
+                }
+                break;
+            case WMI_LOG_TYPE_IO_READ:
+            case WMI_LOG_TYPE_IO_WRITE:
+                complete(event);
+                break;
+            }
+        }
+
+        void merge(const etl_diskio_latency &other)
+        {
+            for (const auto &disk : other.Disks)
+            {
+                Disks[disk.first].merge(disk.second);
+            }
+            for (const auto &process : other.Processes)
+            {
+                Processes[process.first].merge(process.second);
+            }
+            for (const auto &file : other.Files)
+            {
+                Files[file.first].merge(file.second);
+            }
+            Unpaired += other.Unpaired;
+        }
+
+        const std::unordered_map<ULONG, etl_histogram> &disks() const { return Disks; }
+
+        // Requests of threads of unknown process are under etl_no_process
+        const std::unordered_map<ULONG, etl_histogram> &processes() const
+        {
+            return Processes;
+        }
+
+        const std::unordered_map<uint64_t, etl_histogram> &files() const { return Files; }
+
+        // Completions timed by HighResResponseTime, without their request
+        uint64_t unpaired() const { return Unpaired; }
+
+      private:
+        struct request
+        {
+            int64_t TimeStamp;
+            ULONG ThreadId;
+        };
+
+        void complete(const etl_event &event)
+        {
+            // ETW_DISKIO_READWRITE_V2 and _V3 of either pointer size: DiskNumber,
+            // IrpFlags, Size, Reserved and ByteOffset, then FileObject and IrpAddress,
+            // then HighResResponseTime and, from version 3, IssuingThreadId
+            const ULONG pointer_size = event.PointerSize;
+            const ULONG response_offset = 24 + 2 * pointer_size;
+            if (event.PayloadSize < response_offset + sizeof(ULONGLONG))
+            {
+                return;
+            }
+            ULONG disk = etl_load<ULONG>(event.Payload);
+            uint64_t file = etl_load_pointer(event.Payload + 24, pointer_size);
+            uint64_t irp =
+                etl_load_pointer(event.Payload + 24 + pointer_size, pointer_size);
+            uint64_t latency = etl_load<ULONGLONG>(event.Payload + response_offset);
+            ULONG thread_id = 0;
+            if (event.Version >= 3 &&
+                event.PayloadSize >= response_offset + sizeof(ULONGLONG) + sizeof(ULONG))
+            {
+                thread_id = etl_load<ULONG>(event.Payload + response_offset + 8);
+            }
+
+            auto found = Pending.find(irp);
+            if (found != Pending.end())
+            {
+                if (event.TimeStamp >= found->second.TimeStamp)
+                {
+                    latency = (uint64_t)(event.TimeStamp - found->second.TimeStamp);
+                }
+                thread_id = found->second.ThreadId;
+                Pending.erase(found);
+            }
+            else
+            {
+                ++Unpaired;
+            }
+
+            Disks[disk].add(latency);
+            Processes[Threads.process(thread_id)].add(latency);
+            Files[file].add(latency);
+        }
+
+        // Irp of the requests not completed yet
+        std::unordered_map<uint64_t, request> Pending;
+        etl_thread_processes Threads;
+        std::unordered_map<ULONG, etl_histogram> Disks;
+        std::unordered_map<ULONG, etl_histogram> Processes;
+        std::unordered_map<uint64_t, etl_histogram> Files;
+        uint64_t Unpaired = 0;
+    };
+
+} // namespace phnt
@@ -0,0 +1,269 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Kernel event dispatch==
+//
+// Maps the hook (Group | Type), version and pointer size of a kernel record to the
+// structure of its payload. The hook names come from win-polyfill-etl-hook-table.h,
+// generated from ntwmi.h by cmake/generate_etl_hook_table.cmake (build the
+// win-polyfill-etl-hooks target after changing ntwmi.h); the structures of each hook
+// are listed by hand in win-polyfill-etl-payload-table.h. Both are folded by the
+// compiler into one constant table, so a lookup is two indexed loads:
+//
+//   etl_get_hook(hook_id)              etl_hook_info, name and payload by version
+//   etl_get_payload(event)             etl_payload of a record, None if unknown
+//   etl_payloads[payload]              name and size of a payload structure
+//   etl_read_payload(event, payload)   copies the payload if the record carries T
+//
+// A structure is picked by the largest version listed at or below the event version,
+// versions from etl_dispatch_versions on use the last one. Layouts that hold pointers
+// only match traces of their pointer size.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-dispatch.h requires C++"
+#endif
+
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    // Versions told apart by the table, later versions share the last slot
+    constexpr ULONG etl_dispatch_versions = 8;
+
+    enum class etl_payload : UCHAR
+    {
+        None,
+#define PHNT_ETL_PAYLOAD(Struct, PointerSize) Struct,
+#define PHNT_ETL_PAYLOAD_VARIABLE(Struct, PointerSize, Member) Struct,
+#define PHNT_ETL_RECORD(Struct, PointerSize) Struct,
+#define PHNT_ETL_PAYLOAD_HOOK(Hook, Version)
+#include "win-polyfill-etl-payload-table.h"
+#undef PHNT_ETL_PAYLOAD
+#undef PHNT_ETL_PAYLOAD_VARIABLE
+#undef PHNT_ETL_RECORD
+#undef PHNT_ETL_PAYLOAD_HOOK
+        Maximum
+    };
+
+    struct etl_payload_info
+    {
+        const char *Name;
+        // Bytes the record must hold for the structure to be read, counted from the
+        // payload or, for Record, from the start of the record
+        ULONG MinimumSize;
+        // 0 for any trace, else the pointer size of the traces the layout is valid for
+        UCHAR PointerSize;
+        // The structure starts with the SYSTEM_TRACE_HEADER of the record
+        BOOLEAN Record;
+    };
+
+// The last member of a structure ends within its last alignof() bytes, the rest is
+// tail padding that the logger does not write.
+#define PHNT_ETL_FIXED_SIZE(Struct) (ULONG)(sizeof(Struct) - alignof(Struct) + 1)
+
+    constexpr etl_payload_info etl_payloads[] = {
+        {nullptr, 0, 0, FALSE},
+#define PHNT_ETL_PAYLOAD(Struct, PointerSize)                                            \
+    {#Struct, PHNT_ETL_FIXED_SIZE(Struct), PointerSize, FALSE},
+#define PHNT_ETL_PAYLOAD_VARIABLE(Struct, PointerSize, Member)                           \
+    {#Struct, FIELD_OFFSET(Struct, Member), PointerSize, FALSE},
+#define PHNT_ETL_RECORD(Struct, PointerSize)                                             \
+    {#Struct, PHNT_ETL_FIXED_SIZE(Struct), PointerSize, TRUE},
+#define PHNT_ETL_PAYLOAD_HOOK(Hook, Version)
+#include "win-polyfill-etl-payload-table.h"
+#undef PHNT_ETL_PAYLOAD
+#undef PHNT_ETL_PAYLOAD_VARIABLE
+#undef PHNT_ETL_RECORD
+#undef PHNT_ETL_PAYLOAD_HOOK
+    };
+
+#undef PHNT_ETL_FIXED_SIZE
+
+    template <class T> struct etl_payload_of;
+
+#define PHNT_ETL_PAYLOAD(Struct, PointerSize)                                            \
+    template <> struct etl_payload_of<Struct>                                            \
+    {                                                                                    \
+        static constexpr etl_payload value = etl_payload::Struct;                        \
+    };
+#define PHNT_ETL_PAYLOAD_VARIABLE(Struct, PointerSize, Member)                           \
+    PHNT_ETL_PAYLOAD(Struct, PointerSize)
+#define PHNT_ETL_RECORD(Struct, PointerSize) PHNT_ETL_PAYLOAD(Struct, PointerSize)
+#define PHNT_ETL_PAYLOAD_HOOK(Hook, Version)
+#include "win-polyfill-etl-payload-table.h"
+#undef PHNT_ETL_PAYLOAD
+#undef PHNT_ETL_PAYLOAD_VARIABLE
+#undef PHNT_ETL_RECORD
+#undef PHNT_ETL_PAYLOAD_HOOK
+
+    struct etl_hook_info
+    {
+        // The WMI_LOG_TYPE_ or PERFINFO_LOG_TYPE_ macro, nullptr for unknown hooks
+        const char *Name;
+        USHORT HookId;
+        // By pointer size (4, 8) and version
+        etl_payload Payload[2][etl_dispatch_versions];
+    };
+
+    // Hooks in both tables, an upper bound of the hooks with an entry
+    constexpr ULONG etl_hook_capacity = 1
+#define PHNT_ETL_HOOK(Hook) +1
+#include "win-polyfill-etl-hook-table.h"
+#undef PHNT_ETL_HOOK
+#define PHNT_ETL_PAYLOAD(Struct, PointerSize)
+#define PHNT_ETL_PAYLOAD_VARIABLE(Struct, PointerSize, Member)
+#define PHNT_ETL_RECORD(Struct, PointerSize)
+#define PHNT_ETL_PAYLOAD_HOOK(Hook, Version) +1
+#include "win-polyfill-etl-payload-table.h"
+#undef PHNT_ETL_PAYLOAD
+#undef PHNT_ETL_PAYLOAD_VARIABLE
+#undef PHNT_ETL_RECORD
+#undef PHNT_ETL_PAYLOAD_HOOK
+        ;
+
+    struct etl_dispatch_table
+    {
+        // Entry in Hooks of each HookId, 0 (no name, no payload) for unknown hooks
+        USHORT Index[MAX_KERNEL_TRACE_EVENTS << 8];
+        etl_hook_info Hooks[etl_hook_capacity];
+        USHORT HookCount;
+    };
+
+    class etl_dispatch_builder
+    {
+      public:
+        constexpr etl_dispatch_table build()
+        {
+            Table.HookCount = 1;
+#define PHNT_ETL_HOOK(Hook) add_hook(Hook, #Hook);
+#include "win-polyfill-etl-hook-table.h"
+#undef PHNT_ETL_HOOK
+#define PHNT_ETL_PAYLOAD(Struct, PointerSize) Current = etl_payload::Struct;
+#define PHNT_ETL_PAYLOAD_VARIABLE(Struct, PointerSize, Member)                           \
+    PHNT_ETL_PAYLOAD(Struct, PointerSize)
+#define PHNT_ETL_RECORD(Struct, PointerSize) PHNT_ETL_PAYLOAD(Struct, PointerSize)
+#define PHNT_ETL_PAYLOAD_HOOK(Hook, Version) add_payload(Hook, #Hook, Version);
+#include "win-polyfill-etl-payload-table.h"
+#undef PHNT_ETL_PAYLOAD
+#undef PHNT_ETL_PAYLOAD_VARIABLE
+#undef PHNT_ETL_RECORD
+#undef PHNT_ETL_PAYLOAD_HOOK
+            return Table;
+        }
+
+      private:
+        constexpr USHORT add_hook(USHORT HookId, const char *Name)
+        {
+            if ((HookId >> 8) >= MAX_KERNEL_TRACE_EVENTS)
+            {
+                return 0;
+            }
+            if (Table.Index[HookId] == 0)
+            {
+                // Some hooks have two names, the first one is kept
+                etl_hook_info &hook = Table.Hooks[Table.HookCount];
+                hook.Name = Name;
+                hook.HookId = HookId;
+                Table.Index[HookId] = Table.HookCount++;
+            }
+            return Table.Index[HookId];
+        }
+
+        constexpr void add_payload(USHORT HookId, const char *Name, USHORT Version)
+        {
+            USHORT index = add_hook(HookId, Name);
+            if (index == 0)
+            {
+                return;
+            }
+            UCHAR pointer_size = etl_payloads[(ULONG)Current].PointerSize;
+            for (ULONG p = 0; p < 2; ++p)
+            {
+                if (pointer_size != 0 && pointer_size != (p ? 8 : 4))
+                {
+                    continue;
+                }
+                for (ULONG v = Version; v < etl_dispatch_versions; ++v)
+                {
+                    // Since is the listed version + 1, 0 for an empty slot
+                    UCHAR &since = Since[index][p][v];
+                    if (since == 0 || since - 1 < Version)
+                    {
+                        Table.Hooks[index].Payload[p][v] = Current;
+                        since = (UCHAR)(Version + 1);
+                    }
+                }
+            }
+        }
+
+        etl_dispatch_table Table = {};
+        UCHAR Since[etl_hook_capacity][2][etl_dispatch_versions] = {};
+        etl_payload Current = etl_payload::None;
+    };
+
+    inline constexpr etl_dispatch_table etl_dispatch = etl_dispatch_builder().build();
+
+    constexpr const etl_hook_info &etl_get_hook(USHORT HookId)
+    {
+        return etl_dispatch.Hooks
+            [(HookId >> 8) < MAX_KERNEL_TRACE_EVENTS ? etl_dispatch.Index[HookId] : 0];
+    }
+
+    constexpr etl_payload
+    etl_get_payload(USHORT HookId, USHORT Version, UCHAR PointerSize)
+    {
+        return etl_get_hook(HookId)
+            .Payload[PointerSize == 8 ? 1 : 0]
+                    [Version < etl_dispatch_versions ? Version
+                                                     : etl_dispatch_versions - 1];
+    }
+
+    inline etl_payload etl_get_payload(const etl_event &event)
+    {
+        if (!etl_get_header_info(event.HeaderType).SizeInPacket)
+        {
+            return etl_payload::None;
+        }
+        return etl_get_payload(event.HookId, event.Version, event.PointerSize);
+    }
+
+    // Copies the payload of event to payload if the table lists T for the event, the
+    // bytes past the end of the record are zeroed.
+    template <class T> bool etl_read_payload(const etl_event &event, T &payload)
+    {
+        constexpr etl_payload id = etl_payload_of<T>::value;
+        if (etl_get_payload(event) != id)
+        {
+            return false;
+        }
+        const etl_payload_info &info = etl_payloads[(ULONG)id];
+        const UCHAR *data = event.Payload;
+        ULONG size = event.PayloadSize;
+        if (info.Record)
+        {
+            etl_header_info header = etl_get_header_info(event.HeaderType);
+            if (header.HeaderSize != sizeof(SYSTEM_TRACE_HEADER))
+            {
+                return false;
+            }
+            data = event.Data;
+            size = event.Size;
+        }
+        if (size < info.MinimumSize)
+        {
+            return false;
+        }
+        memset(&payload, 0, sizeof(T));
+        memcpy(&payload, data, size < sizeof(T) ? size : sizeof(T));
+        return true;
+    }
+
+    C_ASSERT(RTL_NUMBER_OF(etl_payloads) == (ULONG)etl_payload::Maximum);
+    C_ASSERT(etl_hook_capacity <= 0x10000);
+
+} // namespace phnt
@@ -0,0 +1,276 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==DPC and interrupt latency==
+//
+// Times the deferred procedure calls and interrupt service routines of the kernel
+// from the PERFINFO events:
+//
+//   PERFINFO_LOG_TYPE_DPC, _TIMERDPC,       PERFINFO_DPC_INFORMATION, logged when the
+//   _THREADED_DPC                           routine returns, InitialTime is its start
+//   PERFINFO_LOG_TYPE_INTERRUPT,            PERFINFO_INTERRUPT_INFORMATION, the same
+//   _MSI_INTERRUPT                          for an ISR
+//   PERFINFO_LOG_TYPE_DPC_ENQUEUE           PERFINFO_DPC_ENQUEUE_INFORMATION, a DPC
+//                                           object is queued
+//   PERFINFO_LOG_TYPE_DPC_EXECUTION         PERFINFO_DPC_EXECUTION_INFORMATION, it is
+//                                           taken off the queue to run
+//   PERFINFO_LOG_TYPE_CLOCK_INTERRUPT       PERFINFO_CLOCK_INTERRUPT_INFORMATION
+//
+// The execution time (InitialTime to the event) goes to the etl_histogram of the
+// routine and of the processor it ran on; the enqueue to execute delay pairs the two
+// events by the Key of the DPC object, which is queued once at most. The processor is
+// ProcessorIndex of the buffer, so a routine also sums its time per processor, which
+// shows the driver keeping one CPU busy. Clock interrupts count per processor along
+// with the time between two of them.
+//
+//   etl_dpc_analyzer::consume(event)   DPC, interrupt and clock events
+//   etl_dpc_analyzer::merge(other)     adds the results of another decoder
+//   etl_dpc_analyzer::routines()       etl_dpc_routine_stats by routine address
+//   etl_dpc_analyzer::processors()     etl_dpc_processor_stats by ProcessorIndex
+//
+// Routines are kernel addresses, etl_image_map::find(0, time, routine) names the
+// driver. Decoders that run on separate buffers miss the enqueues queued on another
+// processor than the one they execute on.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-dpc.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    enum class etl_dpc_kind : UCHAR
+    {
+        Dpc,
+        TimerDpc,
+        ThreadedDpc,
+        Interrupt
+    };
+
+    struct etl_dpc_routine_stats
+    {
+        uint64_t Routine;
+        // Of the last run; a routine seen only through DPC_EXECUTION is a Dpc
+        etl_dpc_kind Kind;
+        // Of the last interrupt, 0 for DPCs
+        USHORT Vector;
+        uint64_t TotalTime;
+        // InitialTime to the end, and DPC_ENQUEUE to DPC_EXECUTION, in the clock of the
+        // trace
+        etl_histogram ExecutionTimes;
+        etl_histogram QueueDelays;
+        // Execution time by ProcessorIndex
+        std::vector<uint64_t> ProcessorTime;
+    };
+
+    struct etl_dpc_processor_stats
+    {
+        etl_histogram DpcTimes;
+        etl_histogram InterruptTimes;
+        etl_histogram QueueDelays;
+        uint64_t ClockInterrupts;
+        // Between two clock interrupts of the processor
+        etl_histogram ClockIntervals;
+    };
+
+    class etl_dpc_analyzer
+    {
+      public:
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG p = event.PointerSize;
+            const UCHAR *data = event.Payload;
+            const ULONG size = event.PayloadSize;
+            switch (event.HookId)
+            {
+            case PERFINFO_LOG_TYPE_DPC:
+            case PERFINFO_LOG_TYPE_TIMERDPC:
+            case PERFINFO_LOG_TYPE_THREADED_DPC:
+                // InitialTime, DpcRoutine
+                if (size >= 8 + p)
+                {
+                    etl_dpc_kind kind = etl_dpc_kind::ThreadedDpc;
+                    if (event.HookId == PERFINFO_LOG_TYPE_DPC)
+                    {
+                        kind = etl_dpc_kind::Dpc;
+                    }
+                    else if (event.HookId == PERFINFO_LOG_TYPE_TIMERDPC)
+                    {
+                        kind = etl_dpc_kind::TimerDpc;
+                    }
+                    uint64_t time =
+                        etl_elapsed(etl_load<ULONGLONG>(data), event.TimeStamp);
+                    etl_dpc_routine_stats &routine =
+                        find_routine(etl_load_pointer(data + 8, p));
+                    routine.Kind = kind;
+                    run(routine, event.ProcessorIndex, time);
+                    processor(event.ProcessorIndex).DpcTimes.add(time);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_INTERRUPT:
+            case PERFINFO_LOG_TYPE_MSI_INTERRUPT:
+                // InitialTime, ServiceRoutine, ReturnValue, Vector, packed
+                if (size >= 8 + p + 3)
+                {
+                    uint64_t time =
+                        etl_elapsed(etl_load<ULONGLONG>(data), event.TimeStamp);
+                    etl_dpc_routine_stats &routine =
+                        find_routine(etl_load_pointer(data + 8, p));
+                    routine.Kind = etl_dpc_kind::Interrupt;
+                    routine.Vector = etl_load<USHORT>(data + 8 + p + 1);
+                    run(routine, event.ProcessorIndex, time);
+                    processor(event.ProcessorIndex).InterruptTimes.add(time);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_DPC_ENQUEUE:
+                // Key, DpcQueueDepth, DpcCount, TargetProcessorIndex, Importance
+                if (size >= p)
+                {
+                    Queued[etl_load_pointer(data, p)] = event.TimeStamp;
+                }
+                break;
+            case PERFINFO_LOG_TYPE_DPC_EXECUTION:
+                // DpcRoutine, Key
+                if (size >= 2 * p)
+                {
+                    auto found = Queued.find(etl_load_pointer(data + p, p));
+                    if (found != Queued.end())
+                    {
+                        uint64_t delay = etl_elapsed(found->second, event.TimeStamp);
+                        Queued.erase(found);
+                        find_routine(etl_load_pointer(data, p)).QueueDelays.add(delay);
+                        processor(event.ProcessorIndex).QueueDelays.add(delay);
+                    }
+                }
+                break;
+            case PERFINFO_LOG_TYPE_CLOCK_INTERRUPT:
+            {
+                etl_dpc_processor_stats &stats = processor(event.ProcessorIndex);
+                ++stats.ClockInterrupts;
+                int64_t &last = LastClock[event.ProcessorIndex];
+                if (stats.ClockInterrupts > 1)
+                {
+                    stats.ClockIntervals.add(etl_elapsed(last, event.TimeStamp));
+                }
+                last = event.TimeStamp;
+                break;
+            }
+            }
+        }
+
+        // Processors, and the routine time on them, add up; routines are matched by
+        // address
+        void merge(const etl_dpc_analyzer &Other)
+        {
+            for (const etl_dpc_routine_stats &other : Other.Routines)
+            {
+                etl_dpc_routine_stats &routine = find_routine(other.Routine);
+                if (other.ExecutionTimes.count() != 0)
+                {
+                    routine.Kind = other.Kind;
+                    routine.Vector = other.Vector;
+                }
+                routine.TotalTime += other.TotalTime;
+                routine.ExecutionTimes.merge(other.ExecutionTimes);
+                routine.QueueDelays.merge(other.QueueDelays);
+                if (routine.ProcessorTime.size() < other.ProcessorTime.size())
+                {
+                    routine.ProcessorTime.resize(other.ProcessorTime.size());
+                }
+                for (size_t i = 0; i < other.ProcessorTime.size(); ++i)
+                {
+                    routine.ProcessorTime[i] += other.ProcessorTime[i];
+                }
+            }
+            for (size_t i = 0; i < Other.Processors.size(); ++i)
+            {
+                const etl_dpc_processor_stats &other = Other.Processors[i];
+                etl_dpc_processor_stats &stats = processor((USHORT)i);
+                stats.DpcTimes.merge(other.DpcTimes);
+                stats.InterruptTimes.merge(other.InterruptTimes);
+                stats.QueueDelays.merge(other.QueueDelays);
+                stats.ClockInterrupts += other.ClockInterrupts;
+                stats.ClockIntervals.merge(other.ClockIntervals);
+            }
+        }
+
+        // In order of first appearance
+        const std::vector<etl_dpc_routine_stats> &routines() const { return Routines; }
+
+        // nullptr for a routine not in the trace
+        const etl_dpc_routine_stats *routine(uint64_t Routine) const
+        {
+            auto found = RoutineIds.find(Routine);
+            return found != RoutineIds.end() ? &Routines[found->second] : nullptr;
+        }
+
+        // Up to the highest ProcessorIndex seen
+        const std::vector<etl_dpc_processor_stats> &processors() const
+        {
+            return Processors;
+        }
+
+      private:
+        etl_dpc_routine_stats &find_routine(uint64_t Routine)
+        {
+            auto found = RoutineIds.find(Routine);
+            if (found != RoutineIds.end())
+            {
+                return Routines[found->second];
+            }
+            RoutineIds[Routine] = (ULONG)Routines.size();
+            Routines.emplace_back();
+            etl_dpc_routine_stats &routine = Routines.back();
+            routine.Routine = Routine;
+            routine.Kind = etl_dpc_kind::Dpc;
+            routine.Vector = 0;
+            routine.TotalTime = 0;
+            return routine;
+        }
+
+        etl_dpc_processor_stats &processor(USHORT ProcessorIndex)
+        {
+            if (ProcessorIndex >= Processors.size())
+            {
+                Processors.resize((size_t)ProcessorIndex + 1);
+                LastClock.resize((size_t)ProcessorIndex + 1);
+            }
+            return Processors[ProcessorIndex];
+        }
+
+        void run(etl_dpc_routine_stats &Routine, USHORT ProcessorIndex, uint64_t Time)
+        {
+            Routine.TotalTime += Time;
+            Routine.ExecutionTimes.add(Time);
+            if (ProcessorIndex >= Routine.ProcessorTime.size())
+            {
+                Routine.ProcessorTime.resize((size_t)ProcessorIndex + 1);
+            }
+            Routine.ProcessorTime[ProcessorIndex] += Time;
+        }
+
+        std::vector<etl_dpc_routine_stats> Routines;
+        std::unordered_map<uint64_t, ULONG> RoutineIds;
+        std::vector<etl_dpc_processor_stats> Processors;
+        // Time of the last clock interrupt by ProcessorIndex
+        std::vector<int64_t> LastClock;
+        // DPC_ENQUEUE time by Key
+        std::unordered_map<uint64_t, int64_t> Queued;
+    };
+
+} // namespace phnt
@@ -0,0 +1,251 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Page faults==
+//
+// Classifies the WMI_PAGE_FAULT events by their type (transition, demand zero, copy
+// on write, guard page, hard fault, access violation) and counts them per process and
+// in time buckets. A hard fault is logged twice:
+//
+//   WMI_LOG_TYPE_PAGE_FAULT_HARD_PAGE_FAULT   WMI_PAGE_FAULT, by the faulting thread
+//                                             when it faults
+//   PERFINFO_LOG_TYPE_HARDFAULT               PERFINFO_HARDPAGEFAULT_INFORMATION, when
+//                                             the read completes
+//
+// The faulting thread waits for the read, so it has one hard fault pending at most;
+// the two are paired by ThreadId and the page of VirtualAddress and the time between
+// them is the stall. A completion without its fault counts as a hard fault without
+// stall time. The FileObject of the completion is named through the etl_file_resolver
+// given to the constructor, which has to consume the same events first, and the faults
+// are summed per path.
+//
+//   etl_fault_analyzer::consume(event)    thread, fault and file name events
+//   etl_fault_analyzer::processes()       etl_fault_stats by process
+//   etl_fault_analyzer::for_each_file(f)  hard faults by path
+//   etl_fault_analyzer::heatmap()         etl_fault_bucket per BucketWidth of time
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-fault.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "win-polyfill-etl-fileio.h"
+
+namespace phnt
+{
+
+    enum class etl_fault_kind : UCHAR
+    {
+        Transition,
+        DemandZero,
+        CopyOnWrite,
+        GuardPage,
+        Hard,
+        AccessViolation,
+        Maximum
+    };
+
+    struct etl_fault_stats
+    {
+        uint64_t Faults[(size_t)etl_fault_kind::Maximum];
+        // Bytes read by the hard faults
+        uint64_t HardBytes;
+        // Time from hard fault to its read completing, in the clock of the trace
+        uint64_t StallTime;
+    };
+
+    struct etl_fault_bucket
+    {
+        uint64_t Faults[(size_t)etl_fault_kind::Maximum];
+        uint64_t StallTime;
+    };
+
+    struct etl_fault_heatmap
+    {
+        // Time of Buckets[0], a multiple of BucketWidth
+        int64_t Start;
+        uint64_t BucketWidth;
+        std::vector<etl_fault_bucket> Buckets;
+    };
+
+    class etl_fault_analyzer
+    {
+      public:
+        // BucketWidth of the heatmap in the clock of the trace
+        etl_fault_analyzer(const etl_file_resolver &Files, uint64_t BucketWidth)
+            : Files(Files)
+        {
+            Heatmap.Start = 0;
+            Heatmap.BucketWidth = BucketWidth ? BucketWidth : 1;
+        }
+
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG p = event.PointerSize;
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_THREAD_CREATE:
+            case WMI_LOG_TYPE_THREAD_DC_START:
+                Threads.consume(event);
+                break;
+            case WMI_LOG_TYPE_PAGE_FAULT_TRANSITION:
+            case WMI_LOG_TYPE_PAGE_FAULT_DEMAND_ZERO:
+            case WMI_LOG_TYPE_PAGE_FAULT_COPY_ON_WRITE:
+            case WMI_LOG_TYPE_PAGE_FAULT_GUARD_PAGE:
+            case WMI_LOG_TYPE_PAGE_FAULT_HARD_PAGE_FAULT:
+            case WMI_LOG_TYPE_PAGE_FAULT_ACCESS_VIOLATION:
+                // VirtualAddress, ProgramCounter
+                if (event.PayloadSize >= p)
+                {
+                    UCHAR kind =
+                        (UCHAR)event.HookId - (UCHAR)WMI_LOG_TYPE_PAGE_FAULT_TRANSITION;
+                    fault(
+                        event, (etl_fault_kind)kind, etl_load_pointer(event.Payload, p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_HARDFAULT:
+                // ReadOffset, VirtualAddress, FileObject, ThreadId, ByteCount
+                if (event.PayloadSize >= 8 + 2 * p + 8)
+                {
+                    const UCHAR *data = event.Payload;
+                    hard_fault_done(
+                        event.TimeStamp,
+                        etl_load_pointer(data + 8, p),
+                        etl_load_pointer(data + 8 + p, p),
+                        etl_load<ULONG>(data + 8 + 2 * p),
+                        etl_load<ULONG>(data + 8 + 2 * p + 4));
+                }
+                break;
+            }
+        }
+
+        // Faults of threads of unknown process are under etl_no_process
+        const std::unordered_map<ULONG, etl_fault_stats> &processes() const
+        {
+            return Processes;
+        }
+
+        // f(std::string_view path, const etl_fault_stats &), files of unknown name under
+        // ""; only Faults[Hard], HardBytes and StallTime are set
+        template <class F> void for_each_file(F &&f) const
+        {
+            for (const auto &file : FileStats)
+            {
+                f(Files.names().str(file.first), file.second);
+            }
+        }
+
+        const etl_fault_heatmap &heatmap() const { return Heatmap; }
+
+        // Hard faults still waiting for their read
+        size_t pending() const { return Pending.size(); }
+
+      private:
+        struct hard_fault
+        {
+            int64_t TimeStamp;
+            uint64_t Page;
+            ULONG ProcessId;
+        };
+
+        static constexpr uint64_t page_mask = ~(uint64_t)0xFFF;
+
+        etl_fault_bucket &bucket(LONGLONG TimeStamp)
+        {
+            const int64_t width = (int64_t)Heatmap.BucketWidth;
+            int64_t start = TimeStamp - ((TimeStamp % width) + width) % width;
+            if (Heatmap.Buckets.empty())
+            {
+                Heatmap.Start = start;
+            }
+            else if (start < Heatmap.Start)
+            {
+                // An event older than the first one, when fed out of time order
+                size_t missing = (size_t)((Heatmap.Start - start) / width);
+                Heatmap.Buckets.insert(
+                    Heatmap.Buckets.begin(), missing, etl_fault_bucket());
+                Heatmap.Start = start;
+            }
+            size_t index = (size_t)((start - Heatmap.Start) / width);
+            if (index >= Heatmap.Buckets.size())
+            {
+                Heatmap.Buckets.resize(index + 1);
+            }
+            return Heatmap.Buckets[index];
+        }
+
+        void fault(const etl_event &event, etl_fault_kind Kind, uint64_t VirtualAddress)
+        {
+            ULONG process_id = event.ProcessId != etl_no_id
+                                   ? event.ProcessId
+                                   : Threads.process(event.ThreadId);
+            ++Processes[process_id].Faults[(size_t)Kind];
+            ++bucket(event.TimeStamp).Faults[(size_t)Kind];
+            if (Kind == etl_fault_kind::Hard && event.ThreadId != etl_no_id)
+            {
+                Pending[event.ThreadId] = {
+                    event.TimeStamp, VirtualAddress & page_mask, process_id};
+            }
+        }
+
+        void hard_fault_done(
+            LONGLONG TimeStamp,
+            uint64_t VirtualAddress,
+            uint64_t FileObject,
+            ULONG ThreadId,
+            ULONG ByteCount)
+        {
+            ULONG process_id;
+            uint64_t stall = 0;
+            auto found = Pending.find(ThreadId);
+            if (found != Pending.end() &&
+                found->second.Page == (VirtualAddress & page_mask))
+            {
+                process_id = found->second.ProcessId;
+                if (TimeStamp > found->second.TimeStamp)
+                {
+                    stall = (uint64_t)(TimeStamp - found->second.TimeStamp);
+                }
+                // The fault is in the bucket of its start, the stall in that of its end
+                Pending.erase(found);
+            }
+            else
+            {
+                process_id = Threads.process(ThreadId);
+                ++Processes[process_id].Faults[(size_t)etl_fault_kind::Hard];
+                ++bucket(TimeStamp).Faults[(size_t)etl_fault_kind::Hard];
+            }
+            etl_fault_stats &process = Processes[process_id];
+            process.HardBytes += ByteCount;
+            process.StallTime += stall;
+            bucket(TimeStamp).StallTime += stall;
+
+            etl_fault_stats &file = FileStats[Files.name_id(FileObject)];
+            ++file.Faults[(size_t)etl_fault_kind::Hard];
+            file.HardBytes += ByteCount;
+            file.StallTime += stall;
+        }
+
+        const etl_file_resolver &Files;
+        etl_thread_processes Threads;
+        // By ThreadId
+        std::unordered_map<ULONG, hard_fault> Pending;
+        std::unordered_map<ULONG, etl_fault_stats> Processes;
+        // By id in Files.names()
+        std::unordered_map<ULONG, etl_fault_stats> FileStats;
+        etl_fault_heatmap Heatmap;
+    };
+
+} // namespace phnt
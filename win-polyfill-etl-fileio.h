@@ -0,0 +1,297 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==File I/O by path==
+//
+// File I/O events (PERFINFO_FILE_CREATE, PERFINFO_FILE_READ_WRITE,
+// PERFINFO_FILE_SIMPLE_OPERATION, PERFINFO_FILE_INFORMATION, ...) name the file by
+// FileObject and FileKey pointers, the name comes in separate events:
+//
+//   PERFINFO_LOG_TYPE_FILENAME, _FILENAME_CREATE, _FILENAME_RUNDOWN
+//                                 PERFINFO_FILEOBJECT_INFORMATION, then the name
+//   PERFINFO_LOG_TYPE_FILENAME_DELETE
+//                                 the object is freed, its pointer may be reused
+//   PERFINFO_LOG_TYPE_FILENAME_SAME
+//                                 PERFINFO_FILENAME_SAME_INFORMATION, NewFile has the
+//                                 name of OldFile
+//
+// etl_file_resolver follows them as a stream: a name is looked up by FileKey first,
+// then by FileObject, and PERFINFO_LOG_TYPE_FILE_IO_CREATE names its FileObject from
+// OpenPath until a FILENAME event says otherwise. A FileObject is forgotten when it
+// is closed and a key when the FILENAME_DELETE comes, so a reused pointer never takes
+// the name of the file it used to point to. Operations are paired with their
+// PERFINFO_FILE_OPERATION_END by Irp and summed per path; paths are interned once in
+// an etl_string_table and the stats are indexed by the string id.
+//
+//   etl_file_resolver::consume(event)    file name and file I/O events, in time order
+//   etl_file_resolver::name(key)         the path of a FileObject or FileKey
+//   etl_file_resolver::for_each_path(f)  f(path, etl_file_stats) of each path with I/O
+//
+// Operations on files of unknown name are summed under the empty path.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-fileio.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "win-polyfill-etl-strings.h"
+
+namespace phnt
+{
+
+    enum class etl_file_op : UCHAR
+    {
+        Create,
+        Read,
+        Write,
+        // Cleanup, close, flush, information, directory and path operations
+        Other,
+        Maximum
+    };
+
+    struct etl_file_stats
+    {
+        uint64_t Count[(size_t)etl_file_op::Maximum];
+        // Sum of the times from operation to OPERATION_END, in the clock of the trace
+        uint64_t Duration[(size_t)etl_file_op::Maximum];
+        // From ExtraInformation of the OPERATION_END of reads and writes
+        uint64_t ReadBytes;
+        uint64_t WriteBytes;
+    };
+
+    class etl_file_resolver
+    {
+      public:
+        etl_file_resolver()
+        {
+            // Id 0, files without a name
+            Names.intern(std::string_view());
+        }
+
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG p = event.PointerSize;
+            const UCHAR *data = event.Payload;
+            const ULONG size = event.PayloadSize;
+            switch (event.HookId)
+            {
+            case PERFINFO_LOG_TYPE_FILENAME:
+            case PERFINFO_LOG_TYPE_FILENAME_CREATE:
+            case PERFINFO_LOG_TYPE_FILENAME_RUNDOWN:
+                if (size >= p)
+                {
+                    ULONG name = Names.intern(etl_utf8(data + p, size - p));
+                    Keys[etl_load_pointer(data, p)] = name;
+                }
+                break;
+            case PERFINFO_LOG_TYPE_FILENAME_DELETE:
+                if (size >= p)
+                {
+                    Keys.erase(etl_load_pointer(data, p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_FILENAME_SAME:
+                if (size >= 2 * p)
+                {
+                    uint64_t old_file = etl_load_pointer(data, p);
+                    ULONG name = resolve(old_file, old_file);
+                    if (name != 0)
+                    {
+                        Keys[etl_load_pointer(data + p, p)] = name;
+                    }
+                }
+                break;
+            case PERFINFO_LOG_TYPE_FILE_IO_CREATE:
+            case PERFINFO_LOG_TYPE_FILE_IO_CREATE_NEW:
+                // Irp, FileObject, IssuingThreadId, Options, Attributes, ShareAccess and
+                // OpenPath
+                if (size >= 2 * p + 16)
+                {
+                    uint64_t file_object = etl_load_pointer(data + p, p);
+                    ULONG name =
+                        Names.intern(etl_utf8(data + 2 * p + 16, size - 2 * p - 16));
+                    // A name left by an object that used to live at this address
+                    Keys.erase(file_object);
+                    Objects[file_object] = name;
+                    start(
+                        etl_load_pointer(data, p),
+                        event.TimeStamp,
+                        name,
+                        etl_file_op::Create);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_FILE_IO_READ:
+            case PERFINFO_LOG_TYPE_FILE_IO_WRITE:
+                // Offset, then Irp, FileObject and FileKey
+                if (size >= 8 + 3 * p)
+                {
+                    ULONG name = resolve(
+                        etl_load_pointer(data + 8 + 2 * p, p),
+                        etl_load_pointer(data + 8 + p, p));
+                    etl_file_op op = event.HookId == PERFINFO_LOG_TYPE_FILE_IO_READ
+                                         ? etl_file_op::Read
+                                         : etl_file_op::Write;
+                    start(etl_load_pointer(data + 8, p), event.TimeStamp, name, op);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_FILE_IO_CLEANUP:
+            case PERFINFO_LOG_TYPE_FILE_IO_CLOSE:
+            case PERFINFO_LOG_TYPE_FILE_IO_FLUSH:
+            case PERFINFO_LOG_TYPE_FILE_IO_SET_INFORMATION:
+            case PERFINFO_LOG_TYPE_FILE_IO_DELETE:
+            case PERFINFO_LOG_TYPE_FILE_IO_RENAME:
+            case PERFINFO_LOG_TYPE_FILE_IO_QUERY_INFORMATION:
+            case PERFINFO_LOG_TYPE_FILE_IO_FS_CONTROL:
+            case PERFINFO_LOG_TYPE_FILE_IO_SETLINK:
+            case PERFINFO_LOG_TYPE_FILE_IO_DIRENUM:
+            case PERFINFO_LOG_TYPE_FILE_IO_DIRNOTIFY:
+            case PERFINFO_LOG_TYPE_FILE_IO_DELETE_PATH:
+            case PERFINFO_LOG_TYPE_FILE_IO_RENAME_PATH:
+            case PERFINFO_LOG_TYPE_FILE_IO_SETLINK_PATH:
+                // All of them open with Irp, FileObject and FileKey
+                if (size >= 3 * p)
+                {
+                    uint64_t file_object = etl_load_pointer(data + p, p);
+                    ULONG name = resolve(etl_load_pointer(data + 2 * p, p), file_object);
+                    start(
+                        etl_load_pointer(data, p),
+                        event.TimeStamp,
+                        name,
+                        etl_file_op::Other);
+                    if (event.HookId == PERFINFO_LOG_TYPE_FILE_IO_CLOSE)
+                    {
+                        Objects.erase(file_object);
+                    }
+                }
+                break;
+            case PERFINFO_LOG_TYPE_FILE_IO_OPERATION_END:
+                // Irp, ExtraInformation, Status
+                if (size >= 2 * p)
+                {
+                    end(etl_load_pointer(data, p),
+                        event.TimeStamp,
+                        etl_load_pointer(data + p, p));
+                }
+                break;
+            }
+        }
+
+        // Path of a FileKey or FileObject, empty if unknown
+        std::string_view name(uint64_t Key) const { return Names.str(resolve(Key, Key)); }
+
+        // Id in names() of the path of a FileKey or FileObject, 0 if unknown
+        ULONG name_id(uint64_t Key) const { return resolve(Key, Key); }
+
+        // f(std::string_view path, const etl_file_stats &), unknown files under ""
+        template <class F> void for_each_path(F &&f) const
+        {
+            for (size_t i = 0; i < Stats.size(); ++i)
+            {
+                if (Stats[i].Used)
+                {
+                    const etl_file_stats &stats = Stats[i].Stats;
+                    f(Names.str((ULONG)i), stats);
+                }
+            }
+        }
+
+        // Operations without an OPERATION_END yet
+        size_t pending() const { return Pending.size(); }
+
+        const etl_string_table &names() const { return Names; }
+
+      private:
+        struct operation
+        {
+            int64_t TimeStamp;
+            ULONG Name;
+            etl_file_op Op;
+        };
+
+        struct path_stats
+        {
+            etl_file_stats Stats = {};
+            bool Used = false;
+        };
+
+        ULONG resolve(uint64_t FileKey, uint64_t FileObject) const
+        {
+            auto key = Keys.find(FileKey);
+            if (key != Keys.end())
+            {
+                return key->second;
+            }
+            key = Keys.find(FileObject);
+            if (key != Keys.end())
+            {
+                return key->second;
+            }
+            auto object = Objects.find(FileObject);
+            return object != Objects.end() ? object->second : 0;
+        }
+
+        void start(uint64_t Irp, LONGLONG TimeStamp, ULONG Name, etl_file_op Op)
+        {
+            Pending[Irp] = {TimeStamp, Name, Op};
+            path_stats &path = stats(Name);
+            ++path.Stats.Count[(size_t)Op];
+        }
+
+        void end(uint64_t Irp, LONGLONG TimeStamp, uint64_t ExtraInformation)
+        {
+            auto found = Pending.find(Irp);
+            if (found == Pending.end())
+            {
+                return;
+            }
+            const operation &op = found->second;
+            path_stats &path = stats(op.Name);
+            if (TimeStamp > op.TimeStamp)
+            {
+                path.Stats.Duration[(size_t)op.Op] +=
+                    (uint64_t)(TimeStamp - op.TimeStamp);
+            }
+            if (op.Op == etl_file_op::Read)
+            {
+                path.Stats.ReadBytes += ExtraInformation;
+            }
+            else if (op.Op == etl_file_op::Write)
+            {
+                path.Stats.WriteBytes += ExtraInformation;
+            }
+            Pending.erase(found);
+        }
+
+        path_stats &stats(ULONG Name)
+        {
+            if (Name >= Stats.size())
+            {
+                Stats.resize(Names.size());
+            }
+            Stats[Name].Used = true;
+            return Stats[Name];
+        }
+
+        etl_string_table Names;
+        // FileKey or FileObject of the FILENAME events
+        std::unordered_map<uint64_t, ULONG> Keys;
+        // FileObject named by its create, until closed
+        std::unordered_map<uint64_t, ULONG> Objects;
+        std::unordered_map<uint64_t, operation> Pending;
+        // By name id
+        std::vector<path_stats> Stats;
+    };
+
+} // namespace phnt
@@ -0,0 +1,362 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Handle leaks==
+//
+// Follows the object manager events of EVENT_TRACE_GROUP_OBJECT:
+//
+//   PERFINFO_LOG_TYPE_CREATE_HANDLE           ETW_CREATE_HANDLE_EVENT
+//   PERFINFO_LOG_TYPE_CLOSE_HANDLE            ETW_CLOSE_HANDLE_EVENT
+//   PERFINFO_LOG_TYPE_DUPLICATE_HANDLE        ETW_DUPLICATE_HANDLE_EVENT, a new handle in
+//                                             TargetProcessId
+//   PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_*      ETW_OBJECT_HANDLE_EVENT, handles opened
+//                                             before the trace
+//   PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_*        ETW_OBJECT_TYPE_EVENT, the type names
+//   PERFINFO_LOG_TYPE_CREATE_OBJECT           ETW_CREATEDELETE_OBJECT_EVENT
+//   PERFINFO_LOG_TYPE_DELETE_OBJECT           ETW_CREATEDELETE_OBJECT_EVENT
+//   PERFINFO_LOG_TYPE_(DE)REFERENCE_OBJECT    ETW_REFDEREF_OBJECT_EVENT
+//
+// Handles are created and closed in the process of the event header, kernel handles
+// (ETW_KERNEL_HANDLE_MASK) live in the table of the System process. The open handles
+// of all processes share one etl_hash_map keyed by (process, handle) and the objects
+// another one keyed by address. An object counts the handles open to it and the net
+// references taken in the trace; references taken before it are not known, so the
+// count is relative. Deleting an object forgets it, its handles stay until they are
+// closed.
+//
+//   etl_handle_tracker::consume(event)           object events, in time order
+//   etl_handle_tracker::processes()              etl_handle_stats by process
+//   etl_handle_tracker::for_each_outstanding(f)  open handles by type and stack
+//   etl_handle_tracker::object(address)          etl_object_refs of a live object
+//
+// Stacks come from etl_stack_attachments built in a first pass; without them, and for
+// handles from the rundown, every handle is under etl_no_stack.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-handle.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "win-polyfill-etl-hash.h"
+#include "win-polyfill-etl-stack.h"
+#include "win-polyfill-etl-strings.h"
+
+namespace phnt
+{
+
+    struct etl_handle_stats
+    {
+        uint64_t Created;
+        uint64_t Duplicated;
+        uint64_t Closed;
+        // Closes of handles opened before the trace and not in the rundown
+        uint64_t UnknownCloses;
+        uint64_t LiveHandles;
+        uint64_t PeakHandles;
+    };
+
+    struct etl_object_refs
+    {
+        USHORT ObjectType;
+        // PERFINFO_LOG_TYPE_CREATE_OBJECT seen
+        bool Created;
+        ULONG Handles;
+        // References minus dereferences in the trace
+        int64_t References;
+    };
+
+    class etl_handle_tracker
+    {
+      public:
+        // The ProcessId kernel handles are counted under
+        static constexpr ULONG system_process = 4;
+
+        explicit etl_handle_tracker(const etl_stack_attachments *Attachments = nullptr)
+            : Attachments(Attachments)
+        {
+        }
+
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG p = event.PointerSize;
+            const UCHAR *data = event.Payload;
+            const ULONG size = event.PayloadSize;
+            switch (event.HookId)
+            {
+            case PERFINFO_LOG_TYPE_CREATE_HANDLE:
+                // Object, Handle, ObjectType
+                if (size >= p + 6)
+                {
+                    ULONG handle = etl_load<ULONG>(data + p);
+                    ULONG process_id = owner(event.ProcessId, handle);
+                    ++Processes[process_id].Created;
+                    open(
+                        process_id,
+                        handle,
+                        etl_load_pointer(data, p),
+                        etl_load<USHORT>(data + p + 4),
+                        event.TimeStamp,
+                        stack(event));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_CLOSE_HANDLE:
+                if (size >= p + 6)
+                {
+                    ULONG handle = etl_load<ULONG>(data + p);
+                    close(owner(event.ProcessId, handle), handle);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_DUPLICATE_HANDLE:
+                // Object, SourceHandle, TargetHandle, TargetProcessId, ObjectType,
+                // SourceProcessId, packed
+                if (size >= p + 18)
+                {
+                    ULONG handle = etl_load<ULONG>(data + p + 4);
+                    ULONG process_id = owner(etl_load<ULONG>(data + p + 8), handle);
+                    ++Processes[process_id].Duplicated;
+                    open(
+                        process_id,
+                        handle,
+                        etl_load_pointer(data, p),
+                        etl_load<USHORT>(data + p + 12),
+                        event.TimeStamp,
+                        stack(event));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_START:
+            case PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_END:
+                // Object, ProcessId, Handle, ObjectType
+                if (size >= p + 10)
+                {
+                    ULONG handle = etl_load<ULONG>(data + p + 4);
+                    ULONG process_id = owner(etl_load<ULONG>(data + p), handle);
+                    uint64_t object = etl_load_pointer(data, p);
+                    const handle_entry *known = Handles.find(key(process_id, handle));
+                    if (!known || known->Object != object)
+                    {
+                        open(
+                            process_id,
+                            handle,
+                            object,
+                            etl_load<USHORT>(data + p + 8),
+                            INT64_MIN,
+                            etl_no_stack);
+                    }
+                }
+                break;
+            case PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_START:
+            case PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_END:
+                // ObjectType, Reserved, Name
+                if (size >= 4)
+                {
+                    USHORT type = etl_load<USHORT>(data);
+                    if (type >= Types.size())
+                    {
+                        Types.resize((size_t)type + 1);
+                    }
+                    Types[type] = etl_utf8(data + 4, size - 4);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_CREATE_OBJECT:
+                // Object, ObjectType
+                if (size >= p + 2)
+                {
+                    uint64_t address = etl_load_pointer(data, p);
+                    if (address != 0)
+                    {
+                        // A new object at the address of one whose delete we missed
+                        etl_object_refs &object = Objects.insert(address).first;
+                        object = {};
+                        object.ObjectType = etl_load<USHORT>(data + p);
+                        object.Created = true;
+                    }
+                }
+                break;
+            case PERFINFO_LOG_TYPE_DELETE_OBJECT:
+                if (size >= p)
+                {
+                    Objects.erase(etl_load_pointer(data, p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_REFERENCE_OBJECT:
+            case PERFINFO_LOG_TYPE_DEREFERENCE_OBJECT:
+                // Object, Tag, Count
+                if (size >= p + 8)
+                {
+                    uint64_t address = etl_load_pointer(data, p);
+                    if (address != 0)
+                    {
+                        ULONG count = etl_load<ULONG>(data + p + 4);
+                        int64_t delta = count ? count : 1;
+                        if (event.HookId == PERFINFO_LOG_TYPE_DEREFERENCE_OBJECT)
+                        {
+                            delta = -delta;
+                        }
+                        Objects.insert(address).first.References += delta;
+                    }
+                }
+                break;
+            }
+        }
+
+        const std::unordered_map<ULONG, etl_handle_stats> &processes() const
+        {
+            return Processes;
+        }
+
+        // f(ULONG ProcessId, std::string_view Type, ULONG StackId, uint64_t Handles),
+        // most Handles first; types without a rundown name are ""
+        template <class F> void for_each_outstanding(F &&f) const
+        {
+            std::map<std::tuple<ULONG, USHORT, ULONG>, uint64_t> stacks;
+            Handles.for_each([&](uint64_t Key, const handle_entry &open) {
+                ++stacks[std::make_tuple(
+                    (ULONG)(Key >> 32), open.ObjectType, open.StackId)];
+            });
+            std::vector<std::pair<std::tuple<ULONG, USHORT, ULONG>, uint64_t>> sorted(
+                stacks.begin(), stacks.end());
+            std::stable_sort(
+                sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
+                    return a.second > b.second;
+                });
+            for (const auto &stack : sorted)
+            {
+                f(std::get<0>(stack.first),
+                  type_name(std::get<1>(stack.first)),
+                  std::get<2>(stack.first),
+                  stack.second);
+            }
+        }
+
+        // Of PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_*, "" when not in the trace
+        std::string_view type_name(USHORT ObjectType) const
+        {
+            return ObjectType < Types.size() ? std::string_view(Types[ObjectType])
+                                             : std::string_view();
+        }
+
+        // nullptr for objects deleted or never seen
+        const etl_object_refs *object(uint64_t Address) const
+        {
+            return Objects.find(Address);
+        }
+
+        uint64_t live_handles() const { return Handles.size(); }
+
+        uint64_t live_objects() const { return Objects.size(); }
+
+      private:
+        struct handle_entry
+        {
+            uint64_t Object;
+            // INT64_MIN for handles from the rundown
+            int64_t TimeStamp;
+            ULONG StackId;
+            USHORT ObjectType;
+        };
+
+        ULONG stack(const etl_event &event) const
+        {
+            return Attachments ? Attachments->find(event) : etl_no_stack;
+        }
+
+        static ULONG owner(ULONG ProcessId, ULONG Handle)
+        {
+            return (Handle & ETW_KERNEL_HANDLE_MASK) ? system_process : ProcessId;
+        }
+
+        // Handles are multiples of 4, the key of a valid one is never 0
+        static uint64_t key(ULONG ProcessId, ULONG Handle)
+        {
+            return ((uint64_t)ProcessId << 32) | Handle;
+        }
+
+        void open(
+            ULONG ProcessId,
+            ULONG Handle,
+            uint64_t Object,
+            USHORT ObjectType,
+            int64_t TimeStamp,
+            ULONG StackId)
+        {
+            if (Handle == 0)
+            {
+                return;
+            }
+            auto inserted = Handles.insert(key(ProcessId, Handle));
+            handle_entry &entry = inserted.first;
+            etl_handle_stats &stats = Processes[ProcessId];
+            if (inserted.second)
+            {
+                ++stats.LiveHandles;
+                if (stats.LiveHandles > stats.PeakHandles)
+                {
+                    stats.PeakHandles = stats.LiveHandles;
+                }
+            }
+            else
+            {
+                // Opened again without a close we saw, the old handle is gone
+                release(entry.Object);
+            }
+            entry = {Object, TimeStamp, StackId, ObjectType};
+            if (Object != 0)
+            {
+                etl_object_refs &object = Objects.insert(Object).first;
+                object.ObjectType = ObjectType;
+                ++object.Handles;
+            }
+        }
+
+        void close(ULONG ProcessId, ULONG Handle)
+        {
+            etl_handle_stats &stats = Processes[ProcessId];
+            const handle_entry *entry = Handles.find(key(ProcessId, Handle));
+            if (!entry)
+            {
+                ++stats.UnknownCloses;
+                return;
+            }
+            ++stats.Closed;
+            --stats.LiveHandles;
+            release(entry->Object);
+            Handles.erase(key(ProcessId, Handle));
+        }
+
+        void release(uint64_t Address)
+        {
+            etl_object_refs *object = Objects.find(Address);
+            if (object && object->Handles != 0)
+            {
+                --object->Handles;
+            }
+        }
+
+        const etl_stack_attachments *Attachments;
+        std::unordered_map<ULONG, etl_handle_stats> Processes;
+        // By key(process, handle)
+        etl_hash_map<uint64_t, handle_entry> Handles;
+        // By object address
+        etl_hash_map<uint64_t, etl_object_refs> Objects;
+        // By ObjectType
+        std::vector<std::string> Types;
+    };
+
+} // namespace phnt
@@ -0,0 +1,204 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Open addressing hash map==
+//
+// The table the analyzers keep their live entries in (heap blocks, handles, objects,
+// threads), millions of them over traces of hundreds of millions of events: linear
+// probing over a power of two number of slots kept at most half full, and backward
+// shift deletion, which leaves no tombstones. The events cost no allocation beyond the
+// table doubling.
+//
+//   etl_hash_map<Key, T, Hash>(Empty)  Empty marks the free slots and is never a key
+//   insert(key)                        {T &, whether it is new}, new entries are T()
+//   find(key)                          T *, nullptr if absent
+//   erase(key), erase_if(pred)         pred(key, const T &) picks the entries to drop
+//   for_each(f)                        f(key, const T &) in slot order
+//
+// Hash turns a key into 64 bits, the table multiplies them by 2^64 / phi and keeps the
+// high bits of the product (Fibonacci hashing), so keys that only differ in their high
+// bits, or that share their low bits as handles and thread ids (multiples of 4) do,
+// still spread over all slots. Pointers and references to entries are valid until the
+// next insert or erase.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-hash.h requires C++"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace phnt
+{
+
+    // Hash of etl_hash_map for integer keys
+    struct etl_hash_integer
+    {
+        template <class K> uint64_t operator()(K Key) const { return (uint64_t)Key; }
+    };
+
+    template <class K, class T, class Hash = etl_hash_integer> class etl_hash_map
+    {
+      public:
+        explicit etl_hash_map(const K &Empty = K()) : Empty(Empty) { resize(1024); }
+
+        T *find(const K &Key)
+        {
+            size_t i = lookup(Key);
+            return i != SIZE_MAX ? &Table[i].Value : nullptr;
+        }
+
+        const T *find(const K &Key) const
+        {
+            size_t i = lookup(Key);
+            return i != SIZE_MAX ? &Table[i].Value : nullptr;
+        }
+
+        std::pair<T &, bool> insert(const K &Key)
+        {
+            size_t i = probe(Key);
+            if (!(Table[i].Key == Empty))
+            {
+                return {Table[i].Value, false};
+            }
+            if (2 * (Count + 1) > Table.size())
+            {
+                resize(2 * Table.size());
+                i = probe(Key);
+            }
+            Table[i].Key = Key;
+            Table[i].Value = T();
+            ++Count;
+            return {Table[i].Value, true};
+        }
+
+        bool erase(const K &Key)
+        {
+            size_t i = lookup(Key);
+            if (i == SIZE_MAX)
+            {
+                return false;
+            }
+            erase_slot(i);
+            return true;
+        }
+
+        // Walks the whole table
+        template <class F> size_t erase_if(F &&Pred)
+        {
+            size_t erased = 0;
+            // Backward shifts move entries down, so rescan a slot after each removal
+            for (size_t i = 0; i < Table.size();)
+            {
+                const slot &entry = Table[i];
+                if (!(entry.Key == Empty) && Pred(entry.Key, entry.Value))
+                {
+                    erase_slot(i);
+                    ++erased;
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+            return erased;
+        }
+
+        template <class F> void for_each(F &&f) const
+        {
+            for (const slot &entry : Table)
+            {
+                if (!(entry.Key == Empty))
+                {
+                    f(entry.Key, entry.Value);
+                }
+            }
+        }
+
+        size_t size() const { return Count; }
+
+      private:
+        struct slot
+        {
+            K Key;
+            T Value;
+        };
+
+        size_t home(const K &Key) const
+        {
+            return (size_t)((Hash()(Key) * 0x9E3779B97F4A7C15ull) >> Shift);
+        }
+
+        // The slot of Key, or the free slot that ends its probe sequence
+        size_t probe(const K &Key) const
+        {
+            const size_t mask = Table.size() - 1;
+            size_t i = home(Key);
+            while (!(Table[i].Key == Key) && !(Table[i].Key == Empty))
+            {
+                i = (i + 1) & mask;
+            }
+            return i;
+        }
+
+        size_t lookup(const K &Key) const
+        {
+            if (Key == Empty)
+            {
+                return SIZE_MAX;
+            }
+            size_t i = probe(Key);
+            return Table[i].Key == Empty ? SIZE_MAX : i;
+        }
+
+        void erase_slot(size_t Slot)
+        {
+            const size_t mask = Table.size() - 1;
+            size_t hole = Slot;
+            for (size_t i = (Slot + 1) & mask; !(Table[i].Key == Empty);
+                 i = (i + 1) & mask)
+            {
+                // Move back the entries whose home is not between the hole and them
+                size_t start = home(Table[i].Key);
+                if (((i - start) & mask) >= ((i - hole) & mask))
+                {
+                    Table[hole] = Table[i];
+                    hole = i;
+                }
+            }
+            Table[hole].Key = Empty;
+            --Count;
+        }
+
+        void resize(size_t Slots)
+        {
+            std::vector<slot> old(Slots, slot{Empty, T()});
+            old.swap(Table);
+            Shift = 64;
+            for (size_t n = Slots; n > 1; n >>= 1)
+            {
+                --Shift;
+            }
+            for (const slot &entry : old)
+            {
+                if (!(entry.Key == Empty))
+                {
+                    Table[probe(entry.Key)] = entry;
+                }
+            }
+        }
+
+        K Empty;
+        std::vector<slot> Table;
+        // 64 - log2(Table.size())
+        unsigned Shift = 64;
+        size_t Count = 0;
+    };
+
+} // namespace phnt
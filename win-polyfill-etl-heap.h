@@ -0,0 +1,338 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Heap allocation lifetimes==
+//
+// Follows the user mode heap events of EVENT_TRACE_GROUP_HEAP:
+//
+//   PERFINFO_LOG_TYPE_HEAP_CREATE            ETW_HEAP_EVENT_CREATE
+//   PERFINFO_LOG_TYPE_HEAP_CREATE_SNAPSHOT   ETW_HEAP_EVENT_RUNDOWN, heaps created before
+//                                            the trace
+//   PERFINFO_LOG_TYPE_HEAP_DESTROY           ETW_HEAP_EVENT_COMMON
+//   PERFINFO_LOG_TYPE_HEAP_ALLOC             ETW_HEAP_EVENT_ALLOC
+//   PERFINFO_LOG_TYPE_HEAP_REALLOC           ETW_HEAP_EVENT_REALLOC
+//   PERFINFO_LOG_TYPE_HEAP_FREE              ETW_HEAP_EVENT_FREE
+//
+// Heap handles and addresses are per process, the process is the one of the event
+// header. The live allocations of all heaps share one etl_hash_map keyed by (process,
+// address). A free records the lifetime of its block in the etl_histogram of its heap;
+// a realloc moves the block and keeps its birth time and stack. Destroying a heap
+// frees all its blocks without recording lifetimes, which walks the whole table.
+//
+//   etl_heap_tracker::consume(event)           heap events, in time order
+//   etl_heap_tracker::heaps()                  etl_heap_stats of each heap
+//   etl_heap_tracker::for_each_outstanding(f)  live bytes by process and stack
+//   etl_heap_tracker::live_ages(time)          ages of the live blocks at time
+//
+// Stacks come from etl_stack_attachments built in a first pass; without them every
+// allocation is under etl_no_stack.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-heap.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "win-polyfill-etl-hash.h"
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-stack.h"
+
+namespace phnt
+{
+
+    struct etl_heap_stats
+    {
+        ULONG ProcessId;
+        uint64_t HeapHandle;
+        // Of HEAP_CREATE or the rundown, 0 for heaps only seen through their blocks
+        ULONG Flags;
+        bool Destroyed;
+        uint64_t Allocs;
+        uint64_t Frees;
+        // Frees and reallocs of blocks allocated before the trace
+        uint64_t UnknownFrees;
+        uint64_t LiveBlocks;
+        uint64_t LiveBytes;
+        uint64_t PeakBytes;
+        // Time from alloc to free of the freed blocks, in the clock of the trace
+        etl_histogram Lifetimes;
+    };
+
+    class etl_heap_tracker
+    {
+      public:
+        explicit etl_heap_tracker(const etl_stack_attachments *Attachments = nullptr)
+            : Attachments(Attachments)
+        {
+        }
+
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG p = event.PointerSize;
+            const UCHAR *data = event.Payload;
+            const ULONG size = event.PayloadSize;
+            switch (event.HookId)
+            {
+            case PERFINFO_LOG_TYPE_HEAP_CREATE:
+                // HeapHandle, Flags, then the reserve, commit and allocated sizes
+                if (size >= p + 4)
+                {
+                    ULONG heap = find_heap(event.ProcessId, etl_load_pointer(data, p));
+                    Heaps[heap].Flags = etl_load<ULONG>(data + p);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_HEAP_CREATE_SNAPSHOT:
+                // HeapHandle, Flags, ProcessId, RangeCount and the ranges
+                if (size >= p + 8)
+                {
+                    ULONG process_id = etl_load<ULONG>(data + p + 4);
+                    ULONG heap = find_heap(process_id, etl_load_pointer(data, p));
+                    Heaps[heap].Flags = etl_load<ULONG>(data + p);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_HEAP_DESTROY:
+                if (size >= p)
+                {
+                    destroy(event.ProcessId, etl_load_pointer(data, p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_HEAP_ALLOC:
+                // HeapHandle, Size, Address
+                if (size >= 3 * p)
+                {
+                    ULONG heap = find_heap(event.ProcessId, etl_load_pointer(data, p));
+                    alloc_block(
+                        event,
+                        heap,
+                        etl_load_pointer(data + 2 * p, p),
+                        etl_load_pointer(data + p, p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_HEAP_REALLOC:
+                // HeapHandle, NewAddress, OldAddress, NewSize, OldSize
+                if (size >= 4 * p)
+                {
+                    ULONG heap = find_heap(event.ProcessId, etl_load_pointer(data, p));
+                    realloc_block(
+                        event,
+                        heap,
+                        etl_load_pointer(data + p, p),
+                        etl_load_pointer(data + 2 * p, p),
+                        etl_load_pointer(data + 3 * p, p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_HEAP_FREE:
+                // HeapHandle, Address
+                if (size >= 2 * p)
+                {
+                    ULONG heap = find_heap(event.ProcessId, etl_load_pointer(data, p));
+                    free_block(
+                        event.TimeStamp,
+                        heap,
+                        event.ProcessId,
+                        etl_load_pointer(data + p, p));
+                }
+                break;
+            }
+        }
+
+        // Destroyed heaps stay, a heap created again at the same handle is a new entry
+        const std::vector<etl_heap_stats> &heaps() const { return Heaps; }
+
+        // f(ULONG ProcessId, ULONG StackId, uint64_t Bytes, uint64_t Blocks), largest
+        // Bytes first
+        template <class F> void for_each_outstanding(F &&f) const
+        {
+            std::map<std::pair<ULONG, ULONG>, std::pair<uint64_t, uint64_t>> stacks;
+            Blocks.for_each([&](const block_key &Key, const block &live) {
+                auto &sum = stacks[{Key.ProcessId, live.StackId}];
+                sum.first += live.Size;
+                ++sum.second;
+            });
+            std::vector<std::pair<std::pair<ULONG, ULONG>, std::pair<uint64_t, uint64_t>>>
+                sorted(stacks.begin(), stacks.end());
+            std::stable_sort(
+                sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
+                    return a.second.first > b.second.first;
+                });
+            for (const auto &stack : sorted)
+            {
+                f(stack.first.first,
+                  stack.first.second,
+                  stack.second.first,
+                  stack.second.second);
+            }
+        }
+
+        // Age at TimeStamp of each live block, typically the time of the last event
+        etl_histogram live_ages(LONGLONG TimeStamp) const
+        {
+            etl_histogram ages;
+            Blocks.for_each([&](const block_key &, const block &live) {
+                ages.add(etl_elapsed(live.TimeStamp, TimeStamp));
+            });
+            return ages;
+        }
+
+        uint64_t live_blocks() const { return Blocks.size(); }
+
+      private:
+        // Address 0 marks a free slot, heaps never hand it out
+        struct block_key
+        {
+            ULONG ProcessId;
+            uint64_t Address;
+
+            bool operator==(const block_key &other) const
+            {
+                return Address == other.Address && ProcessId == other.ProcessId;
+            }
+        };
+
+        struct block_hash
+        {
+            uint64_t operator()(const block_key &Key) const
+            {
+                // Blocks are 8 or 16 byte aligned, the low bits carry nothing
+                return (Key.Address >> 3) ^ ((uint64_t)Key.ProcessId << 40);
+            }
+        };
+
+        struct block
+        {
+            uint64_t Size;
+            int64_t TimeStamp;
+            ULONG Heap;
+            ULONG StackId;
+        };
+
+        ULONG find_heap(ULONG ProcessId, uint64_t Handle)
+        {
+            auto key = std::make_pair(ProcessId, Handle);
+            auto found = HeapIds.find(key);
+            if (found != HeapIds.end())
+            {
+                return found->second;
+            }
+            ULONG id = (ULONG)Heaps.size();
+            Heaps.emplace_back();
+            Heaps.back().ProcessId = ProcessId;
+            Heaps.back().HeapHandle = Handle;
+            HeapIds[key] = id;
+            return id;
+        }
+
+        void destroy(ULONG ProcessId, uint64_t Handle)
+        {
+            auto found = HeapIds.find(std::make_pair(ProcessId, Handle));
+            if (found == HeapIds.end())
+            {
+                return;
+            }
+            ULONG heap = found->second;
+            HeapIds.erase(found);
+            etl_heap_stats &stats = Heaps[heap];
+            stats.Destroyed = true;
+            stats.LiveBlocks = 0;
+            stats.LiveBytes = 0;
+            Blocks.erase_if([heap](const block_key &, const block &live) {
+                return live.Heap == heap;
+            });
+        }
+
+        void
+        alloc_block(const etl_event &event, ULONG Heap, uint64_t Address, uint64_t Size)
+        {
+            if (Address == 0)
+            {
+                return;
+            }
+            ULONG stack = Attachments ? Attachments->find(event) : etl_no_stack;
+            insert({event.ProcessId, Address}, {Size, event.TimeStamp, Heap, stack});
+            ++Heaps[Heap].Allocs;
+        }
+
+        void realloc_block(
+            const etl_event &event,
+            ULONG Heap,
+            uint64_t NewAddress,
+            uint64_t OldAddress,
+            uint64_t NewSize)
+        {
+            if (NewAddress == 0)
+            {
+                // Failed, the old block stays
+                return;
+            }
+            const block *old = Blocks.find({event.ProcessId, OldAddress});
+            if (!old)
+            {
+                ++Heaps[Heap].UnknownFrees;
+                alloc_block(event, Heap, NewAddress, NewSize);
+                return;
+            }
+            block moved = *old;
+            Blocks.erase({event.ProcessId, OldAddress});
+            etl_heap_stats &old_heap = Heaps[moved.Heap];
+            --old_heap.LiveBlocks;
+            old_heap.LiveBytes -= moved.Size;
+            moved.Size = NewSize;
+            moved.Heap = Heap;
+            insert({event.ProcessId, NewAddress}, moved);
+        }
+
+        void free_block(LONGLONG TimeStamp, ULONG Heap, ULONG ProcessId, uint64_t Address)
+        {
+            const block *freed = Blocks.find({ProcessId, Address});
+            if (!freed)
+            {
+                ++Heaps[Heap].UnknownFrees;
+                return;
+            }
+            etl_heap_stats &stats = Heaps[freed->Heap];
+            ++stats.Frees;
+            --stats.LiveBlocks;
+            stats.LiveBytes -= freed->Size;
+            stats.Lifetimes.add(etl_elapsed(freed->TimeStamp, TimeStamp));
+            Blocks.erase({ProcessId, Address});
+        }
+
+        void insert(const block_key &Key, const block &Block)
+        {
+            auto inserted = Blocks.insert(Key);
+            if (!inserted.second)
+            {
+                // Allocated again without a free we saw, the old block is lost
+                etl_heap_stats &stale = Heaps[inserted.first.Heap];
+                --stale.LiveBlocks;
+                stale.LiveBytes -= inserted.first.Size;
+            }
+            inserted.first = Block;
+            etl_heap_stats &stats = Heaps[Block.Heap];
+            ++stats.LiveBlocks;
+            stats.LiveBytes += Block.Size;
+            if (stats.LiveBytes > stats.PeakBytes)
+            {
+                stats.PeakBytes = stats.LiveBytes;
+            }
+        }
+
+        const etl_stack_attachments *Attachments;
+        std::vector<etl_heap_stats> Heaps;
+        std::map<std::pair<ULONG, uint64_t>, ULONG> HeapIds;
+        etl_hash_map<block_key, block, block_hash> Blocks;
+    };
+
+} // namespace phnt
@@ -0,0 +1,164 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Latency histogram==
+//
+// A log-linear histogram in the style of HdrHistogram: values below
+// 2^etl_histogram_sub_bits have a bucket each, larger ones share a bucket with the
+// values of the same power of two and the same etl_histogram_sub_bits - 1 bits below
+// the leading one, so every bucket is within 1 / 2^(etl_histogram_sub_bits - 1) of
+// its values. The buckets cover all of uint64_t in a fixed array, nothing allocates
+// while recording and two histograms merge by adding their buckets, which suits one
+// histogram per decoder thread merged at the end.
+//
+//   etl_histogram::add(value, count)   records value
+//   etl_histogram::merge(other)        adds the samples of other
+//   etl_histogram::percentile(p)       upper bound of the bucket p percent falls in
+//   etl_histogram::count(), min_value(), max_value(), mean()
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-histogram.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#include "phnt_ntdef.h"
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace phnt
+{
+
+    constexpr unsigned etl_histogram_sub_bits = 5;
+    constexpr ULONG etl_histogram_buckets = (66 - etl_histogram_sub_bits)
+                                            << (etl_histogram_sub_bits - 1);
+
+    // Index of the highest set bit, Value is not 0
+    inline unsigned etl_highest_bit(uint64_t Value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(Value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, Value);
+        return index;
+#else
+        unsigned index = 0;
+        while (Value >>= 1)
+        {
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    class etl_histogram
+    {
+      public:
+        etl_histogram() { reset(); }
+
+        void reset()
+        {
+            memset(Buckets, 0, sizeof(Buckets));
+            Count = 0;
+            Total = 0;
+            Min = UINT64_MAX;
+            Max = 0;
+        }
+
+        static ULONG bucket(uint64_t Value)
+        {
+            const unsigned sub = etl_histogram_sub_bits;
+            if (Value < (1ull << sub))
+            {
+                return (ULONG)Value;
+            }
+            unsigned exponent = etl_highest_bit(Value);
+            ULONG mantissa = (ULONG)(Value >> (exponent - sub + 1)) - (1u << (sub - 1));
+            return ((exponent - sub + 2) << (sub - 1)) + mantissa;
+        }
+
+        // Largest value of a bucket
+        static uint64_t bucket_limit(ULONG Bucket)
+        {
+            const unsigned sub = etl_histogram_sub_bits;
+            if (Bucket < (1u << sub))
+            {
+                return Bucket;
+            }
+            unsigned exponent = (Bucket >> (sub - 1)) + sub - 2;
+            uint64_t mantissa = (Bucket & ((1u << (sub - 1)) - 1)) + (1u << (sub - 1));
+            unsigned shift = exponent - sub + 1;
+            return (mantissa << shift) + ((1ull << shift) - 1);
+        }
+
+        void add(uint64_t Value, uint64_t Samples = 1)
+        {
+            Buckets[bucket(Value)] += Samples;
+            Count += Samples;
+            Total += Value * Samples;
+            Min = Value < Min ? Value : Min;
+            Max = Value > Max ? Value : Max;
+        }
+
+        void merge(const etl_histogram &other)
+        {
+            for (ULONG i = 0; i < etl_histogram_buckets; ++i)
+            {
+                Buckets[i] += other.Buckets[i];
+            }
+            Count += other.Count;
+            Total += other.Total;
+            Min = other.Min < Min ? other.Min : Min;
+            Max = other.Max > Max ? other.Max : Max;
+        }
+
+        // Percent from 0 to 100, 0 when empty; never above max_value()
+        uint64_t percentile(double Percent) const
+        {
+            if (Count == 0)
+            {
+                return 0;
+            }
+            uint64_t rank = (uint64_t)(Percent / 100.0 * (double)Count + 0.5);
+            rank = rank == 0 ? 1 : (rank > Count ? Count : rank);
+            uint64_t seen = 0;
+            for (ULONG i = 0; i < etl_histogram_buckets; ++i)
+            {
+                seen += Buckets[i];
+                if (seen >= rank)
+                {
+                    uint64_t limit = bucket_limit(i);
+                    return limit < Max ? limit : Max;
+                }
+            }
+            return Max;
+        }
+
+        uint64_t count() const { return Count; }
+
+        // 0 when empty
+        uint64_t min_value() const { return Count ? Min : 0; }
+
+        uint64_t max_value() const { return Max; }
+
+        double mean() const { return Count ? (double)Total / (double)Count : 0.0; }
+
+        uint64_t samples(ULONG Bucket) const { return Buckets[Bucket]; }
+
+      private:
+        uint64_t Buckets[etl_histogram_buckets];
+        uint64_t Count;
+        uint64_t Total;
+        uint64_t Min;
+        uint64_t Max;
+    };
+
+} // namespace phnt
@@ -0,0 +1,616 @@
+/* Auto generated by cmake/generate_etl_hook_table.cmake, do not edit */
+
+// No include guard, included by win-polyfill-etl-dispatch.h once per pass.
+
+// EVENT_TRACE_GROUP_HEADER
+PHNT_ETL_HOOK(WMI_LOG_TYPE_HEADER)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_HEADER_EXTENSION)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_RUNDOWN_COMPLETE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_GROUP_MASKS_END)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_RUNDOWN_BEGIN)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_RUNDOWN_END)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_DBGID_RSDS)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_DBGID_NB10)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_BUILD_LAB)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_BINARY_PATH)
+
+// EVENT_TRACE_GROUP_CONFIG
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_CPU)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_PHYSICALDISK)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_LOGICALDISK)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_OPTICALMEDIA)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_NIC)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_VIDEO)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_SERVICES)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_POWER)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_IRQ)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_PNP)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_IDECHANNEL)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_NUMANODE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_PLATFORM)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_PROCESSORGROUP)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_PROCESSORNUMBER)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_DPI)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_CODEINTEGRITY)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_CONFIG_MACHINEID)
+
+// EVENT_TRACE_GROUP_FILE
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILENAME)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILENAME_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILENAME_SAME)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILENAME_NULL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILENAME_DELETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILENAME_RUNDOWN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MAPFILE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UNMAPFILE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MAPFILE_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MAPFILE_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CLEANUP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CLOSE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_READ)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_WRITE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_SET_INFORMATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DELETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_RENAME)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DIRENUM)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_FLUSH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_QUERY_INFORMATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_FS_CONTROL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_OPERATION_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DIRNOTIFY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CREATE_NEW)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DELETE_PATH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_RENAME_PATH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_SETLINK_PATH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_IO_SETLINK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FLT_PREOP_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FLT_POSTOP_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FLT_PREOP_COMPLETION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FLT_POSTOP_COMPLETION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FLT_PREOP_FAILURE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FLT_POSTOP_FAILURE)
+
+// EVENT_TRACE_GROUP_JOB
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_CREATE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_TERMINATE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_OPEN)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_ASSIGN_PROCESS)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_REMOVE_PROCESS)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_SET)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_QUERY)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_SET_FAILED)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_QUERY_FAILED)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_SET_NOTIFICATION)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_SEND_NOTIFICATION)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_QUERY_VIOLATION)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_SET_CPU_RATE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_JOB_SET_NET_RATE)
+
+// EVENT_TRACE_GROUP_PROCESS
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PROCESS_CREATE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PROCESS_DELETE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PROCESS_DC_START)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PROCESS_DC_END)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PROCESS_LOAD_IMAGE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PROCESS_TERMINATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PROCESS_PERFCTR_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PROCESS_PERFCTR_RD)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INSWAPPROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PROCESS_FREEZE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PROCESS_THAW)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BOOT_PHASE_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ZOMBIE_PROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PROCESS_SET_AFFINITY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CHARGE_WAKE_COUNTER_USER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CHARGE_WAKE_COUNTER_EXECUTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CHARGE_WAKE_COUNTER_KERNEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CHARGE_WAKE_COUNTER_INSTRUMENTATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CHARGE_WAKE_COUNTER_PRESERVE_PROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_RELEASE_WAKE_COUNTER_USER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_RELEASE_WAKE_COUNTER_EXECUTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_RELEASE_WAKE_COUNTER_KERNEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_RELEASE_WAKE_COUNTER_INSTRUMENTATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_RELEASE_WAKE_COUNTER_PRESERVE_PROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_DROP_USER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_DROP_EXECUTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_DROP_KERNEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_DROP_INSTRUMENTATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_DROP_PRESERVE_PROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_EVENT_USER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_EVENT_EXECUTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_EVENT_KERNEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_EVENT_INSTRUMENTATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAKE_EVENT_PRESERVE_PROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DEBUG_EVENT)
+
+// EVENT_TRACE_GROUP_IMAGE
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IMAGE_LOAD)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IMAGE_UNLOAD)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IMAGE_DC_START)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IMAGE_DC_END)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IMAGE_RELOCATION)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IMAGE_KERNEL_BASE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IMAGE_HYPERCALL_PAGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_LOCK_ACQUIRE_ATTEMPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_LOCK_ACQUIRE_SUCCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_LOCK_ACQUIRE_FAIL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_LOCK_ACQUIRE_WAIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_PROC_INIT_DONE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_CREATE_SECTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_SECTION_CREATED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_MAP_VIEW)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_RELOCATE_IMAGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_IMAGE_RELOCATED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_HANDLE_OLD_DESCRIPTORS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_OLD_DESCRIPTORS_HANDLED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_HANDLE_NEW_DESCRIPTORS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_NEW_DESCRIPTORS_HANDLED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_DLLMAIN_EXIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_FIND_DLL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_VIEW_MAPPED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_LOCK_RELEASE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_DLLMAIN_ENTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_ERROR)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_VIEW_MAPPING)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_SNAPPING)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_SNAPPED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_LOADING)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_LOADED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_FOUND_KNOWN_DLL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_ABNORMAL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_PLACEHOLDER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_RDY_TO_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_RDY_TO_RUN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_NEW_DLL_LOAD)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_NEW_DLL_AS_DATA)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_EXTERNAL_PATH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_GENERATED_PATH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_APISET_RESOLVING)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_APISET_HOSTED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_APISET_UNHOSTED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_APISET_UNRESOLVED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_SEARCH_SECURITY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_LDR_SEARCH_PATH_SECURITY)
+
+// EVENT_TRACE_GROUP_THREAD
+PHNT_ETL_HOOK(WMI_LOG_TYPE_THREAD_CREATE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_THREAD_DELETE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_THREAD_DC_START)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_THREAD_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CONTEXTSWAP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CONTEXTSWAP_BATCH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SPINLOCK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_QUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_RESOURCE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PUSHLOCK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAIT_SINGLE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WAIT_MULTIPLE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DELAY_EXECUTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_PRIORITY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_BASE_PRIORITY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_READY_THREAD)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_PAGE_PRIORITY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_IO_PRIORITY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_AFFINITY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WORKER_THREAD_ITEM)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DFSS_START_NEW_INTERVAL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DFSS_PROCESS_IDLE_ONLY_QUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ANTI_STARVATION_BOOST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREAD_MIGRATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KQUEUE_ENQUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KQUEUE_DEQUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WORKER_THREAD_ITEM_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WORKER_THREAD_ITEM_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_AUTO_BOOST_SET_FLOOR)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_AUTO_BOOST_CLEAR_FLOOR)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_AUTO_BOOST_NO_ENTRIES)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREAD_SUBPROCESSTAG_CHANGED)
+
+// EVENT_TRACE_GROUP_TCPIP
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_SEND)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_RECEIVE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_CONNECT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_DISCONNECT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_RETRANSMIT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_ACCEPT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_RECONNECT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_FAIL)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_TCPCOPY)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_ARPCOPY)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_FULLACK)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_PARTACK)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_DUPACK)
+
+// EVENT_TRACE_GROUP_UDPIP
+PHNT_ETL_HOOK(WMI_LOG_TYPE_UDP_SEND)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_UDP_RECEIVE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_UDP_FAIL)
+
+// EVENT_TRACE_GROUP_TCPIP
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_SEND_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_RECEIVE_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_CONNECT_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_DISCONNECT_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_RETRANSMIT_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_ACCEPT_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_RECONNECT_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_FAIL_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_TCPCOPY_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_ARPCOPY_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_FULLACK_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_PARTACK_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_TCPIP_DUPACK_IPV6)
+
+// EVENT_TRACE_GROUP_UDPIP
+PHNT_ETL_HOOK(WMI_LOG_TYPE_UDP_SEND_IPV6)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_UDP_RECEIVE_IPV6)
+
+// EVENT_TRACE_GROUP_IO
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IO_READ)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IO_WRITE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IO_READ_INIT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IO_WRITE_INIT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IO_FLUSH)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IO_FLUSH_INIT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_IO_REDIRECTED_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_INIT_COMPLETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_MAJORFUNCTION_CALL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_MAJORFUNCTION_RETURN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_COMPLETIONROUTINE_CALL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_COMPLETIONROUTINE_RETURN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_ADD_DEVICE_CALL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_ADD_DEVICE_RETURN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_STARTIO_CALL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_STARTIO_RETURN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PREFETCH_ACTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PREFETCH_REQUEST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PREFETCH_READLIST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PREFETCH_READ)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_COMPLETE_REQUEST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DRIVER_COMPLETE_REQUEST_RETURN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BOOT_PREFETCH_INFORMATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OPTICAL_IO_READ)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OPTICAL_IO_WRITE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OPTICAL_IO_FLUSH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OPTICAL_IO_READ_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OPTICAL_IO_WRITE_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OPTICAL_IO_FLUSH_INIT)
+
+// EVENT_TRACE_GROUP_MEMORY
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PAGE_FAULT_TRANSITION)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PAGE_FAULT_DEMAND_ZERO)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PAGE_FAULT_COPY_ON_WRITE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PAGE_FAULT_GUARD_PAGE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PAGE_FAULT_HARD_PAGE_FAULT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_PAGE_FAULT_ACCESS_VIOLATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HARDFAULT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REMOVEPAGEBYCOLOR)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REMOVEPAGEFROMLIST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGEINMEMORY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INSERTINFREELIST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INSERTINMODIFIEDLIST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INSERTINLIST)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INSERTATFRONT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UNLINKFROMSTANDBY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UNLINKFFREEORZERO)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WORKINGSETMANAGER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TRIMPROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ZEROSHARECOUNT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WSINFOPROCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FAULTADDR_WITH_IP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TRIMSESSION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MEMORYSNAPLITE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PFMAPPED_SECTION_RUNDOWN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PFMAPPED_SECTION_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WSINFOSESSION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CREATE_SESSION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SESSION_RUNDOWN_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SESSION_RUNDOWN_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SESSION_DELETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PFMAPPED_SECTION_DELETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_ALLOC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_FREE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_RANGE_RUNDOWN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_RANGE_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_RANGE_RESERVE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_RANGE_RELEASE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_RANGE_DESTROY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGEFILE_BACK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MEMINFO)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CONTMEM_GENERATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FILE_STORE_FAULT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INMEMORY_STORE_FAULT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_COMPRESSED_PAGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGEINMEMORY_ACTIVE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGE_ACCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGE_RELEASE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGE_RANGE_ACCESS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGE_RANGE_RELEASE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGE_COMBINE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KERNEL_MEMUSAGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MM_STATS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MEMINFOEX_WS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MEMINFOEX_SESSIONWS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_ROTATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_ALLOC_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_ALLOC_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PAGE_ACCESS_EX)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REMOVEFROMWS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WSSHAREABLE_RUNDOWN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INMEMORYACTIVE_RUNDOWN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MEM_RESET_INFO)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PFMAPPED_SECTION_OBJECT_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PFMAPPED_SECTION_OBJECT_DELETE)
+
+// EVENT_TRACE_GROUP_REGISTRY
+PHNT_ETL_HOOK(WMI_LOG_TYPE_REG_RUNDOWNBEGIN)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_REG_RUNDOWNEND)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CMCELLREFERRED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_SET_VALUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_COUNTERS)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_CONFIG)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_HIVE_INITIALIZE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_HIVE_DESTROY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_HIVE_LINK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_HIVE_RUNDOWN_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_HIVE_DIRTY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_NOTIF_REGISTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REG_NOTIF_DELIVER)
+
+// EVENT_TRACE_GROUP_PERFINFO
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_RUNDOWN_CHECKPOINT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MARK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ASYNCMARK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_IMAGENAME)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DELAYS_CC_CAN_I_WRITE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PMC_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PMC_CONFIG)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MSI_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SYSCALL_ENTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SYSCALL_EXIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BACKTRACE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BACKTRACE_USERSTACK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_CACHE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_EXCEPTION_STACK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BRANCH_TRACE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DEBUGGER_ENABLED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DEBUGGER_EXIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BRANCH_TRACE_DEBUG)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BRANCH_ADDRESS_DEBUG)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_THREADED_DPC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DPC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIMERDPC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_IOTIMER_EXPIRATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_NMI)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_SET_INTERVAL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SPINLOCK_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SPINLOCK_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ERESOURCE_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ERESOURCE_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CLOCK_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIMER_EXPIRATION_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIMER_EXPIRATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIMER_SET_PERIODIC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIMER_SET_ONE_SHOT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIMER_SET_THREAD)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIMER_CANCEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TIME_ADJUSTMENT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CLOCK_MODE_SWITCH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CLOCK_TIME_UPDATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CLOCK_DYNAMIC_TICK_VETO)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CLOCK_CONFIGURATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_IPI)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UNEXPECTED_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_IOTIMER_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_IOTIMER_STOP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PASSIVE_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WDF_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WDF_PASSIVE_INTERRUPT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WDF_DPC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CPU_CACHE_FLUSH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DPC_ENQUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DPC_EXECUTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_INTERRUPT_STEERING)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WDF_WORK_ITEM)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KTIMER2_SET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KTIMER2_EXPIRATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KTIMER2_CANCEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KTIMER2_DISABLE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_KTIMER2_FINALIZATION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SHOULD_YIELD_PROCESSOR)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FUNCTION_CALL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FUNCTION_RETURN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FUNCTION_ENTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FUNCTION_EXIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TAILCALL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TRAP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SPINLOCK_ACQUIRE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SPINLOCK_RELEASE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CAP_COMMENT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CAP_RUNDOWN)
+
+// EVENT_TRACE_GROUP_DBGPRINT
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DEBUG_PRINT)
+
+// EVENT_TRACE_GROUP_WNF
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WNF_SUBSCRIBE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WNF_UNSUBSCRIBE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WNF_CALLBACK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WNF_PUBLISH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_WNF_NAME_SUB_RUNDOWN)
+
+// EVENT_TRACE_GROUP_POOL
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ALLOCATEPOOL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ALLOCATEPOOL_SESSION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FREEPOOL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_FREEPOOL_SESSION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ADDPOOLPAGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_ADDPOOLPAGE_SESSION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BIGPOOLPAGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BIGPOOLPAGE_SESSION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_POOLSNAP_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_POOLSNAP_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BIGPOOLSNAP_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BIGPOOLSNAP_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_POOLSNAP_SESSION_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_POOLSNAP_SESSION_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SESSIONBIGPOOLSNAP_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SESSIONBIGPOOLSNAP_DC_END)
+
+// EVENT_TRACE_GROUP_HEAP
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_ALLOC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_REALLOC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_DESTROY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_FREE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_EXTEND)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_SNAPSHOT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_CREATE_SNAPSHOT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_DESTROY_SNAPSHOT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_EXTEND_SNAPSHOT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_CONTRACT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_LOCK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_UNLOCK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_VALIDATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_WALK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_ALLOC)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_FREE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_ALLOC_CACHE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_FREE_CACHE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_COMMIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_DECOMMIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_INIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_AFFINITY_ENABLE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_ACTIVATED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_AFFINITY_ASSIGN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_HEAP_REUSE_THRESHOLD_ACTIVATED)
+
+// EVENT_TRACE_GROUP_CRITSEC
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CRITSEC_ENTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CRITSEC_LEAVE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CRITSEC_COLLISION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CRITSEC_INITIALIZE)
+
+// EVENT_TRACE_GROUP_STACKWALK
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_STACKWALK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_STACKTRACE_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_STACKTRACE_DELETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_STACKTRACE_RUNDOWN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_STACKTRACE_KEY_KERNEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_STACKTRACE_KEY_USER)
+
+// EVENT_TRACE_GROUP_ALPC
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_SEND_MESSAGE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_RECEIVE_MESSAGE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_WAIT_FOR_REPLY)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_WAIT_FOR_NEW_MESSAGE)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_UNWAIT)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_CONNECT_REQUEST)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_CONNECT_SUCCESS)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_CONNECT_FAIL)
+PHNT_ETL_HOOK(WMI_LOG_TYPE_ALPC_CLOSE_PORT)
+
+// EVENT_TRACE_GROUP_OBJECT
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CREATE_HANDLE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CLOSE_HANDLE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DUPLICATE_HANDLE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CREATE_OBJECT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DELETE_OBJECT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_REFERENCE_OBJECT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_DEREFERENCE_OBJECT)
+
+// EVENT_TRACE_GROUP_POWER
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_BATTERY_LIFE_INFO)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_IDLE_STATE_CHANGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SET_POWER_ACTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SET_POWER_ACTION_RET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SET_DEVICES_STATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SET_DEVICES_STATE_RET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_NOTIFY_DEVICE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_NOTIFY_DEVICE_COMPLETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_SESSION_CALLOUT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_SESSION_CALLOUT_RET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_PRESLEEP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_POSTSLEEP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_CALIBRATED_PERFCOUNTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_PERF_STATE_CHANGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_THROTTLE_STATE_CHANGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_IDLE_STATE_CHANGE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_THERMAL_CONSTRAINT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_SIGNAL_RESUME_UI)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PO_SIGNAL_VIDEO_ON)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_IDLE_STATE_ENTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_IDLE_STATE_EXIT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_PLATFORM_IDLE_STATE_ENTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_IDLE_EXIT_LATENCY)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_IDLE_PROCESSOR_SELECTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_IDLE_PLATFORM_SELECTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_COORDINATED_IDLE_ENTER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_PPM_COORDINATED_IDLE_EXIT)
+
+// EVENT_TRACE_GROUP_MODBOUND
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_COWHEADER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_COWBLOB)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_COWBLOB_CLOSED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_ENT)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_JUMP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_RET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_CALL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_CALLRET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_INT2E)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_INT2B)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_MODULEBOUND_FULLTRACE)
+
+// EVENT_TRACE_GROUP_SPLITIO
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_SPLITIO_VOLMGR)
+
+// EVENT_TRACE_GROUP_THREAD_POOL
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_DEQUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_STOP)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_CANCEL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_POOL_CREATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_POOL_CLOSE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_POOL_TH_MIN_SET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_POOL_TH_MAX_SET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_WORKER_NUMANODE_SWITCH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_SET)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_CANCELLED)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_SET_NTTIMER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_CANCEL_NTTIMER)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION_BEGIN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION)
+
+// EVENT_TRACE_GROUP_UMS
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UMS_DIRECTED_SWITCH_START)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UMS_DIRECTED_SWITCH_END)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UMS_PARK)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UMS_DISASSOCIATE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_UMS_CONTEXT_SWITCH)
+
+// EVENT_TRACE_GROUP_CC
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_WORKITEM_ENQUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_WORKITEM_DEQUEUE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_WORKITEM_COMPLETE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_READ_AHEAD)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_WRITE_BEHIND)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_LAZY_WRITE_SCAN)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_CAN_I_WRITE_FAIL)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_FLUSH_CACHE)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_FLUSH_SECTION)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_READ_AHEAD_PREFETCH)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_SCHEDULE_READ_AHEAD)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_LOGGED_STREAM_INFO)
+PHNT_ETL_HOOK(PERFINFO_LOG_TYPE_CC_EXTRA_WRITEBEHIND_THREAD)
@@ -0,0 +1,337 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Time index of a trace==
+//
+// A sidecar for large traces: every Interval buffers the index records the flush time
+// (WMI_BUFFER_HEADER::TimeStamp), file offset and SequenceNumber of the buffer and a
+// checkpoint of the processes and threads alive before it, taken from the process and
+// thread events (create, delete and the DC_START/DC_END rundowns). A viewer finds the
+// buffer to start decoding from with a binary search and has the context of that point
+// without replaying the trace from the start.
+//
+//   etl_time_index::build(reader, interval)  one pass over the trace
+//   etl_time_index::seek(time)               entry to start decoding from, O(log n)
+//   etl_time_index::processes(entry)         checkpoint of an entry
+//   etl_time_index::save(), load(data, size) the sidecar format, see etl_index_header
+//
+// Buffers are written when they are flushed, so a buffer holds no event later than its
+// TimeStamp. Entries keep the largest TimeStamp seen up to their buffer; every buffer
+// before the entry seek(time) returns ends before time.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-index.h requires C++"
+#endif
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    // "ETLX"
+    constexpr ULONG etl_index_magic = 0x584C5445;
+    constexpr ULONG etl_index_version = 1;
+
+    // Sidecar layout, little endian: etl_index_header, EntryCount etl_index_entry, then
+    // the etl_index_process and etl_index_thread arrays the entries point into.
+    struct etl_index_header
+    {
+        ULONG Magic;
+        ULONG Version;
+        // Buffers between entries
+        ULONG Interval;
+        ULONG EntryCount;
+        // Of the trace the index was built from
+        ULONGLONG TraceSize;
+        ULONGLONG BufferCount;
+        ULONGLONG ProcessCount;
+        ULONGLONG ThreadCount;
+    };
+
+    struct etl_index_entry
+    {
+        // Largest WMI_BUFFER_HEADER::TimeStamp up to and including the buffer
+        LONGLONG TimeStamp;
+        ULONGLONG FileOffset;
+        LONGLONG SequenceNumber;
+        ULONG BufferIndex;
+        ULONG ProcessCount;
+        ULONG ThreadCount;
+        ULONG Reserved;
+        // First checkpoint row of the entry in the process and thread arrays
+        ULONGLONG FirstProcess;
+        ULONGLONG FirstThread;
+    };
+
+    struct etl_index_process
+    {
+        ULONG ProcessId;
+        ULONG ParentId;
+        ULONG SessionId;
+        ULONG Reserved;
+    };
+
+    struct etl_index_thread
+    {
+        ULONG ThreadId;
+        ULONG ProcessId;
+    };
+
+    class etl_time_index
+    {
+      public:
+        static etl_time_index build(const etl_reader &reader, ULONG Interval = 1024)
+        {
+            etl_time_index index;
+            index.Header = {};
+            index.Header.Magic = etl_index_magic;
+            index.Header.Version = etl_index_version;
+            index.Header.Interval = Interval ? Interval : 1;
+            index.Header.TraceSize = reader.trace_size();
+            index.Header.BufferCount = reader.buffer_count();
+
+            std::unordered_map<ULONG, etl_index_process> processes;
+            // Only the threads alive at each checkpoint
+            etl_thread_processes threads(false);
+            LONGLONG latest = 0;
+            for (size_t i = 0; i < reader.buffer_count(); ++i)
+            {
+                etl_buffer buffer = reader.buffer(i);
+                const WMI_BUFFER_HEADER &header = buffer.header();
+                latest = std::max<LONGLONG>(latest, header.TimeStamp.QuadPart);
+                if (i % index.Header.Interval == 0)
+                {
+                    index.add_entry(reader, i, latest, processes, threads);
+                }
+                buffer.for_each_event(
+                    [&](const etl_event &event) { track(event, processes, threads); });
+            }
+            index.Header.EntryCount = (ULONG)index.Entries.size();
+            index.Header.ProcessCount = index.Processes.size();
+            index.Header.ThreadCount = index.Threads.size();
+            return index;
+        }
+
+        // False if Data is not an index of this version
+        bool load(const void *Data, size_t Size)
+        {
+            const UCHAR *p = static_cast<const UCHAR *>(Data);
+            if (Size < sizeof(etl_index_header))
+            {
+                return false;
+            }
+            etl_index_header header = etl_load<etl_index_header>(p);
+            if (header.Magic != etl_index_magic || header.Version != etl_index_version)
+            {
+                return false;
+            }
+            ULONGLONG expected = sizeof(etl_index_header) +
+                                 header.EntryCount * (ULONGLONG)sizeof(etl_index_entry) +
+                                 header.ProcessCount * sizeof(etl_index_process) +
+                                 header.ThreadCount * sizeof(etl_index_thread);
+            if (header.ProcessCount > Size || header.ThreadCount > Size ||
+                expected != Size)
+            {
+                return false;
+            }
+
+            std::vector<etl_index_entry> entries(header.EntryCount);
+            std::vector<etl_index_process> processes((size_t)header.ProcessCount);
+            std::vector<etl_index_thread> threads((size_t)header.ThreadCount);
+            p += sizeof(etl_index_header);
+            p = copy_out(p, entries);
+            p = copy_out(p, processes);
+            copy_out(p, threads);
+            for (const etl_index_entry &entry : entries)
+            {
+                // Compared without adding, a corrupt First* would wrap the sum
+                if (entry.FirstProcess > processes.size() ||
+                    entry.ProcessCount > processes.size() - entry.FirstProcess ||
+                    entry.FirstThread > threads.size() ||
+                    entry.ThreadCount > threads.size() - entry.FirstThread)
+                {
+                    return false;
+                }
+            }
+
+            Header = header;
+            Entries = std::move(entries);
+            Processes = std::move(processes);
+            Threads = std::move(threads);
+            return true;
+        }
+
+        std::vector<UCHAR> save() const
+        {
+            std::vector<UCHAR> data;
+            append(data, &Header, sizeof(Header));
+            append(data, Entries.data(), Entries.size() * sizeof(etl_index_entry));
+            append(data, Processes.data(), Processes.size() * sizeof(etl_index_process));
+            append(data, Threads.data(), Threads.size() * sizeof(etl_index_thread));
+            return data;
+        }
+
+        const etl_index_header &header() const { return Header; }
+
+        // The index was built from a trace of this size and buffer count
+        bool matches(const etl_reader &reader) const
+        {
+            return Header.TraceSize == reader.trace_size() &&
+                   Header.BufferCount == reader.buffer_count();
+        }
+
+        const std::vector<etl_index_entry> &entries() const { return Entries; }
+
+        // The last entry whose buffers before it all end before time, nullptr if the
+        // index is empty. Decode from entry->BufferIndex (entry->FileOffset) on.
+        const etl_index_entry *seek(LONGLONG time) const
+        {
+            auto it = std::lower_bound(
+                Entries.begin(),
+                Entries.end(),
+                time,
+                [](const etl_index_entry &entry, LONGLONG value) {
+                    return entry.TimeStamp < value;
+                });
+            if (it != Entries.begin())
+            {
+                --it;
+            }
+            return Entries.empty() ? nullptr : &*it;
+        }
+
+        // Processes alive before the buffer of entry, by ProcessId
+        const etl_index_process *processes(const etl_index_entry &entry) const
+        {
+            return Processes.data() + entry.FirstProcess;
+        }
+
+        // Threads alive before the buffer of entry, by ThreadId
+        const etl_index_thread *threads(const etl_index_entry &entry) const
+        {
+            return Threads.data() + entry.FirstThread;
+        }
+
+      private:
+        static void track(
+            const etl_event &event,
+            std::unordered_map<ULONG, etl_index_process> &processes,
+            etl_thread_processes &threads)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_PROCESS_CREATE:
+            case WMI_LOG_TYPE_PROCESS_DC_START:
+            case WMI_LOG_TYPE_PROCESS_DC_END:
+            case WMI_LOG_TYPE_PROCESS_DELETE:
+            {
+                // ProcessId, ParentId and SessionId follow UniqueProcessKey, a pointer,
+                // in WMI_PROCESS_INFORMATION of either pointer size
+                if (event.PayloadSize < event.PointerSize + 3 * sizeof(ULONG))
+                {
+                    return;
+                }
+                const UCHAR *ids = event.Payload + event.PointerSize;
+                etl_index_process process = {};
+                process.ProcessId = etl_load<ULONG>(ids);
+                process.ParentId = etl_load<ULONG>(ids + 4);
+                process.SessionId = etl_load<ULONG>(ids + 8);
+                if (event.HookId == WMI_LOG_TYPE_PROCESS_DELETE)
+                {
+                    processes.erase(process.ProcessId);
+                }
+                else
+                {
+                    processes[process.ProcessId] = process;
+                }
+                break;
+            }
+            case WMI_LOG_TYPE_THREAD_CREATE:
+            case WMI_LOG_TYPE_THREAD_DC_START:
+            case WMI_LOG_TYPE_THREAD_DC_END:
+            case WMI_LOG_TYPE_THREAD_DELETE:
+                threads.consume(event);
+                break;
+            }
+        }
+
+        void add_entry(
+            const etl_reader &reader,
+            size_t buffer_index,
+            LONGLONG time,
+            const std::unordered_map<ULONG, etl_index_process> &processes,
+            const etl_thread_processes &threads)
+        {
+            etl_buffer buffer = reader.buffer(buffer_index);
+            etl_index_entry entry = {};
+            entry.TimeStamp = time;
+            entry.FileOffset = reader.buffer_offset(buffer_index);
+            entry.SequenceNumber = buffer.header().SequenceNumber;
+            entry.BufferIndex = (ULONG)buffer_index;
+            entry.ProcessCount = (ULONG)processes.size();
+            entry.ThreadCount = (ULONG)threads.size();
+            entry.FirstProcess = Processes.size();
+            entry.FirstThread = Threads.size();
+            Entries.push_back(entry);
+
+            for (const auto &process : processes)
+            {
+                Processes.push_back(process.second);
+            }
+            threads.for_each_thread([&](ULONG ThreadId, ULONG ProcessId) {
+                Threads.push_back({ThreadId, ProcessId});
+            });
+            std::sort(
+                Processes.begin() + entry.FirstProcess,
+                Processes.end(),
+                [](const etl_index_process &a, const etl_index_process &b) {
+                    return a.ProcessId < b.ProcessId;
+                });
+            std::sort(
+                Threads.begin() + entry.FirstThread,
+                Threads.end(),
+                [](const etl_index_thread &a, const etl_index_thread &b) {
+                    return a.ThreadId < b.ThreadId;
+                });
+        }
+
+        template <class T>
+        static const UCHAR *copy_out(const UCHAR *p, std::vector<T> &rows)
+        {
+            if (!rows.empty())
+            {
+                memcpy(rows.data(), p, rows.size() * sizeof(T));
+            }
+            return p + rows.size() * sizeof(T);
+        }
+
+        static void append(std::vector<UCHAR> &data, const void *p, size_t size)
+        {
+            const UCHAR *bytes = static_cast<const UCHAR *>(p);
+            data.insert(data.end(), bytes, bytes + size);
+        }
+
+        etl_index_header Header = {};
+        std::vector<etl_index_entry> Entries;
+        std::vector<etl_index_process> Processes;
+        std::vector<etl_index_thread> Threads;
+    };
+
+    C_ASSERT(sizeof(etl_index_header) == 0x30);
+    C_ASSERT(sizeof(etl_index_entry) == 0x38);
+    C_ASSERT(sizeof(etl_index_process) == 0x10);
+    C_ASSERT(sizeof(etl_index_thread) == 0x08);
+
+} // namespace phnt
@@ -0,0 +1,252 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Time ordered merge of per-processor buffers==
+//
+// Each buffer of a kernel trace holds the events of one processor in time order
+// (ETW_BUFFER_CONTEXT::ProcessorIndex), so the file as a whole is only ordered per
+// processor. etl_merger walks one cursor per processor and merges them through a
+// tournament (loser) tree: each event costs log2(processors) comparisons and the
+// merge holds one decoded event per processor, never the whole trace.
+//
+//   etl_merger(reader)          one stream per processor, buffers in file order
+//   etl_merger::next(event)     the next event in time order, false at the end
+//   etl_merger::for_each_event  calls f(etl_event) for each event in time order
+//
+// Events with the same timestamp come in processor order, then in buffer order.
+// Records without a timestamp (WNODE_HEADER, MESSAGE_TRACE_HEADER) take the one of the
+// previous event of their processor. When a stream enters a buffer, the first
+// etl_merge_prefetch_size bytes of its next buffer are prefetched.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-merge.h requires C++"
+#endif
+
+#include <utility>
+#include <vector>
+
+#include "win-polyfill-etl-reader.h"
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+namespace phnt
+{
+
+    // Bytes of the next buffer of a stream brought into the cache
+    constexpr ULONG etl_merge_prefetch_size = 0x1000;
+
+    inline void etl_prefetch(const UCHAR *Data, ULONG Size)
+    {
+        for (ULONG offset = 0; offset < Size; offset += 64)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(Data + offset);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+            _mm_prefetch(reinterpret_cast<const char *>(Data + offset), _MM_HINT_T0);
+#else
+            (void)Data;
+#endif
+        }
+    }
+
+    class etl_merger
+    {
+      public:
+        explicit etl_merger(const etl_reader &Reader) : Reader(Reader)
+        {
+            std::vector<size_t> stream_of;
+            Reader.for_each_buffer([&](const etl_buffer &buffer) {
+                USHORT processor = buffer.processor_index();
+                if (buffer.compressed())
+                {
+                    return;
+                }
+                if (processor >= stream_of.size())
+                {
+                    stream_of.resize(processor + 1, (size_t)-1);
+                }
+                stream_of[processor] = 0;
+            });
+
+            // Streams by processor number, so ties break the same way in every file
+            size_t count = 0;
+            for (size_t processor = 0; processor < stream_of.size(); ++processor)
+            {
+                if (stream_of[processor] != (size_t)-1)
+                {
+                    stream_of[processor] = count++;
+                }
+            }
+            Streams.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                Streams.emplace_back(Reader.buffer(0));
+            }
+            Reader.for_each_buffer([&](const etl_buffer &buffer) {
+                if (!buffer.compressed())
+                {
+                    Streams[stream_of[buffer.processor_index()]].Buffers.push_back(
+                        buffer.index());
+                }
+            });
+
+            for (size_t i = 0; i < Streams.size(); ++i)
+            {
+                enter_buffer(Streams[i], 0);
+                advance(Streams[i]);
+            }
+            build();
+        }
+
+        size_t stream_count() const { return Streams.size(); }
+
+        // A buffer had a record that runs past its end, the rest of that buffer is
+        // skipped
+        bool malformed() const { return Malformed; }
+
+        bool next(etl_event &event)
+        {
+            if (Streams.empty())
+            {
+                return false;
+            }
+            size_t winner = Tree[0];
+            stream &head = Streams[winner];
+            if (head.Done)
+            {
+                return false;
+            }
+            event = head.Event;
+            advance(head);
+            replay(winner);
+            return true;
+        }
+
+        // False if a buffer was malformed, the events of the other buffers still come.
+        template <class F> bool for_each_event(F &&f)
+        {
+            etl_event event;
+            while (next(event))
+            {
+                f(static_cast<const etl_event &>(event));
+            }
+            return !Malformed;
+        }
+
+      private:
+        struct stream
+        {
+            explicit stream(const etl_buffer &Buffer) : Buffer(Buffer) {}
+
+            // Buffer indices in file order
+            std::vector<ULONG> Buffers;
+            size_t Position = 0;
+            etl_buffer Buffer;
+            ULONG Offset = 0;
+            // The head of the stream, valid unless Done
+            etl_event Event = {};
+            bool Done = false;
+        };
+
+        void enter_buffer(stream &s, size_t position)
+        {
+            s.Position = position;
+            s.Buffer = Reader.buffer(s.Buffers[position]);
+            s.Offset = etl_buffer::first_offset;
+            if (position + 1 < s.Buffers.size())
+            {
+                etl_buffer next = Reader.buffer(s.Buffers[position + 1]);
+                ULONG size = next.used_size();
+                etl_prefetch(
+                    next.data(),
+                    size < etl_merge_prefetch_size ? size : etl_merge_prefetch_size);
+            }
+        }
+
+        void advance(stream &s)
+        {
+            LONGLONG previous = s.Event.TimeStamp;
+            for (;;)
+            {
+                etl_next_result result = s.Buffer.next_event(s.Offset, s.Event);
+                if (result == etl_next_result::Event)
+                {
+                    if (etl_get_header_info(s.Event.HeaderType).TimeStampOffset == 0)
+                    {
+                        s.Event.TimeStamp = previous;
+                    }
+                    return;
+                }
+                Malformed |= result == etl_next_result::Malformed;
+                if (s.Position + 1 == s.Buffers.size())
+                {
+                    s.Done = true;
+                    return;
+                }
+                enter_buffer(s, s.Position + 1);
+            }
+        }
+
+        bool before(size_t a, size_t b) const
+        {
+            const stream &x = Streams[a];
+            const stream &y = Streams[b];
+            if (x.Done || y.Done)
+            {
+                return x.Done == y.Done ? a < b : y.Done;
+            }
+            if (x.Event.TimeStamp != y.Event.TimeStamp)
+            {
+                return x.Event.TimeStamp < y.Event.TimeStamp;
+            }
+            return a < b;
+        }
+
+        // Tree[1..k-1] hold the loser of each match, Tree[0] the overall winner; the
+        // leaves k..2k-1 are the streams.
+        void build()
+        {
+            size_t k = Streams.size();
+            Tree.assign(k ? k : 1, 0);
+            std::vector<size_t> winners(2 * k);
+            for (size_t i = 0; i < k; ++i)
+            {
+                winners[k + i] = i;
+            }
+            for (size_t node = k - 1; node > 0 && k > 1; --node)
+            {
+                size_t a = winners[2 * node];
+                size_t b = winners[2 * node + 1];
+                winners[node] = before(a, b) ? a : b;
+                Tree[node] = before(a, b) ? b : a;
+            }
+            Tree[0] = k > 1 ? winners[1] : 0;
+        }
+
+        // Replays the matches from the leaf of stream up to the root
+        void replay(size_t winner)
+        {
+            size_t k = Streams.size();
+            for (size_t node = (winner + k) / 2; node > 0; node /= 2)
+            {
+                if (before(Tree[node], winner))
+                {
+                    std::swap(Tree[node], winner);
+                }
+            }
+            Tree[0] = winner;
+        }
+
+        const etl_reader &Reader;
+        std::vector<stream> Streams;
+        std::vector<size_t> Tree;
+        bool Malformed = false;
+    };
+
+} // namespace phnt
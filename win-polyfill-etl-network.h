@@ -0,0 +1,498 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Network flows==
+//
+// Sums the kernel TCP and UDP events (WMI_TCPIP_V4, WMI_TCPIP_V6, WMI_UDP_V4 and
+// WMI_UDP_V6) per flow, that is per protocol, local and remote address and port, and
+// per process. SourceAddress and SourcePort are the local end of the flow for sends
+// and receives alike.
+//
+// IPv4 addresses are kept as IPv4 mapped IPv6 addresses (::ffff:a.b.c.d), so both
+// families share one 40 byte key and one table. Ports are in host order. The table
+// is a Robin Hood hash of 8 byte slots, the low bits of the key hash and the index
+// of the flow in a dense vector, probed without touching the flows until a hash
+// matches; flows are never removed.
+//
+// The kernel logs connects once done, so the latencies are those the trace can see:
+//
+//   connect delay      from the first RECONNECT (a SYN sent again) of a flow to its
+//                      CONNECT; connects that needed no retry are not timed
+//   retransmit delay   from a RETRANSMIT to the next FULLACK or PARTACK of the flow
+//
+// A FAIL (TcpIp_Fail) carries the protocol and a failure code but no addresses, so it
+// belongs to no flow: failures are counted by code, and by the process of the event
+// header when it has one.
+//
+//   etl_flow_table::consume(event)        TCP and UDP events, in time order
+//   etl_flow_table::for_each_flow(f)      f(etl_flow_key, etl_flow_stats)
+//   etl_flow_table::processes()           etl_flow_stats summed by process
+//   etl_flow_table::failures()            failed connects by FailureCode
+//   etl_flow_table::connect_delays(), retransmit_delays()
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-network.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    struct etl_flow_key
+    {
+        UCHAR LocalAddress[16];
+        UCHAR RemoteAddress[16];
+        USHORT LocalPort;
+        USHORT RemotePort;
+        // IPPROTO_TCP (6) or IPPROTO_UDP (17)
+        UCHAR Protocol;
+        UCHAR Reserved[3];
+
+        bool ipv4() const
+        {
+            static const UCHAR mapped[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+            return memcmp(LocalAddress, mapped, 12) == 0 &&
+                   memcmp(RemoteAddress, mapped, 12) == 0;
+        }
+
+        bool operator==(const etl_flow_key &other) const
+        {
+            return memcmp(this, &other, sizeof(*this)) == 0;
+        }
+    };
+
+    // Hashed as five words
+    static_assert(sizeof(etl_flow_key) == 40, "etl_flow_key is packed");
+
+    struct etl_flow_stats
+    {
+        // Of the last event of the flow
+        ULONG ProcessId;
+        uint64_t SendBytes;
+        uint64_t SendPackets;
+        uint64_t ReceiveBytes;
+        uint64_t ReceivePackets;
+        uint64_t Connects;
+        uint64_t Accepts;
+        uint64_t Disconnects;
+        uint64_t Reconnects;
+        // Only set in processes(), a FAIL belongs to no flow
+        uint64_t Failures;
+        uint64_t Retransmits;
+        int64_t FirstTimeStamp;
+        int64_t LastTimeStamp;
+    };
+
+    class etl_flow_table
+    {
+      public:
+        etl_flow_table() { Slots.assign(1024, 0); }
+
+        void consume(const etl_event &event)
+        {
+            if (!etl_get_header_info(event.HeaderType).SizeInPacket)
+            {
+                return;
+            }
+            const UCHAR group_tcp = EVENT_TRACE_GROUP_TCPIP >> 8;
+            const UCHAR group_udp = EVENT_TRACE_GROUP_UDPIP >> 8;
+            UCHAR group = (UCHAR)(event.HookId >> 8);
+            UCHAR type = (UCHAR)event.HookId;
+            if (group == group_tcp)
+            {
+                // The IPv6 types follow the IPv4 ones from 0x1A on, in the same order
+                if (type >= (UCHAR)WMI_LOG_TYPE_TCPIP_SEND_IPV6 &&
+                    type <= (UCHAR)WMI_LOG_TYPE_TCPIP_DUPACK_IPV6)
+                {
+                    UCHAR v4_type = type - (UCHAR)WMI_LOG_TYPE_TCPIP_SEND_IPV6 +
+                                    EVENT_TRACE_TYPE_SEND;
+                    if (v4_type == EVENT_TRACE_TYPE_CONNFAIL)
+                    {
+                        fail(event);
+                    }
+                    else
+                    {
+                        tcp(event, v4_type, read<WMI_TCPIP_V6>(event));
+                    }
+                }
+                else if (type == EVENT_TRACE_TYPE_CONNFAIL)
+                {
+                    fail(event);
+                }
+                else
+                {
+                    tcp(event, type, read<WMI_TCPIP_V4>(event));
+                }
+            }
+            else if (group == group_udp)
+            {
+                if (event.HookId == WMI_LOG_TYPE_UDP_SEND ||
+                    event.HookId == WMI_LOG_TYPE_UDP_RECEIVE)
+                {
+                    udp(event, read<WMI_UDP_V4>(event));
+                }
+                else if (
+                    event.HookId == WMI_LOG_TYPE_UDP_SEND_IPV6 ||
+                    event.HookId == WMI_LOG_TYPE_UDP_RECEIVE_IPV6)
+                {
+                    udp(event, read<WMI_UDP_V6>(event));
+                }
+            }
+        }
+
+        // f(const etl_flow_key &, const etl_flow_stats &), in the order first seen
+        template <class F> void for_each_flow(F &&f) const
+        {
+            for (const flow &each : Flows)
+            {
+                f(each.Key, each.Stats);
+            }
+        }
+
+        // Stats of a flow, nullptr if never seen
+        const etl_flow_stats *find(const etl_flow_key &Key) const
+        {
+            ULONG index = lookup(Key, hash(Key));
+            return index == no_flow ? nullptr : &Flows[index].Stats;
+        }
+
+        // By ProcessId; FirstTimeStamp, LastTimeStamp and ProcessId are those of the
+        // process's events
+        const std::unordered_map<ULONG, etl_flow_stats> &processes() const
+        {
+            return Processes;
+        }
+
+        size_t size() const { return Flows.size(); }
+
+        // Failed TCP connects by FailureCode
+        const std::unordered_map<USHORT, uint64_t> &failures() const { return Failures; }
+
+        const etl_histogram &connect_delays() const { return ConnectDelays; }
+
+        const etl_histogram &retransmit_delays() const { return RetransmitDelays; }
+
+      private:
+        struct record
+        {
+            bool Valid;
+            etl_flow_key Key;
+            ULONG ProcessId;
+            ULONG TransferSize;
+        };
+
+        struct flow
+        {
+            etl_flow_key Key;
+            etl_flow_stats Stats;
+            // Of the pending RECONNECT and RETRANSMIT, INT64_MIN if none
+            int64_t Reconnect;
+            int64_t Retransmit;
+        };
+
+        static constexpr ULONG no_flow = 0xFFFFFFFF;
+        // Slot: index + 1 in the high half, hash bits in the low half, 0 when free
+        static constexpr unsigned slot_hash_bits = 32;
+
+        static USHORT swap(USHORT Port) { return (USHORT)(Port >> 8 | Port << 8); }
+
+        template <size_t N> static void address(UCHAR (&To)[16], const UCHAR (&From)[N])
+        {
+            static_assert(N == 4 || N == 16, "IPv4 or IPv6");
+            if (N == 4)
+            {
+                memset(To, 0, 10);
+                To[10] = 0xFF;
+                To[11] = 0xFF;
+            }
+            memcpy(To + 16 - N, From, N);
+        }
+
+        // WMI_TCPIP_V4, _V6, WMI_UDP_V4 and _V6 differ in address length and in the size
+        // of TransferSize only
+        template <class T> static record read(const etl_event &event)
+        {
+            record result = {};
+            const ULONG size = FIELD_OFFSET(T, SourcePort) + sizeof(USHORT);
+            if (event.PayloadSize < size)
+            {
+                return result;
+            }
+            T payload;
+            memcpy(&payload, event.Payload, size);
+            result.Valid = true;
+            address(result.Key.LocalAddress, payload.SourceAddress);
+            address(result.Key.RemoteAddress, payload.DestinationAddress);
+            result.Key.LocalPort = swap(payload.SourcePort);
+            result.Key.RemotePort = swap(payload.DestinationPort);
+            result.ProcessId = payload.ProcessId;
+            result.TransferSize = payload.TransferSize;
+            return result;
+        }
+
+        static uint64_t hash(const etl_flow_key &Key)
+        {
+            uint64_t words[5];
+            memcpy(words, &Key, sizeof(words));
+            uint64_t h = 0x9E3779B97F4A7C15ull;
+            for (uint64_t word : words)
+            {
+                h = (h ^ word) * 0xFF51AFD7ED558CCDull;
+                h ^= h >> 32;
+            }
+            return h;
+        }
+
+        ULONG lookup(const etl_flow_key &Key, uint64_t Hash) const
+        {
+            const size_t mask = Slots.size() - 1;
+            const uint64_t fragment = (ULONG)Hash;
+            for (size_t i = Hash & mask, distance = 0;; i = (i + 1) & mask, ++distance)
+            {
+                uint64_t slot = Slots[i];
+                // A slot closer to its home than we are to ours ends the search
+                if (slot == 0 || probe_distance(slot, i) < distance)
+                {
+                    return no_flow;
+                }
+                ULONG index = (ULONG)(slot >> slot_hash_bits) - 1;
+                if ((ULONG)slot == fragment && Flows[index].Key == Key)
+                {
+                    return index;
+                }
+            }
+        }
+
+        size_t probe_distance(uint64_t Slot, size_t Index) const
+        {
+            const size_t mask = Slots.size() - 1;
+            return (Index - ((ULONG)Slot & mask)) & mask;
+        }
+
+        void place(uint64_t Slot)
+        {
+            const size_t mask = Slots.size() - 1;
+            size_t distance = 0;
+            for (size_t i = (ULONG)Slot & mask;; i = (i + 1) & mask, ++distance)
+            {
+                if (Slots[i] == 0)
+                {
+                    Slots[i] = Slot;
+                    return;
+                }
+                // Take the place of a richer slot and carry it on
+                size_t other = probe_distance(Slots[i], i);
+                if (other < distance)
+                {
+                    uint64_t carried = Slots[i];
+                    Slots[i] = Slot;
+                    Slot = carried;
+                    distance = other;
+                }
+            }
+        }
+
+        flow &get(const etl_flow_key &Key, LONGLONG TimeStamp)
+        {
+            uint64_t h = hash(Key);
+            ULONG index = lookup(Key, h);
+            if (index != no_flow)
+            {
+                return Flows[index];
+            }
+            // Below 3/4 full; the table is sized by the low 32 bits of the hash
+            if (4 * (Flows.size() + 1) > 3 * Slots.size())
+            {
+                std::vector<uint64_t> old(Slots.size() * 2, 0);
+                // Slots is the larger table from here on
+                old.swap(Slots);
+                for (uint64_t slot : old)
+                {
+                    if (slot != 0)
+                    {
+                        place(slot);
+                    }
+                }
+            }
+            index = (ULONG)Flows.size();
+            flow created = {};
+            created.Key = Key;
+            created.Stats.FirstTimeStamp = TimeStamp;
+            created.Reconnect = INT64_MIN;
+            created.Retransmit = INT64_MIN;
+            Flows.push_back(created);
+            place((uint64_t)(index + 1) << slot_hash_bits | (ULONG)h);
+            return Flows.back();
+        }
+
+        etl_flow_stats &process(ULONG ProcessId, LONGLONG TimeStamp)
+        {
+            auto found = Processes.find(ProcessId);
+            if (found == Processes.end())
+            {
+                etl_flow_stats created = {};
+                created.ProcessId = ProcessId;
+                created.FirstTimeStamp = TimeStamp;
+                found = Processes.emplace(ProcessId, created).first;
+            }
+            found->second.LastTimeStamp = TimeStamp;
+            return found->second;
+        }
+
+        void tcp(const etl_event &event, UCHAR Type, record Record)
+        {
+            if (!Record.Valid)
+            {
+                return;
+            }
+            Record.Key.Protocol = 6;
+            flow &each = get(Record.Key, event.TimeStamp);
+            etl_flow_stats &stats = each.Stats;
+            etl_flow_stats &owner = process(Record.ProcessId, event.TimeStamp);
+            stats.ProcessId = Record.ProcessId;
+            stats.LastTimeStamp = event.TimeStamp;
+            switch (Type)
+            {
+            case EVENT_TRACE_TYPE_SEND:
+                count(
+                    stats.SendBytes,
+                    stats.SendPackets,
+                    owner.SendBytes,
+                    owner.SendPackets,
+                    Record.TransferSize);
+                break;
+            case EVENT_TRACE_TYPE_RECEIVE:
+                count(
+                    stats.ReceiveBytes,
+                    stats.ReceivePackets,
+                    owner.ReceiveBytes,
+                    owner.ReceivePackets,
+                    Record.TransferSize);
+                break;
+            case EVENT_TRACE_TYPE_CONNECT:
+                ++stats.Connects;
+                ++owner.Connects;
+                end(ConnectDelays, each.Reconnect, event.TimeStamp);
+                break;
+            case EVENT_TRACE_TYPE_ACCEPT:
+                ++stats.Accepts;
+                ++owner.Accepts;
+                break;
+            case EVENT_TRACE_TYPE_DISCONNECT:
+                ++stats.Disconnects;
+                ++owner.Disconnects;
+                each.Reconnect = INT64_MIN;
+                each.Retransmit = INT64_MIN;
+                break;
+            case EVENT_TRACE_TYPE_RECONNECT:
+                ++stats.Reconnects;
+                ++owner.Reconnects;
+                if (each.Reconnect == INT64_MIN)
+                {
+                    each.Reconnect = event.TimeStamp;
+                }
+                break;
+            case EVENT_TRACE_TYPE_RETRANSMIT:
+                ++stats.Retransmits;
+                ++owner.Retransmits;
+                if (each.Retransmit == INT64_MIN)
+                {
+                    each.Retransmit = event.TimeStamp;
+                }
+                break;
+            case EVENT_TRACE_TYPE_ACKFULL:
+            case EVENT_TRACE_TYPE_ACKPART:
+                end(RetransmitDelays, each.Retransmit, event.TimeStamp);
+                break;
+            }
+        }
+
+        // TcpIp_Fail: USHORT Proto, USHORT FailureCode
+        void fail(const etl_event &event)
+        {
+            if (event.PayloadSize < 2 * sizeof(USHORT))
+            {
+                return;
+            }
+            ++Failures[etl_load<USHORT>(event.Payload + sizeof(USHORT))];
+            if (event.ProcessId != etl_no_id)
+            {
+                ++process(event.ProcessId, event.TimeStamp).Failures;
+            }
+        }
+
+        void udp(const etl_event &event, record Record)
+        {
+            if (!Record.Valid)
+            {
+                return;
+            }
+            Record.Key.Protocol = 17;
+            etl_flow_stats &stats = get(Record.Key, event.TimeStamp).Stats;
+            etl_flow_stats &owner = process(Record.ProcessId, event.TimeStamp);
+            stats.ProcessId = Record.ProcessId;
+            stats.LastTimeStamp = event.TimeStamp;
+            // The IPv6 types are the IPv4 ones + 0x10
+            if ((UCHAR)event.HookId == EVENT_TRACE_TYPE_SEND ||
+                event.HookId == WMI_LOG_TYPE_UDP_SEND_IPV6)
+            {
+                count(
+                    stats.SendBytes,
+                    stats.SendPackets,
+                    owner.SendBytes,
+                    owner.SendPackets,
+                    Record.TransferSize);
+            }
+            else
+            {
+                count(
+                    stats.ReceiveBytes,
+                    stats.ReceivePackets,
+                    owner.ReceiveBytes,
+                    owner.ReceivePackets,
+                    Record.TransferSize);
+            }
+        }
+
+        static void count(
+            uint64_t &Bytes,
+            uint64_t &Packets,
+            uint64_t &ProcessBytes,
+            uint64_t &ProcessPackets,
+            ULONG Size)
+        {
+            Bytes += Size;
+            ++Packets;
+            ProcessBytes += Size;
+            ++ProcessPackets;
+        }
+
+        static void end(etl_histogram &Delays, int64_t &Start, LONGLONG TimeStamp)
+        {
+            if (Start != INT64_MIN)
+            {
+                Delays.add(TimeStamp > Start ? (uint64_t)(TimeStamp - Start) : 0);
+                Start = INT64_MIN;
+            }
+        }
+
+        std::vector<flow> Flows;
+        std::vector<uint64_t> Slots;
+        std::unordered_map<ULONG, etl_flow_stats> Processes;
+        std::unordered_map<USHORT, uint64_t> Failures;
+        etl_histogram ConnectDelays;
+        etl_histogram RetransmitDelays;
+    };
+
+} // namespace phnt
@@ -0,0 +1,350 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+// No include guard, included by win-polyfill-etl-dispatch.h once per pass.
+//
+// The payload structure of each kernel event, maintained by hand. A structure row is
+// followed by the hooks that carry it:
+//
+//   PHNT_ETL_PAYLOAD(Struct, PointerSize)         payload starts after the header
+//   PHNT_ETL_PAYLOAD_VARIABLE(Struct, PointerSize, Member)
+//                                                 same, Member and what follows is
+//                                                 variable length and may be empty
+//   PHNT_ETL_RECORD(Struct, PointerSize)          the structure starts with the
+//                                                 SYSTEM_TRACE_HEADER of the record
+//   PHNT_ETL_PAYLOAD_HOOK(Hook, Version)          Hook carries the structure from
+//                                                 event version Version on
+//
+// PointerSize is the pointer size of the trace the layout is valid for: 0 when the
+// structure has no pointer sized member, 4 or 8 for the explicit 32 and 64 bit
+// layouts, sizeof(PVOID) for the layouts that follow the build. When two rows claim
+// the same hook, version and pointer size the first one wins, so the explicit layouts
+// come before the native ones.
+
+// EVENT_TRACE_GROUP_PROCESS
+PHNT_ETL_PAYLOAD(WMI_PROCESS_INFORMATION64, 8)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_CREATE, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_DELETE, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_DC_START, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_DC_END, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_TERMINATE, 4)
+PHNT_ETL_PAYLOAD(WMI_PROCESS_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_CREATE, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_DELETE, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_DC_START, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_DC_END, 4)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PROCESS_TERMINATE, 4)
+
+// EVENT_TRACE_GROUP_IMAGE
+PHNT_ETL_PAYLOAD_VARIABLE(WMI_IMAGELOAD_INFORMATION32, 4, FileName)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_LOAD, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_UNLOAD, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_DC_START, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_DC_END, 3)
+PHNT_ETL_PAYLOAD_VARIABLE(WMI_IMAGELOAD_INFORMATION64, 8, FileName)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_LOAD, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_UNLOAD, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_DC_START, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IMAGE_DC_END, 3)
+
+// EVENT_TRACE_GROUP_THREAD
+PHNT_ETL_PAYLOAD(WMI_EXTENDED_THREAD_INFORMATION64, 8)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_CREATE, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_DELETE, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_DC_START, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_DC_END, 3)
+PHNT_ETL_PAYLOAD(WMI_EXTENDED_THREAD_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_CREATE, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_DELETE, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_DC_START, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_THREAD_DC_END, 3)
+PHNT_ETL_PAYLOAD(WMI_CONTEXTSWAP, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CONTEXTSWAP, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_CCSWAP_BUFFER, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CONTEXTSWAP_BATCH, 2)
+PHNT_ETL_PAYLOAD(ETW_READY_THREAD_EVENT, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_READY_THREAD, 2)
+PHNT_ETL_PAYLOAD(WMI_SPINLOCK, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SPINLOCK, 2)
+PHNT_ETL_PAYLOAD(WMI_QUEUE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_QUEUE, 2)
+PHNT_ETL_PAYLOAD(WMI_RESOURCE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_RESOURCE, 2)
+PHNT_ETL_PAYLOAD(WMI_PUSHLOCK, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_PUSHLOCK, 2)
+PHNT_ETL_PAYLOAD(WMI_WAIT_SINGLE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_WAIT_SINGLE, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(WMI_WAIT_MULTIPLE, sizeof(PVOID), ObjectRecord)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_WAIT_MULTIPLE, 2)
+PHNT_ETL_PAYLOAD(WMI_DELAY_EXECUTION, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DELAY_EXECUTION, 2)
+PHNT_ETL_PAYLOAD(ETW_PRIORITY_EVENT, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_PRIORITY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_BASE_PRIORITY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_PAGE_PRIORITY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_IO_PRIORITY, 2)
+PHNT_ETL_PAYLOAD(ETW_THREAD_AFFINITY_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_THREAD_SET_AFFINITY, 2)
+PHNT_ETL_PAYLOAD(ETW_ANTI_STARVATION_BOOST_EVENT, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_ANTI_STARVATION_BOOST, 2)
+PHNT_ETL_PAYLOAD(ETW_KQUEUE_ENQUEUE_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_KQUEUE_ENQUEUE, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(ETW_KQUEUE_DEQUEUE_EVENT, sizeof(PVOID), Entries)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_KQUEUE_DEQUEUE, 2)
+PHNT_ETL_PAYLOAD(ETW_THREAD_EVENT_SUBPROCESSTAG, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_THREAD_SUBPROCESSTAG_CHANGED, 2)
+
+// EVENT_TRACE_GROUP_TCPIP, EVENT_TRACE_GROUP_UDPIP
+PHNT_ETL_PAYLOAD(WMI_TCPIP_V4, 0)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_SEND, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_RECEIVE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_CONNECT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_DISCONNECT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_RETRANSMIT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_ACCEPT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_RECONNECT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_FAIL, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_TCPCOPY, 2)
+PHNT_ETL_PAYLOAD(WMI_TCPIP_V6, 0)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_SEND_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_RECEIVE_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_CONNECT_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_DISCONNECT_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_RETRANSMIT_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_ACCEPT_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_RECONNECT_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_FAIL_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_TCPIP_TCPCOPY_IPV6, 2)
+PHNT_ETL_PAYLOAD(WMI_UDP_V4, 0)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_UDP_SEND, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_UDP_RECEIVE, 2)
+PHNT_ETL_PAYLOAD(WMI_UDP_V6, 0)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_UDP_SEND_IPV6, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_UDP_RECEIVE_IPV6, 2)
+
+// EVENT_TRACE_GROUP_IO
+PHNT_ETL_PAYLOAD(ETW_DISKIO_READWRITE_V2, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_READ, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_WRITE, 2)
+PHNT_ETL_PAYLOAD(ETW_DISKIO_READWRITE_V3, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_READ, 3)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_WRITE, 3)
+PHNT_ETL_PAYLOAD(ETW_DISKIO_FLUSH_BUFFERS_V2, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_FLUSH, 2)
+PHNT_ETL_PAYLOAD(ETW_DISKIO_FLUSH_BUFFERS_V3, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_FLUSH, 3)
+PHNT_ETL_PAYLOAD(WMI_DISKIO_READWRITE_INIT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_READ_INIT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_WRITE_INIT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_FLUSH_INIT, 2)
+PHNT_ETL_PAYLOAD(WMI_DISKIO_IO_REDIRECTED_INIT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_IO_REDIRECTED_INIT, 2)
+
+// EVENT_TRACE_GROUP_MEMORY
+PHNT_ETL_PAYLOAD(WMI_PAGE_FAULT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PAGE_FAULT_TRANSITION, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PAGE_FAULT_DEMAND_ZERO, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PAGE_FAULT_COPY_ON_WRITE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PAGE_FAULT_GUARD_PAGE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PAGE_FAULT_HARD_PAGE_FAULT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_PAGE_FAULT_ACCESS_VIOLATION, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_HARDPAGEFAULT_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HARDFAULT, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_VIRTUAL_ALLOC, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_ALLOC, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_FREE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_ALLOC_DC_START, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_VIRTUAL_ALLOC_DC_END, 2)
+PHNT_ETL_PAYLOAD(ETW_POOL_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_ALLOCATEPOOL, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_ALLOCATEPOOL_SESSION, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FREEPOOL, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FREEPOOL_SESSION, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_BIGPOOLPAGE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_BIGPOOLPAGE_SESSION, 2)
+
+// EVENT_TRACE_GROUP_REGISTRY, the operations have no PERFINFO_LOG_TYPE_ name
+PHNT_ETL_PAYLOAD_VARIABLE(WMI_REGISTRY, sizeof(PVOID), Name)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGCREATE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGOPEN, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGDELETE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGQUERY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGSETVALUE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGDELETEVALUE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGQUERYVALUE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGENUMERATEKEY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGENUMERATEVALUEKEY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGQUERYMULTIPLEVALUE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGSETINFORMATION, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGFLUSH, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGKCBCREATE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGKCBDELETE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_REG_RUNDOWNBEGIN, 2)
+    PHNT_ETL_PAYLOAD_HOOK(WMI_LOG_TYPE_REG_RUNDOWNEND, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGVIRTUALIZE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGCLOSE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGSETSECURITY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGQUERYSECURITY, 2)
+// The transactions of the registry name their hive instead of a KCB
+PHNT_ETL_PAYLOAD_VARIABLE(WMI_TXR, 0, Hive)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGCOMMIT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGPREPARE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGROLLBACK, 2)
+PHNT_ETL_PAYLOAD(ETW_REGNOTIF_REGISTER, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_REG_NOTIF_REGISTER, 2)
+
+// EVENT_TRACE_GROUP_FILE
+PHNT_ETL_PAYLOAD(PERFINFO_FILEOBJECT_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILENAME, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILENAME_CREATE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILENAME_DELETE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILENAME_RUNDOWN, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_FILENAME_SAME_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILENAME_SAME, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(PERFINFO_FILE_CREATE, sizeof(PVOID), OpenPath)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CREATE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CREATE_NEW, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_FILE_READ_WRITE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_READ, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_WRITE, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_FILE_SIMPLE_OPERATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CLEANUP, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_CLOSE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_FLUSH, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_FILE_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_SET_INFORMATION, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DELETE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_RENAME, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_QUERY_INFORMATION, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_FS_CONTROL, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_SETLINK, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(PERFINFO_FILE_DIRENUM, sizeof(PVOID), FileName)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DIRENUM, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DIRNOTIFY, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(PERFINFO_FILE_PATH_OPERATION, sizeof(PVOID), Path)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_DELETE_PATH, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_RENAME_PATH, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_SETLINK_PATH, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_FILE_OPERATION_END, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_FILE_IO_OPERATION_END, 2)
+
+// EVENT_TRACE_GROUP_PERFINFO
+PHNT_ETL_PAYLOAD(PERFINFO_SAMPLED_PROFILE_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_NMI, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(PERFINFO_SAMPLED_PROFILE_CACHE, sizeof(PVOID), Sample)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_CACHE, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_SAMPLED_PROFILE_CONFIG, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_SET_INTERVAL, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_DC_START, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SAMPLED_PROFILE_DC_END, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_PMC_SAMPLE_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_PMC_INTERRUPT, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_SYSCALL_ENTER_DATA, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SYSCALL_ENTER, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_SYSCALL_EXIT_DATA, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_SYSCALL_EXIT, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_DPC_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DPC, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TIMERDPC, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_THREADED_DPC, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_DPC_ENQUEUE_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DPC_ENQUEUE, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_DPC_EXECUTION_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DPC_EXECUTION, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_INTERRUPT_INFORMATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_INTERRUPT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_MSI_INTERRUPT, 2)
+PHNT_ETL_PAYLOAD(PERFINFO_CLOCK_INTERRUPT_INFORMATION, 0)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CLOCK_INTERRUPT, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(ETW_DEBUG_PRINT_EVENT, 0, Message)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DEBUG_PRINT, 2)
+
+// EVENT_TRACE_GROUP_HEAP, EVENT_TRACE_GROUP_CRITSEC
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_CREATE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_CREATE, 2)
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_ALLOC, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_ALLOC, 2)
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_REALLOC, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_REALLOC, 2)
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_FREE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_FREE, 2)
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_COMMON, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_DESTROY, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_LOCK, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_UNLOCK, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_VALIDATE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_WALK, 2)
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_EXPANSION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_EXTEND, 2)
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_CONTRACTION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_CONTRACT, 2)
+PHNT_ETL_RECORD(ETW_HEAP_EVENT_SNAPSHOT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_SNAPSHOT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_CREATE_SNAPSHOT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_DESTROY_SNAPSHOT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_EXTEND_SNAPSHOT, 2)
+PHNT_ETL_RECORD(HEAP_COMMIT_DECOMMIT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_COMMIT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_DECOMMIT, 2)
+PHNT_ETL_RECORD(HEAP_SUBSEGMENT_ALLOC, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_ALLOC, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_ALLOC_CACHE, 2)
+PHNT_ETL_RECORD(HEAP_SUBSEGMENT_FREE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_FREE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_HEAP_SUBSEGMENT_FREE_CACHE, 2)
+PHNT_ETL_RECORD(ETW_CRITSEC_EVENT_COLLISION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CRITSEC_ENTER, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CRITSEC_LEAVE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CRITSEC_COLLISION, 2)
+PHNT_ETL_RECORD(ETW_CRITSEC_EVENT_INIT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CRITSEC_INITIALIZE, 2)
+
+// EVENT_TRACE_GROUP_STACKWALK
+PHNT_ETL_PAYLOAD_VARIABLE(STACK_WALK_EVENT_DATA, sizeof(PVOID), Addresses)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_STACKWALK, 2)
+
+// EVENT_TRACE_GROUP_OBJECT
+PHNT_ETL_PAYLOAD(ETW_CREATE_HANDLE_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CREATE_HANDLE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CLOSE_HANDLE, 2)
+PHNT_ETL_PAYLOAD(ETW_DUPLICATE_HANDLE_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DUPLICATE_HANDLE, 2)
+PHNT_ETL_PAYLOAD_VARIABLE(ETW_OBJECT_TYPE_EVENT, 0, Name)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_START, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_OBJECT_TYPE_DC_END, 2)
+PHNT_ETL_PAYLOAD(ETW_OBJECT_HANDLE_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_START, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_OBJECT_HANDLE_DC_END, 2)
+PHNT_ETL_PAYLOAD(ETW_CREATEDELETE_OBJECT_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_CREATE_OBJECT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DELETE_OBJECT, 2)
+PHNT_ETL_PAYLOAD(ETW_REFDEREF_OBJECT_EVENT, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_REFERENCE_OBJECT, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_DEREFERENCE_OBJECT, 2)
+
+// EVENT_TRACE_GROUP_THREAD_POOL
+PHNT_ETL_RECORD(ETW_TP_EVENT_CALLBACK_ENQUEUE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_DEQUEUE, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_CALLBACK_START, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_START, 2)
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_STOP, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_CALLBACK_CANCEL, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_CALLBACK_CANCEL, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_POOL_CREATE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_POOL_CREATE, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_POOL_CLOSE, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_POOL_CLOSE, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_POOL_TH_MIN_SET, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_POOL_TH_MIN_SET, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_POOL_TH_MAX_SET, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_POOL_TH_MAX_SET, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_TIMER_SET, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_SET, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_TIMER_CANCELLED, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_CANCELLED, 2)
+PHNT_ETL_RECORD(ETW_TP_EVENT_TIMER_EXPIRATION, sizeof(PVOID))
+    PHNT_ETL_PAYLOAD_HOOK(PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION, 2)
@@ -0,0 +1,441 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Sampled profile by module==
+//
+// Joins the InstructionPointer of the PERFINFO_SAMPLED_PROFILE_INFORMATION samples to
+// the images loaded at that address, in that process, at that time.
+//
+//   etl_image_map::consume(event)        image load, unload and rundown events
+//   etl_image_map::find(process, time, address)
+//                                        the image mapped there, O(log n)
+//   etl_profile::consume(event)          thread events and samples
+//   etl_profile::for_each_rva(f)         samples per image and RVA
+//   etl_profile::for_each_folded(f)      samples per stack, "pid 4;nt!0x1000;..." lines
+//                                        for flame graph tools
+//
+// The image map is built in a first pass over the trace and the samples are read in a
+// second one, both in time order (etl_merger). Each process keeps the bases its images
+// were loaded at sorted, with the running maximum of their ends, and the images of
+// each base by load time. A lookup is a binary search for the base, a short walk back
+// over the bases whose images overlap in address and a binary search for the load
+// mapped at that time, so images reloaded at the same base do not lengthen it. Kernel
+// images are loaded in process 0 and found from any process. etl_profile remembers the
+// last image hit per thread and tries it before the search, since consecutive samples
+// of a thread mostly land in the same module.
+//
+// Folded stacks use the stacks attached to the samples (win-polyfill-etl-stack.h) or
+// the sampled address alone, which is kept in the folded key and never interned. A
+// stack is resolved once per process and image of its sampled address, against the
+// images of the time of its first sample.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-profile.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "win-polyfill-etl-stack.h"
+#include "win-polyfill-etl-strings.h"
+
+namespace phnt
+{
+
+    constexpr ULONG etl_no_image = 0xFFFFFFFF;
+
+    struct etl_image
+    {
+        uint64_t Base;
+        uint64_t Size;
+        ULONG ProcessId;
+        // INT64_MIN for the images of the rundown, loaded before the trace
+        int64_t Load;
+        // INT64_MAX while loaded
+        int64_t Unload;
+        // Full path, UTF-8
+        std::string FileName;
+
+        // File name without the directory
+        const char *module() const
+        {
+            size_t slash = FileName.find_last_of("\\/");
+            return FileName.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+        }
+    };
+
+    class etl_image_map
+    {
+      public:
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_IMAGE_LOAD:
+            case WMI_LOG_TYPE_IMAGE_DC_START:
+            case WMI_LOG_TYPE_IMAGE_UNLOAD:
+                break;
+            default:
+                return;
+            }
+
+            // ImageBase and ImageSize are pointer sized, ProcessId follows in
+            // WMI_IMAGELOAD_INFORMATION32 and WMI_IMAGELOAD_INFORMATION64
+            ULONG name_offset = event.PointerSize == 8
+                                    ? FIELD_OFFSET(WMI_IMAGELOAD_INFORMATION64, FileName)
+                                    : FIELD_OFFSET(WMI_IMAGELOAD_INFORMATION32, FileName);
+            if (event.PayloadSize < name_offset)
+            {
+                return;
+            }
+            uint64_t base = etl_load_pointer(event.Payload, event.PointerSize);
+            uint64_t size =
+                etl_load_pointer(event.Payload + event.PointerSize, event.PointerSize);
+            ULONG process_id = etl_load<ULONG>(event.Payload + 2 * event.PointerSize);
+            if (event.HookId == WMI_LOG_TYPE_IMAGE_UNLOAD)
+            {
+                unload(process_id, base, event.TimeStamp);
+                return;
+            }
+            std::string name =
+                etl_utf8(event.Payload + name_offset, event.PayloadSize - name_offset);
+            LONGLONG time =
+                event.HookId == WMI_LOG_TYPE_IMAGE_DC_START ? INT64_MIN : event.TimeStamp;
+            load(process_id, base, size, time, std::move(name));
+        }
+
+        void load(
+            ULONG ProcessId,
+            uint64_t Base,
+            uint64_t Size,
+            LONGLONG TimeStamp,
+            std::string FileName)
+        {
+            ULONG index = (ULONG)Images.size();
+            Images.push_back(
+                {Base, Size, ProcessId, TimeStamp, INT64_MAX, std::move(FileName)});
+            Open[{ProcessId, Base}] = index;
+
+            // Images mostly come in base and time order, insertions stay short
+            std::vector<base_images> &bases = Processes[ProcessId];
+            auto it = std::lower_bound(
+                bases.begin(),
+                bases.end(),
+                Base,
+                [](const base_images &base, uint64_t value) {
+                    return base.Base < value;
+                });
+            size_t position = it - bases.begin();
+            if (it == bases.end() || it->Base != Base)
+            {
+                bases.insert(it, base_images{Base, 0, 0, {}});
+            }
+            base_images &base = bases[position];
+            base.End = std::max(base.End, Base + Size);
+            base.Loads.insert(
+                std::upper_bound(
+                    base.Loads.begin(),
+                    base.Loads.end(),
+                    TimeStamp,
+                    [&](LONGLONG time, ULONG image) {
+                        return time < Images[image].Load;
+                    }),
+                index);
+            for (size_t i = position; i < bases.size(); ++i)
+            {
+                uint64_t previous = i ? bases[i - 1].MaxEnd : 0;
+                bases[i].MaxEnd = std::max(bases[i].End, previous);
+            }
+        }
+
+        void unload(ULONG ProcessId, uint64_t Base, LONGLONG TimeStamp)
+        {
+            auto it = Open.find({ProcessId, Base});
+            if (it != Open.end())
+            {
+                Images[it->second].Unload = TimeStamp;
+                Open.erase(it);
+            }
+        }
+
+        // The image of ProcessId, or of process 0, mapped at Address at TimeStamp
+        ULONG find(ULONG ProcessId, LONGLONG TimeStamp, uint64_t Address) const
+        {
+            ULONG image = find_in(ProcessId, TimeStamp, Address);
+            if (image == etl_no_image && ProcessId != 0)
+            {
+                image = find_in(0, TimeStamp, Address);
+            }
+            return image;
+        }
+
+        bool contains(ULONG Image, LONGLONG TimeStamp, uint64_t Address) const
+        {
+            const etl_image &image = Images[Image];
+            return Address - image.Base < image.Size && image.Load <= TimeStamp &&
+                   TimeStamp < image.Unload;
+        }
+
+        const etl_image &image(ULONG Image) const { return Images[Image]; }
+
+        size_t size() const { return Images.size(); }
+
+      private:
+        struct base_images
+        {
+            uint64_t Base;
+            // Largest Base + Size of the images loaded at Base
+            uint64_t End;
+            // Largest End of this and the lower bases
+            uint64_t MaxEnd;
+            // Images loaded at Base by Load, one unloads before the next loads
+            std::vector<ULONG> Loads;
+        };
+
+        ULONG find_in(ULONG ProcessId, LONGLONG TimeStamp, uint64_t Address) const
+        {
+            auto found = Processes.find(ProcessId);
+            if (found == Processes.end())
+            {
+                return etl_no_image;
+            }
+            const std::vector<base_images> &bases = found->second;
+            auto it = std::upper_bound(
+                bases.begin(),
+                bases.end(),
+                Address,
+                [](uint64_t address, const base_images &base) {
+                    return address < base.Base;
+                });
+            while (it != bases.begin() && (--it)->MaxEnd > Address)
+            {
+                // Only the last load at or before TimeStamp can be mapped then
+                auto load = std::upper_bound(
+                    it->Loads.begin(),
+                    it->Loads.end(),
+                    TimeStamp,
+                    [&](LONGLONG time, ULONG image) {
+                        return time < Images[image].Load;
+                    });
+                if (load != it->Loads.begin() && contains(load[-1], TimeStamp, Address))
+                {
+                    return load[-1];
+                }
+            }
+            return etl_no_image;
+        }
+
+        std::vector<etl_image> Images;
+        // By ImageBase
+        std::unordered_map<ULONG, std::vector<base_images>> Processes;
+        std::map<std::pair<ULONG, uint64_t>, ULONG> Open;
+    };
+
+    class etl_profile
+    {
+      public:
+        // Attachments is optional, samples without an attached stack are folded by
+        // their address alone and take no room in Stacks
+        etl_profile(
+            const etl_image_map &Images,
+            etl_stack_store &Stacks,
+            const etl_stack_attachments *Attachments = nullptr)
+            : Images(Images), Stacks(Stacks), Attachments(Attachments)
+        {
+        }
+
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_THREAD_CREATE:
+            case WMI_LOG_TYPE_THREAD_DC_START:
+                // A thread that reuses an id starts without the image of the old one
+                Cache.erase(Threads.consume(event));
+                break;
+            case PERFINFO_LOG_TYPE_SAMPLED_PROFILE:
+            case PERFINFO_LOG_TYPE_SAMPLED_PROFILE_NMI:
+                // InstructionPointer is pointer sized, ThreadId and Count follow
+                if (event.PayloadSize >= event.PointerSize + 6u)
+                {
+                    uint64_t ip = etl_load_pointer(event.Payload, event.PointerSize);
+                    ULONG thread_id = etl_load<ULONG>(event.Payload + event.PointerSize);
+                    USHORT count =
+                        etl_load<USHORT>(event.Payload + event.PointerSize + 4);
+                    sample(thread_id, event.TimeStamp, ip, count ? count : 1);
+                }
+                break;
+            }
+        }
+
+        void sample(
+            ULONG ThreadId,
+            LONGLONG TimeStamp,
+            uint64_t InstructionPointer,
+            ULONG Count)
+        {
+            auto [cached, added] = Cache.try_emplace(ThreadId);
+            thread_state &thread = cached->second;
+            if (added)
+            {
+                thread.ProcessId = Threads.process(ThreadId);
+            }
+            ULONG image = thread.LastImage;
+            if (image == etl_no_image ||
+                !Images.contains(image, TimeStamp, InstructionPointer))
+            {
+                image = Images.find(thread.ProcessId, TimeStamp, InstructionPointer);
+                if (image != etl_no_image)
+                {
+                    thread.LastImage = image;
+                }
+            }
+            if (image == etl_no_image)
+            {
+                Unresolved += Count;
+            }
+            else
+            {
+                uint64_t rva = InstructionPointer - Images.image(image).Base;
+                Rvas[(uint64_t)image << 32 | (ULONG)rva] += Count;
+            }
+
+            ULONG stack =
+                Attachments ? Attachments->find(TimeStamp, ThreadId) : etl_no_stack;
+            folded_stack &folded = Folded[{
+                thread.ProcessId,
+                stack,
+                image,
+                stack == etl_no_stack ? InstructionPointer : 0}];
+            if (folded.Samples == 0)
+            {
+                folded.TimeStamp = TimeStamp;
+            }
+            folded.Samples += Count;
+        }
+
+        // f(const etl_image &, ULONG Rva, uint64_t Samples), unordered
+        template <class F> void for_each_rva(F &&f) const
+        {
+            for (const auto &rva : Rvas)
+            {
+                f(Images.image((ULONG)(rva.first >> 32)), (ULONG)rva.first, rva.second);
+            }
+        }
+
+        // f(const std::string &Stack, uint64_t Samples), root frame first, frames outside
+        // any image as 0x<address>
+        template <class F> void for_each_folded(F &&f) const
+        {
+            std::string line;
+            for (const auto &folded : Folded)
+            {
+                ULONG process_id = folded.first.ProcessId;
+                etl_stack stack = folded.first.StackId != etl_no_stack
+                                      ? Stacks.frames(folded.first.StackId)
+                                      : etl_stack{&folded.first.Address, 1};
+                char text[64];
+                snprintf(text, sizeof(text), "pid %lu", (unsigned long)process_id);
+                line = text;
+                for (ULONG i = stack.Count; i-- > 0;)
+                {
+                    uint64_t address = stack.Frames[i];
+                    ULONG image =
+                        Images.find(process_id, folded.second.TimeStamp, address);
+                    line += ';';
+                    if (image == etl_no_image)
+                    {
+                        snprintf(
+                            text, sizeof(text), "0x%llx", (unsigned long long)address);
+                    }
+                    else
+                    {
+                        line += Images.image(image).module();
+                        snprintf(
+                            text,
+                            sizeof(text),
+                            "!0x%llx",
+                            (unsigned long long)(address - Images.image(image).Base));
+                    }
+                    line += text;
+                }
+                f(static_cast<const std::string &>(line), folded.second.Samples);
+            }
+        }
+
+        // Samples outside any known image
+        uint64_t unresolved() const { return Unresolved; }
+
+      private:
+        struct thread_state
+        {
+            ULONG ProcessId = etl_no_process;
+            ULONG LastImage = etl_no_image;
+        };
+
+        struct folded_key
+        {
+            ULONG ProcessId;
+            ULONG StackId;
+            // Of the sampled address, the same stack may run in another image after a
+            // reload
+            ULONG Image;
+            // The sampled address when StackId is etl_no_stack, else 0
+            uint64_t Address;
+
+            bool operator==(const folded_key &other) const
+            {
+                return ProcessId == other.ProcessId && StackId == other.StackId &&
+                       Image == other.Image && Address == other.Address;
+            }
+        };
+
+        struct folded_hash
+        {
+            size_t operator()(const folded_key &key) const
+            {
+                uint64_t hash =
+                    ((uint64_t)key.ProcessId << 32 | key.StackId) ^
+                    ((uint64_t)key.Image + key.Address) * 0x9E3779B97F4A7C15ull;
+                return (size_t)(hash ^ (hash >> 29));
+            }
+        };
+
+        struct folded_stack
+        {
+            // First sample, the time the stack is resolved at
+            int64_t TimeStamp = 0;
+            uint64_t Samples = 0;
+        };
+
+        const etl_image_map &Images;
+        etl_stack_store &Stacks;
+        const etl_stack_attachments *Attachments;
+        etl_thread_processes Threads;
+        // Process and last image hit of the threads that took samples
+        std::unordered_map<ULONG, thread_state> Cache;
+        // Image << 32 | RVA
+        std::unordered_map<uint64_t, uint64_t> Rvas;
+        std::unordered_map<folded_key, folded_stack, folded_hash> Folded;
+        uint64_t Unresolved = 0;
+    };
+
+} // namespace phnt
@@ -0,0 +1,631 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Event trace log (.etl) reader==
+//
+// An .etl file is a sequence of buffers, each one a WMI_BUFFER_HEADER followed by
+// records up to WMI_BUFFER_HEADER::Offset, every record aligned to 8 bytes. The reader
+// finds the buffers by their BufferSize and hands out the records in place, without
+// copying them:
+//
+//   etl_file(path)                        maps the file read only
+//   etl_reader(data, size)                finds the buffers of a trace in memory
+//   etl_reader::for_each_event(f)         calls f(etl_event) on each record in file order
+//   etl_reader::for_each_buffer(f)        calls f(etl_buffer) for each buffer
+//   etl_reader::for_each_buffer_parallel  same, buffers spread over worker threads
+//   etl_buffer::for_each_event(f)         calls f(etl_event) for each record of a buffer
+//   etl_buffer::next_event(offset, e)     same, one record per call
+//
+// The buffers are independent of each other, so for_each_buffer_parallel() decodes
+// them on every core; each buffer holds the events of one processor in time order.
+// Compressed buffers (ETW_BUFFER_FLAG_COMPRESSED) are listed but have no records.
+//
+// The analyzers built on the reader share a few helpers for kernel events:
+//
+//   etl_is_kernel_event(e)                system, compact or perfinfo record
+//   etl_load_pointer(p, pointer_size)     a 4 or 8 byte pointer field
+//   etl_elapsed(start, end)               end - start, 0 if the clock went back
+//   etl_thread_processes                  thread to process map from thread events
+//
+// Traces are little endian, as is every Windows ABI, and the reader expects a little
+// endian host. Records are read with memcpy, so the mapping needs no alignment.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-reader.h requires C++"
+#endif
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "phnt_ntdef.h"
+#include "ntwmi.h"
+
+#if (PHNT_MODE == PHNT_MODE_LAYOUT) && (defined(__unix__) || defined(__APPLE__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PHNT_ETL_MMAP
+#elif (PHNT_MODE == PHNT_MODE_LAYOUT)
+#include <stdio.h>
+#endif
+
+namespace phnt
+{
+
+    // sizeof(EVENT_HEADER) in evntcons.h, the header of manifest and TraceLogging events
+    constexpr ULONG etl_event_header_size = 0x50;
+
+    // Records are aligned to 8 bytes in the buffers
+    constexpr ULONG etl_record_alignment = 8;
+
+    // ThreadId and ProcessId of records whose header has none
+    constexpr ULONG etl_no_id = 0xFFFFFFFF;
+
+    // Process of threads the trace has not shown yet
+    constexpr ULONG etl_no_process = 0xFFFFFFFF;
+
+    // Unused space at the end of a buffer
+    constexpr ULONG etl_filler_marker = 0xFFFFFFFF;
+
+    template <class T> inline T etl_load(const UCHAR *p)
+    {
+        T value;
+        memcpy(&value, p, sizeof(T));
+        return value;
+    }
+
+    struct etl_header_info
+    {
+        // Bytes before the payload
+        USHORT HeaderSize;
+        // Pointer size of the logging process, 0 if the header does not tell
+        UCHAR PointerSize;
+        // The record size is WMI_TRACE_PACKET::Size instead of the first USHORT
+        UCHAR SizeInPacket : 1;
+        // ThreadId at 0x08, ProcessId at 0x0C
+        UCHAR HasIds : 1;
+        // Offset of the timestamp, 0 if there is none
+        UCHAR TimeStampOffset;
+    };
+
+    constexpr etl_header_info etl_get_header_info(UCHAR HeaderType)
+    {
+        switch (HeaderType)
+        {
+        case TRACE_HEADER_TYPE_SYSTEM32:
+            return {sizeof(SYSTEM_TRACE_HEADER), 4, 1, 1, 0x10};
+        case TRACE_HEADER_TYPE_SYSTEM64:
+            return {sizeof(SYSTEM_TRACE_HEADER), 8, 1, 1, 0x10};
+        case TRACE_HEADER_TYPE_COMPACT32:
+            return {COMPACT_HEADER_SIZE, 4, 1, 1, 0x10};
+        case TRACE_HEADER_TYPE_COMPACT64:
+            return {COMPACT_HEADER_SIZE, 8, 1, 1, 0x10};
+        case TRACE_HEADER_TYPE_PERFINFO32:
+            return {FIELD_OFFSET(PERFINFO_TRACE_HEADER, Data), 4, 1, 0, 0x08};
+        case TRACE_HEADER_TYPE_PERFINFO64:
+            return {FIELD_OFFSET(PERFINFO_TRACE_HEADER, Data), 8, 1, 0, 0x08};
+        case TRACE_HEADER_TYPE_FULL_HEADER32:
+            return {sizeof(EVENT_TRACE_HEADER), 4, 0, 1, 0x10};
+        case TRACE_HEADER_TYPE_FULL_HEADER64:
+            return {sizeof(EVENT_TRACE_HEADER), 8, 0, 1, 0x10};
+        case TRACE_HEADER_TYPE_INSTANCE32:
+            return {sizeof(EVENT_INSTANCE_GUID_HEADER), 4, 0, 1, 0x10};
+        case TRACE_HEADER_TYPE_INSTANCE64:
+            return {sizeof(EVENT_INSTANCE_GUID_HEADER), 8, 0, 1, 0x10};
+        case TRACE_HEADER_TYPE_EVENT_HEADER32:
+            return {etl_event_header_size, 4, 0, 1, 0x10};
+        case TRACE_HEADER_TYPE_EVENT_HEADER64:
+            return {etl_event_header_size, 8, 0, 1, 0x10};
+        case TRACE_HEADER_TYPE_MESSAGE:
+            return {sizeof(MESSAGE_TRACE_HEADER), 0, 0, 0, 0};
+        case TRACE_HEADER_TYPE_WNODE_HEADER:
+            return {sizeof(WNODE_HEADER), 0, 0, 0, 0};
+        default:
+            return {sizeof(ULONG), 0, 0, 0, 0};
+        }
+    }
+
+    struct etl_event
+    {
+        // The whole record, header included
+        const UCHAR *Data;
+        ULONG Size;
+        // TRACE_HEADER_TYPE_*
+        UCHAR HeaderType;
+        // 4 or 8, 0 if the header does not tell
+        UCHAR PointerSize;
+        // Processor that logged the buffer
+        USHORT ProcessorIndex;
+        // Group << 8 | Type (WMI_TRACE_PACKET) of system, compact and perfinfo records, 0
+        // otherwise
+        USHORT HookId;
+        // Version of system, compact and perfinfo records, 0 otherwise
+        USHORT Version;
+        ULONG ThreadId;
+        ULONG ProcessId;
+        // In the clock of the trace (EVENT_TRACE_CLOCK_*), 0 if the header has none
+        LONGLONG TimeStamp;
+        const UCHAR *Payload;
+        ULONG PayloadSize;
+    };
+
+    // System, compact and perfinfo records: HookId names them and their pointer sized
+    // fields are PointerSize bytes
+    inline bool etl_is_kernel_event(const etl_event &event)
+    {
+        return etl_get_header_info(event.HeaderType).SizeInPacket &&
+               event.PointerSize != 0;
+    }
+
+    inline uint64_t etl_load_pointer(const UCHAR *p, ULONG PointerSize)
+    {
+        return PointerSize == 8 ? etl_load<uint64_t>(p) : etl_load<ULONG>(p);
+    }
+
+    // Time from Start to End, 0 for events that come before their start
+    inline uint64_t etl_elapsed(int64_t Start, int64_t End)
+    {
+        return End > Start ? (uint64_t)(End - Start) : 0;
+    }
+
+    // Process of each thread, from the thread create and rundown events. Exited threads
+    // are kept unless asked otherwise, so that their late completions still find their
+    // process, until a thread that reuses the id replaces them.
+    class etl_thread_processes
+    {
+      public:
+        explicit etl_thread_processes(bool KeepExited = true) : KeepExited(KeepExited) {}
+
+        // ThreadId of a thread create, delete or rundown event, etl_no_id for the others
+        ULONG consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event) ||
+                event.PayloadSize < sizeof(WMI_THREAD_INFORMATION))
+            {
+                return etl_no_id;
+            }
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_THREAD_CREATE:
+            case WMI_LOG_TYPE_THREAD_DC_START:
+            case WMI_LOG_TYPE_THREAD_DC_END:
+            case WMI_LOG_TYPE_THREAD_DELETE:
+                break;
+            default:
+                return etl_no_id;
+            }
+            // Every version opens with WMI_THREAD_INFORMATION
+            WMI_THREAD_INFORMATION thread =
+                etl_load<WMI_THREAD_INFORMATION>(event.Payload);
+            if (event.HookId != WMI_LOG_TYPE_THREAD_DELETE)
+            {
+                Processes[thread.ThreadId] = thread.ProcessId;
+            }
+            else if (!KeepExited)
+            {
+                Processes.erase(thread.ThreadId);
+            }
+            return thread.ThreadId;
+        }
+
+        // etl_no_process if the thread was not seen
+        ULONG process(ULONG ThreadId) const
+        {
+            auto found = Processes.find(ThreadId);
+            return found != Processes.end() ? found->second : etl_no_process;
+        }
+
+        // f(ThreadId, ProcessId), in no particular order
+        template <class F> void for_each_thread(F &&f) const
+        {
+            for (const auto &thread : Processes)
+            {
+                f(thread.first, thread.second);
+            }
+        }
+
+        size_t size() const { return Processes.size(); }
+
+      private:
+        bool KeepExited;
+        std::unordered_map<ULONG, ULONG> Processes;
+    };
+
+    enum class etl_next_result
+    {
+        Event,
+        // Filler or the end of the buffer
+        End,
+        // A record runs past the end of the buffer
+        Malformed
+    };
+
+    class etl_buffer
+    {
+      public:
+        etl_buffer(const UCHAR *Data, ULONG Index) : Data(Data), Index(Index)
+        {
+            memcpy(&Header, Data, sizeof(Header));
+        }
+
+        const UCHAR *data() const { return Data; }
+
+        // Position in the file
+        ULONG index() const { return Index; }
+
+        const WMI_BUFFER_HEADER &header() const { return Header; }
+
+        USHORT processor_index() const
+        {
+            if (Header.BufferFlag & ETW_BUFFER_FLAG_PROC_INDEX)
+            {
+                return Header.ClientContext.ProcessorIndex & ETW_PROCESSOR_INDEX_MASK;
+            }
+            return Header.ClientContext.ProcessorNumber;
+        }
+
+        bool compressed() const
+        {
+            return (Header.BufferFlag & ETW_BUFFER_FLAG_COMPRESSED) != 0;
+        }
+
+        // End of the records, BufferSize bounds it
+        ULONG used_size() const
+        {
+            return Header.Offset < Header.BufferSize ? Header.Offset : Header.BufferSize;
+        }
+
+        // Stops at the filler; false if a record runs past the end of the buffer.
+        template <class F> bool for_each_event(F &&f) const
+        {
+            ULONG offset = first_offset;
+            etl_event event;
+            etl_next_result result;
+            while ((result = next_event(offset, event)) == etl_next_result::Event)
+            {
+                f(static_cast<const etl_event &>(event));
+            }
+            return result == etl_next_result::End;
+        }
+
+        // Cursor of next_event() at the first record
+        static constexpr ULONG first_offset = sizeof(WMI_BUFFER_HEADER);
+
+        // Decodes the record at offset and moves offset to the next one, for callers that
+        // walk several buffers at once. Start from first_offset.
+        etl_next_result next_event(ULONG &offset, etl_event &event) const
+        {
+            ULONG end = used_size();
+            if (compressed() || offset + sizeof(ULONG) > end)
+            {
+                return etl_next_result::End;
+            }
+            decode_result result = decode_event(offset, end, processor_index(), event);
+            if (result != decode_result::Event)
+            {
+                return result == decode_result::Filler ? etl_next_result::End
+                                                       : etl_next_result::Malformed;
+            }
+            offset +=
+                (event.Size + etl_record_alignment - 1) & ~(etl_record_alignment - 1);
+            return etl_next_result::Event;
+        }
+
+      private:
+        enum class decode_result
+        {
+            Event,
+            Filler,
+            Malformed
+        };
+
+        decode_result
+        decode_event(ULONG offset, ULONG end, USHORT processor, etl_event &event) const
+        {
+            const UCHAR *p = Data + offset;
+            ULONG marker = etl_load<ULONG>(p);
+            if (marker == etl_filler_marker)
+            {
+                return decode_result::Filler;
+            }
+
+            event = {};
+            if (marker & TRACE_HEADER_FLAG)
+            {
+                event.HeaderType = (UCHAR)((marker & TRACE_HEADER_ENUM_MASK) >> 16);
+            }
+            else if (marker & TRACE_MESSAGE)
+            {
+                event.HeaderType = TRACE_HEADER_TYPE_MESSAGE;
+            }
+            else
+            {
+                event.HeaderType = TRACE_HEADER_TYPE_WNODE_HEADER;
+            }
+
+            etl_header_info info = etl_get_header_info(event.HeaderType);
+            if (info.HeaderSize > end - offset)
+            {
+                return decode_result::Malformed;
+            }
+            if (event.HeaderType == TRACE_HEADER_TYPE_WNODE_HEADER)
+            {
+                event.Size = marker;
+            }
+            else if (info.SizeInPacket)
+            {
+                WMI_TRACE_PACKET packet = etl_load<WMI_TRACE_PACKET>(p + sizeof(ULONG));
+                event.Size = packet.Size;
+                event.HookId = packet.HookId;
+                event.Version = (USHORT)marker;
+            }
+            else
+            {
+                event.Size = (USHORT)marker;
+            }
+            if (event.Size < info.HeaderSize || event.Size > end - offset)
+            {
+                return decode_result::Malformed;
+            }
+
+            event.Data = p;
+            event.PointerSize = info.PointerSize;
+            event.ProcessorIndex = processor;
+            event.ThreadId = info.HasIds ? etl_load<ULONG>(p + 0x08) : etl_no_id;
+            event.ProcessId = info.HasIds ? etl_load<ULONG>(p + 0x0C) : etl_no_id;
+            event.TimeStamp =
+                info.TimeStampOffset ? etl_load<LONGLONG>(p + info.TimeStampOffset) : 0;
+            event.Payload = p + info.HeaderSize;
+            event.PayloadSize = event.Size - info.HeaderSize;
+            return decode_result::Event;
+        }
+
+        const UCHAR *Data;
+        ULONG Index;
+        WMI_BUFFER_HEADER Header;
+    };
+
+    class etl_reader
+    {
+      public:
+        etl_reader(const void *Data, size_t Size)
+            : Data(static_cast<const UCHAR *>(Data)), Size(Size)
+        {
+            size_t offset = 0;
+            while (Size - offset >= sizeof(WMI_BUFFER_HEADER))
+            {
+                ULONG buffer_size = etl_load<ULONG>(this->Data + offset);
+                if (buffer_size < sizeof(WMI_BUFFER_HEADER) ||
+                    buffer_size > Size - offset)
+                {
+                    break;
+                }
+                Buffers.push_back(offset);
+                offset += buffer_size;
+            }
+            Truncated = offset != Size;
+        }
+
+        // Bytes of the trace, the partial buffer at the end included
+        size_t trace_size() const { return Size; }
+
+        size_t buffer_count() const { return Buffers.size(); }
+
+        etl_buffer buffer(size_t index) const
+        {
+            return etl_buffer(Data + Buffers[index], (ULONG)index);
+        }
+
+        // Position of a buffer in the file
+        size_t buffer_offset(size_t index) const { return Buffers[index]; }
+
+        // Trailing bytes that are not a whole buffer
+        bool truncated() const { return Truncated; }
+
+        template <class F> void for_each_buffer(F &&f) const
+        {
+            for (size_t i = 0; i < Buffers.size(); ++i)
+            {
+                f(static_cast<const etl_buffer &>(buffer(i)));
+            }
+        }
+
+        // False if a buffer has a malformed record, the following buffers are still read.
+        template <class F> bool for_each_event(F &&f) const
+        {
+            bool valid = true;
+            for (size_t i = 0; i < Buffers.size(); ++i)
+            {
+                valid &= buffer(i).for_each_event(f);
+            }
+            return valid;
+        }
+
+        // Number of threads for_each_buffer_parallel(f, threads) runs f on, 0 for one per
+        // core
+        unsigned worker_count(unsigned threads = 0) const
+        {
+            if (threads == 0)
+            {
+                threads = std::thread::hardware_concurrency();
+            }
+            if (threads > Buffers.size())
+            {
+                threads = (unsigned)Buffers.size();
+            }
+            return threads ? threads : 1;
+        }
+
+        // Calls f(etl_buffer, worker) with worker < worker_count(threads), on the calling
+        // thread and worker_count(threads) - 1 more. f is called concurrently and the
+        // buffers come in no particular order; keep state per worker and merge it after.
+        template <class F>
+        void for_each_buffer_parallel(F &&f, unsigned threads = 0) const
+        {
+            unsigned workers = worker_count(threads);
+            std::atomic<size_t> next(0);
+            auto work = [&](unsigned worker) {
+                size_t i;
+                while ((i = next.fetch_add(1, std::memory_order_relaxed)) <
+                       Buffers.size())
+                {
+                    f(static_cast<const etl_buffer &>(buffer(i)), worker);
+                }
+            };
+
+            std::vector<std::thread> pool;
+            pool.reserve(workers - 1);
+            for (unsigned worker = 1; worker < workers; ++worker)
+            {
+                pool.emplace_back(work, worker);
+            }
+            work(0);
+            for (std::thread &thread : pool)
+            {
+                thread.join();
+            }
+        }
+
+      private:
+        const UCHAR *Data;
+        size_t Size;
+        std::vector<size_t> Buffers;
+        bool Truncated;
+    };
+
+    // A whole file mapped read only: MapViewOfFile on Windows, mmap on POSIX systems,
+    // read into memory elsewhere.
+    class etl_file
+    {
+      public:
+#if (PHNT_MODE != PHNT_MODE_LAYOUT)
+        explicit etl_file(PCWSTR Path)
+        {
+            HANDLE file = CreateFileW(
+                Path,
+                GENERIC_READ,
+                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_FLAG_SEQUENTIAL_SCAN,
+                nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                return;
+            }
+            LARGE_INTEGER size;
+            if (GetFileSizeEx(file, &size) && size.QuadPart > 0 &&
+                (ULONGLONG)size.QuadPart <= (SIZE_T)-1)
+            {
+                HANDLE mapping =
+                    CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping)
+                {
+                    Data = static_cast<const UCHAR *>(
+                        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                    Size = Data ? (size_t)size.QuadPart : 0;
+                    CloseHandle(mapping);
+                }
+            }
+            CloseHandle(file);
+        }
+
+        ~etl_file()
+        {
+            if (Data)
+            {
+                UnmapViewOfFile(Data);
+            }
+        }
+#elif defined(PHNT_ETL_MMAP)
+        explicit etl_file(const char *Path)
+        {
+            int fd = open(Path, O_RDONLY);
+            if (fd < 0)
+            {
+                return;
+            }
+            struct stat st;
+            if (fstat(fd, &st) == 0 && st.st_size > 0 &&
+                (ULONGLONG)st.st_size <= (size_t)-1)
+            {
+                void *view =
+                    mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (view != MAP_FAILED)
+                {
+                    Data = static_cast<const UCHAR *>(view);
+                    Size = (size_t)st.st_size;
+                }
+            }
+            close(fd);
+        }
+
+        ~etl_file()
+        {
+            if (Data)
+            {
+                munmap(const_cast<UCHAR *>(Data), Size);
+            }
+        }
+#else
+        explicit etl_file(const char *Path)
+        {
+            FILE *file = fopen(Path, "rb");
+            if (!file)
+            {
+                return;
+            }
+            UCHAR chunk[0x10000];
+            size_t read;
+            while ((read = fread(chunk, 1, sizeof(chunk), file)) != 0)
+            {
+                Contents.insert(Contents.end(), chunk, chunk + read);
+            }
+            fclose(file);
+            Data = Contents.empty() ? nullptr : Contents.data();
+            Size = Contents.size();
+        }
+#endif
+
+        etl_file(const etl_file &) = delete;
+        etl_file &operator=(const etl_file &) = delete;
+
+        bool is_open() const { return Data != nullptr; }
+
+        const UCHAR *data() const { return Data; }
+
+        size_t size() const { return Size; }
+
+      private:
+        const UCHAR *Data = nullptr;
+        size_t Size = 0;
+#if (PHNT_MODE == PHNT_MODE_LAYOUT) && !defined(PHNT_ETL_MMAP)
+        std::vector<UCHAR> Contents;
+#endif
+    };
+
+    C_ASSERT(etl_get_header_info(TRACE_HEADER_TYPE_SYSTEM64).HeaderSize == 0x20);
+    C_ASSERT(etl_get_header_info(TRACE_HEADER_TYPE_COMPACT64).HeaderSize == 0x18);
+    C_ASSERT(etl_get_header_info(TRACE_HEADER_TYPE_PERFINFO64).HeaderSize == 0x10);
+    C_ASSERT(etl_get_header_info(TRACE_HEADER_TYPE_FULL_HEADER64).HeaderSize == 0x30);
+    C_ASSERT(etl_get_header_info(TRACE_HEADER_TYPE_INSTANCE64).HeaderSize == 0x48);
+    C_ASSERT(etl_get_header_info(TRACE_HEADER_TYPE_WNODE_HEADER).HeaderSize == 0x30);
+    C_ASSERT(FIELD_OFFSET(SYSTEM_TRACE_HEADER, ThreadId) == 0x08);
+    C_ASSERT(FIELD_OFFSET(SYSTEM_TRACE_HEADER, SystemTime) == 0x10);
+    C_ASSERT(FIELD_OFFSET(PERFINFO_TRACE_HEADER, SystemTime) == 0x08);
+    C_ASSERT(FIELD_OFFSET(EVENT_TRACE_HEADER, ThreadId) == 0x08);
+    C_ASSERT(FIELD_OFFSET(EVENT_TRACE_HEADER, TimeStamp) == 0x10);
+    C_ASSERT(FIELD_OFFSET(EVENT_INSTANCE_GUID_HEADER, ProcessId) == 0x0C);
+    C_ASSERT(FIELD_OFFSET(EVENT_INSTANCE_GUID_HEADER, TimeStamp) == 0x10);
+
+} // namespace phnt
@@ -0,0 +1,710 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Registry operations by key path==
+//
+// The events of EVENT_TRACE_GROUP_REGISTRY name a key by the address of its key
+// control block (KCB), the name of a KCB comes in separate events:
+//
+//   _REGKCBCREATE, WMI_LOG_TYPE_REG_RUNDOWNBEGIN, _RUNDOWNEND
+//                              WMI_REGISTRY, Kcb and its full path in Name
+//   _REGKCBDELETE              the KCB is freed, its address may be reused
+//   _REGCREATE, _REGOPEN       WMI_REGISTRY, Name is relative to Kcb or a full path
+//   _REGQUERYVALUE, _REGSETVALUE, ...
+//                              WMI_REGISTRY on the key of Kcb, Name is the value
+//   _REGCOMMIT, _REGPREPARE, _REGROLLBACK
+//                              WMI_TXR, a transaction on the Hive path
+//   PERFINFO_LOG_TYPE_REG_NOTIF_REGISTER
+//                              ETW_REGNOTIF_REGISTER, a change notification on Kcb
+//   PERFINFO_LOG_TYPE_REG_NOTIF_DELIVER
+//                              opens with the Notification of its register event
+//
+// Operations are logged when they complete: InitialTime is their start and a Status
+// of NT_ERROR severity a failure. The KCBs alive at the end of the trace are only
+// named by the rundown that ends it, so the operations of a KCB with no name yet are
+// kept by address until its name comes, or until it is deleted without one.
+//
+// Paths are stored once in etl_registry_tree, a radix tree over the '\' separated
+// components compared without ASCII case. Each key holds the count, failures and time
+// of every operation on it, and a rollup adds them up below any prefix:
+//
+//   etl_registry_analyzer::consume(event)   registry events, in time order
+//   etl_registry_analyzer::finish()         after the last event
+//   etl_registry_analyzer::rollup(prefix)   etl_registry_stats of prefix and below
+//   etl_registry_analyzer::for_each_key(f)  f(path, etl_registry_stats) of each key
+//   etl_registry_analyzer::latencies(op)    etl_histogram of an operation
+//
+// Operations of KCBs that are never named are summed on the root, the empty path.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-registry.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-strings.h"
+
+namespace phnt
+{
+
+    enum class etl_registry_op : UCHAR
+    {
+        Create,
+        Open,
+        Delete,
+        Query,
+        SetValue,
+        DeleteValue,
+        QueryValue,
+        EnumerateKey,
+        EnumerateValueKey,
+        QueryMultipleValue,
+        SetInformation,
+        Flush,
+        Virtualize,
+        Close,
+        SetSecurity,
+        QuerySecurity,
+        // Transactions, on the root key of their hive
+        Commit,
+        Prepare,
+        Rollback,
+        // Change notifications registered on and delivered for a key, without a time
+        NotifyRegister,
+        NotifyDeliver,
+        Maximum
+    };
+
+    struct etl_registry_stats
+    {
+        uint64_t Count[(size_t)etl_registry_op::Maximum];
+        uint64_t Failures[(size_t)etl_registry_op::Maximum];
+        // Sum and largest of the times from InitialTime to the event, in the clock of the
+        // trace
+        uint64_t Duration[(size_t)etl_registry_op::Maximum];
+        uint64_t MaxDuration[(size_t)etl_registry_op::Maximum];
+    };
+
+    // An edge holds one or more path components and the children of a node differ in
+    // their first one. A split adds the node in the middle of an edge and leaves the
+    // nodes below it in place, so a node id names the same path for the life of the tree.
+    class etl_registry_tree
+    {
+      public:
+        static constexpr ULONG root = 0;
+
+        etl_registry_tree()
+        {
+            Nodes.push_back({std::string(), etl_no_id, etl_no_id, etl_no_id});
+        }
+
+        // Node of Path below From, added if needed; a Path starting with '\' is below the
+        // root
+        ULONG insert(ULONG From, std::string_view Path)
+        {
+            ULONG node = !Path.empty() && Path[0] == '\\' ? root : From;
+            std::string_view rest = trim(Path);
+            while (!rest.empty())
+            {
+                ULONG child = find_child(node, rest);
+                if (child == etl_no_id)
+                {
+                    return add(node, rest);
+                }
+                size_t common = common_prefix(Nodes[child].Label, rest);
+                if (common < Nodes[child].Label.size())
+                {
+                    child = split(child, common);
+                }
+                node = child;
+                rest = trim(rest.substr(common));
+            }
+            return node;
+        }
+
+        // Node of the subtree holding Prefix and the paths below it, etl_no_id if none.
+        // It is deeper than Prefix when Prefix ends within an edge.
+        ULONG find(std::string_view Prefix) const
+        {
+            ULONG node = root;
+            std::string_view rest = trim(Prefix);
+            while (!rest.empty())
+            {
+                ULONG child = find_child(node, rest);
+                if (child == etl_no_id)
+                {
+                    return etl_no_id;
+                }
+                size_t common = common_prefix(Nodes[child].Label, rest);
+                if (common < Nodes[child].Label.size() && common < rest.size())
+                {
+                    return etl_no_id;
+                }
+                node = child;
+                rest = trim(rest.substr(common));
+            }
+            return node;
+        }
+
+        // "\REGISTRY\MACHINE\..." in the case the path was first seen in, "" for the root
+        std::string path(ULONG Node) const
+        {
+            std::vector<ULONG> chain;
+            for (ULONG node = Node; node != root; node = Nodes[node].Parent)
+            {
+                chain.push_back(node);
+            }
+            std::string text;
+            for (auto node = chain.rbegin(); node != chain.rend(); ++node)
+            {
+                text += '\\';
+                text += Nodes[*node].Label;
+            }
+            return text;
+        }
+
+        ULONG parent(ULONG Node) const { return Nodes[Node].Parent; }
+
+        // f(ULONG node) for each child of Node
+        template <class F> void for_each_child(ULONG Node, F &&f) const
+        {
+            for (ULONG child = Nodes[Node].FirstChild; child != etl_no_id;
+                 child = Nodes[child].NextSibling)
+            {
+                f(child);
+            }
+        }
+
+        // f(ULONG node) for Node and every node below it, parents first
+        template <class F> void for_each_below(ULONG Node, F &&f) const
+        {
+            std::vector<ULONG> stack(1, Node);
+            while (!stack.empty())
+            {
+                ULONG node = stack.back();
+                stack.pop_back();
+                f(node);
+                for_each_child(node, [&](ULONG child) { stack.push_back(child); });
+            }
+        }
+
+        size_t size() const { return Nodes.size(); }
+
+      private:
+        struct node
+        {
+            // Components below the parent, without the leading '\'
+            std::string Label;
+            ULONG Parent;
+            ULONG FirstChild;
+            ULONG NextSibling;
+        };
+
+        static char fold(char c)
+        {
+            return c >= 'A' && c <= 'Z' ? (char)(c - 'A' + 'a') : c;
+        }
+
+        static std::string_view trim(std::string_view Path)
+        {
+            while (!Path.empty() && Path.front() == '\\')
+            {
+                Path.remove_prefix(1);
+            }
+            while (!Path.empty() && Path.back() == '\\')
+            {
+                Path.remove_suffix(1);
+            }
+            return Path;
+        }
+
+        static std::string_view first_component(std::string_view Path)
+        {
+            return Path.substr(0, Path.find('\\'));
+        }
+
+        static bool same(std::string_view a, std::string_view b)
+        {
+            return a.size() == b.size() &&
+                   std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+                       return fold(x) == fold(y);
+                   });
+        }
+
+        // Length of the whole components Label and Path start with
+        static size_t common_prefix(std::string_view Label, std::string_view Path)
+        {
+            size_t boundary = 0, i = 0;
+            while (i < Label.size() && i < Path.size() && fold(Label[i]) == fold(Path[i]))
+            {
+                if (Label[i] == '\\')
+                {
+                    boundary = i;
+                }
+                ++i;
+            }
+            bool label_end = i == Label.size() || Label[i] == '\\';
+            bool path_end = i == Path.size() || Path[i] == '\\';
+            return label_end && path_end ? i : boundary;
+        }
+
+        // FNV-1a of the parent and the folded component
+        static uint64_t key(ULONG Parent, std::string_view Component)
+        {
+            uint64_t hash = 0xCBF29CE484222325ull ^ Parent;
+            for (char c : Component)
+            {
+                hash ^= (UCHAR)fold(c);
+                hash *= 0x100000001B3ull;
+            }
+            return hash;
+        }
+
+        bool is_child(ULONG Child, ULONG Parent, std::string_view Component) const
+        {
+            return Nodes[Child].Parent == Parent &&
+                   same(first_component(Nodes[Child].Label), Component);
+        }
+
+        ULONG find_child(ULONG Node, std::string_view Path) const
+        {
+            std::string_view component = first_component(Path);
+            auto found = Index.find(key(Node, component));
+            if (found != Index.end() && is_child(found->second, Node, component))
+            {
+                return found->second;
+            }
+            // The index keeps the first node of a hash, the others are found by a scan
+            for (ULONG child = Nodes[Node].FirstChild; child != etl_no_id;
+                 child = Nodes[child].NextSibling)
+            {
+                if (is_child(child, Node, component))
+                {
+                    return child;
+                }
+            }
+            return etl_no_id;
+        }
+
+        ULONG add(ULONG Parent, std::string_view Label)
+        {
+            ULONG id = (ULONG)Nodes.size();
+            ULONG next = Nodes[Parent].FirstChild;
+            Nodes.push_back({std::string(Label), Parent, etl_no_id, next});
+            Nodes[Parent].FirstChild = id;
+            Index.emplace(key(Parent, first_component(Label)), id);
+            return id;
+        }
+
+        // Cuts the edge of Child after Length characters, returns the node in the middle
+        ULONG split(ULONG Child, size_t Length)
+        {
+            ULONG parent = Nodes[Child].Parent;
+            ULONG middle = (ULONG)Nodes.size();
+            Nodes.push_back(
+                {Nodes[Child].Label.substr(0, Length),
+                 parent,
+                 Child,
+                 Nodes[Child].NextSibling});
+            ULONG *link = &Nodes[parent].FirstChild;
+            while (*link != Child)
+            {
+                link = &Nodes[*link].NextSibling;
+            }
+            *link = middle;
+            auto found = Index.find(key(parent, first_component(Nodes[middle].Label)));
+            if (found != Index.end() && found->second == Child)
+            {
+                found->second = middle;
+            }
+            node &child = Nodes[Child];
+            child.Label.erase(0, Length + 1);
+            child.Parent = middle;
+            child.NextSibling = etl_no_id;
+            Index.emplace(key(middle, first_component(child.Label)), Child);
+            return middle;
+        }
+
+        std::vector<node> Nodes;
+        // Child by parent and first component
+        std::unordered_map<uint64_t, ULONG> Index;
+    };
+
+    class etl_registry_analyzer
+    {
+      public:
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG p = event.PointerSize;
+            const UCHAR *data = event.Payload;
+            const ULONG size = event.PayloadSize;
+            etl_registry_op op;
+            switch (event.HookId)
+            {
+            case EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGKCBCREATE:
+            case WMI_LOG_TYPE_REG_RUNDOWNBEGIN:
+            case WMI_LOG_TYPE_REG_RUNDOWNEND:
+                // InitialTime, Status, Index, Kcb, then Name
+                if (size >= 16 + p)
+                {
+                    std::string path = etl_utf8(data + 16 + p, size - 16 - p);
+                    name(etl_load_pointer(data + 16, p), Tree.insert(Tree.root, path));
+                }
+                break;
+            case EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGKCBDELETE:
+                if (size >= 16 + p)
+                {
+                    uint64_t kcb = etl_load_pointer(data + 16, p);
+                    std::string path = etl_utf8(data + 16 + p, size - 16 - p);
+                    if (!path.empty())
+                    {
+                        name(kcb, Tree.insert(Tree.root, path));
+                    }
+                    forget(kcb);
+                }
+                break;
+            case EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGCOMMIT:
+            case EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGPREPARE:
+            case EVENT_TRACE_GROUP_REGISTRY | EVENT_TRACE_TYPE_REGROLLBACK:
+                // InitialTime, TxRGUID, Status, UowCount, then Hive
+                if (size >= 32)
+                {
+                    op = etl_registry_op::Rollback;
+                    if ((event.HookId & 0xFF) == EVENT_TRACE_TYPE_REGCOMMIT)
+                    {
+                        op = etl_registry_op::Commit;
+                    }
+                    else if ((event.HookId & 0xFF) == EVENT_TRACE_TYPE_REGPREPARE)
+                    {
+                        op = etl_registry_op::Prepare;
+                    }
+                    std::string hive = etl_utf8(data + 32, size - 32);
+                    uint64_t time =
+                        etl_elapsed(etl_load<LONGLONG>(data), event.TimeStamp);
+                    record(
+                        key_stats(Tree.insert(Tree.root, hive)),
+                        op,
+                        etl_load<ULONG>(data + 24),
+                        time);
+                    Latencies[(size_t)op].add(time);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_REG_NOTIF_REGISTER:
+                // Notification, Kcb, Type, WatchTree, Primary
+                if (size >= 2 * p)
+                {
+                    uint64_t kcb = etl_load_pointer(data + p, p);
+                    Notifications[etl_load_pointer(data, p)] = kcb;
+                    operation(
+                        kcb, std::string_view(), etl_registry_op::NotifyRegister, 0, 0);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_REG_NOTIF_DELIVER:
+                if (size >= p)
+                {
+                    auto found = Notifications.find(etl_load_pointer(data, p));
+                    if (found != Notifications.end())
+                    {
+                        operation(
+                            found->second,
+                            std::string_view(),
+                            etl_registry_op::NotifyDeliver,
+                            0,
+                            0);
+                    }
+                }
+                break;
+            default:
+                if (registry_op(event.HookId, op) && size >= 16 + p)
+                {
+                    uint64_t time =
+                        etl_elapsed(etl_load<LONGLONG>(data), event.TimeStamp);
+                    std::string path;
+                    if (!value_op(op))
+                    {
+                        path = etl_utf8(data + 16 + p, size - 16 - p);
+                        // Only opens and creates name a key below their KCB
+                        bool absolute = !path.empty() && path[0] == '\\';
+                        if (!absolute && op != etl_registry_op::Create &&
+                            op != etl_registry_op::Open)
+                        {
+                            path.clear();
+                        }
+                    }
+                    operation(
+                        etl_load_pointer(data + 16, p),
+                        path,
+                        op,
+                        etl_load<ULONG>(data + 8),
+                        time);
+                    Latencies[(size_t)op].add(time);
+                }
+                break;
+            }
+        }
+
+        // Sums the operations of the KCBs never named on the root
+        void finish()
+        {
+            for (const auto &kcb : Parked)
+            {
+                unnamed(kcb.second);
+            }
+            Parked.clear();
+        }
+
+        // Of Prefix and the keys below it, Prefix is whole components compared without
+        // ASCII case; "" for the whole trace
+        etl_registry_stats rollup(std::string_view Prefix) const
+        {
+            etl_registry_stats total = {};
+            ULONG node = Tree.find(Prefix);
+            if (node != etl_no_id)
+            {
+                Tree.for_each_below(node, [&](ULONG below) {
+                    if (below < NodeStats.size() && NodeStats[below] != etl_no_id)
+                    {
+                        add(total, Stats[NodeStats[below]]);
+                    }
+                });
+            }
+            return total;
+        }
+
+        // f(const std::string &path, const etl_registry_stats &) of each key with
+        // operations, in order of the first one
+        template <class F> void for_each_key(F &&f) const
+        {
+            for (size_t i = 0; i < Stats.size(); ++i)
+            {
+                f(Tree.path(StatsNodes[i]), Stats[i]);
+            }
+        }
+
+        // Of every operation, named or not
+        const etl_histogram &latencies(etl_registry_op Op) const
+        {
+            return Latencies[(size_t)Op];
+        }
+
+        // Path of a KCB alive at the end of the events, empty if unknown
+        std::string name(uint64_t Kcb) const
+        {
+            auto found = Kcbs.find(Kcb);
+            return found != Kcbs.end() ? Tree.path(found->second) : std::string();
+        }
+
+        const etl_registry_tree &tree() const { return Tree; }
+
+      private:
+        // Operations of a KCB without a name, on the key itself and by relative path
+        struct parked
+        {
+            etl_registry_stats Key = {};
+            std::map<std::string, etl_registry_stats> Children;
+        };
+
+        static bool registry_op(USHORT HookId, etl_registry_op &Op)
+        {
+            if ((HookId & 0xFF00) != EVENT_TRACE_GROUP_REGISTRY)
+            {
+                return false;
+            }
+            switch (HookId & 0xFF)
+            {
+            case EVENT_TRACE_TYPE_REGCREATE:
+                Op = etl_registry_op::Create;
+                return true;
+            case EVENT_TRACE_TYPE_REGOPEN:
+                Op = etl_registry_op::Open;
+                return true;
+            case EVENT_TRACE_TYPE_REGDELETE:
+                Op = etl_registry_op::Delete;
+                return true;
+            case EVENT_TRACE_TYPE_REGQUERY:
+                Op = etl_registry_op::Query;
+                return true;
+            case EVENT_TRACE_TYPE_REGSETVALUE:
+                Op = etl_registry_op::SetValue;
+                return true;
+            case EVENT_TRACE_TYPE_REGDELETEVALUE:
+                Op = etl_registry_op::DeleteValue;
+                return true;
+            case EVENT_TRACE_TYPE_REGQUERYVALUE:
+                Op = etl_registry_op::QueryValue;
+                return true;
+            case EVENT_TRACE_TYPE_REGENUMERATEKEY:
+                Op = etl_registry_op::EnumerateKey;
+                return true;
+            case EVENT_TRACE_TYPE_REGENUMERATEVALUEKEY:
+                Op = etl_registry_op::EnumerateValueKey;
+                return true;
+            case EVENT_TRACE_TYPE_REGQUERYMULTIPLEVALUE:
+                Op = etl_registry_op::QueryMultipleValue;
+                return true;
+            case EVENT_TRACE_TYPE_REGSETINFORMATION:
+                Op = etl_registry_op::SetInformation;
+                return true;
+            case EVENT_TRACE_TYPE_REGFLUSH:
+                Op = etl_registry_op::Flush;
+                return true;
+            case EVENT_TRACE_TYPE_REGVIRTUALIZE:
+                Op = etl_registry_op::Virtualize;
+                return true;
+            case EVENT_TRACE_TYPE_REGCLOSE:
+                Op = etl_registry_op::Close;
+                return true;
+            case EVENT_TRACE_TYPE_REGSETSECURITY:
+                Op = etl_registry_op::SetSecurity;
+                return true;
+            case EVENT_TRACE_TYPE_REGQUERYSECURITY:
+                Op = etl_registry_op::QuerySecurity;
+                return true;
+            }
+            return false;
+        }
+
+        // Name is the value of these, not a key
+        static bool value_op(etl_registry_op Op)
+        {
+            return Op == etl_registry_op::SetValue ||
+                   Op == etl_registry_op::DeleteValue ||
+                   Op == etl_registry_op::QueryValue ||
+                   Op == etl_registry_op::EnumerateValueKey ||
+                   Op == etl_registry_op::QueryMultipleValue;
+        }
+
+        static void add(etl_registry_stats &Total, const etl_registry_stats &Stats)
+        {
+            for (size_t i = 0; i < (size_t)etl_registry_op::Maximum; ++i)
+            {
+                Total.Count[i] += Stats.Count[i];
+                Total.Failures[i] += Stats.Failures[i];
+                Total.Duration[i] += Stats.Duration[i];
+                Total.MaxDuration[i] =
+                    std::max(Total.MaxDuration[i], Stats.MaxDuration[i]);
+            }
+        }
+
+        static void
+        record(etl_registry_stats &Stats, etl_registry_op Op, ULONG Status, uint64_t Time)
+        {
+            size_t i = (size_t)Op;
+            ++Stats.Count[i];
+            // NT_ERROR
+            if ((Status >> 30) == 3)
+            {
+                ++Stats.Failures[i];
+            }
+            Stats.Duration[i] += Time;
+            Stats.MaxDuration[i] = std::max(Stats.MaxDuration[i], Time);
+        }
+
+        etl_registry_stats &key_stats(ULONG Node)
+        {
+            if (Node >= NodeStats.size())
+            {
+                NodeStats.resize(Tree.size(), etl_no_id);
+            }
+            if (NodeStats[Node] == etl_no_id)
+            {
+                NodeStats[Node] = (ULONG)Stats.size();
+                Stats.push_back({});
+                StatsNodes.push_back(Node);
+            }
+            return Stats[NodeStats[Node]];
+        }
+
+        // Path is a full path, relative to the key of Kcb, or empty for the key itself
+        void operation(
+            uint64_t Kcb,
+            std::string_view Path,
+            etl_registry_op Op,
+            ULONG Status,
+            uint64_t Time)
+        {
+            if (!Path.empty() && Path[0] == '\\')
+            {
+                record(key_stats(Tree.insert(Tree.root, Path)), Op, Status, Time);
+                return;
+            }
+            auto found = Kcbs.find(Kcb);
+            if (found != Kcbs.end())
+            {
+                ULONG node =
+                    Path.empty() ? found->second : Tree.insert(found->second, Path);
+                record(key_stats(node), Op, Status, Time);
+                return;
+            }
+            parked &kcb = Parked[Kcb];
+            etl_registry_stats &stats =
+                Path.empty() ? kcb.Key : kcb.Children[std::string(Path)];
+            record(stats, Op, Status, Time);
+        }
+
+        void name(uint64_t Kcb, ULONG Node)
+        {
+            Kcbs[Kcb] = Node;
+            auto found = Parked.find(Kcb);
+            if (found == Parked.end())
+            {
+                return;
+            }
+            add(key_stats(Node), found->second.Key);
+            for (const auto &child : found->second.Children)
+            {
+                add(key_stats(Tree.insert(Node, child.first)), child.second);
+            }
+            Parked.erase(found);
+        }
+
+        void forget(uint64_t Kcb)
+        {
+            Kcbs.erase(Kcb);
+            auto found = Parked.find(Kcb);
+            if (found == Parked.end())
+            {
+                return;
+            }
+            unnamed(found->second);
+            Parked.erase(found);
+        }
+
+        void unnamed(const parked &Kcb)
+        {
+            add(key_stats(Tree.root), Kcb.Key);
+            for (const auto &child : Kcb.Children)
+            {
+                add(key_stats(Tree.root), child.second);
+            }
+        }
+
+        etl_registry_tree Tree;
+        // Node of each named KCB
+        std::unordered_map<uint64_t, ULONG> Kcbs;
+        std::unordered_map<uint64_t, parked> Parked;
+        // KCB of each registered Notification
+        std::unordered_map<uint64_t, uint64_t> Notifications;
+        // By node id, etl_no_id for nodes without operations
+        std::vector<ULONG> NodeStats;
+        std::vector<etl_registry_stats> Stats;
+        std::vector<ULONG> StatsNodes;
+        etl_histogram Latencies[(size_t)etl_registry_op::Maximum];
+    };
+
+} // namespace phnt
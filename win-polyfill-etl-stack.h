@@ -0,0 +1,393 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Stack interning==
+//
+// Stack walk events (PERFINFO_LOG_TYPE_STACKWALK, STACK_WALK_EVENT_DATA) follow the
+// event they belong to and carry its TimeStamp and ThreadId, then the return
+// addresses. Sampled traces repeat the same few thousand stacks millions of times, so
+// etl_stack_store keeps each distinct frame array once and hands out a 32 bit id, and
+// etl_stack_attachments maps (TimeStamp, ThreadId) of the owning event to that id.
+//
+//   etl_stack_store::intern(frames, count)   id of a frame array, adds it if new
+//   etl_stack_store::intern(event)           same, from a stack walk event
+//   etl_stack_store::frames(id)              the frames of an id
+//   etl_stack_attachments::add, sort, find   owning event to stack id
+//
+// intern() is lock free and may be called from any number of threads, for example
+// from the workers of etl_reader::for_each_buffer_parallel with one
+// etl_stack_attachments each, merged and sorted afterwards. The store has a fixed
+// capacity of MaxStacks ids and grows its frame storage by chunks that are never
+// moved, so ids and frames() stay valid while other threads insert. When two threads
+// add the same new stack at once, one id wins and the other is left unused.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-stack.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    constexpr ULONG etl_no_stack = 0xFFFFFFFF;
+    // Frames kept of a stack walk event, deeper stacks are cut
+    constexpr ULONG etl_stack_max_frames = 256;
+
+    struct etl_stack
+    {
+        const uint64_t *Frames;
+        ULONG Count;
+    };
+
+    class etl_stack_store
+    {
+      public:
+        explicit etl_stack_store(ULONG MaxStacks = 1 << 20) : MaxStacks(MaxStacks)
+        {
+            // At most half full, probing always ends at a free slot
+            size_t slots = 1;
+            while (slots < 2 * (size_t)MaxStacks)
+            {
+                slots *= 2;
+            }
+            SlotMask = slots - 1;
+            Slots.reset(new std::atomic<ULONG>[slots]);
+            for (size_t i = 0; i < slots; ++i)
+            {
+                Slots[i].store(0, std::memory_order_relaxed);
+            }
+            EntryChunks.reset(
+                new std::atomic<entry *>[(MaxStacks >> entry_chunk_bits) + 1]);
+            for (size_t i = 0; i <= (MaxStacks >> entry_chunk_bits); ++i)
+            {
+                EntryChunks[i].store(nullptr, std::memory_order_relaxed);
+            }
+            for (std::atomic<uint64_t *> &chunk : FrameChunks)
+            {
+                chunk.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        ~etl_stack_store()
+        {
+            for (size_t i = 0; i <= (MaxStacks >> entry_chunk_bits); ++i)
+            {
+                delete[] EntryChunks[i].load(std::memory_order_relaxed);
+            }
+            for (std::atomic<uint64_t *> &chunk : FrameChunks)
+            {
+                delete[] chunk.load(std::memory_order_relaxed);
+            }
+        }
+
+        etl_stack_store(const etl_stack_store &) = delete;
+        etl_stack_store &operator=(const etl_stack_store &) = delete;
+
+        // etl_no_stack when the store is full
+        ULONG intern(const uint64_t *Frames, ULONG Count)
+        {
+            if (Count > etl_stack_max_frames)
+            {
+                Count = etl_stack_max_frames;
+            }
+            uint64_t hash = hash_frames(Frames, Count);
+            size_t i = (size_t)hash & SlotMask;
+            ULONG id = etl_no_stack;
+            for (;;)
+            {
+                ULONG slot = Slots[i].load(std::memory_order_acquire);
+                if (slot == 0)
+                {
+                    // Publish the frames before the slot, readers only follow slots
+                    if (id == etl_no_stack)
+                    {
+                        id = add(hash, Frames, Count);
+                        if (id == etl_no_stack)
+                        {
+                            return etl_no_stack;
+                        }
+                    }
+                    if (Slots[i].compare_exchange_strong(
+                            slot,
+                            id + 1,
+                            std::memory_order_acq_rel,
+                            std::memory_order_acquire))
+                    {
+                        return id;
+                    }
+                    // Lost the slot, slot is the id that took it
+                }
+                if (same(slot - 1, hash, Frames, Count))
+                {
+                    return slot - 1;
+                }
+                i = (i + 1) & SlotMask;
+            }
+        }
+
+        // Id of the stack of a PERFINFO_LOG_TYPE_STACKWALK event, etl_no_stack for other
+        // events. TimeStamp and ThreadId are those of the owning event.
+        ULONG intern(
+            const etl_event &event,
+            LONGLONG *TimeStamp = nullptr,
+            ULONG *ThreadId = nullptr)
+        {
+            const ULONG header = FIELD_OFFSET(STACK_WALK_EVENT_DATA, Addresses);
+            if (event.HookId != PERFINFO_LOG_TYPE_STACKWALK ||
+                (event.PointerSize != 4 && event.PointerSize != 8) ||
+                event.PayloadSize < header)
+            {
+                return etl_no_stack;
+            }
+            ULONG count = (event.PayloadSize - header) / event.PointerSize;
+            count = count < etl_stack_max_frames ? count : etl_stack_max_frames;
+            uint64_t frames[etl_stack_max_frames];
+            const UCHAR *addresses = event.Payload + header;
+            for (ULONG i = 0; i < count; ++i)
+            {
+                if (event.PointerSize == 8)
+                {
+                    memcpy(&frames[i], addresses + i * 8, 8);
+                }
+                else
+                {
+                    ULONG frame;
+                    memcpy(&frame, addresses + i * 4, 4);
+                    frames[i] = frame;
+                }
+            }
+            if (TimeStamp)
+            {
+                const UCHAR *field =
+                    event.Payload + FIELD_OFFSET(STACK_WALK_EVENT_DATA, TimeStamp);
+                memcpy(TimeStamp, field, sizeof(*TimeStamp));
+            }
+            if (ThreadId)
+            {
+                const UCHAR *field =
+                    event.Payload + FIELD_OFFSET(STACK_WALK_EVENT_DATA, ThreadId);
+                memcpy(ThreadId, field, sizeof(*ThreadId));
+            }
+            return intern(frames, count);
+        }
+
+        etl_stack frames(ULONG StackId) const
+        {
+            const entry &stack = get_entry(StackId);
+            return {frame_at(stack.Offset), stack.Count};
+        }
+
+        // Ids handed out so far, unused ids included
+        ULONG size() const { return NextId.load(std::memory_order_acquire); }
+
+        // Frames stored, for the memory footprint
+        uint64_t frame_count() const { return NextFrame.load(std::memory_order_acquire); }
+
+      private:
+        struct entry
+        {
+            uint64_t Hash;
+            uint64_t Offset;
+            ULONG Count;
+        };
+
+        static constexpr unsigned entry_chunk_bits = 14;
+        static constexpr unsigned frame_chunk_bits = 20;
+        static constexpr size_t frame_chunk_count = 4096;
+
+        static uint64_t hash_frames(const uint64_t *Frames, ULONG Count)
+        {
+            uint64_t hash = Count * 0x9E3779B97F4A7C15ull;
+            for (ULONG i = 0; i < Count; ++i)
+            {
+                hash = (hash ^ Frames[i]) * 0xFF51AFD7ED558CCDull;
+                hash ^= hash >> 32;
+            }
+            return hash;
+        }
+
+        template <class T> static T *chunk(std::atomic<T *> &slot, size_t size)
+        {
+            T *current = slot.load(std::memory_order_acquire);
+            if (current)
+            {
+                return current;
+            }
+            T *created = new T[size];
+            if (slot.compare_exchange_strong(
+                    current,
+                    created,
+                    std::memory_order_acq_rel,
+                    std::memory_order_acquire))
+            {
+                return created;
+            }
+            delete[] created;
+            return current;
+        }
+
+        const entry &get_entry(ULONG Id) const
+        {
+            const entry *entries =
+                EntryChunks[Id >> entry_chunk_bits].load(std::memory_order_acquire);
+            return entries[Id & ((1u << entry_chunk_bits) - 1)];
+        }
+
+        const uint64_t *frame_at(uint64_t Offset) const
+        {
+            const uint64_t *frames =
+                FrameChunks[Offset >> frame_chunk_bits].load(std::memory_order_acquire);
+            return frames + (Offset & ((1u << frame_chunk_bits) - 1));
+        }
+
+        bool same(ULONG Id, uint64_t Hash, const uint64_t *Frames, ULONG Count) const
+        {
+            const entry &stack = get_entry(Id);
+            return stack.Hash == Hash && stack.Count == Count &&
+                   memcmp(frame_at(stack.Offset), Frames, Count * sizeof(uint64_t)) == 0;
+        }
+
+        // A new id with its frames copied, not yet in the table
+        ULONG add(uint64_t Hash, const uint64_t *Frames, ULONG Count)
+        {
+            // A stack never straddles two frame chunks
+            uint64_t offset = NextFrame.load(std::memory_order_relaxed);
+            uint64_t start;
+            do
+            {
+                start = offset;
+                uint64_t chunk_end = ((start >> frame_chunk_bits) + 1)
+                                     << frame_chunk_bits;
+                if (start + Count > chunk_end)
+                {
+                    start = chunk_end;
+                }
+                if (((start + Count) >> frame_chunk_bits) >= frame_chunk_count)
+                {
+                    return etl_no_stack;
+                }
+            } while (!NextFrame.compare_exchange_weak(
+                offset, start + Count, std::memory_order_relaxed));
+
+            // Stops at MaxStacks, a counter left running would wrap back to used ids
+            ULONG id = NextId.load(std::memory_order_relaxed);
+            do
+            {
+                if (id >= MaxStacks)
+                {
+                    return etl_no_stack;
+                }
+            } while (
+                !NextId.compare_exchange_weak(id, id + 1, std::memory_order_relaxed));
+            uint64_t *frames = chunk(
+                FrameChunks[start >> frame_chunk_bits], (size_t)1 << frame_chunk_bits);
+            frames += start & ((1u << frame_chunk_bits) - 1);
+            memcpy(frames, Frames, Count * sizeof(uint64_t));
+            entry *entries =
+                chunk(EntryChunks[id >> entry_chunk_bits], (size_t)1 << entry_chunk_bits);
+            entries[id & ((1u << entry_chunk_bits) - 1)] = {Hash, start, Count};
+            return id;
+        }
+
+        ULONG MaxStacks;
+        size_t SlotMask;
+        // Id + 1, 0 for a free slot
+        std::unique_ptr<std::atomic<ULONG>[]> Slots;
+        std::unique_ptr<std::atomic<entry *>[]> EntryChunks;
+        std::atomic<uint64_t *> FrameChunks[frame_chunk_count];
+        std::atomic<ULONG> NextId{0};
+        std::atomic<uint64_t> NextFrame{0};
+    };
+
+    struct etl_stack_attachment
+    {
+        int64_t TimeStamp;
+        ULONG ThreadId;
+        ULONG StackId;
+
+        bool operator<(const etl_stack_attachment &other) const
+        {
+            return TimeStamp != other.TimeStamp ? TimeStamp < other.TimeStamp
+                                                : ThreadId < other.ThreadId;
+        }
+    };
+
+    class etl_stack_attachments
+    {
+      public:
+        void add(LONGLONG TimeStamp, ULONG ThreadId, ULONG StackId)
+        {
+            Attachments.push_back({TimeStamp, ThreadId, StackId});
+            Sorted = false;
+        }
+
+        // Interns the stack of a stack walk event and attaches it, false for other events
+        bool consume(etl_stack_store &store, const etl_event &event)
+        {
+            LONGLONG time_stamp;
+            ULONG thread_id;
+            ULONG id = store.intern(event, &time_stamp, &thread_id);
+            if (id == etl_no_stack)
+            {
+                return false;
+            }
+            add(time_stamp, thread_id, id);
+            return true;
+        }
+
+        // Takes the attachments of another worker
+        void merge(const etl_stack_attachments &other)
+        {
+            Attachments.insert(
+                Attachments.end(), other.Attachments.begin(), other.Attachments.end());
+            Sorted = false;
+        }
+
+        void sort()
+        {
+            std::stable_sort(Attachments.begin(), Attachments.end());
+            Sorted = true;
+        }
+
+        // Stack of the event at TimeStamp on ThreadId, etl_no_stack if none; after sort()
+        ULONG find(LONGLONG TimeStamp, ULONG ThreadId) const
+        {
+            if (!Sorted)
+            {
+                return etl_no_stack;
+            }
+            etl_stack_attachment key = {TimeStamp, ThreadId, 0};
+            auto it = std::lower_bound(Attachments.begin(), Attachments.end(), key);
+            if (it == Attachments.end() || it->TimeStamp != TimeStamp ||
+                it->ThreadId != ThreadId)
+            {
+                return etl_no_stack;
+            }
+            return it->StackId;
+        }
+
+        ULONG find(const etl_event &event) const
+        {
+            return find(event.TimeStamp, event.ThreadId);
+        }
+
+        size_t size() const { return Attachments.size(); }
+
+      private:
+        std::vector<etl_stack_attachment> Attachments;
+        bool Sorted = true;
+    };
+
+} // namespace phnt
@@ -0,0 +1,109 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Strings of a trace==
+//
+// Kernel events carry names as NUL terminated UTF-16LE at the end of the payload,
+// with no guarantee of alignment or of the terminator fitting in the record.
+//
+//   etl_utf8(data, size)           UTF-16LE to UTF-8, up to the NUL or the end
+//   etl_string_table::intern(s)    a dense id per distinct string, stored once
+//   etl_string_table::str(id)      the string of an id
+//
+// The table keeps its strings in a deque, so str() views stay valid as it grows.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-strings.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    inline std::string etl_utf8(const UCHAR *Data, ULONG Size)
+    {
+        std::string text;
+        for (ULONG i = 0; i + 2 <= Size; i += 2)
+        {
+            uint32_t c = etl_load<USHORT>(Data + i);
+            if (c == 0)
+            {
+                break;
+            }
+            if (c >= 0xD800 && c < 0xDC00 && i + 4 <= Size)
+            {
+                uint32_t low = etl_load<USHORT>(Data + i + 2);
+                if (low >= 0xDC00 && low < 0xE000)
+                {
+                    c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                    i += 2;
+                }
+            }
+            if (c < 0x80)
+            {
+                text += (char)c;
+            }
+            else if (c < 0x800)
+            {
+                text += (char)(0xC0 | (c >> 6));
+                text += (char)(0x80 | (c & 0x3F));
+            }
+            else if (c < 0x10000)
+            {
+                text += (char)(0xE0 | (c >> 12));
+                text += (char)(0x80 | ((c >> 6) & 0x3F));
+                text += (char)(0x80 | (c & 0x3F));
+            }
+            else
+            {
+                text += (char)(0xF0 | (c >> 18));
+                text += (char)(0x80 | ((c >> 12) & 0x3F));
+                text += (char)(0x80 | ((c >> 6) & 0x3F));
+                text += (char)(0x80 | (c & 0x3F));
+            }
+        }
+        return text;
+    }
+
+    class etl_string_table
+    {
+      public:
+        etl_string_table() = default;
+        // The index points into Strings
+        etl_string_table(const etl_string_table &) = delete;
+        etl_string_table &operator=(const etl_string_table &) = delete;
+
+        ULONG intern(std::string_view String)
+        {
+            auto found = Index.find(String);
+            if (found != Index.end())
+            {
+                return found->second;
+            }
+            ULONG id = (ULONG)Strings.size();
+            Strings.emplace_back(String);
+            Index.emplace(std::string_view(Strings.back()), id);
+            return id;
+        }
+
+        std::string_view str(ULONG Id) const { return Strings[Id]; }
+
+        size_t size() const { return Strings.size(); }
+
+      private:
+        std::deque<std::string> Strings;
+        std::unordered_map<std::string_view, ULONG> Index;
+    };
+
+} // namespace phnt
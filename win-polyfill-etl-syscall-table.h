@@ -0,0 +1,477 @@
+/* Auto generated by cmake/generate_etl_syscall_table.cmake, do not edit */
+
+// No include guard, included by win-polyfill-etl-syscall.h.
+
+PHNT_ETL_SYSCALL(NtAcceptConnectPort)
+PHNT_ETL_SYSCALL(NtAccessCheck)
+PHNT_ETL_SYSCALL(NtAccessCheckAndAuditAlarm)
+PHNT_ETL_SYSCALL(NtAccessCheckByType)
+PHNT_ETL_SYSCALL(NtAccessCheckByTypeAndAuditAlarm)
+PHNT_ETL_SYSCALL(NtAccessCheckByTypeResultList)
+PHNT_ETL_SYSCALL(NtAccessCheckByTypeResultListAndAuditAlarm)
+PHNT_ETL_SYSCALL(NtAccessCheckByTypeResultListAndAuditAlarmByHandle)
+PHNT_ETL_SYSCALL(NtAcquireCMFViewOwnership)
+PHNT_ETL_SYSCALL(NtAddAtom)
+PHNT_ETL_SYSCALL(NtAddAtomEx)
+PHNT_ETL_SYSCALL(NtAddBootEntry)
+PHNT_ETL_SYSCALL(NtAddDriverEntry)
+PHNT_ETL_SYSCALL(NtAdjustGroupsToken)
+PHNT_ETL_SYSCALL(NtAdjustPrivilegesToken)
+PHNT_ETL_SYSCALL(NtAdjustTokenClaimsAndDeviceGroups)
+PHNT_ETL_SYSCALL(NtAlertResumeThread)
+PHNT_ETL_SYSCALL(NtAlertThread)
+PHNT_ETL_SYSCALL(NtAlertThreadByThreadId)
+PHNT_ETL_SYSCALL(NtAllocateLocallyUniqueId)
+PHNT_ETL_SYSCALL(NtAllocateReserveObject)
+PHNT_ETL_SYSCALL(NtAllocateUserPhysicalPages)
+PHNT_ETL_SYSCALL(NtAllocateUserPhysicalPagesEx)
+PHNT_ETL_SYSCALL(NtAllocateUuids)
+PHNT_ETL_SYSCALL(NtAllocateVirtualMemory)
+PHNT_ETL_SYSCALL(NtAllocateVirtualMemoryEx)
+PHNT_ETL_SYSCALL(NtAlpcAcceptConnectPort)
+PHNT_ETL_SYSCALL(NtAlpcCancelMessage)
+PHNT_ETL_SYSCALL(NtAlpcConnectPort)
+PHNT_ETL_SYSCALL(NtAlpcConnectPortEx)
+PHNT_ETL_SYSCALL(NtAlpcCreatePort)
+PHNT_ETL_SYSCALL(NtAlpcCreatePortSection)
+PHNT_ETL_SYSCALL(NtAlpcCreateResourceReserve)
+PHNT_ETL_SYSCALL(NtAlpcCreateSectionView)
+PHNT_ETL_SYSCALL(NtAlpcCreateSecurityContext)
+PHNT_ETL_SYSCALL(NtAlpcDeletePortSection)
+PHNT_ETL_SYSCALL(NtAlpcDeleteResourceReserve)
+PHNT_ETL_SYSCALL(NtAlpcDeleteSectionView)
+PHNT_ETL_SYSCALL(NtAlpcDeleteSecurityContext)
+PHNT_ETL_SYSCALL(NtAlpcDisconnectPort)
+PHNT_ETL_SYSCALL(NtAlpcImpersonateClientContainerOfPort)
+PHNT_ETL_SYSCALL(NtAlpcImpersonateClientOfPort)
+PHNT_ETL_SYSCALL(NtAlpcOpenSenderProcess)
+PHNT_ETL_SYSCALL(NtAlpcOpenSenderThread)
+PHNT_ETL_SYSCALL(NtAlpcQueryInformation)
+PHNT_ETL_SYSCALL(NtAlpcQueryInformationMessage)
+PHNT_ETL_SYSCALL(NtAlpcRevokeSecurityContext)
+PHNT_ETL_SYSCALL(NtAlpcSendWaitReceivePort)
+PHNT_ETL_SYSCALL(NtAlpcSetInformation)
+PHNT_ETL_SYSCALL(NtAreMappedFilesTheSame)
+PHNT_ETL_SYSCALL(NtAssignProcessToJobObject)
+PHNT_ETL_SYSCALL(NtAssociateWaitCompletionPacket)
+PHNT_ETL_SYSCALL(NtCallEnclave)
+PHNT_ETL_SYSCALL(NtCallbackReturn)
+PHNT_ETL_SYSCALL(NtCancelIoFile)
+PHNT_ETL_SYSCALL(NtCancelIoFileEx)
+PHNT_ETL_SYSCALL(NtCancelSynchronousIoFile)
+PHNT_ETL_SYSCALL(NtCancelTimer)
+PHNT_ETL_SYSCALL(NtCancelTimer2)
+PHNT_ETL_SYSCALL(NtCancelWaitCompletionPacket)
+PHNT_ETL_SYSCALL(NtChangeProcessState)
+PHNT_ETL_SYSCALL(NtChangeThreadState)
+PHNT_ETL_SYSCALL(NtClearEvent)
+PHNT_ETL_SYSCALL(NtClose)
+PHNT_ETL_SYSCALL(NtCloseObjectAuditAlarm)
+PHNT_ETL_SYSCALL(NtCommitComplete)
+PHNT_ETL_SYSCALL(NtCommitEnlistment)
+PHNT_ETL_SYSCALL(NtCommitTransaction)
+PHNT_ETL_SYSCALL(NtCompactKeys)
+PHNT_ETL_SYSCALL(NtCompareObjects)
+PHNT_ETL_SYSCALL(NtCompareSigningLevels)
+PHNT_ETL_SYSCALL(NtCompareTokens)
+PHNT_ETL_SYSCALL(NtCompleteConnectPort)
+PHNT_ETL_SYSCALL(NtCompressKey)
+PHNT_ETL_SYSCALL(NtConnectPort)
+PHNT_ETL_SYSCALL(NtContinue)
+PHNT_ETL_SYSCALL(NtContinueEx)
+PHNT_ETL_SYSCALL(NtConvertBetweenAuxiliaryCounterAndPerformanceCounter)
+PHNT_ETL_SYSCALL(NtCopyFileChunk)
+PHNT_ETL_SYSCALL(NtCreateDebugObject)
+PHNT_ETL_SYSCALL(NtCreateDirectoryObject)
+PHNT_ETL_SYSCALL(NtCreateDirectoryObjectEx)
+PHNT_ETL_SYSCALL(NtCreateEnclave)
+PHNT_ETL_SYSCALL(NtCreateEnlistment)
+PHNT_ETL_SYSCALL(NtCreateEvent)
+PHNT_ETL_SYSCALL(NtCreateEventPair)
+PHNT_ETL_SYSCALL(NtCreateFile)
+PHNT_ETL_SYSCALL(NtCreateIRTimer)
+PHNT_ETL_SYSCALL(NtCreateIoCompletion)
+PHNT_ETL_SYSCALL(NtCreateIoRing)
+PHNT_ETL_SYSCALL(NtCreateJobObject)
+PHNT_ETL_SYSCALL(NtCreateJobSet)
+PHNT_ETL_SYSCALL(NtCreateKey)
+PHNT_ETL_SYSCALL(NtCreateKeyTransacted)
+PHNT_ETL_SYSCALL(NtCreateKeyedEvent)
+PHNT_ETL_SYSCALL(NtCreateLowBoxToken)
+PHNT_ETL_SYSCALL(NtCreateMailslotFile)
+PHNT_ETL_SYSCALL(NtCreateMutant)
+PHNT_ETL_SYSCALL(NtCreateNamedPipeFile)
+PHNT_ETL_SYSCALL(NtCreatePagingFile)
+PHNT_ETL_SYSCALL(NtCreatePartition)
+PHNT_ETL_SYSCALL(NtCreatePort)
+PHNT_ETL_SYSCALL(NtCreatePrivateNamespace)
+PHNT_ETL_SYSCALL(NtCreateProcess)
+PHNT_ETL_SYSCALL(NtCreateProcessEx)
+PHNT_ETL_SYSCALL(NtCreateProcessStateChange)
+PHNT_ETL_SYSCALL(NtCreateProfile)
+PHNT_ETL_SYSCALL(NtCreateProfileEx)
+PHNT_ETL_SYSCALL(NtCreateResourceManager)
+PHNT_ETL_SYSCALL(NtCreateSection)
+PHNT_ETL_SYSCALL(NtCreateSectionEx)
+PHNT_ETL_SYSCALL(NtCreateSemaphore)
+PHNT_ETL_SYSCALL(NtCreateSymbolicLinkObject)
+PHNT_ETL_SYSCALL(NtCreateThread)
+PHNT_ETL_SYSCALL(NtCreateThreadEx)
+PHNT_ETL_SYSCALL(NtCreateThreadStateChange)
+PHNT_ETL_SYSCALL(NtCreateTimer)
+PHNT_ETL_SYSCALL(NtCreateTimer2)
+PHNT_ETL_SYSCALL(NtCreateToken)
+PHNT_ETL_SYSCALL(NtCreateTokenEx)
+PHNT_ETL_SYSCALL(NtCreateTransaction)
+PHNT_ETL_SYSCALL(NtCreateTransactionManager)
+PHNT_ETL_SYSCALL(NtCreateUserProcess)
+PHNT_ETL_SYSCALL(NtCreateWaitCompletionPacket)
+PHNT_ETL_SYSCALL(NtCreateWaitablePort)
+PHNT_ETL_SYSCALL(NtCreateWnfStateName)
+PHNT_ETL_SYSCALL(NtCreateWorkerFactory)
+PHNT_ETL_SYSCALL(NtDebugActiveProcess)
+PHNT_ETL_SYSCALL(NtDebugContinue)
+PHNT_ETL_SYSCALL(NtDelayExecution)
+PHNT_ETL_SYSCALL(NtDeleteAtom)
+PHNT_ETL_SYSCALL(NtDeleteBootEntry)
+PHNT_ETL_SYSCALL(NtDeleteDriverEntry)
+PHNT_ETL_SYSCALL(NtDeleteFile)
+PHNT_ETL_SYSCALL(NtDeleteKey)
+PHNT_ETL_SYSCALL(NtDeleteObjectAuditAlarm)
+PHNT_ETL_SYSCALL(NtDeletePrivateNamespace)
+PHNT_ETL_SYSCALL(NtDeleteValueKey)
+PHNT_ETL_SYSCALL(NtDeleteWnfStateData)
+PHNT_ETL_SYSCALL(NtDeleteWnfStateName)
+PHNT_ETL_SYSCALL(NtDeviceIoControlFile)
+PHNT_ETL_SYSCALL(NtDisableLastKnownGood)
+PHNT_ETL_SYSCALL(NtDisplayString)
+PHNT_ETL_SYSCALL(NtDrawText)
+PHNT_ETL_SYSCALL(NtDuplicateObject)
+PHNT_ETL_SYSCALL(NtDuplicateToken)
+PHNT_ETL_SYSCALL(NtEnableLastKnownGood)
+PHNT_ETL_SYSCALL(NtEnumerateBootEntries)
+PHNT_ETL_SYSCALL(NtEnumerateDriverEntries)
+PHNT_ETL_SYSCALL(NtEnumerateKey)
+PHNT_ETL_SYSCALL(NtEnumerateSystemEnvironmentValuesEx)
+PHNT_ETL_SYSCALL(NtEnumerateTransactionObject)
+PHNT_ETL_SYSCALL(NtEnumerateValueKey)
+PHNT_ETL_SYSCALL(NtExtendSection)
+PHNT_ETL_SYSCALL(NtFilterBootOption)
+PHNT_ETL_SYSCALL(NtFilterToken)
+PHNT_ETL_SYSCALL(NtFilterTokenEx)
+PHNT_ETL_SYSCALL(NtFindAtom)
+PHNT_ETL_SYSCALL(NtFlushBuffersFile)
+PHNT_ETL_SYSCALL(NtFlushBuffersFileEx)
+PHNT_ETL_SYSCALL(NtFlushInstallUILanguage)
+PHNT_ETL_SYSCALL(NtFlushInstructionCache)
+PHNT_ETL_SYSCALL(NtFlushKey)
+PHNT_ETL_SYSCALL(NtFlushProcessWriteBuffers)
+PHNT_ETL_SYSCALL(NtFlushVirtualMemory)
+PHNT_ETL_SYSCALL(NtFlushWriteBuffer)
+PHNT_ETL_SYSCALL(NtFreeUserPhysicalPages)
+PHNT_ETL_SYSCALL(NtFreeVirtualMemory)
+PHNT_ETL_SYSCALL(NtFreezeRegistry)
+PHNT_ETL_SYSCALL(NtFreezeTransactions)
+PHNT_ETL_SYSCALL(NtFsControlFile)
+PHNT_ETL_SYSCALL(NtGetCachedSigningLevel)
+PHNT_ETL_SYSCALL(NtGetCompleteWnfStateSubscription)
+PHNT_ETL_SYSCALL(NtGetContextThread)
+PHNT_ETL_SYSCALL(NtGetCurrentProcessorNumber)
+PHNT_ETL_SYSCALL(NtGetCurrentProcessorNumberEx)
+PHNT_ETL_SYSCALL(NtGetDevicePowerState)
+PHNT_ETL_SYSCALL(NtGetMUIRegistryInfo)
+PHNT_ETL_SYSCALL(NtGetNextProcess)
+PHNT_ETL_SYSCALL(NtGetNextThread)
+PHNT_ETL_SYSCALL(NtGetNlsSectionPtr)
+PHNT_ETL_SYSCALL(NtGetNotificationResourceManager)
+PHNT_ETL_SYSCALL(NtGetPlugPlayEvent)
+PHNT_ETL_SYSCALL(NtGetWriteWatch)
+PHNT_ETL_SYSCALL(NtImpersonateAnonymousToken)
+PHNT_ETL_SYSCALL(NtImpersonateClientOfPort)
+PHNT_ETL_SYSCALL(NtImpersonateThread)
+PHNT_ETL_SYSCALL(NtInitializeEnclave)
+PHNT_ETL_SYSCALL(NtInitializeNlsFiles)
+PHNT_ETL_SYSCALL(NtInitializeRegistry)
+PHNT_ETL_SYSCALL(NtInitiatePowerAction)
+PHNT_ETL_SYSCALL(NtIsProcessInJob)
+PHNT_ETL_SYSCALL(NtIsSystemResumeAutomatic)
+PHNT_ETL_SYSCALL(NtIsUILanguageComitted)
+PHNT_ETL_SYSCALL(NtListenPort)
+PHNT_ETL_SYSCALL(NtLoadDriver)
+PHNT_ETL_SYSCALL(NtLoadEnclaveData)
+PHNT_ETL_SYSCALL(NtLoadKey)
+PHNT_ETL_SYSCALL(NtLoadKey2)
+PHNT_ETL_SYSCALL(NtLoadKey3)
+PHNT_ETL_SYSCALL(NtLoadKeyEx)
+PHNT_ETL_SYSCALL(NtLockFile)
+PHNT_ETL_SYSCALL(NtLockProductActivationKeys)
+PHNT_ETL_SYSCALL(NtLockRegistryKey)
+PHNT_ETL_SYSCALL(NtLockVirtualMemory)
+PHNT_ETL_SYSCALL(NtMakePermanentObject)
+PHNT_ETL_SYSCALL(NtMakeTemporaryObject)
+PHNT_ETL_SYSCALL(NtManagePartition)
+PHNT_ETL_SYSCALL(NtMapCMFModule)
+PHNT_ETL_SYSCALL(NtMapUserPhysicalPages)
+PHNT_ETL_SYSCALL(NtMapUserPhysicalPagesScatter)
+PHNT_ETL_SYSCALL(NtMapViewOfSection)
+PHNT_ETL_SYSCALL(NtMapViewOfSectionEx)
+PHNT_ETL_SYSCALL(NtModifyBootEntry)
+PHNT_ETL_SYSCALL(NtModifyDriverEntry)
+PHNT_ETL_SYSCALL(NtNotifyChangeDirectoryFile)
+PHNT_ETL_SYSCALL(NtNotifyChangeDirectoryFileEx)
+PHNT_ETL_SYSCALL(NtNotifyChangeKey)
+PHNT_ETL_SYSCALL(NtNotifyChangeMultipleKeys)
+PHNT_ETL_SYSCALL(NtNotifyChangeSession)
+PHNT_ETL_SYSCALL(NtOpenDirectoryObject)
+PHNT_ETL_SYSCALL(NtOpenEnlistment)
+PHNT_ETL_SYSCALL(NtOpenEvent)
+PHNT_ETL_SYSCALL(NtOpenEventPair)
+PHNT_ETL_SYSCALL(NtOpenFile)
+PHNT_ETL_SYSCALL(NtOpenIoCompletion)
+PHNT_ETL_SYSCALL(NtOpenJobObject)
+PHNT_ETL_SYSCALL(NtOpenKey)
+PHNT_ETL_SYSCALL(NtOpenKeyEx)
+PHNT_ETL_SYSCALL(NtOpenKeyTransacted)
+PHNT_ETL_SYSCALL(NtOpenKeyTransactedEx)
+PHNT_ETL_SYSCALL(NtOpenKeyedEvent)
+PHNT_ETL_SYSCALL(NtOpenMutant)
+PHNT_ETL_SYSCALL(NtOpenObjectAuditAlarm)
+PHNT_ETL_SYSCALL(NtOpenPartition)
+PHNT_ETL_SYSCALL(NtOpenPrivateNamespace)
+PHNT_ETL_SYSCALL(NtOpenProcess)
+PHNT_ETL_SYSCALL(NtOpenProcessToken)
+PHNT_ETL_SYSCALL(NtOpenProcessTokenEx)
+PHNT_ETL_SYSCALL(NtOpenResourceManager)
+PHNT_ETL_SYSCALL(NtOpenSection)
+PHNT_ETL_SYSCALL(NtOpenSemaphore)
+PHNT_ETL_SYSCALL(NtOpenSession)
+PHNT_ETL_SYSCALL(NtOpenSymbolicLinkObject)
+PHNT_ETL_SYSCALL(NtOpenThread)
+PHNT_ETL_SYSCALL(NtOpenThreadToken)
+PHNT_ETL_SYSCALL(NtOpenThreadTokenEx)
+PHNT_ETL_SYSCALL(NtOpenTimer)
+PHNT_ETL_SYSCALL(NtOpenTransaction)
+PHNT_ETL_SYSCALL(NtOpenTransactionManager)
+PHNT_ETL_SYSCALL(NtPlugPlayControl)
+PHNT_ETL_SYSCALL(NtPowerInformation)
+PHNT_ETL_SYSCALL(NtPrePrepareComplete)
+PHNT_ETL_SYSCALL(NtPrePrepareEnlistment)
+PHNT_ETL_SYSCALL(NtPrepareComplete)
+PHNT_ETL_SYSCALL(NtPrepareEnlistment)
+PHNT_ETL_SYSCALL(NtPrivilegeCheck)
+PHNT_ETL_SYSCALL(NtPrivilegeObjectAuditAlarm)
+PHNT_ETL_SYSCALL(NtPrivilegedServiceAuditAlarm)
+PHNT_ETL_SYSCALL(NtPropagationComplete)
+PHNT_ETL_SYSCALL(NtPropagationFailed)
+PHNT_ETL_SYSCALL(NtProtectVirtualMemory)
+PHNT_ETL_SYSCALL(NtPssCaptureVaSpaceBulk)
+PHNT_ETL_SYSCALL(NtPulseEvent)
+PHNT_ETL_SYSCALL(NtQueryAttributesFile)
+PHNT_ETL_SYSCALL(NtQueryAuxiliaryCounterFrequency)
+PHNT_ETL_SYSCALL(NtQueryBootEntryOrder)
+PHNT_ETL_SYSCALL(NtQueryBootOptions)
+PHNT_ETL_SYSCALL(NtQueryDebugFilterState)
+PHNT_ETL_SYSCALL(NtQueryDefaultLocale)
+PHNT_ETL_SYSCALL(NtQueryDefaultUILanguage)
+PHNT_ETL_SYSCALL(NtQueryDirectoryFile)
+PHNT_ETL_SYSCALL(NtQueryDirectoryFileEx)
+PHNT_ETL_SYSCALL(NtQueryDirectoryObject)
+PHNT_ETL_SYSCALL(NtQueryDriverEntryOrder)
+PHNT_ETL_SYSCALL(NtQueryEaFile)
+PHNT_ETL_SYSCALL(NtQueryEvent)
+PHNT_ETL_SYSCALL(NtQueryFullAttributesFile)
+PHNT_ETL_SYSCALL(NtQueryInformationAtom)
+PHNT_ETL_SYSCALL(NtQueryInformationByName)
+PHNT_ETL_SYSCALL(NtQueryInformationEnlistment)
+PHNT_ETL_SYSCALL(NtQueryInformationFile)
+PHNT_ETL_SYSCALL(NtQueryInformationJobObject)
+PHNT_ETL_SYSCALL(NtQueryInformationPort)
+PHNT_ETL_SYSCALL(NtQueryInformationProcess)
+PHNT_ETL_SYSCALL(NtQueryInformationResourceManager)
+PHNT_ETL_SYSCALL(NtQueryInformationThread)
+PHNT_ETL_SYSCALL(NtQueryInformationToken)
+PHNT_ETL_SYSCALL(NtQueryInformationTransaction)
+PHNT_ETL_SYSCALL(NtQueryInformationTransactionManager)
+PHNT_ETL_SYSCALL(NtQueryInformationWorkerFactory)
+PHNT_ETL_SYSCALL(NtQueryInstallUILanguage)
+PHNT_ETL_SYSCALL(NtQueryIntervalProfile)
+PHNT_ETL_SYSCALL(NtQueryIoCompletion)
+PHNT_ETL_SYSCALL(NtQueryIoRingCapabilities)
+PHNT_ETL_SYSCALL(NtQueryKey)
+PHNT_ETL_SYSCALL(NtQueryLicenseValue)
+PHNT_ETL_SYSCALL(NtQueryMultipleValueKey)
+PHNT_ETL_SYSCALL(NtQueryMutant)
+PHNT_ETL_SYSCALL(NtQueryObject)
+PHNT_ETL_SYSCALL(NtQueryOpenSubKeys)
+PHNT_ETL_SYSCALL(NtQueryOpenSubKeysEx)
+PHNT_ETL_SYSCALL(NtQueryPerformanceCounter)
+PHNT_ETL_SYSCALL(NtQueryPortInformationProcess)
+PHNT_ETL_SYSCALL(NtQueryQuotaInformationFile)
+PHNT_ETL_SYSCALL(NtQuerySection)
+PHNT_ETL_SYSCALL(NtQuerySecurityAttributesToken)
+PHNT_ETL_SYSCALL(NtQuerySecurityObject)
+PHNT_ETL_SYSCALL(NtQuerySemaphore)
+PHNT_ETL_SYSCALL(NtQuerySymbolicLinkObject)
+PHNT_ETL_SYSCALL(NtQuerySystemEnvironmentValue)
+PHNT_ETL_SYSCALL(NtQuerySystemEnvironmentValueEx)
+PHNT_ETL_SYSCALL(NtQuerySystemInformation)
+PHNT_ETL_SYSCALL(NtQuerySystemInformationEx)
+PHNT_ETL_SYSCALL(NtQuerySystemTime)
+PHNT_ETL_SYSCALL(NtQueryTimer)
+PHNT_ETL_SYSCALL(NtQueryTimerResolution)
+PHNT_ETL_SYSCALL(NtQueryValueKey)
+PHNT_ETL_SYSCALL(NtQueryVirtualMemory)
+PHNT_ETL_SYSCALL(NtQueryVolumeInformationFile)
+PHNT_ETL_SYSCALL(NtQueryWnfStateData)
+PHNT_ETL_SYSCALL(NtQueryWnfStateNameInformation)
+PHNT_ETL_SYSCALL(NtQueueApcThread)
+PHNT_ETL_SYSCALL(NtQueueApcThreadEx)
+PHNT_ETL_SYSCALL(NtQueueApcThreadEx2)
+PHNT_ETL_SYSCALL(NtRaiseException)
+PHNT_ETL_SYSCALL(NtRaiseHardError)
+PHNT_ETL_SYSCALL(NtReadFile)
+PHNT_ETL_SYSCALL(NtReadFileScatter)
+PHNT_ETL_SYSCALL(NtReadOnlyEnlistment)
+PHNT_ETL_SYSCALL(NtReadRequestData)
+PHNT_ETL_SYSCALL(NtReadVirtualMemory)
+PHNT_ETL_SYSCALL(NtReadVirtualMemoryEx)
+PHNT_ETL_SYSCALL(NtRecoverEnlistment)
+PHNT_ETL_SYSCALL(NtRecoverResourceManager)
+PHNT_ETL_SYSCALL(NtRecoverTransactionManager)
+PHNT_ETL_SYSCALL(NtRegisterProtocolAddressInformation)
+PHNT_ETL_SYSCALL(NtRegisterThreadTerminatePort)
+PHNT_ETL_SYSCALL(NtReleaseCMFViewOwnership)
+PHNT_ETL_SYSCALL(NtReleaseKeyedEvent)
+PHNT_ETL_SYSCALL(NtReleaseMutant)
+PHNT_ETL_SYSCALL(NtReleaseSemaphore)
+PHNT_ETL_SYSCALL(NtReleaseWorkerFactoryWorker)
+PHNT_ETL_SYSCALL(NtRemoveIoCompletion)
+PHNT_ETL_SYSCALL(NtRemoveIoCompletionEx)
+PHNT_ETL_SYSCALL(NtRemoveProcessDebug)
+PHNT_ETL_SYSCALL(NtRenameKey)
+PHNT_ETL_SYSCALL(NtRenameTransactionManager)
+PHNT_ETL_SYSCALL(NtReplaceKey)
+PHNT_ETL_SYSCALL(NtReplacePartitionUnit)
+PHNT_ETL_SYSCALL(NtReplyPort)
+PHNT_ETL_SYSCALL(NtReplyWaitReceivePort)
+PHNT_ETL_SYSCALL(NtReplyWaitReceivePortEx)
+PHNT_ETL_SYSCALL(NtReplyWaitReplyPort)
+PHNT_ETL_SYSCALL(NtRequestPort)
+PHNT_ETL_SYSCALL(NtRequestWaitReplyPort)
+PHNT_ETL_SYSCALL(NtRequestWakeupLatency)
+PHNT_ETL_SYSCALL(NtResetEvent)
+PHNT_ETL_SYSCALL(NtResetWriteWatch)
+PHNT_ETL_SYSCALL(NtRestoreKey)
+PHNT_ETL_SYSCALL(NtResumeProcess)
+PHNT_ETL_SYSCALL(NtResumeThread)
+PHNT_ETL_SYSCALL(NtRevertContainerImpersonation)
+PHNT_ETL_SYSCALL(NtRollbackComplete)
+PHNT_ETL_SYSCALL(NtRollbackEnlistment)
+PHNT_ETL_SYSCALL(NtRollbackTransaction)
+PHNT_ETL_SYSCALL(NtRollforwardTransactionManager)
+PHNT_ETL_SYSCALL(NtSaveKey)
+PHNT_ETL_SYSCALL(NtSaveKeyEx)
+PHNT_ETL_SYSCALL(NtSaveMergedKeys)
+PHNT_ETL_SYSCALL(NtSecureConnectPort)
+PHNT_ETL_SYSCALL(NtSerializeBoot)
+PHNT_ETL_SYSCALL(NtSetBootEntryOrder)
+PHNT_ETL_SYSCALL(NtSetBootOptions)
+PHNT_ETL_SYSCALL(NtSetCachedSigningLevel)
+PHNT_ETL_SYSCALL(NtSetContextThread)
+PHNT_ETL_SYSCALL(NtSetDebugFilterState)
+PHNT_ETL_SYSCALL(NtSetDefaultHardErrorPort)
+PHNT_ETL_SYSCALL(NtSetDefaultLocale)
+PHNT_ETL_SYSCALL(NtSetDefaultUILanguage)
+PHNT_ETL_SYSCALL(NtSetDriverEntryOrder)
+PHNT_ETL_SYSCALL(NtSetEaFile)
+PHNT_ETL_SYSCALL(NtSetEvent)
+PHNT_ETL_SYSCALL(NtSetEventBoostPriority)
+PHNT_ETL_SYSCALL(NtSetHighEventPair)
+PHNT_ETL_SYSCALL(NtSetHighWaitLowEventPair)
+PHNT_ETL_SYSCALL(NtSetIRTimer)
+PHNT_ETL_SYSCALL(NtSetInformationDebugObject)
+PHNT_ETL_SYSCALL(NtSetInformationEnlistment)
+PHNT_ETL_SYSCALL(NtSetInformationFile)
+PHNT_ETL_SYSCALL(NtSetInformationIoRing)
+PHNT_ETL_SYSCALL(NtSetInformationJobObject)
+PHNT_ETL_SYSCALL(NtSetInformationKey)
+PHNT_ETL_SYSCALL(NtSetInformationObject)
+PHNT_ETL_SYSCALL(NtSetInformationProcess)
+PHNT_ETL_SYSCALL(NtSetInformationResourceManager)
+PHNT_ETL_SYSCALL(NtSetInformationSymbolicLink)
+PHNT_ETL_SYSCALL(NtSetInformationThread)
+PHNT_ETL_SYSCALL(NtSetInformationToken)
+PHNT_ETL_SYSCALL(NtSetInformationTransaction)
+PHNT_ETL_SYSCALL(NtSetInformationTransactionManager)
+PHNT_ETL_SYSCALL(NtSetInformationVirtualMemory)
+PHNT_ETL_SYSCALL(NtSetInformationWorkerFactory)
+PHNT_ETL_SYSCALL(NtSetIntervalProfile)
+PHNT_ETL_SYSCALL(NtSetIoCompletion)
+PHNT_ETL_SYSCALL(NtSetIoCompletionEx)
+PHNT_ETL_SYSCALL(NtSetLdtEntries)
+PHNT_ETL_SYSCALL(NtSetLowEventPair)
+PHNT_ETL_SYSCALL(NtSetLowWaitHighEventPair)
+PHNT_ETL_SYSCALL(NtSetQuotaInformationFile)
+PHNT_ETL_SYSCALL(NtSetSecurityObject)
+PHNT_ETL_SYSCALL(NtSetSystemEnvironmentValue)
+PHNT_ETL_SYSCALL(NtSetSystemEnvironmentValueEx)
+PHNT_ETL_SYSCALL(NtSetSystemInformation)
+PHNT_ETL_SYSCALL(NtSetSystemPowerState)
+PHNT_ETL_SYSCALL(NtSetSystemTime)
+PHNT_ETL_SYSCALL(NtSetThreadExecutionState)
+PHNT_ETL_SYSCALL(NtSetTimer)
+PHNT_ETL_SYSCALL(NtSetTimer2)
+PHNT_ETL_SYSCALL(NtSetTimerEx)
+PHNT_ETL_SYSCALL(NtSetTimerResolution)
+PHNT_ETL_SYSCALL(NtSetUuidSeed)
+PHNT_ETL_SYSCALL(NtSetValueKey)
+PHNT_ETL_SYSCALL(NtSetVolumeInformationFile)
+PHNT_ETL_SYSCALL(NtSetWnfProcessNotificationEvent)
+PHNT_ETL_SYSCALL(NtShutdownSystem)
+PHNT_ETL_SYSCALL(NtShutdownWorkerFactory)
+PHNT_ETL_SYSCALL(NtSignalAndWaitForSingleObject)
+PHNT_ETL_SYSCALL(NtSinglePhaseReject)
+PHNT_ETL_SYSCALL(NtStartProfile)
+PHNT_ETL_SYSCALL(NtStopProfile)
+PHNT_ETL_SYSCALL(NtSubmitIoRing)
+PHNT_ETL_SYSCALL(NtSubscribeWnfStateChange)
+PHNT_ETL_SYSCALL(NtSuspendProcess)
+PHNT_ETL_SYSCALL(NtSuspendThread)
+PHNT_ETL_SYSCALL(NtSystemDebugControl)
+PHNT_ETL_SYSCALL(NtTerminateEnclave)
+PHNT_ETL_SYSCALL(NtTerminateJobObject)
+PHNT_ETL_SYSCALL(NtTerminateProcess)
+PHNT_ETL_SYSCALL(NtTerminateThread)
+PHNT_ETL_SYSCALL(NtTestAlert)
+PHNT_ETL_SYSCALL(NtThawRegistry)
+PHNT_ETL_SYSCALL(NtThawTransactions)
+PHNT_ETL_SYSCALL(NtTraceControl)
+PHNT_ETL_SYSCALL(NtTraceEvent)
+PHNT_ETL_SYSCALL(NtTranslateFilePath)
+PHNT_ETL_SYSCALL(NtUmsThreadYield)
+PHNT_ETL_SYSCALL(NtUnloadDriver)
+PHNT_ETL_SYSCALL(NtUnloadKey)
+PHNT_ETL_SYSCALL(NtUnloadKey2)
+PHNT_ETL_SYSCALL(NtUnloadKeyEx)
+PHNT_ETL_SYSCALL(NtUnlockFile)
+PHNT_ETL_SYSCALL(NtUnlockVirtualMemory)
+PHNT_ETL_SYSCALL(NtUnmapViewOfSection)
+PHNT_ETL_SYSCALL(NtUnmapViewOfSectionEx)
+PHNT_ETL_SYSCALL(NtUnsubscribeWnfStateChange)
+PHNT_ETL_SYSCALL(NtUpdateWnfStateData)
+PHNT_ETL_SYSCALL(NtVdmControl)
+PHNT_ETL_SYSCALL(NtWaitForAlertByThreadId)
+PHNT_ETL_SYSCALL(NtWaitForDebugEvent)
+PHNT_ETL_SYSCALL(NtWaitForKeyedEvent)
+PHNT_ETL_SYSCALL(NtWaitForMultipleObjects)
+PHNT_ETL_SYSCALL(NtWaitForMultipleObjects32)
+PHNT_ETL_SYSCALL(NtWaitForSingleObject)
+PHNT_ETL_SYSCALL(NtWaitForWorkViaWorkerFactory)
+PHNT_ETL_SYSCALL(NtWaitHighEventPair)
+PHNT_ETL_SYSCALL(NtWaitLowEventPair)
+PHNT_ETL_SYSCALL(NtWorkerFactoryWorkerReady)
+PHNT_ETL_SYSCALL(NtWriteFile)
+PHNT_ETL_SYSCALL(NtWriteFileGather)
+PHNT_ETL_SYSCALL(NtWriteRequestData)
+PHNT_ETL_SYSCALL(NtWriteVirtualMemory)
+PHNT_ETL_SYSCALL(NtYieldExecution)
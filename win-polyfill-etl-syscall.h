@@ -0,0 +1,460 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==System call latency==
+//
+// Pairs PERFINFO_LOG_TYPE_SYSCALL_ENTER (PERFINFO_SYSCALL_ENTER_DATA, the address of
+// the service routine) with the next PERFINFO_LOG_TYPE_SYSCALL_EXIT
+// (PERFINFO_SYSCALL_EXIT_DATA, its NTSTATUS) of the same thread, and records the time
+// between them per service in etl_histogram. The latency is wall time, waits inside the
+// call included. Both events carry a PERFINFO header without a thread, so the thread
+// is the one the last context switch of the processor put there; events in a header
+// with ThreadId use it instead.
+//
+//   etl_syscall_profiler::consume(event)         thread, CSwitch and syscall events,
+//                                                in time order
+//   etl_syscall_profiler::services()             etl_syscall_stats by service address
+//   etl_syscall_profiler::for_each_process(f)    calls and time by process and service
+//   etl_syscall_profiler::name(service)          the name of a service
+//
+// The service names are the routines of ntzwapi.h, generated into
+// win-polyfill-etl-syscall-table.h (build the win-polyfill-etl-syscalls target after
+// changing ntzwapi.h) with a dense id each. An etl_syscall_map ties the ids to the
+// RVAs and service numbers of one kernel build; it is filled once with add() from
+// the symbols of that build and kept in a small sidecar file with save() and load(),
+// 8 bytes per service. With an etl_image_map of the trace the profiler turns the
+// service address into an RVA of the kernel image and looks it up; without a map, or
+// for another build, services are named "module+0xRVA" or by address.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-syscall.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "win-polyfill-etl-dispatch.h"
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-profile.h"
+
+namespace phnt
+{
+
+    inline constexpr const char *etl_syscall_names[] = {
+#define PHNT_ETL_SYSCALL(Name) #Name,
+#include "win-polyfill-etl-syscall-table.h"
+#undef PHNT_ETL_SYSCALL
+    };
+
+    constexpr USHORT etl_syscall_count =
+        (USHORT)(sizeof(etl_syscall_names) / sizeof(etl_syscall_names[0]));
+
+    // Not a service id nor a service number
+    constexpr USHORT etl_no_syscall = 0xFFFF;
+
+    // Id of an Nt or Zw routine name, etl_no_syscall if it is not in ntzwapi.h
+    inline USHORT etl_syscall_id(std::string_view Name)
+    {
+        if (Name.size() > 2 && Name[0] == 'Z' && Name[1] == 'w')
+        {
+            std::string nt = "Nt";
+            nt.append(Name.substr(2));
+            return etl_syscall_id(nt);
+        }
+        auto begin = etl_syscall_names, end = etl_syscall_names + etl_syscall_count;
+        auto found = std::lower_bound(
+            begin, end, Name, [](const char *name, std::string_view key) {
+                return std::string_view(name) < key;
+            });
+        return found != end && Name == *found ? (USHORT)(found - begin) : etl_no_syscall;
+    }
+
+    // FNV-1a of the names of win-polyfill-etl-syscall-table.h, each with its NUL
+    constexpr ULONG etl_syscall_names_hash()
+    {
+        uint32_t hash = 0x811C9DC5;
+        for (const char *name : etl_syscall_names)
+        {
+            const char *c = name;
+            do
+            {
+                hash = (hash ^ (UCHAR)*c) * 0x01000193;
+            } while (*c++);
+        }
+        return hash;
+    }
+
+    // "ETLS"
+    constexpr ULONG etl_syscall_map_magic = 0x534C5445;
+    constexpr ULONG etl_syscall_map_version = 2;
+
+    // Sidecar layout, little endian: etl_syscall_map_header, then Count
+    // etl_syscall_map_entry sorted by Rva. Service ids are rows of
+    // win-polyfill-etl-syscall-table.h, a file is only read with the table it was written
+    // with (ServiceCount and NameHash); a service added or renamed in ntzwapi.h moves
+    // the ids after it without changing the count.
+    struct etl_syscall_map_header
+    {
+        ULONG Magic;
+        ULONG Version;
+        // SizeOfImage of the kernel image the RVAs are of, 0 to take any
+        ULONG ImageSize;
+        ULONG ServiceCount;
+        ULONG Count;
+        // etl_syscall_names_hash() of the table
+        ULONG NameHash;
+    };
+
+    struct etl_syscall_map_entry
+    {
+        ULONG Rva;
+        USHORT Service;
+        // System service number, etl_no_syscall when not known
+        USHORT Number;
+    };
+
+    class etl_syscall_map
+    {
+      public:
+        explicit etl_syscall_map(ULONG ImageSize = 0)
+        {
+            Header = {};
+            Header.Magic = etl_syscall_map_magic;
+            Header.Version = etl_syscall_map_version;
+            Header.ImageSize = ImageSize;
+            Header.ServiceCount = etl_syscall_count;
+            Header.NameHash = etl_syscall_names_hash();
+        }
+
+        // False if Name is not a routine of ntzwapi.h; an RVA added again is replaced
+        bool add(ULONG Rva, std::string_view Name, USHORT Number = etl_no_syscall)
+        {
+            USHORT service = etl_syscall_id(Name);
+            if (service == etl_no_syscall)
+            {
+                return false;
+            }
+            auto it = Entries.begin() + find(Rva);
+            if (it != Entries.end() && it->Rva == Rva)
+            {
+                *it = {Rva, service, Number};
+            }
+            else
+            {
+                Entries.insert(it, {Rva, service, Number});
+            }
+            Header.Count = (ULONG)Entries.size();
+            return true;
+        }
+
+        // False if Data is not a map of this version and service table
+        bool load(const void *Data, size_t Size)
+        {
+            const UCHAR *p = static_cast<const UCHAR *>(Data);
+            if (Size < sizeof(etl_syscall_map_header))
+            {
+                return false;
+            }
+            etl_syscall_map_header header = etl_load<etl_syscall_map_header>(p);
+            ULONGLONG expected =
+                sizeof(header) + header.Count * (ULONGLONG)sizeof(etl_syscall_map_entry);
+            if (header.Magic != etl_syscall_map_magic ||
+                header.Version != etl_syscall_map_version ||
+                header.ServiceCount != etl_syscall_count ||
+                header.NameHash != etl_syscall_names_hash() || expected != Size)
+            {
+                return false;
+            }
+            std::vector<etl_syscall_map_entry> entries(header.Count);
+            p += sizeof(header);
+            for (etl_syscall_map_entry &entry : entries)
+            {
+                entry = etl_load<etl_syscall_map_entry>(p);
+                p += sizeof(entry);
+                if (entry.Service >= etl_syscall_count ||
+                    (&entry != entries.data() && (&entry)[-1].Rva >= entry.Rva))
+                {
+                    return false;
+                }
+            }
+            Header = header;
+            Entries = std::move(entries);
+            return true;
+        }
+
+        std::vector<UCHAR> save() const
+        {
+            std::vector<UCHAR> data(
+                sizeof(Header) + Entries.size() * sizeof(etl_syscall_map_entry));
+            memcpy(data.data(), &Header, sizeof(Header));
+            if (!Entries.empty())
+            {
+                memcpy(
+                    data.data() + sizeof(Header),
+                    Entries.data(),
+                    Entries.size() * sizeof(etl_syscall_map_entry));
+            }
+            return data;
+        }
+
+        const etl_syscall_map_header &header() const { return Header; }
+
+        // Service id of the routine at Rva, etl_no_syscall if none starts there
+        USHORT service(ULONG Rva) const
+        {
+            auto it = Entries.begin() + find(Rva);
+            return it != Entries.end() && it->Rva == Rva ? it->Service : etl_no_syscall;
+        }
+
+        // Service id of a system service number, etl_no_syscall if not known
+        USHORT service_of_number(USHORT Number) const
+        {
+            if (Number == etl_no_syscall)
+            {
+                return etl_no_syscall;
+            }
+            for (const etl_syscall_map_entry &entry : Entries)
+            {
+                if (entry.Number == Number)
+                {
+                    return entry.Service;
+                }
+            }
+            return etl_no_syscall;
+        }
+
+      private:
+        // Position of the first entry at or after Rva
+        size_t find(ULONG Rva) const
+        {
+            auto it = std::lower_bound(
+                Entries.begin(),
+                Entries.end(),
+                Rva,
+                [](const etl_syscall_map_entry &entry, ULONG rva) {
+                    return entry.Rva < rva;
+                });
+            return it - Entries.begin();
+        }
+
+        etl_syscall_map_header Header;
+        std::vector<etl_syscall_map_entry> Entries;
+    };
+
+    C_ASSERT(sizeof(etl_syscall_map_header) == 0x18);
+    C_ASSERT(sizeof(etl_syscall_map_entry) == 0x08);
+
+    struct etl_syscall_stats
+    {
+        // Address of the service routine
+        uint64_t Service;
+        // Of the first call, to find the kernel image it was in
+        int64_t FirstCall;
+        uint64_t Calls;
+        // Returned an NTSTATUS of severity error
+        uint64_t Failures;
+        uint64_t TotalTime;
+        // SYSCALL_ENTER to SYSCALL_EXIT, in the clock of the trace
+        etl_histogram Latencies;
+    };
+
+    class etl_syscall_profiler
+    {
+      public:
+        explicit etl_syscall_profiler(
+            const etl_image_map *Images = nullptr,
+            const etl_syscall_map *Map = nullptr)
+            : Images(Images), Map(Map)
+        {
+        }
+
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            WMI_CONTEXTSWAP cswitch;
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_THREAD_CREATE:
+            case WMI_LOG_TYPE_THREAD_DC_START:
+                Threads.consume(event);
+                break;
+            case PERFINFO_LOG_TYPE_CONTEXTSWAP:
+                if (etl_read_payload(event, cswitch))
+                {
+                    if (event.ProcessorIndex >= Current.size())
+                    {
+                        Current.resize((size_t)event.ProcessorIndex + 1, etl_no_id);
+                    }
+                    Current[event.ProcessorIndex] = cswitch.NewThreadId;
+                }
+                break;
+            case PERFINFO_LOG_TYPE_SYSCALL_ENTER:
+                if (event.PayloadSize >= event.PointerSize)
+                {
+                    ULONG thread = thread_of(event);
+                    if (thread != etl_no_id)
+                    {
+                        uint64_t address =
+                            etl_load_pointer(event.Payload, event.PointerSize);
+                        Pending[thread] = {event.TimeStamp, address};
+                    }
+                }
+                break;
+            case PERFINFO_LOG_TYPE_SYSCALL_EXIT:
+                if (event.PayloadSize >= sizeof(NTSTATUS))
+                {
+                    exit(
+                        thread_of(event),
+                        event.TimeStamp,
+                        etl_load<ULONG>(event.Payload));
+                }
+                break;
+            }
+        }
+
+        // In order of first call
+        const std::vector<etl_syscall_stats> &services() const { return Services; }
+
+        // f(ULONG ProcessId, const etl_syscall_stats &Service, uint64_t Calls,
+        //   uint64_t TotalTime); threads of unknown process are under etl_no_process
+        template <class F> void for_each_process(F &&f) const
+        {
+            for (const auto &process : Processes)
+            {
+                f((ULONG)(process.first >> 32),
+                  Services[(ULONG)process.first],
+                  process.second.Calls,
+                  process.second.TotalTime);
+            }
+        }
+
+        // The routine name from the etl_syscall_map, else "module+0xRVA", else the
+        // address
+        std::string name(const etl_syscall_stats &Service) const
+        {
+            char text[64];
+            ULONG image = Images ? Images->find(0, Service.FirstCall, Service.Service)
+                                 : etl_no_image;
+            if (image == etl_no_image)
+            {
+                snprintf(
+                    text, sizeof(text), "0x%llx", (unsigned long long)Service.Service);
+                return text;
+            }
+            const etl_image &kernel = Images->image(image);
+            uint64_t rva = Service.Service - kernel.Base;
+            ULONG image_size = Map ? Map->header().ImageSize : 0;
+            if (Map && (image_size == 0 || image_size == kernel.Size))
+            {
+                USHORT service = Map->service((ULONG)rva);
+                if (service != etl_no_syscall)
+                {
+                    return etl_syscall_names[service];
+                }
+            }
+            snprintf(text, sizeof(text), "+0x%llx", (unsigned long long)rva);
+            return kernel.module() + std::string(text);
+        }
+
+        // Exits without their enter, of calls made before the trace
+        uint64_t unmatched() const { return Unmatched; }
+
+      private:
+        struct pending
+        {
+            int64_t TimeStamp;
+            uint64_t Service;
+        };
+
+        struct process_calls
+        {
+            uint64_t Calls;
+            uint64_t TotalTime;
+        };
+
+        ULONG thread_of(const etl_event &event) const
+        {
+            if (event.ThreadId != etl_no_id)
+            {
+                return event.ThreadId;
+            }
+            return event.ProcessorIndex < Current.size() ? Current[event.ProcessorIndex]
+                                                         : etl_no_id;
+        }
+
+        ULONG find_service(uint64_t Address, int64_t TimeStamp)
+        {
+            auto found = ServiceIds.find(Address);
+            if (found != ServiceIds.end())
+            {
+                return found->second;
+            }
+            ULONG id = (ULONG)Services.size();
+            Services.emplace_back();
+            etl_syscall_stats &stats = Services.back();
+            stats.Service = Address;
+            stats.FirstCall = TimeStamp;
+            stats.Calls = 0;
+            stats.Failures = 0;
+            stats.TotalTime = 0;
+            ServiceIds[Address] = id;
+            return id;
+        }
+
+        void exit(ULONG Thread, LONGLONG TimeStamp, ULONG Status)
+        {
+            auto found = Thread != etl_no_id ? Pending.find(Thread) : Pending.end();
+            if (found == Pending.end())
+            {
+                ++Unmatched;
+                return;
+            }
+            pending call = found->second;
+            Pending.erase(found);
+            uint64_t time =
+                TimeStamp > call.TimeStamp ? (uint64_t)(TimeStamp - call.TimeStamp) : 0;
+            ULONG service = find_service(call.Service, call.TimeStamp);
+            etl_syscall_stats &stats = Services[service];
+            ++stats.Calls;
+            // NT_ERROR
+            if ((Status >> 30) == 3)
+            {
+                ++stats.Failures;
+            }
+            stats.TotalTime += time;
+            stats.Latencies.add(time);
+
+            ULONG process_id = Threads.process(Thread);
+            process_calls &process = Processes[((uint64_t)process_id << 32) | service];
+            ++process.Calls;
+            process.TotalTime += time;
+        }
+
+        const etl_image_map *Images;
+        const etl_syscall_map *Map;
+        etl_thread_processes Threads;
+        // Thread running on each processor, etl_no_id until its first switch
+        std::vector<ULONG> Current;
+        // Call in progress by thread
+        std::unordered_map<ULONG, pending> Pending;
+        std::vector<etl_syscall_stats> Services;
+        std::unordered_map<uint64_t, ULONG> ServiceIds;
+        // By process << 32 | index in Services
+        std::unordered_map<uint64_t, process_calls> Processes;
+        uint64_t Unmatched = 0;
+    };
+
+} // namespace phnt
@@ -0,0 +1,304 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Thread pool queueing delay==
+//
+// Follows the user mode thread pool events of EVENT_TRACE_GROUP_THREAD_POOL. Each
+// callback is followed by its TaskId, the callback object, through
+//
+//   PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE   queued on PoolId
+//   PERFINFO_LOG_TYPE_TP_CALLBACK_START     a worker thread runs it
+//   PERFINFO_LOG_TYPE_TP_CALLBACK_STOP      the same thread is done with it
+//   PERFINFO_LOG_TYPE_TP_CALLBACK_CANCEL    CancelCount queued runs are dropped
+//
+// and the queueing delay (ENQUEUE to START) and the execution time (START to STOP) go
+// to the etl_histogram of the pool. A callback object may be queued several times
+// before it runs, its enqueues are kept in order and a start takes the oldest; a
+// cancel drops the newest. Starts without an enqueue, of callbacks queued before the
+// trace, have an execution time only.
+//
+// PERFINFO_LOG_TYPE_TP_POOL_TH_MIN_SET and _TH_MAX_SET add a point to the thread limit
+// history of the pool, and TIMER_EXPIRATION_BEGIN to _END times the expiration of each
+// timer queue. Pools and callbacks belong to the process of the event header.
+//
+//   etl_threadpool_analyzer::consume(event)       thread pool events, in time order
+//   etl_threadpool_analyzer::pools()              etl_threadpool_stats of each pool
+//   etl_threadpool_analyzer::timer_expirations()  time spent expiring timers
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-threadpool.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "win-polyfill-etl-histogram.h"
+#include "win-polyfill-etl-reader.h"
+
+namespace phnt
+{
+
+    struct etl_threadpool_limits
+    {
+        int64_t TimeStamp;
+        // 0 until set in the trace
+        ULONG MinThreads;
+        ULONG MaxThreads;
+    };
+
+    struct etl_threadpool_stats
+    {
+        ULONG ProcessId;
+        uint64_t PoolId;
+        // INT64_MIN and INT64_MAX for pools created before or closed after the trace
+        int64_t Created;
+        int64_t Closed;
+        uint64_t Enqueued;
+        uint64_t Started;
+        uint64_t Cancelled;
+        // ENQUEUE to START and START to STOP, in the clock of the trace
+        etl_histogram QueueDelays;
+        etl_histogram ExecutionTimes;
+        // One entry per change, in time order
+        std::vector<etl_threadpool_limits> Limits;
+    };
+
+    class etl_threadpool_analyzer
+    {
+      public:
+        void consume(const etl_event &event)
+        {
+            if (!etl_is_kernel_event(event))
+            {
+                return;
+            }
+            const ULONG p = event.PointerSize;
+            const UCHAR *data = event.Payload;
+            const ULONG size = event.PayloadSize;
+            switch (event.HookId)
+            {
+            case PERFINFO_LOG_TYPE_TP_POOL_CREATE:
+                if (size >= p)
+                {
+                    ULONG pool = find_pool(event.ProcessId, etl_load_pointer(data, p));
+                    Pools[pool].Created = event.TimeStamp;
+                }
+                break;
+            case PERFINFO_LOG_TYPE_TP_POOL_CLOSE:
+                if (size >= p)
+                {
+                    auto key = std::make_pair(event.ProcessId, etl_load_pointer(data, p));
+                    auto found = PoolIds.find(key);
+                    if (found != PoolIds.end())
+                    {
+                        Pools[found->second].Closed = event.TimeStamp;
+                        PoolIds.erase(found);
+                    }
+                }
+                break;
+            case PERFINFO_LOG_TYPE_TP_POOL_TH_MIN_SET:
+            case PERFINFO_LOG_TYPE_TP_POOL_TH_MAX_SET:
+                // PoolId, ThreadNum
+                if (size >= p + 4)
+                {
+                    ULONG pool = find_pool(event.ProcessId, etl_load_pointer(data, p));
+                    limit(pool, event, etl_load<ULONG>(data + p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_TP_CALLBACK_ENQUEUE:
+                // PoolId, TaskId, Callback, Context, SubProcessTag
+                if (size >= 2 * p)
+                {
+                    ULONG pool = find_pool(event.ProcessId, etl_load_pointer(data, p));
+                    ++Pools[pool].Enqueued;
+                    Queued[{event.ProcessId, etl_load_pointer(data + p, p)}].push_back(
+                        event.TimeStamp);
+                }
+                break;
+            case PERFINFO_LOG_TYPE_TP_CALLBACK_START:
+                if (size >= 2 * p)
+                {
+                    ULONG pool = find_pool(event.ProcessId, etl_load_pointer(data, p));
+                    start(pool, event, etl_load_pointer(data + p, p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_TP_CALLBACK_STOP:
+                stop(event);
+                break;
+            case PERFINFO_LOG_TYPE_TP_CALLBACK_CANCEL:
+                // The ENQUEUE fields, then CancelCount
+                if (size >= 5 * p + 4)
+                {
+                    ULONG pool = find_pool(event.ProcessId, etl_load_pointer(data, p));
+                    cancel(
+                        pool,
+                        event.ProcessId,
+                        etl_load_pointer(data + p, p),
+                        etl_load<ULONG>(data + 5 * p));
+                }
+                break;
+            case PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION_BEGIN:
+                if (size >= p)
+                {
+                    Expiring[{event.ProcessId, etl_load_pointer(data, p)}] =
+                        event.TimeStamp;
+                }
+                break;
+            case PERFINFO_LOG_TYPE_TP_TIMER_EXPIRATION_END:
+                if (size >= p)
+                {
+                    auto found =
+                        Expiring.find({event.ProcessId, etl_load_pointer(data, p)});
+                    if (found != Expiring.end())
+                    {
+                        TimerExpirations.add(etl_elapsed(found->second, event.TimeStamp));
+                        Expiring.erase(found);
+                    }
+                }
+                break;
+            }
+        }
+
+        // Closed pools stay, a pool created again at the same PoolId is a new entry
+        const std::vector<etl_threadpool_stats> &pools() const { return Pools; }
+
+        const etl_histogram &timer_expirations() const { return TimerExpirations; }
+
+        // Callback runs queued and not started yet
+        uint64_t queued() const
+        {
+            uint64_t count = 0;
+            for (const auto &task : Queued)
+            {
+                count += task.second.size();
+            }
+            return count;
+        }
+
+      private:
+        struct running
+        {
+            int64_t TimeStamp;
+            ULONG Pool;
+        };
+
+        using task_key = std::pair<ULONG, uint64_t>;
+
+        struct task_hash
+        {
+            size_t operator()(const task_key &key) const
+            {
+                uint64_t hash = key.second ^ ((uint64_t)key.first << 32);
+                hash *= 0x9E3779B97F4A7C15ull;
+                return (size_t)(hash ^ (hash >> 32));
+            }
+        };
+
+        ULONG find_pool(ULONG ProcessId, uint64_t PoolId)
+        {
+            auto key = std::make_pair(ProcessId, PoolId);
+            auto found = PoolIds.find(key);
+            if (found != PoolIds.end())
+            {
+                return found->second;
+            }
+            ULONG id = (ULONG)Pools.size();
+            Pools.emplace_back();
+            etl_threadpool_stats &pool = Pools.back();
+            pool.ProcessId = ProcessId;
+            pool.PoolId = PoolId;
+            pool.Created = INT64_MIN;
+            pool.Closed = INT64_MAX;
+            pool.Enqueued = 0;
+            pool.Started = 0;
+            pool.Cancelled = 0;
+            PoolIds[key] = id;
+            return id;
+        }
+
+        void limit(ULONG Pool, const etl_event &event, ULONG ThreadNum)
+        {
+            std::vector<etl_threadpool_limits> &limits = Pools[Pool].Limits;
+            etl_threadpool_limits next = {event.TimeStamp, 0, 0};
+            if (!limits.empty())
+            {
+                next.MinThreads = limits.back().MinThreads;
+                next.MaxThreads = limits.back().MaxThreads;
+            }
+            if (event.HookId == PERFINFO_LOG_TYPE_TP_POOL_TH_MIN_SET)
+            {
+                next.MinThreads = ThreadNum;
+            }
+            else
+            {
+                next.MaxThreads = ThreadNum;
+            }
+            limits.push_back(next);
+        }
+
+        void start(ULONG Pool, const etl_event &event, uint64_t TaskId)
+        {
+            etl_threadpool_stats &pool = Pools[Pool];
+            ++pool.Started;
+            auto found = Queued.find({event.ProcessId, TaskId});
+            if (found != Queued.end())
+            {
+                pool.QueueDelays.add(etl_elapsed(found->second.front(), event.TimeStamp));
+                found->second.pop_front();
+                if (found->second.empty())
+                {
+                    Queued.erase(found);
+                }
+            }
+            if (event.ThreadId != etl_no_id)
+            {
+                Running[event.ThreadId] = {event.TimeStamp, Pool};
+            }
+        }
+
+        void stop(const etl_event &event)
+        {
+            auto found = Running.find(event.ThreadId);
+            if (found != Running.end())
+            {
+                Pools[found->second.Pool].ExecutionTimes.add(
+                    etl_elapsed(found->second.TimeStamp, event.TimeStamp));
+                Running.erase(found);
+            }
+        }
+
+        void cancel(ULONG Pool, ULONG ProcessId, uint64_t TaskId, ULONG CancelCount)
+        {
+            Pools[Pool].Cancelled += CancelCount;
+            auto found = Queued.find({ProcessId, TaskId});
+            if (found == Queued.end())
+            {
+                return;
+            }
+            std::deque<int64_t> &queued = found->second;
+            queued.resize(queued.size() > CancelCount ? queued.size() - CancelCount : 0);
+            if (queued.empty())
+            {
+                Queued.erase(found);
+            }
+        }
+
+        std::vector<etl_threadpool_stats> Pools;
+        std::map<task_key, ULONG> PoolIds;
+        // Enqueue times of each callback object not started yet, oldest first
+        std::unordered_map<task_key, std::deque<int64_t>, task_hash> Queued;
+        // By ThreadId of the worker
+        std::unordered_map<ULONG, running> Running;
+        std::map<task_key, int64_t> Expiring;
+        etl_histogram TimerExpirations;
+    };
+
+} // namespace phnt
@@ -0,0 +1,342 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Wait chains and critical path==
+//
+// Joins the thread timeline of etl_cswitch_timeline with the readying edges of
+// ETW_READY_THREAD_EVENT: the thread of the event header readied ThreadId, unless the
+// event was logged from a DPC (ExecutingDpc) or the header has no thread. After
+// finish() the intervals and the edges are sorted once into flat indexes by thread
+// and time, and every query is a few binary searches:
+//
+//   etl_wait_graph::consume(event)                   thread, CSwitch and ReadyThread
+//                                                    events, in time order
+//   etl_wait_graph::finish(time)                     closes the timeline, builds the
+//                                                    indexes
+//   etl_wait_graph::critical_path(thread, from, to)  etl_path_segment list
+//   etl_wait_graph::for_each_waker(thread, from, to, f)  edges readying thread
+//   etl_wait_graph::for_each_wakee(thread, from, to, f)  edges thread readied
+//
+// The critical path walks back from the end of the window on the thread. Running and
+// Ready intervals are on the path as they are; at the end of a wait the walk moves to
+// the thread that readied it, at the time of the edge, and goes on back from there,
+// across processes. A wait ended by a DPC, the idle thread or an unknown thread stays
+// on the path as Waiting. Time of a thread outside its known intervals is Initialized.
+
+#ifndef __cplusplus
+#error "win-polyfill-etl-waitchain.h requires C++"
+#endif
+
+#include <stdint.h>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "win-polyfill-etl-cswitch.h"
+
+namespace phnt
+{
+
+    struct etl_ready_edge
+    {
+        int64_t TimeStamp;
+        // etl_no_thread when readied from a DPC or by an unknown thread
+        ULONG Readier;
+        ULONG Readied;
+        // Of ETW_READY_THREAD_EVENT
+        UCHAR Flags;
+    };
+
+    struct etl_path_segment
+    {
+        ULONG ThreadId;
+        // etl_no_process when the thread events of the thread are not in the trace
+        ULONG ProcessId;
+        int64_t Start;
+        int64_t End;
+        // KTHREAD_STATE: Running, Ready, Waiting, or Initialized when not known
+        UCHAR State;
+        // KWAIT_REASON of Waiting segments, MaximumWaitReason otherwise
+        UCHAR WaitReason;
+        USHORT Processor;
+    };
+
+    class etl_wait_graph
+    {
+      public:
+        void consume(const etl_event &event)
+        {
+            ETW_READY_THREAD_EVENT ready;
+            switch (event.HookId)
+            {
+            case WMI_LOG_TYPE_THREAD_CREATE:
+            case WMI_LOG_TYPE_THREAD_DC_START:
+                Processes.consume(event);
+                break;
+            case PERFINFO_LOG_TYPE_READY_THREAD:
+                if (etl_read_payload(event, ready))
+                {
+                    bool thread = event.ThreadId != etl_no_id && event.ThreadId != 0 &&
+                                  !ready.ExecutingDpc;
+                    Edges.push_back(
+                        {event.TimeStamp,
+                         thread ? event.ThreadId : etl_no_thread,
+                         ready.ThreadId,
+                         ready.Flags});
+                }
+                Timeline.consume(event);
+                break;
+            default:
+                Timeline.consume(event);
+                break;
+            }
+        }
+
+        // After the last event; TimeStamp closes the threads still running
+        void finish(LONGLONG TimeStamp)
+        {
+            Timeline.finish(TimeStamp);
+            const etl_thread_intervals &intervals = Timeline.intervals();
+            ByThread.resize(intervals.size());
+            for (size_t i = 0; i < ByThread.size(); ++i)
+            {
+                ByThread[i] = (ULONG)i;
+            }
+            std::sort(ByThread.begin(), ByThread.end(), [&](ULONG a, ULONG b) {
+                return intervals.ThreadId[a] != intervals.ThreadId[b]
+                           ? intervals.ThreadId[a] < intervals.ThreadId[b]
+                           : intervals.Start[a] < intervals.Start[b];
+            });
+            index(ByThread, ThreadIntervals, [&](ULONG i) {
+                return intervals.ThreadId[i];
+            });
+
+            std::sort(
+                Edges.begin(),
+                Edges.end(),
+                [](const etl_ready_edge &a, const etl_ready_edge &b) {
+                    return a.Readied != b.Readied ? a.Readied < b.Readied
+                                                  : a.TimeStamp < b.TimeStamp;
+                });
+            std::vector<ULONG> readied(Edges.size());
+            for (size_t i = 0; i < readied.size(); ++i)
+            {
+                readied[i] = (ULONG)i;
+            }
+            index(readied, Wakers, [&](ULONG i) { return Edges[i].Readied; });
+            ByReadier = std::move(readied);
+            std::stable_sort(ByReadier.begin(), ByReadier.end(), [&](ULONG a, ULONG b) {
+                const etl_ready_edge &x = Edges[a], &y = Edges[b];
+                return x.Readier != y.Readier ? x.Readier < y.Readier
+                                              : x.TimeStamp < y.TimeStamp;
+            });
+            index(ByReadier, Wakees, [&](ULONG i) { return Edges[i].Readier; });
+        }
+
+        // The path that ends the window [From, To] on ThreadId, oldest segment first
+        std::vector<etl_path_segment>
+        critical_path(ULONG ThreadId, LONGLONG From, LONGLONG To) const
+        {
+            const etl_thread_intervals &intervals = Timeline.intervals();
+            std::vector<etl_path_segment> path;
+            ULONG thread = ThreadId;
+            int64_t time = To;
+            // One move per point in time, two threads readying each other at the same
+            // time would loop
+            bool moved = false;
+            while (time > From)
+            {
+                size_t i = interval_before(thread, time);
+                if (i == SIZE_MAX || intervals.End[ByThread[i]] < time)
+                {
+                    // A gap, or before the first interval of the thread
+                    int64_t start = From;
+                    if (i != SIZE_MAX && intervals.End[ByThread[i]] > start)
+                    {
+                        start = intervals.End[ByThread[i]];
+                    }
+                    push(path, thread, start, time, Initialized, MaximumWaitReason, 0);
+                    time = start;
+                    moved = false;
+                    continue;
+                }
+                ULONG at = ByThread[i];
+                UCHAR state = intervals.State[at];
+                int64_t start = std::max<int64_t>(intervals.Start[at], From);
+                if (state == Waiting && time == intervals.End[at])
+                {
+                    const etl_ready_edge *edge = waker(thread, intervals.Start[at], time);
+                    if (edge && edge->Readier != etl_no_thread &&
+                        edge->Readier != thread && !moved)
+                    {
+                        // The readier was running at the time of the edge
+                        thread = edge->Readier;
+                        time = edge->TimeStamp;
+                        moved = true;
+                        continue;
+                    }
+                }
+                push(
+                    path,
+                    thread,
+                    start,
+                    time,
+                    state,
+                    intervals.WaitReason[at],
+                    intervals.Processor[at]);
+                time = start;
+                moved = false;
+            }
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+        // f(const etl_ready_edge &) for the edges readying ThreadId in [From, To], in
+        // time order
+        template <class F>
+        void for_each_waker(ULONG ThreadId, LONGLONG From, LONGLONG To, F &&f) const
+        {
+            for_each_edge(Wakers, nullptr, ThreadId, From, To, f);
+        }
+
+        // f(const etl_ready_edge &) for the edges ThreadId readied in [From, To], in time
+        // order
+        template <class F>
+        void for_each_wakee(ULONG ThreadId, LONGLONG From, LONGLONG To, F &&f) const
+        {
+            for_each_edge(Wakees, &ByReadier, ThreadId, From, To, f);
+        }
+
+        const etl_cswitch_timeline &timeline() const { return Timeline; }
+
+      private:
+        // [Begin, End) of the entries of a thread in a sorted index
+        using ranges = std::unordered_map<ULONG, std::pair<ULONG, ULONG>>;
+
+        template <class Key>
+        static void index(const std::vector<ULONG> &Sorted, ranges &Ranges, Key &&key)
+        {
+            Ranges.clear();
+            for (ULONG begin = 0, end; begin < Sorted.size(); begin = end)
+            {
+                ULONG thread = key(Sorted[begin]);
+                end = begin + 1;
+                while (end < Sorted.size() && key(Sorted[end]) == thread)
+                {
+                    ++end;
+                }
+                Ranges[thread] = {begin, end};
+            }
+        }
+
+        // Position in ByThread of the last interval of Thread starting before TimeStamp
+        size_t interval_before(ULONG Thread, int64_t TimeStamp) const
+        {
+            auto found = ThreadIntervals.find(Thread);
+            if (found == ThreadIntervals.end())
+            {
+                return SIZE_MAX;
+            }
+            const std::vector<int64_t> &starts = Timeline.intervals().Start;
+            auto first = ByThread.begin() + found->second.first;
+            auto last = ByThread.begin() + found->second.second;
+            auto next =
+                std::lower_bound(first, last, TimeStamp, [&](ULONG i, int64_t time) {
+                    return starts[i] < time;
+                });
+            return next == first ? SIZE_MAX : (size_t)(next - ByThread.begin()) - 1;
+        }
+
+        // The last edge readying Thread in [From, To]
+        const etl_ready_edge *waker(ULONG Thread, int64_t From, int64_t To) const
+        {
+            auto found = Wakers.find(Thread);
+            if (found == Wakers.end())
+            {
+                return nullptr;
+            }
+            auto first = Edges.begin() + found->second.first;
+            auto last = Edges.begin() + found->second.second;
+            auto next = std::upper_bound(
+                first, last, To, [](int64_t time, const etl_ready_edge &edge) {
+                    return time < edge.TimeStamp;
+                });
+            if (next == first || (next - 1)->TimeStamp < From)
+            {
+                return nullptr;
+            }
+            return &*(next - 1);
+        }
+
+        template <class F>
+        void for_each_edge(
+            const ranges &Ranges,
+            const std::vector<ULONG> *Order,
+            ULONG Thread,
+            LONGLONG From,
+            LONGLONG To,
+            F &f) const
+        {
+            auto found = Ranges.find(Thread);
+            if (found == Ranges.end())
+            {
+                return;
+            }
+            auto edge = [&](ULONG i) -> const etl_ready_edge & {
+                return Edges[Order ? (*Order)[i] : i];
+            };
+            ULONG begin = found->second.first, end = found->second.second;
+            // First edge at or after From
+            while (begin < end)
+            {
+                ULONG middle = begin + (end - begin) / 2;
+                if (edge(middle).TimeStamp < From)
+                {
+                    begin = middle + 1;
+                }
+                else
+                {
+                    end = middle;
+                }
+            }
+            for (ULONG i = begin; i < found->second.second && edge(i).TimeStamp <= To;
+                 ++i)
+            {
+                f(edge(i));
+            }
+        }
+
+        void push(
+            std::vector<etl_path_segment> &Path,
+            ULONG Thread,
+            int64_t Start,
+            int64_t End,
+            UCHAR State,
+            UCHAR WaitReason,
+            USHORT Processor) const
+        {
+            ULONG process_id = Processes.process(Thread);
+            Path.push_back(
+                {Thread, process_id, Start, End, State, WaitReason, Processor});
+        }
+
+        etl_cswitch_timeline Timeline;
+        etl_thread_processes Processes;
+        // Sorted by Readied and time after finish()
+        std::vector<etl_ready_edge> Edges;
+        // Positions in Edges by Readier and time
+        std::vector<ULONG> ByReadier;
+        // Positions in the intervals of Timeline by thread and start
+        std::vector<ULONG> ByThread;
+        ranges ThreadIntervals;
+        // Ranges of Edges by Readied, and of ByReadier by Readier
+        ranges Wakers;
+        ranges Wakees;
+    };
+
+} // namespace phnt
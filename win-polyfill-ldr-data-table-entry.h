@@ -1,7 +1,15 @@
-﻿#pragma once
+﻿#if !defined(_WIN_POLYFILL_LDR_DATA_TABLE_ENTRY_H) || defined(WIN_POLYFILL_BASIC_PASS)
+#ifndef WIN_POLYFILL_BASIC_PASS
+#define _WIN_POLYFILL_LDR_DATA_TABLE_ENTRY_H
 
 #include "phnt_ntdef.h"
 
+// Re-included by win-polyfill-basic-pebteb.h, see win-polyfill-peb.h.
+#ifndef WIN_POLYFILL_POINTER
+#define WIN_POLYFILL_POINTER(Type) Type
+#endif
+#endif // WIN_POLYFILL_BASIC_PASS
+
 // https://www.geoffchappell.com/studies/windows/km/ntoskrnl/inc/api/ntldr/ldr_data_table_entry.htm
 typedef struct _LDR_DATA_TABLE_ENTRY
 {
@@ -18,15 +26,15 @@ typedef struct _LDR_DATA_TABLE_ENTRY
         LIST_ENTRY InProgressLinks;
     };
     // 0x18 0x30 (all)
-    VOID *DllBase;
+    PVOID DllBase;
     // 0x1C 0x38 (all)
-    VOID *EntryPoint;
+    PVOID EntryPoint;
     // 0x20 0x40 (all)
     ULONG SizeOfImage;
     // 0x24 0x48 (all)
-    struct _UNICODE_STRING FullDllName;
+    UNICODE_STRING FullDllName;
     // 0x2C 0x58 (all)
-    struct _UNICODE_STRING BaseDllName;
+    UNICODE_STRING BaseDllName;
     // 0x34 0x68 (all)
     union
     {
@@ -126,7 +134,7 @@ typedef struct _LDR_DATA_TABLE_ENTRY
     // 0x44 0x80 (4.0 and higher)
     ULONG TimeDateStamp;
     // 0x48 0x88 (5.1 and higher)
-    struct _ACTIVATION_CONTEXT *EntryPointActivationContext;
+    WIN_POLYFILL_POINTER(PACTIVATION_CONTEXT) EntryPointActivationContext;
     // 0x4C 0x90 (5.1 from Windows XP SP2 and higher)
     union
     {
@@ -135,7 +143,7 @@ typedef struct _LDR_DATA_TABLE_ENTRY
         // 6.3 only
         PVOID Spare;
         // 10.0 and higher
-        VOID *Lock;
+        PVOID Lock;
     };
     union
     {
@@ -157,25 +165,25 @@ typedef struct _LDR_DATA_TABLE_ENTRY
         struct
         {
             // 0x50 0x98 (6.2 and higher)
-            struct _LDR_DDAG_NODE *DdagNode;
+            WIN_POLYFILL_POINTER(PLDR_DDAG_NODE) DdagNode;
             LIST_ENTRY NodeModuleLink;
-            struct _LDRP_LOAD_CONTEXT *LoadContext;
-            VOID *ParentDllBase;
-            VOID *SwitchBackContext;
-            struct _RTL_BALANCED_NODE BaseAddressIndexNode;
+            WIN_POLYFILL_POINTER(PLDRP_LOAD_CONTEXT) LoadContext;
+            PVOID ParentDllBase;
+            PVOID SwitchBackContext;
+            RTL_BALANCED_NODE BaseAddressIndexNode;
             // 0x74 0xE0 (6.2 and higher)
-            struct _RTL_BALANCED_NODE MappingInfoIndexNode;
+            RTL_BALANCED_NODE MappingInfoIndexNode;
             // 0x80 0xF8 (6.2 and higher)
             ULONGLONG OriginalBase;
             // 0x88 0x0100 (6.2 and higher)
-            union _LARGE_INTEGER LoadTime;
+            LARGE_INTEGER LoadTime;
         };
     };
 
     // 0x90 0x0108 (6.2 and higher)
     ULONG BaseNameHashValue;
     // 0x94 0x010C (6.2 and higher)
-    enum _LDR_DLL_LOAD_REASON LoadReason;
+    LDR_DLL_LOAD_REASON LoadReason;
     // 0x98 0x0110 (6.3 and higher)
     ULONG ImplicitPathOptions;
     // 0x9C 0x0114 (10.0 and higher)
@@ -187,7 +195,8 @@ typedef struct _LDR_DATA_TABLE_ENTRY
     // 0xA8 0x0120 (11 21H2 and higher)
     ULONG CheckSum;
     // 0xAC 0x0128 (11 21H2 and higher)
-    VOID *ActivePatchImageBase;
+    PVOID ActivePatchImageBase;
     // 0xB0 0x0130 (11 21H2 and higher)
-    enum _LDR_HOT_PATCH_STATE HotPatchState;
+    LDR_HOT_PATCH_STATE HotPatchState;
 } LDR_DATA_TABLE_ENTRY, *PLDR_DATA_TABLE_ENTRY;
+#endif
@@ -3,7 +3,9 @@
  * SPDX-License-Identifier: MIT
  */
 
-#pragma once
+#if !defined(_WIN_POLYFILL_PEB_H) || defined(WIN_POLYFILL_BASIC_PASS)
+#ifndef WIN_POLYFILL_BASIC_PASS
+#define _WIN_POLYFILL_PEB_H
 
 #include "ntpebteb.h"
 
@@ -11,6 +13,13 @@
 extern "C" {
 #endif
 
+// Pointer members that are not spelled with one of the pointer-width base
+// types go through WIN_POLYFILL_POINTER, so that win-polyfill-basic-pebteb.h can
+// re-include the structure with foreign-width pointers.
+#ifndef WIN_POLYFILL_POINTER
+#define WIN_POLYFILL_POINTER(Type) Type
+#endif
+
 typedef struct _PEB_LDR_DATA *PPEB_LDR_DATA;
 typedef struct _RTL_USER_PROCESS_PARAMETERS *PRTL_USER_PROCESS_PARAMETERS;
 
@@ -24,6 +33,8 @@ typedef struct _ACTIVATION_CONTEXT_DATA ACTIVATION_CONTEXT_DATA;
 typedef struct _ASSEMBLY_STORAGE_MAP ASSEMBLY_STORAGE_MAP;
 typedef struct _FLS_CALLBACK_INFO FLS_CALLBACK_INFO;
 typedef struct _LEAP_SECOND_DATA LEAP_SECOND_DATA;
+typedef VOID (*PPEB_POST_PROCESS_INIT_ROUTINE)(VOID);
+#endif // WIN_POLYFILL_BASIC_PASS
 
 // ==PEB==
 // https://www.geoffchappell.com/studies/windows/km/ntoskrnl/inc/api/pebteb/peb/index.htm
@@ -271,9 +282,9 @@ typedef struct _PEB
     // 0x08 0x10 (all)
     PVOID ImageBaseAddress;
     // 0x0C 0x18 (all)
-    PPEB_LDR_DATA Ldr;
+    WIN_POLYFILL_POINTER(PPEB_LDR_DATA) Ldr;
     // 0x10 0x20 (all)
-    PRTL_USER_PROCESS_PARAMETERS ProcessParameters;
+    WIN_POLYFILL_POINTER(PRTL_USER_PROCESS_PARAMETERS) ProcessParameters;
     // 0x14 0x28 (all)
     PVOID SubSystemData;
     // 0x18 0x30 (all)
@@ -305,7 +316,7 @@ typedef struct _PEB
         } nt_3_10_p1;
 #endif
         // 0x1C 0x38 (5.1 and higher)
-        PRTL_CRITICAL_SECTION FastPebLock;
+        WIN_POLYFILL_POINTER(PRTL_CRITICAL_SECTION) FastPebLock;
     };
     union
     {
@@ -511,7 +522,7 @@ typedef struct _PEB
     union
     {
         // 0x38 0x68 (3.10 to early 6.0)
-        PEB_FREE_BLOCK *FreeList;
+        WIN_POLYFILL_POINTER(PEB_FREE_BLOCK *) FreeList;
         // 0x38 0x68 (late 6.0 only)
         ULONG SparePebPtr0;
         // 0x38 0x68 (6.1 and higher)
@@ -553,7 +564,7 @@ typedef struct _PEB
         PVOID SharedData;
     };
     // 0x54 0x98 (all)
-    PVOID *ReadOnlyStaticServerData;
+    WIN_POLYFILL_POINTER(PVOID *) ReadOnlyStaticServerData;
     // 0x58 0xA0 (all)
     PVOID AnsiCodePageData;
     // 0x5C 0xA8 (all)
@@ -613,7 +624,7 @@ typedef struct _PEB
     ULONG NumberOfHeaps;
     ULONG MaximumNumberOfHeaps;
     // 0x90 0xF0 (3.51 and higher)
-    PVOID *ProcessHeaps;
+    WIN_POLYFILL_POINTER(PVOID *) ProcessHeaps;
 
     //
     //
@@ -637,7 +648,7 @@ typedef struct _PEB
             PVOID LoaderLock;
         } nt_4_0_p1;
 #endif
-        RTL_CRITICAL_SECTION *LoaderLock;
+        WIN_POLYFILL_POINTER(RTL_CRITICAL_SECTION *) LoaderLock;
     };
     ULONG OSMajorVersion;
     ULONG OSMinorVersion;
@@ -686,7 +697,7 @@ typedef struct _PEB
     // Appended for Windows 2000
     //
     // 0x014C 0x0230 (5.0 and higher)
-    VOID (*PostProcessInitRoutine)(VOID);
+    WIN_POLYFILL_POINTER(PPEB_POST_PROCESS_INIT_ROUTINE) PostProcessInitRoutine;
     // 0x0150 0x0238 (5.0 and higher)
     PVOID TlsExpansionBitmap;
     ULONG TlsExpansionBitmapBits[0x20];
@@ -738,10 +749,10 @@ typedef struct _PEB
     // Appended for Windows XP
     //
     // 0x01F8 0x02F8 (5.1 and higher)
-    ACTIVATION_CONTEXT_DATA const *ActivationContextData;
-    ASSEMBLY_STORAGE_MAP *ProcessAssemblyStorageMap;
-    ACTIVATION_CONTEXT_DATA const *SystemDefaultActivationContextData;
-    ASSEMBLY_STORAGE_MAP *SystemAssemblyStorageMap;
+    WIN_POLYFILL_POINTER(ACTIVATION_CONTEXT_DATA const *) ActivationContextData;
+    WIN_POLYFILL_POINTER(ASSEMBLY_STORAGE_MAP *) ProcessAssemblyStorageMap;
+    WIN_POLYFILL_POINTER(ACTIVATION_CONTEXT_DATA const *) SystemDefaultActivationContextData;
+    WIN_POLYFILL_POINTER(ASSEMBLY_STORAGE_MAP *) SystemAssemblyStorageMap;
     // 0x0208 0x0318 (5.1 and higher)
     ULONG_PTR MinimumStackCommit;
 
@@ -755,7 +766,7 @@ typedef struct _PEB
         struct
         {
             // 0x020C 0x0320 (5.2 to 1809)
-            FLS_CALLBACK_INFO *FlsCallback;
+            WIN_POLYFILL_POINTER(FLS_CALLBACK_INFO *) FlsCallback;
             // 0x0210 0x0328 (5.2 to 1809)
             LIST_ENTRY FlsListHead;
             // 0x0218 0x0338 (5.2 to 1809)
@@ -840,7 +851,7 @@ typedef struct _PEB
     // 0x0469 0x07B1 (1803 and higher)
     CHAR PlaceholderCompatibilityModeReserved[7];
     // 0x0470 0x07B8 (1809 and higher)
-    LEAP_SECOND_DATA *LeapSecondData;
+    WIN_POLYFILL_POINTER(LEAP_SECOND_DATA *) LeapSecondData;
     union
     {
         // 0x0474 0x07C0 (1809 and higher)
@@ -896,6 +907,9 @@ typedef struct _PEB
     ULONGLONG ExtendedFeatureDisableMask;
 } PEB, *PPEB;
 
+#ifndef WIN_POLYFILL_BASIC_PASS
 #ifdef __cplusplus
 }
 #endif
+#endif // WIN_POLYFILL_BASIC_PASS
+#endif
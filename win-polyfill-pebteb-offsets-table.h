@@ -0,0 +1,655 @@
+/* Auto generated by cmake/generate_pebteb_offsets.cmake, do not edit */
+
+#pragma once
+
+namespace phnt
+{
+
+enum class peb_field : USHORT
+{
+    InheritedAddressSpace,
+    ReadImageFileExecOptions,
+    BeingDebugged,
+    SpareBool,
+    BitField,
+    Padding0,
+    Mutant,
+    ImageBaseAddress,
+    Ldr,
+    ProcessParameters,
+    SubSystemData,
+    ProcessHeap,
+    FastPebLock,
+    FastPebLockRoutine,
+    SparePtr1,
+    AtlThunkSListPtr,
+    FastPebUnlockRoutine,
+    SparePtr2,
+    IFEOKey,
+    EnvironmentUpdateCount,
+    CrossProcessFlags,
+    Padding1,
+    KernelCallbackTable,
+    UserSharedInfoPtr,
+    EventLogSection,
+    SystemReserved0,
+    EventLog,
+    SystemReserved1,
+    SpareUlong,
+    AtlThunkSListPtr32,
+    FreeList,
+    SparePebPtr0,
+    ApiSetMap,
+    TlsExpansionCounter,
+    Padding2,
+    TlsBitmap,
+    TlsBitmapBits,
+    ReadOnlySharedMemoryBase,
+    ReadOnlySharedMemoryHeap,
+    HotpatchInformation,
+    SparePvoid0,
+    SharedData,
+    ReadOnlyStaticServerData,
+    AnsiCodePageData,
+    OemCodePageData,
+    UnicodeCaseTableData,
+    CriticalSectionTimeout,
+    NumberOfProcessors,
+    NtGlobalFlag,
+    HeapSegmentReserve,
+    ProcessHeaps,
+    GdiSharedHandleTable,
+    ProcessStarterHelper,
+    GdiHandleBuffer,
+    PostProcessInitRoutine,
+    TlsExpansionBitmap,
+    SessionId,
+    Padding5,
+    AppCompatInfo,
+    CSDVersion,
+    AppCompatFlags,
+    AppCompatFlagsUser,
+    pShimData,
+    ActivationContextData,
+    MinimumStackCommit,
+    FlsCallback,
+    FlsListHead,
+    FlsBitmap,
+    FlsBitmapBits,
+    FlsHighIndex,
+    SparePointers,
+    SpareUlongs,
+    WerRegistrationData,
+    WerShipAssertPtr,
+    pContextData,
+    pUnused,
+    pImageHeaderHash,
+    TracingFlags,
+    CsrServerReadOnlySharedMemoryBase,
+    TppWorkerpListLock,
+    TppWorkerpList,
+    WaitOnAddressHashTable,
+    TelemetryCoverageHeader,
+    CloudFileFlags,
+    CloudFileDiagFlags,
+    PlaceholderCompatibiltyMode,
+    PlaceholderCompatibilityModeReserved,
+    LeapSecondData,
+    LeapSecondFlags,
+    NtGlobalFlag2,
+    ExtendedFeatureDisableMask,
+    MaximumField
+};
+
+constexpr field_offset_range peb_field_offset_ranges[] = {
+    {build_key(0, 0), build_key_max, 0x00, 0x00}, // InheritedAddressSpace
+    {build_key(1057, 0), build_key_max, 0x01, 0x01}, // ReadImageFileExecOptions
+    {build_key(1057, 0), build_key_max, 0x02, 0x02}, // BeingDebugged
+    {build_key(1057, 0), build_key(3790, 1), 0x03, 0x03}, // SpareBool
+    {build_key(3790, 1), build_key_max, 0x03, 0x03}, // BitField
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x04}, // Padding0
+    {build_key(0, 0), build_key_max, 0x04, 0x08}, // Mutant
+    {build_key(0, 0), build_key_max, 0x08, 0x10}, // ImageBaseAddress
+    {build_key(0, 0), build_key_max, 0x0C, 0x18}, // Ldr
+    {build_key(0, 0), build_key_max, 0x10, 0x20}, // ProcessParameters
+    {build_key(0, 0), build_key_max, 0x14, 0x28}, // SubSystemData
+    {build_key(0, 0), build_key_max, 0x18, 0x30}, // ProcessHeap
+    {build_key(2600, 0), build_key_max, 0x1C, 0x38}, // FastPebLock
+    {build_key(511, 0), build_key(3790, 0), 0x20, field_offset_none}, // FastPebLockRoutine
+    {build_key(3790, 0), build_key(3790, 1), 0x20, field_offset_none}, // SparePtr1
+    {build_key(3790, 1), build_key_max, 0x20, 0x40}, // AtlThunkSListPtr
+    {build_key(511, 0), build_key(3790, 0), 0x24, field_offset_none}, // FastPebUnlockRoutine
+    {build_key(3790, 0), build_key(6000, 0), 0x24, 0x48}, // SparePtr2
+    {build_key(6000, 0), build_key_max, 0x24, 0x48}, // IFEOKey
+    {build_key(807, 0), build_key(6000, 0), 0x28, field_offset_none}, // EnvironmentUpdateCount
+    {build_key(6000, 0), build_key_max, 0x28, 0x50}, // CrossProcessFlags
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x54}, // Padding1
+    {build_key(1057, 0), build_key_max, 0x2C, 0x58}, // KernelCallbackTable
+    {build_key(6000, 0), build_key_max, 0x2C, 0x58}, // UserSharedInfoPtr
+    {build_key(807, 0), build_key(2195, 0), 0x30, field_offset_none}, // EventLogSection
+    {build_key(2195, 0), build_key_max, 0x30, 0x60}, // SystemReserved0
+    {build_key(807, 0), build_key(2195, 0), 0x34, field_offset_none}, // EventLog
+    {build_key(2195, 0), build_key(2600, 0), 0x34, field_offset_none}, // SystemReserved1
+    {build_key(3790, 1), build_key(7600, 0), 0x34, 0x64}, // SpareUlong
+    {build_key(2600, 2), build_key(3790, 0), 0x34, 0x64}, // AtlThunkSListPtr32
+    {build_key(7600, 0), build_key_max, 0x34, 0x64}, // AtlThunkSListPtr32
+    {build_key(511, 0), build_key(6001, 0), 0x38, 0x68}, // FreeList
+    {build_key(6001, 0), build_key(7600, 0), 0x38, 0x68}, // SparePebPtr0
+    {build_key(7600, 0), build_key_max, 0x38, 0x68}, // ApiSetMap
+    {build_key(0, 0), build_key_max, 0x3C, 0x70}, // TlsExpansionCounter
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x74}, // Padding2
+    {build_key(0, 0), build_key_max, 0x40, 0x78}, // TlsBitmap
+    {build_key(0, 0), build_key_max, 0x44, 0x80}, // TlsBitmapBits
+    {build_key(0, 0), build_key_max, 0x4C, 0x88}, // ReadOnlySharedMemoryBase
+    {build_key(511, 0), build_key(6000, 0), 0x50, 0x90}, // ReadOnlySharedMemoryHeap
+    {build_key(6000, 0), build_key(9600, 0), 0x50, 0x90}, // HotpatchInformation
+    {build_key(9600, 0), build_key(15063, 0), 0x50, 0x90}, // SparePvoid0
+    {build_key(15063, 0), build_key_max, 0x50, 0x90}, // SharedData
+    {build_key(0, 0), build_key_max, 0x54, 0x98}, // ReadOnlyStaticServerData
+    {build_key(0, 0), build_key_max, 0x58, 0xA0}, // AnsiCodePageData
+    {build_key(0, 0), build_key_max, 0x5C, 0xA8}, // OemCodePageData
+    {build_key(511, 0), build_key(1057, 0), 0x60, field_offset_none}, // UnicodeCaseTableData
+    {build_key(1057, 0), build_key_max, 0x60, 0xB0}, // UnicodeCaseTableData
+    {build_key(511, 0), build_key(1057, 0), 0x68, field_offset_none}, // CriticalSectionTimeout
+    {build_key(1057, 0), build_key_max, 0x70, 0xC0}, // CriticalSectionTimeout
+    {build_key(1057, 0), build_key_max, 0x64, 0xB8}, // NumberOfProcessors
+    {build_key(1057, 0), build_key_max, 0x68, 0xBC}, // NtGlobalFlag
+    {build_key(1057, 0), build_key_max, 0x78, 0xC8}, // HeapSegmentReserve
+    {build_key(1057, 0), build_key_max, 0x90, 0xF0}, // ProcessHeaps
+    {build_key(1381, 0), build_key_max, 0x94, 0xF8}, // GdiSharedHandleTable
+    {build_key(1381, 0), build_key_max, 0x98, 0x0100}, // ProcessStarterHelper
+    {build_key(0, 0), build_key(1381, 0), field_offset_none, 0x0140}, // GdiHandleBuffer
+    {build_key(1381, 0), build_key_max, 0xC4, 0x0140}, // GdiHandleBuffer
+    {build_key(2195, 0), build_key_max, 0x014C, 0x0230}, // PostProcessInitRoutine
+    {build_key(2195, 0), build_key_max, 0x0150, 0x0238}, // TlsExpansionBitmap
+    {build_key(2195, 0), build_key_max, 0x01D4, 0x02C0}, // SessionId
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x02C4}, // Padding5
+    {build_key(2195, 0), build_key(2600, 0), 0x01D8, field_offset_none}, // AppCompatInfo
+    {build_key(2600, 0), build_key_max, 0x01EC, 0x02E0}, // AppCompatInfo
+    {build_key(2195, 0), build_key(2600, 0), 0x01DC, field_offset_none}, // CSDVersion
+    {build_key(2600, 0), build_key_max, 0x01DC, 0x02E8}, // CSDVersion
+    {build_key(2600, 0), build_key_max, 0x01D8, 0x02C8}, // AppCompatFlags
+    {build_key(2600, 0), build_key_max, 0x01E0, 0x02D0}, // AppCompatFlagsUser
+    {build_key(2600, 0), build_key_max, 0x01E8, 0x02D8}, // pShimData
+    {build_key(2600, 0), build_key_max, 0x01F8, 0x02F8}, // ActivationContextData
+    {build_key(2600, 0), build_key_max, 0x0208, 0x0318}, // MinimumStackCommit
+    {build_key(3790, 0), build_key(18362, 0), 0x020C, 0x0320}, // FlsCallback
+    {build_key(3790, 0), build_key(18362, 0), 0x0210, 0x0328}, // FlsListHead
+    {build_key(3790, 0), build_key(18362, 0), 0x0218, 0x0338}, // FlsBitmap
+    {build_key(3790, 0), build_key(18362, 0), 0x021C, 0x0340}, // FlsBitmapBits
+    {build_key(3790, 0), build_key(18362, 0), 0x022C, 0x0350}, // FlsHighIndex
+    {build_key(18362, 0), build_key_max, 0x020C, 0x0320}, // SparePointers
+    {build_key(18362, 0), build_key_max, 0x021C, 0x0340}, // SpareUlongs
+    {build_key(6000, 0), build_key_max, 0x0230, 0x0358}, // WerRegistrationData
+    {build_key(6000, 0), build_key_max, 0x0234, 0x0360}, // WerShipAssertPtr
+    {build_key(7600, 0), build_key(9200, 0), 0x0238, 0x0368}, // pContextData
+    {build_key(9200, 0), build_key_max, 0x0238, 0x0368}, // pUnused
+    {build_key(7600, 0), build_key_max, 0x023C, 0x0370}, // pImageHeaderHash
+    {build_key(7600, 0), build_key_max, 0x0240, 0x0378}, // TracingFlags
+    {build_key(9200, 0), build_key_max, 0x0248, 0x0380}, // CsrServerReadOnlySharedMemoryBase
+    {build_key(10586, 0), build_key_max, 0x0250, 0x0388}, // TppWorkerpListLock
+    {build_key(10586, 0), build_key_max, 0x0254, 0x0390}, // TppWorkerpList
+    {build_key(10586, 0), build_key_max, 0x025C, 0x03A0}, // WaitOnAddressHashTable
+    {build_key(16299, 0), build_key_max, 0x045C, 0x07A0}, // TelemetryCoverageHeader
+    {build_key(16299, 0), build_key_max, 0x0460, 0x07A8}, // CloudFileFlags
+    {build_key(17134, 0), build_key_max, 0x0464, 0x07AC}, // CloudFileDiagFlags
+    {build_key(17134, 0), build_key_max, 0x0468, 0x07B0}, // PlaceholderCompatibiltyMode
+    {build_key(17134, 0), build_key_max, 0x0469, 0x07B1}, // PlaceholderCompatibilityModeReserved
+    {build_key(17763, 0), build_key_max, 0x0470, 0x07B8}, // LeapSecondData
+    {build_key(17763, 0), build_key_max, 0x0474, 0x07C0}, // LeapSecondFlags
+    {build_key(17763, 0), build_key_max, 0x0478, 0x07C4}, // NtGlobalFlag2
+    {build_key(26100, 0), build_key_max, 0x0480, 0x07C8}, // ExtendedFeatureDisableMask
+};
+
+constexpr field_offset_index peb_field_offset_indexes[] = {
+    {0, 1}, // InheritedAddressSpace
+    {1, 1}, // ReadImageFileExecOptions
+    {2, 1}, // BeingDebugged
+    {3, 1}, // SpareBool
+    {4, 1}, // BitField
+    {5, 1}, // Padding0
+    {6, 1}, // Mutant
+    {7, 1}, // ImageBaseAddress
+    {8, 1}, // Ldr
+    {9, 1}, // ProcessParameters
+    {10, 1}, // SubSystemData
+    {11, 1}, // ProcessHeap
+    {12, 1}, // FastPebLock
+    {13, 1}, // FastPebLockRoutine
+    {14, 1}, // SparePtr1
+    {15, 1}, // AtlThunkSListPtr
+    {16, 1}, // FastPebUnlockRoutine
+    {17, 1}, // SparePtr2
+    {18, 1}, // IFEOKey
+    {19, 1}, // EnvironmentUpdateCount
+    {20, 1}, // CrossProcessFlags
+    {21, 1}, // Padding1
+    {22, 1}, // KernelCallbackTable
+    {23, 1}, // UserSharedInfoPtr
+    {24, 1}, // EventLogSection
+    {25, 1}, // SystemReserved0
+    {26, 1}, // EventLog
+    {27, 1}, // SystemReserved1
+    {28, 1}, // SpareUlong
+    {29, 2}, // AtlThunkSListPtr32
+    {31, 1}, // FreeList
+    {32, 1}, // SparePebPtr0
+    {33, 1}, // ApiSetMap
+    {34, 1}, // TlsExpansionCounter
+    {35, 1}, // Padding2
+    {36, 1}, // TlsBitmap
+    {37, 1}, // TlsBitmapBits
+    {38, 1}, // ReadOnlySharedMemoryBase
+    {39, 1}, // ReadOnlySharedMemoryHeap
+    {40, 1}, // HotpatchInformation
+    {41, 1}, // SparePvoid0
+    {42, 1}, // SharedData
+    {43, 1}, // ReadOnlyStaticServerData
+    {44, 1}, // AnsiCodePageData
+    {45, 1}, // OemCodePageData
+    {46, 2}, // UnicodeCaseTableData
+    {48, 2}, // CriticalSectionTimeout
+    {50, 1}, // NumberOfProcessors
+    {51, 1}, // NtGlobalFlag
+    {52, 1}, // HeapSegmentReserve
+    {53, 1}, // ProcessHeaps
+    {54, 1}, // GdiSharedHandleTable
+    {55, 1}, // ProcessStarterHelper
+    {56, 2}, // GdiHandleBuffer
+    {58, 1}, // PostProcessInitRoutine
+    {59, 1}, // TlsExpansionBitmap
+    {60, 1}, // SessionId
+    {61, 1}, // Padding5
+    {62, 2}, // AppCompatInfo
+    {64, 2}, // CSDVersion
+    {66, 1}, // AppCompatFlags
+    {67, 1}, // AppCompatFlagsUser
+    {68, 1}, // pShimData
+    {69, 1}, // ActivationContextData
+    {70, 1}, // MinimumStackCommit
+    {71, 1}, // FlsCallback
+    {72, 1}, // FlsListHead
+    {73, 1}, // FlsBitmap
+    {74, 1}, // FlsBitmapBits
+    {75, 1}, // FlsHighIndex
+    {76, 1}, // SparePointers
+    {77, 1}, // SpareUlongs
+    {78, 1}, // WerRegistrationData
+    {79, 1}, // WerShipAssertPtr
+    {80, 1}, // pContextData
+    {81, 1}, // pUnused
+    {82, 1}, // pImageHeaderHash
+    {83, 1}, // TracingFlags
+    {84, 1}, // CsrServerReadOnlySharedMemoryBase
+    {85, 1}, // TppWorkerpListLock
+    {86, 1}, // TppWorkerpList
+    {87, 1}, // WaitOnAddressHashTable
+    {88, 1}, // TelemetryCoverageHeader
+    {89, 1}, // CloudFileFlags
+    {90, 1}, // CloudFileDiagFlags
+    {91, 1}, // PlaceholderCompatibiltyMode
+    {92, 1}, // PlaceholderCompatibilityModeReserved
+    {93, 1}, // LeapSecondData
+    {94, 1}, // LeapSecondFlags
+    {95, 1}, // NtGlobalFlag2
+    {96, 1}, // ExtendedFeatureDisableMask
+};
+
+enum class teb_field : USHORT
+{
+    NtTib,
+    EnvironmentPointer,
+    ClientId,
+    UnknownPointerCsrQlpcTeb,
+    ActiveRpcHandle,
+    ThreadLocalStoragePointer,
+    ProcessEnvironmentBlock,
+    LastErrorValue,
+    UnknowByte,
+    CountOfOwnedCriticalSections,
+    Win32ProcessInfo,
+    Win32ThreadInfo,
+    CsrQlpcStack,
+    SpareBytes,
+    CsrClientThread,
+    Win32ClientInfo,
+    User32Reserved,
+    UserReserved,
+    WOW32Reserved,
+    CurrentLocale,
+    FpSoftwareStatusRegister,
+    ReservedForDebuggerInstrumentation,
+    SystemReserved1,
+    PlaceholderCompatibilityMode,
+    PlaceholderHydrationAlwaysExplicit,
+    PlaceholderReserved,
+    ProxiedProcessId,
+    ActivationStack,
+    WorkingOnBehalfOfTicket,
+    Spare1,
+    ExceptionCode,
+    Padding0,
+    Spare2,
+    UnaccountedBytes_0x01B4,
+    DbgSsReserved,
+    SystemReserved2,
+    GdiClientPID,
+    GdiClientTID,
+    GdiThreadLocalInfo,
+    User32Reserved0,
+    User32Reserved1,
+    CsrQlpcTeb,
+    gdiRgn,
+    gdiPen,
+    gdiBrush,
+    RealClientId,
+    GdiCachedProcessHandle,
+    glDispatchTable,
+    SpareBytes1,
+    GdiTebBatch,
+    glReserved1,
+    glReserved2,
+    ActivationContextStackPointer,
+    InstrumentationCallbackSp,
+    InstrumentationCallbackPreviousPc,
+    InstrumentationCallbackPreviousSp,
+    TxFsContext,
+    InstrumentationCallbackDisabled,
+    UnalignedLoadStoreExceptions,
+    Padding1,
+    glSectionInfo,
+    glSection,
+    glTable,
+    glCurrentRC,
+    glContext,
+    LastStatusValue,
+    Padding2,
+    StaticUnicodeString,
+    StaticUnicodeBuffer,
+    Padding3,
+    DeallocationStack,
+    TlsSlots,
+    TlsLinks,
+    Vdm,
+    ReservedForNtRpc,
+    Padding4,
+    Instrumentation,
+    SubProcessTag,
+    EtwTraceData,
+    ActivityId,
+    WinSockData,
+    GdiBatchCount,
+    ReservedForOle,
+    WaitingOnLoaderLock,
+    Padding6,
+    TlsExpansionSlots,
+    IsImpersonating,
+    NlsCache,
+    pShimData,
+    HeapVirtualAffinity,
+    LowFragHeapDataSlot,
+    Padding7,
+    CurrentTransactionHandle,
+    ActiveFrame,
+    SafeThunkCall,
+    FlsData,
+    PreferredLanguages,
+    UserPrefLanguages,
+    LockCount,
+    LastSwitchTime,
+    TotalSwitchOutTime,
+    WaitReasonBitMap,
+    PaddingVista,
+    ResourceRetValue,
+    ReservedForWdf,
+    ReservedForCrt,
+    EffectiveContainerId,
+    LastSleepCounter,
+    MaximumField
+};
+
+constexpr field_offset_range teb_field_offset_ranges[] = {
+    {build_key(0, 0), build_key_max, 0x00, 0x00}, // NtTib
+    {build_key(0, 0), build_key_max, 0x1C, 0x38}, // EnvironmentPointer
+    {build_key(0, 0), build_key_max, 0x20, 0x40}, // ClientId
+    {build_key(511, 0), build_key(807, 0), 0x28, field_offset_none}, // UnknownPointerCsrQlpcTeb
+    {build_key(807, 0), build_key_max, 0x28, 0x50}, // ActiveRpcHandle
+    {build_key(0, 0), build_key_max, 0x2C, 0x58}, // ThreadLocalStoragePointer
+    {build_key(0, 0), build_key_max, 0x30, 0x60}, // ProcessEnvironmentBlock
+    {build_key(0, 0), build_key_max, 0x34, 0x68}, // LastErrorValue
+    {build_key(511, 0), build_key(807, 0), 0x38, field_offset_none}, // UnknowByte
+    {build_key(807, 0), build_key_max, 0x38, 0x6C}, // CountOfOwnedCriticalSections
+    {build_key(511, 0), build_key(807, 0), 0x01B0, field_offset_none}, // Win32ProcessInfo
+    {build_key(807, 0), build_key(1381, 0), 0x3C, field_offset_none}, // Win32ProcessInfo
+    {build_key(511, 0), build_key(807, 0), 0x01AC, field_offset_none}, // Win32ThreadInfo
+    {build_key(807, 0), build_key(1381, 0), 0x40, field_offset_none}, // Win32ThreadInfo
+    {build_key(1381, 0), build_key_max, 0x40, 0x78}, // Win32ThreadInfo
+    {build_key(511, 0), build_key(807, 0), 0x06F0, field_offset_none}, // CsrQlpcStack
+    {build_key(807, 0), build_key(1381, 0), 0x44, field_offset_none}, // CsrQlpcStack
+    {build_key(807, 0), build_key(1381, 0), 0x48, field_offset_none}, // SpareBytes
+    {build_key(10240, 0), build_key_max, 0x01B9, field_offset_none}, // SpareBytes
+    {build_key(1381, 0), build_key_max, 0x3C, 0x70}, // CsrClientThread
+    {build_key(807, 0), build_key(1381, 0), 0x01C0, field_offset_none}, // Win32ClientInfo
+    {build_key(1381, 0), build_key(2195, 0), 0x44, field_offset_none}, // Win32ClientInfo
+    {build_key(2195, 0), build_key_max, 0x06CC, 0x0800}, // Win32ClientInfo
+    {build_key(2195, 0), build_key_max, 0x44, 0x80}, // User32Reserved
+    {build_key(511, 0), build_key(1381, 0), 0x0708, field_offset_none}, // UserReserved
+    {build_key(1381, 0), build_key(2195, 0), 0x0700, field_offset_none}, // UserReserved
+    {build_key(2195, 0), build_key_max, 0xAC, 0xE8}, // UserReserved
+    {build_key(1381, 0), build_key_max, 0xC0, 0x0100}, // WOW32Reserved
+    {build_key(0, 0), build_key_max, 0xC4, 0x0108}, // CurrentLocale
+    {build_key(0, 0), build_key_max, 0xC8, 0x010C}, // FpSoftwareStatusRegister
+    {build_key(10240, 0), build_key_max, 0xCC, 0x0110}, // ReservedForDebuggerInstrumentation
+    {build_key(16299, 0), build_key_max, 0x010C, 0x0190}, // SystemReserved1
+    {build_key(16299, 0), build_key_max, 0x0174, 0x0280}, // PlaceholderCompatibilityMode
+    {build_key(17763, 0), build_key_max, 0x0175, 0x0281}, // PlaceholderHydrationAlwaysExplicit
+    {build_key(17763, 0), build_key_max, 0x0176, 0x0282}, // PlaceholderReserved
+    {build_key(16299, 0), build_key_max, 0x0180, 0x028C}, // ProxiedProcessId
+    {build_key(15063, 0), build_key_max, 0x0184, 0x0290}, // ActivationStack
+    {build_key(14393, 0), build_key_max, 0x019C, 0x02B8}, // WorkingOnBehalfOfTicket
+    {build_key(511, 0), build_key(2195, 0), 0x01A4, field_offset_none}, // Spare1
+    {build_key(1381, 0), build_key(2195, 0), 0x01A8, field_offset_none}, // ExceptionCode
+    {build_key(2195, 0), build_key_max, 0x01A4, 0x02C0}, // ExceptionCode
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x02C4}, // Padding0
+    {build_key(511, 0), build_key(1381, 0), 0x01A8, field_offset_none}, // Spare2
+    {build_key(511, 0), build_key(807, 0), 0x01B4, field_offset_none}, // UnaccountedBytes_0x01B4
+    {build_key(511, 0), build_key(807, 0), 0x01DC, field_offset_none}, // DbgSsReserved
+    {build_key(807, 0), build_key_max, 0x0F20, 0x16A0}, // DbgSsReserved
+    {build_key(511, 0), build_key(807, 0), 0x01E4, field_offset_none}, // SystemReserved2
+    {build_key(807, 0), build_key(2195, 0), 0x01D4, field_offset_none}, // SystemReserved2
+    {build_key(511, 0), build_key(2195, 0), 0x06F4, field_offset_none}, // GdiClientPID
+    {build_key(2195, 0), build_key_max, 0x06C0, 0x07F0}, // GdiClientPID
+    {build_key(511, 0), build_key(2195, 0), 0x06F8, field_offset_none}, // GdiClientTID
+    {build_key(2195, 0), build_key_max, 0x06C4, 0x07F4}, // GdiClientTID
+    {build_key(511, 0), build_key(2195, 0), 0x06FC, field_offset_none}, // GdiThreadLocalInfo
+    {build_key(2195, 0), build_key_max, 0x06C8, 0x07F8}, // GdiThreadLocalInfo
+    {build_key(511, 0), build_key(1381, 0), 0x0700, field_offset_none}, // User32Reserved0
+    {build_key(511, 0), build_key(1381, 0), 0x0704, field_offset_none}, // User32Reserved1
+    {build_key(807, 0), build_key(1381, 0), 0x01AC, field_offset_none}, // CsrQlpcTeb
+    {build_key(807, 0), build_key(2195, 0), 0x06DC, field_offset_none}, // gdiRgn
+    {build_key(807, 0), build_key(2195, 0), 0x06E0, field_offset_none}, // gdiPen
+    {build_key(807, 0), build_key(2195, 0), 0x06E4, field_offset_none}, // gdiBrush
+    {build_key(807, 0), build_key(2195, 0), 0x06E8, field_offset_none}, // RealClientId
+    {build_key(2195, 0), build_key_max, 0x06B4, 0x07D8}, // RealClientId
+    {build_key(807, 0), build_key(2195, 0), 0x06F0, field_offset_none}, // GdiCachedProcessHandle
+    {build_key(2195, 0), build_key_max, 0x06BC, 0x07E8}, // GdiCachedProcessHandle
+    {build_key(807, 0), build_key(2195, 0), 0x0714, field_offset_none}, // glDispatchTable
+    {build_key(2195, 0), build_key_max, 0x07C4, 0x09F0}, // glDispatchTable
+    {build_key(1381, 0), build_key(2195, 0), 0x01AC, field_offset_none}, // SpareBytes1
+    {build_key(1381, 0), build_key(2195, 0), 0x01FC, field_offset_none}, // GdiTebBatch
+    {build_key(2195, 0), build_key_max, 0x01D4, 0x02F0}, // GdiTebBatch
+    {build_key(1381, 0), build_key(2195, 0), 0x0B74, field_offset_none}, // glReserved1
+    {build_key(2195, 0), build_key_max, 0x0B68, 0x1138}, // glReserved1
+    {build_key(1381, 0), build_key(2195, 0), 0x0BDC, field_offset_none}, // glReserved2
+    {build_key(2195, 0), build_key_max, 0x0BDC, 0x1220}, // glReserved2
+    {build_key(3790, 1), build_key_max, 0x01A8, 0x02C8}, // ActivationContextStackPointer
+    {build_key(10240, 0), build_key_max, 0x01AC, 0x02D0}, // InstrumentationCallbackSp
+    {build_key(10240, 0), build_key_max, 0x01B0, 0x02D8}, // InstrumentationCallbackPreviousPc
+    {build_key(10240, 0), build_key_max, 0x01B4, 0x02E0}, // InstrumentationCallbackPreviousSp
+    {build_key(6000, 0), build_key_max, 0x01D0, 0x02E8}, // TxFsContext
+    {build_key(10240, 0), build_key_max, 0x01B8, 0x02EC}, // InstrumentationCallbackDisabled
+    {build_key(17763, 0), build_key_max, field_offset_none, 0x02ED}, // UnalignedLoadStoreExceptions
+    {build_key(17763, 0), build_key_max, field_offset_none, 0x02EE}, // Padding1
+    {build_key(807, 0), build_key_max, 0x0BE0, 0x1228}, // glSectionInfo
+    {build_key(807, 0), build_key_max, 0x0BE4, 0x1230}, // glSection
+    {build_key(807, 0), build_key_max, 0x0BE8, 0x1238}, // glTable
+    {build_key(807, 0), build_key_max, 0x0BEC, 0x1240}, // glCurrentRC
+    {build_key(807, 0), build_key_max, 0x0BF0, 0x1248}, // glContext
+    {build_key(0, 0), build_key_max, 0x0BF4, 0x1250}, // LastStatusValue
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x1254}, // Padding2
+    {build_key(0, 0), build_key_max, 0x0BF8, 0x1258}, // StaticUnicodeString
+    {build_key(0, 0), build_key_max, 0x0C00, 0x1268}, // StaticUnicodeBuffer
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x1472}, // Padding3
+    {build_key(0, 0), build_key_max, 0x0E0C, 0x1478}, // DeallocationStack
+    {build_key(0, 0), build_key_max, 0x0E10, 0x1480}, // TlsSlots
+    {build_key(0, 0), build_key_max, 0x0F10, 0x1680}, // TlsLinks
+    {build_key(0, 0), build_key_max, 0x0F18, 0x1690}, // Vdm
+    {build_key(0, 0), build_key_max, 0x0F1C, 0x1698}, // ReservedForNtRpc
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x16B4}, // Padding4
+    {build_key(3790, 1), build_key_max, 0x0F2C, 0x16B8}, // Instrumentation
+    {build_key(3790, 1), build_key(6000, 0), 0x0F64, 0x1728}, // SubProcessTag
+    {build_key(6000, 0), build_key_max, 0x0F60, 0x1720}, // SubProcessTag
+    {build_key(3790, 1), build_key_max, 0x0F68, 0x1730}, // EtwTraceData
+    {build_key(6000, 0), build_key_max, 0x0F50, 0x1710}, // ActivityId
+    {build_key(1381, 0), build_key_max, 0x0F6C, 0x1738}, // WinSockData
+    {build_key(1381, 0), build_key_max, 0x0F70, 0x1740}, // GdiBatchCount
+    {build_key(1381, 0), build_key_max, 0x0F80, 0x1758}, // ReservedForOle
+    {build_key(1381, 0), build_key_max, 0x0F84, 0x1760}, // WaitingOnLoaderLock
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x1764}, // Padding6
+    {build_key(2195, 0), build_key_max, 0x0F94, 0x1780}, // TlsExpansionSlots
+    {build_key(2195, 0), build_key_max, 0x0F9C, 0x179C}, // IsImpersonating
+    {build_key(2195, 0), build_key_max, 0x0FA0, 0x17A0}, // NlsCache
+    {build_key(2600, 0), build_key_max, 0x0FA4, 0x17A8}, // pShimData
+    {build_key(9200, 0), build_key(17763, 0), 0x0FA8, 0x17B0}, // HeapVirtualAffinity
+    {build_key(9200, 0), build_key(17763, 0), 0x0FAA, 0x17B2}, // LowFragHeapDataSlot
+    {build_key(9600, 0), build_key_max, field_offset_none, 0x17B4}, // Padding7
+    {build_key(2600, 0), build_key_max, 0x0FAC, 0x17B8}, // CurrentTransactionHandle
+    {build_key(2600, 0), build_key_max, 0x0FB0, 0x17C0}, // ActiveFrame
+    {build_key(2600, 2), build_key(3790, 0), 0x0FB4, field_offset_none}, // SafeThunkCall
+    {build_key(3790, 0), build_key_max, 0x0FB4, 0x17C8}, // FlsData
+    {build_key(6000, 0), build_key_max, 0x0FB8, 0x17D0}, // PreferredLanguages
+    {build_key(6000, 0), build_key_max, 0x0FBC, 0x17D8}, // UserPrefLanguages
+    {build_key(6000, 0), build_key_max, 0x0FD8, 0x1808}, // LockCount
+    {build_key(6000, 0), build_key(7600, 0), 0x0FE0, 0x1810}, // LastSwitchTime
+    {build_key(6000, 0), build_key(7600, 0), 0x0FE8, 0x1818}, // TotalSwitchOutTime
+    {build_key(6000, 0), build_key(7600, 0), 0x0FF0, 0x1820}, // WaitReasonBitMap
+    {build_key(6000, 0), build_key(7600, 0), 0x0FF8, 0x1828}, // PaddingVista
+    {build_key(7600, 0), build_key_max, 0x0FE0, 0x1810}, // ResourceRetValue
+    {build_key(9200, 0), build_key_max, 0x0FE4, 0x1818}, // ReservedForWdf
+    {build_key(10240, 0), build_key_max, 0x0FE8, 0x1820}, // ReservedForCrt
+    {build_key(10240, 0), build_key_max, 0x0FF0, 0x1828}, // EffectiveContainerId
+    {build_key(22000, 0), build_key_max, 0x1000, 0x1838}, // LastSleepCounter
+};
+
+constexpr field_offset_index teb_field_offset_indexes[] = {
+    {0, 1}, // NtTib
+    {1, 1}, // EnvironmentPointer
+    {2, 1}, // ClientId
+    {3, 1}, // UnknownPointerCsrQlpcTeb
+    {4, 1}, // ActiveRpcHandle
+    {5, 1}, // ThreadLocalStoragePointer
+    {6, 1}, // ProcessEnvironmentBlock
+    {7, 1}, // LastErrorValue
+    {8, 1}, // UnknowByte
+    {9, 1}, // CountOfOwnedCriticalSections
+    {10, 2}, // Win32ProcessInfo
+    {12, 3}, // Win32ThreadInfo
+    {15, 2}, // CsrQlpcStack
+    {17, 2}, // SpareBytes
+    {19, 1}, // CsrClientThread
+    {20, 3}, // Win32ClientInfo
+    {23, 1}, // User32Reserved
+    {24, 3}, // UserReserved
+    {27, 1}, // WOW32Reserved
+    {28, 1}, // CurrentLocale
+    {29, 1}, // FpSoftwareStatusRegister
+    {30, 1}, // ReservedForDebuggerInstrumentation
+    {31, 1}, // SystemReserved1
+    {32, 1}, // PlaceholderCompatibilityMode
+    {33, 1}, // PlaceholderHydrationAlwaysExplicit
+    {34, 1}, // PlaceholderReserved
+    {35, 1}, // ProxiedProcessId
+    {36, 1}, // ActivationStack
+    {37, 1}, // WorkingOnBehalfOfTicket
+    {38, 1}, // Spare1
+    {39, 2}, // ExceptionCode
+    {41, 1}, // Padding0
+    {42, 1}, // Spare2
+    {43, 1}, // UnaccountedBytes_0x01B4
+    {44, 2}, // DbgSsReserved
+    {46, 2}, // SystemReserved2
+    {48, 2}, // GdiClientPID
+    {50, 2}, // GdiClientTID
+    {52, 2}, // GdiThreadLocalInfo
+    {54, 1}, // User32Reserved0
+    {55, 1}, // User32Reserved1
+    {56, 1}, // CsrQlpcTeb
+    {57, 1}, // gdiRgn
+    {58, 1}, // gdiPen
+    {59, 1}, // gdiBrush
+    {60, 2}, // RealClientId
+    {62, 2}, // GdiCachedProcessHandle
+    {64, 2}, // glDispatchTable
+    {66, 1}, // SpareBytes1
+    {67, 2}, // GdiTebBatch
+    {69, 2}, // glReserved1
+    {71, 2}, // glReserved2
+    {73, 1}, // ActivationContextStackPointer
+    {74, 1}, // InstrumentationCallbackSp
+    {75, 1}, // InstrumentationCallbackPreviousPc
+    {76, 1}, // InstrumentationCallbackPreviousSp
+    {77, 1}, // TxFsContext
+    {78, 1}, // InstrumentationCallbackDisabled
+    {79, 1}, // UnalignedLoadStoreExceptions
+    {80, 1}, // Padding1
+    {81, 1}, // glSectionInfo
+    {82, 1}, // glSection
+    {83, 1}, // glTable
+    {84, 1}, // glCurrentRC
+    {85, 1}, // glContext
+    {86, 1}, // LastStatusValue
+    {87, 1}, // Padding2
+    {88, 1}, // StaticUnicodeString
+    {89, 1}, // StaticUnicodeBuffer
+    {90, 1}, // Padding3
+    {91, 1}, // DeallocationStack
+    {92, 1}, // TlsSlots
+    {93, 1}, // TlsLinks
+    {94, 1}, // Vdm
+    {95, 1}, // ReservedForNtRpc
+    {96, 1}, // Padding4
+    {97, 1}, // Instrumentation
+    {98, 2}, // SubProcessTag
+    {100, 1}, // EtwTraceData
+    {101, 1}, // ActivityId
+    {102, 1}, // WinSockData
+    {103, 1}, // GdiBatchCount
+    {104, 1}, // ReservedForOle
+    {105, 1}, // WaitingOnLoaderLock
+    {106, 1}, // Padding6
+    {107, 1}, // TlsExpansionSlots
+    {108, 1}, // IsImpersonating
+    {109, 1}, // NlsCache
+    {110, 1}, // pShimData
+    {111, 1}, // HeapVirtualAffinity
+    {112, 1}, // LowFragHeapDataSlot
+    {113, 1}, // Padding7
+    {114, 1}, // CurrentTransactionHandle
+    {115, 1}, // ActiveFrame
+    {116, 1}, // SafeThunkCall
+    {117, 1}, // FlsData
+    {118, 1}, // PreferredLanguages
+    {119, 1}, // UserPrefLanguages
+    {120, 1}, // LockCount
+    {121, 1}, // LastSwitchTime
+    {122, 1}, // TotalSwitchOutTime
+    {123, 1}, // WaitReasonBitMap
+    {124, 1}, // PaddingVista
+    {125, 1}, // ResourceRetValue
+    {126, 1}, // ReservedForWdf
+    {127, 1}, // ReservedForCrt
+    {128, 1}, // EffectiveContainerId
+    {129, 1}, // LastSleepCounter
+};
+
+} // namespace phnt
@@ -0,0 +1,141 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==PEB/TEB field offsets by build==
+//
+// field_offset<Ptr>(build, field) is the offset of a PEB or TEB member in the given
+// Windows build, for the x86 (Ptr32) or x64 (Ptr64) layout, or -1 if the member is
+// not there. It lets a reader of another process fetch just the members it needs
+// from a target of any build instead of the whole structure.
+//
+// The table in win-polyfill-pebteb-offsets-table.h is generated from the offset
+// comments in win-polyfill-peb.h and win-polyfill-teb.h by
+// cmake/generate_pebteb_offsets.cmake (build the win-polyfill-pebteb-offsets
+// target after changing them). Members are found by an index into the table,
+// and each member has no more than a handful of version ranges to check.
+//
+// Versions that only differ by service pack (early and late 5.1, 5.2) are told
+// apart by the service pack argument, which is the major version of the CSD.
+
+#ifndef __cplusplus
+#error "win-polyfill-pebteb-offsets.h requires C++"
+#endif
+
+#include "win-polyfill-basic-pebteb.h"
+
+namespace phnt
+{
+
+    constexpr ULONG build_key(ULONG build, ULONG service_pack)
+    {
+        return (build << 4) | (service_pack > 15 ? 15 : service_pack);
+    }
+
+    constexpr ULONG build_key_max = 0xFFFFFFFF;
+    constexpr USHORT field_offset_none = 0xFFFF;
+
+    // [First, End) in build_key order
+    struct field_offset_range
+    {
+        ULONG First;
+        ULONG End;
+        USHORT X86;
+        USHORT X64;
+    };
+
+    struct field_offset_index
+    {
+        USHORT First;
+        USHORT Count;
+    };
+
+} // namespace phnt
+
+#include "win-polyfill-pebteb-offsets-table.h"
+
+namespace phnt
+{
+
+    template <class Ptr>
+    constexpr LONG field_offset_lookup(
+        const field_offset_range *ranges,
+        field_offset_index index,
+        ULONG key)
+    {
+        for (USHORT i = index.First; i < index.First + index.Count; ++i)
+        {
+            if (ranges[i].First <= key && key < ranges[i].End)
+            {
+                USHORT offset =
+                    sizeof(typename Ptr::type) == 8 ? ranges[i].X64 : ranges[i].X86;
+                return offset == field_offset_none ? -1 : offset;
+            }
+        }
+        return -1;
+    }
+
+    template <class Ptr>
+    constexpr LONG field_offset(ULONG build, peb_field field, ULONG service_pack = 15)
+    {
+        return field_offset_lookup<Ptr>(
+            peb_field_offset_ranges,
+            peb_field_offset_indexes[(USHORT)field],
+            build_key(build, service_pack));
+    }
+
+    template <class Ptr>
+    constexpr LONG field_offset(ULONG build, teb_field field, ULONG service_pack = 15)
+    {
+        return field_offset_lookup<Ptr>(
+            teb_field_offset_ranges,
+            teb_field_offset_indexes[(USHORT)field],
+            build_key(build, service_pack));
+    }
+
+    C_ASSERT(RTL_NUMBER_OF(peb_field_offset_indexes) == (USHORT)peb_field::MaximumField);
+    C_ASSERT(RTL_NUMBER_OF(teb_field_offset_indexes) == (USHORT)teb_field::MaximumField);
+
+    // The latest build agrees with the structure definitions.
+    C_ASSERT(field_offset<Ptr32>(26100, peb_field::Ldr) == FIELD_OFFSET(ptr32::PEB, Ldr));
+    C_ASSERT(field_offset<Ptr64>(26100, peb_field::Ldr) == FIELD_OFFSET(ptr64::PEB, Ldr));
+    C_ASSERT(
+        field_offset<Ptr32>(26100, peb_field::SessionId) ==
+        FIELD_OFFSET(ptr32::PEB, SessionId));
+    C_ASSERT(
+        field_offset<Ptr64>(26100, peb_field::SessionId) ==
+        FIELD_OFFSET(ptr64::PEB, SessionId));
+    C_ASSERT(
+        field_offset<Ptr32>(26100, teb_field::ProcessEnvironmentBlock) ==
+        FIELD_OFFSET(ptr32::TEB, ProcessEnvironmentBlock));
+    C_ASSERT(
+        field_offset<Ptr64>(26100, teb_field::ProcessEnvironmentBlock) ==
+        FIELD_OFFSET(ptr64::TEB, ProcessEnvironmentBlock));
+    C_ASSERT(
+        field_offset<Ptr32>(26100, teb_field::TlsSlots) ==
+        FIELD_OFFSET(ptr32::TEB, TlsSlots));
+    C_ASSERT(
+        field_offset<Ptr64>(26100, teb_field::TlsSlots) ==
+        FIELD_OFFSET(ptr64::TEB, TlsSlots));
+
+    // Members that came and went, and the early/late service pack split.
+    C_ASSERT(field_offset<Ptr32>(2600, peb_field::FastPebLockRoutine) == 0x20);
+    C_ASSERT(field_offset<Ptr32>(7600, peb_field::FastPebLockRoutine) == -1);
+    C_ASSERT(field_offset<Ptr64>(3790, peb_field::FastPebLockRoutine) == -1);
+    C_ASSERT(field_offset<Ptr32>(2600, peb_field::AtlThunkSListPtr32, 1) == -1);
+    C_ASSERT(field_offset<Ptr32>(2600, peb_field::AtlThunkSListPtr32, 2) == 0x34);
+
+    // Members of a union or #ifdef branch that only exists for some versions or one
+    // architecture.
+    C_ASSERT(field_offset<Ptr32>(511, peb_field::UnicodeCaseTableData) == 0x60);
+    C_ASSERT(field_offset<Ptr64>(511, peb_field::UnicodeCaseTableData) == -1);
+    C_ASSERT(field_offset<Ptr32>(511, peb_field::CriticalSectionTimeout) == 0x68);
+    C_ASSERT(field_offset<Ptr32>(1057, peb_field::CriticalSectionTimeout) == 0x70);
+    C_ASSERT(field_offset<Ptr32>(1057, peb_field::GdiHandleBuffer) == -1);
+    C_ASSERT(field_offset<Ptr32>(1381, peb_field::GdiHandleBuffer) == 0xC4);
+    C_ASSERT(field_offset<Ptr64>(3790, peb_field::GdiHandleBuffer) == 0x140);
+
+} // namespace phnt
@@ -0,0 +1,5717 @@
+/* Auto generated by cmake/generate_reflection_table.cmake, do not edit */
+
+// No include guard, included by win-polyfill-reflection.h once per pass.
+
+// phnt_ntdef.h
+#ifdef _PHNT_NTDEF_H
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+#ifdef _NTDEF_
+PHNT_REFLECT_BEGIN(QUAD)
+    PHNT_REFLECT_FIELD(UseThisFieldToCopy, "__int64")
+    PHNT_REFLECT_FIELD(DoNotUseThisField, "double")
+PHNT_REFLECT_END(QUAD)
+PHNT_REFLECT_BEGIN(QUAD_PTR)
+    PHNT_REFLECT_FIELD(DoNotUseThisField1, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DoNotUseThisField2, "ULONG_PTR")
+PHNT_REFLECT_END(QUAD_PTR)
+PHNT_REFLECT_BEGIN(LARGE_INTEGER_128)
+    PHNT_REFLECT_FIELD(QuadPart, "LONGLONG")
+PHNT_REFLECT_END(LARGE_INTEGER_128)
+PHNT_REFLECT_BEGIN(STRING)
+    PHNT_REFLECT_FIELD(Length, "USHORT")
+    PHNT_REFLECT_FIELD(MaximumLength, "USHORT")
+    PHNT_REFLECT_FIELD(Buffer, "PCHAR")
+PHNT_REFLECT_END(STRING)
+PHNT_REFLECT_BEGIN(UNICODE_STRING)
+    PHNT_REFLECT_FIELD(Length, "USHORT")
+    PHNT_REFLECT_FIELD(MaximumLength, "USHORT")
+    PHNT_REFLECT_FIELD(Buffer, "PWCH")
+PHNT_REFLECT_END(UNICODE_STRING)
+PHNT_REFLECT_BEGIN(RTL_BALANCED_NODE)
+    PHNT_REFLECT_FIELD(Children, "struct _RTL_BALANCED_NODE*")
+    PHNT_REFLECT_FIELD(Left, "struct _RTL_BALANCED_NODE*")
+    PHNT_REFLECT_FIELD(Right, "struct _RTL_BALANCED_NODE*")
+    PHNT_REFLECT_BITFIELD(Red, "UCHAR")
+    PHNT_REFLECT_BITFIELD(Balance, "UCHAR")
+    PHNT_REFLECT_FIELD(ParentValue, "ULONG_PTR")
+PHNT_REFLECT_END(RTL_BALANCED_NODE)
+PHNT_REFLECT_BEGIN(SINGLE_LIST_ENTRY32)
+    PHNT_REFLECT_FIELD(Next, "ULONG")
+PHNT_REFLECT_END(SINGLE_LIST_ENTRY32)
+PHNT_REFLECT_BEGIN(STRING32)
+    PHNT_REFLECT_FIELD(Length, "USHORT")
+    PHNT_REFLECT_FIELD(MaximumLength, "USHORT")
+    PHNT_REFLECT_FIELD(Buffer, "ULONG")
+PHNT_REFLECT_END(STRING32)
+PHNT_REFLECT_BEGIN(STRING64)
+    PHNT_REFLECT_FIELD(Length, "USHORT")
+    PHNT_REFLECT_FIELD(MaximumLength, "USHORT")
+    PHNT_REFLECT_FIELD(Buffer, "ULONGLONG")
+PHNT_REFLECT_END(STRING64)
+PHNT_REFLECT_BEGIN(OBJECT_ATTRIBUTES)
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(RootDirectory, "HANDLE")
+    PHNT_REFLECT_FIELD(ObjectName, "PUNICODE_STRING")
+    PHNT_REFLECT_FIELD(Attributes, "ULONG")
+    PHNT_REFLECT_FIELD(SecurityDescriptor, "PVOID")
+    PHNT_REFLECT_FIELD(SecurityQualityOfService, "PVOID")
+PHNT_REFLECT_END(OBJECT_ATTRIBUTES)
+PHNT_REFLECT_BEGIN(OBJECT_ATTRIBUTES64)
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(RootDirectory, "ULONG64")
+    PHNT_REFLECT_FIELD(ObjectName, "ULONG64")
+    PHNT_REFLECT_FIELD(Attributes, "ULONG")
+    PHNT_REFLECT_FIELD(SecurityDescriptor, "ULONG64")
+    PHNT_REFLECT_FIELD(SecurityQualityOfService, "ULONG64")
+PHNT_REFLECT_END(OBJECT_ATTRIBUTES64)
+PHNT_REFLECT_BEGIN(OBJECT_ATTRIBUTES32)
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(RootDirectory, "ULONG")
+    PHNT_REFLECT_FIELD(ObjectName, "ULONG")
+    PHNT_REFLECT_FIELD(Attributes, "ULONG")
+    PHNT_REFLECT_FIELD(SecurityDescriptor, "ULONG")
+    PHNT_REFLECT_FIELD(SecurityQualityOfService, "ULONG")
+PHNT_REFLECT_END(OBJECT_ATTRIBUTES32)
+PHNT_REFLECT_BEGIN(CLIENT_ID)
+    PHNT_REFLECT_FIELD(UniqueProcess, "HANDLE")
+    PHNT_REFLECT_FIELD(UniqueThread, "HANDLE")
+PHNT_REFLECT_END(CLIENT_ID)
+PHNT_REFLECT_BEGIN(CLIENT_ID32)
+    PHNT_REFLECT_FIELD(UniqueProcess, "ULONG")
+    PHNT_REFLECT_FIELD(UniqueThread, "ULONG")
+PHNT_REFLECT_END(CLIENT_ID32)
+PHNT_REFLECT_BEGIN(CLIENT_ID64)
+    PHNT_REFLECT_FIELD(UniqueProcess, "ULONGLONG")
+    PHNT_REFLECT_FIELD(UniqueThread, "ULONGLONG")
+PHNT_REFLECT_END(CLIENT_ID64)
+PHNT_REFLECT_BEGIN(KSYSTEM_TIME)
+    PHNT_REFLECT_FIELD(LowPart, "ULONG")
+    PHNT_REFLECT_FIELD(High1Time, "LONG")
+    PHNT_REFLECT_FIELD(High2Time, "LONG")
+PHNT_REFLECT_END(KSYSTEM_TIME)
+#endif
+#endif
+#endif
+
+// ntldr.h
+#ifdef _NTLDR_H
+PHNT_REFLECT_BEGIN(LDR_SERVICE_TAG_RECORD)
+    PHNT_REFLECT_FIELD(Next, "struct _LDR_SERVICE_TAG_RECORD*")
+    PHNT_REFLECT_FIELD(ServiceTag, "ULONG")
+PHNT_REFLECT_END(LDR_SERVICE_TAG_RECORD)
+PHNT_REFLECT_BEGIN(LDRP_CSLIST)
+    PHNT_REFLECT_FIELD(Tail, "PSINGLE_LIST_ENTRY")
+PHNT_REFLECT_END(LDRP_CSLIST)
+PHNT_REFLECT_BEGIN(LDRP_CSLIST_DEPENDENT)
+    PHNT_REFLECT_FIELD(NextDependentEntry, "PSINGLE_LIST_ENTRY")
+    PHNT_REFLECT_FIELD(DependentDdagNode, "struct _LDR_DDAG_NODE*")
+PHNT_REFLECT_END(LDRP_CSLIST_DEPENDENT)
+PHNT_REFLECT_BEGIN(LDRP_CSLIST_INCOMMING)
+    PHNT_REFLECT_FIELD(NextIncommingEntry, "PSINGLE_LIST_ENTRY")
+    PHNT_REFLECT_FIELD(IncommingDdagNode, "struct _LDR_DDAG_NODE*")
+PHNT_REFLECT_END(LDRP_CSLIST_INCOMMING)
+PHNT_REFLECT_BEGIN(LDR_DDAG_NODE)
+    PHNT_REFLECT_FIELD(Modules, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(ServiceTagList, "PLDR_SERVICE_TAG_RECORD")
+    PHNT_REFLECT_FIELD(LoadCount, "ULONG")
+    PHNT_REFLECT_FIELD(ReferenceCount, "ULONG")
+    PHNT_REFLECT_FIELD(LoadWhileUnloadingCount, "ULONG")
+    PHNT_REFLECT_FIELD(DependencyCount, "ULONG")
+    PHNT_REFLECT_FIELD(LowestLink, "ULONG")
+    PHNT_REFLECT_FIELD(Dependencies, "PLDRP_CSLIST_DEPENDENT")
+    PHNT_REFLECT_FIELD(RemovalLink, "SINGLE_LIST_ENTRY")
+    PHNT_REFLECT_FIELD(IncomingDependencies, "PLDRP_CSLIST_INCOMMING")
+    PHNT_REFLECT_FIELD(State, "LDR_DDAG_STATE")
+    PHNT_REFLECT_FIELD(CondenseLink, "SINGLE_LIST_ENTRY")
+    PHNT_REFLECT_FIELD(PreorderNumber, "ULONG")
+PHNT_REFLECT_END(LDR_DDAG_NODE)
+PHNT_REFLECT_BEGIN(LDR_DEPENDENCY_RECORD)
+    PHNT_REFLECT_FIELD(DependencyLink, "SINGLE_LIST_ENTRY")
+    PHNT_REFLECT_FIELD(DependencyNode, "PLDR_DDAG_NODE")
+    PHNT_REFLECT_FIELD(IncomingDependencyLink, "SINGLE_LIST_ENTRY")
+    PHNT_REFLECT_FIELD(IncomingDependencyNode, "PLDR_DDAG_NODE")
+PHNT_REFLECT_END(LDR_DEPENDENCY_RECORD)
+#if 1
+#else
+PHNT_REFLECT_BEGIN(LDR_DATA_TABLE_ENTRY)
+    PHNT_REFLECT_FIELD(InLoadOrderLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(InMemoryOrderLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(InInitializationOrderLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(DllBase, "PVOID")
+    PHNT_REFLECT_FIELD(EntryPoint, "PLDR_INIT_ROUTINE")
+    PHNT_REFLECT_FIELD(SizeOfImage, "ULONG")
+    PHNT_REFLECT_FIELD(FullDllName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(BaseDllName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(FlagGroup, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_BITFIELD(PackagedBinary, "ULONG")
+    PHNT_REFLECT_BITFIELD(MarkedForRemoval, "ULONG")
+    PHNT_REFLECT_BITFIELD(ImageDll, "ULONG")
+    PHNT_REFLECT_BITFIELD(LoadNotificationsSent, "ULONG")
+    PHNT_REFLECT_BITFIELD(TelemetryEntryProcessed, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessStaticImport, "ULONG")
+    PHNT_REFLECT_BITFIELD(InLegacyLists, "ULONG")
+    PHNT_REFLECT_BITFIELD(InIndexes, "ULONG")
+    PHNT_REFLECT_BITFIELD(ShimDll, "ULONG")
+    PHNT_REFLECT_BITFIELD(InExceptionTable, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags1, "ULONG")
+    PHNT_REFLECT_BITFIELD(LoadInProgress, "ULONG")
+    PHNT_REFLECT_BITFIELD(LoadConfigProcessed, "ULONG")
+    PHNT_REFLECT_BITFIELD(EntryProcessed, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProtectDelayLoad, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags3, "ULONG")
+    PHNT_REFLECT_BITFIELD(DontCallForThreads, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessAttachCalled, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessAttachFailed, "ULONG")
+    PHNT_REFLECT_BITFIELD(CorDeferredValidate, "ULONG")
+    PHNT_REFLECT_BITFIELD(CorImage, "ULONG")
+    PHNT_REFLECT_BITFIELD(DontRelocate, "ULONG")
+    PHNT_REFLECT_BITFIELD(CorILOnly, "ULONG")
+    PHNT_REFLECT_BITFIELD(ChpeImage, "ULONG")
+    PHNT_REFLECT_BITFIELD(ChpeEmulatorImage, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags5, "ULONG")
+    PHNT_REFLECT_BITFIELD(Redirected, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags6, "ULONG")
+    PHNT_REFLECT_BITFIELD(CompatDatabaseProcessed, "ULONG")
+    PHNT_REFLECT_FIELD(ObsoleteLoadCount, "USHORT")
+    PHNT_REFLECT_FIELD(TlsIndex, "USHORT")
+    PHNT_REFLECT_FIELD(HashLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(EntryPointActivationContext, "PACTIVATION_CONTEXT")
+    PHNT_REFLECT_FIELD(Lock, "PVOID")
+    PHNT_REFLECT_FIELD(DdagNode, "PLDR_DDAG_NODE")
+    PHNT_REFLECT_FIELD(NodeModuleLink, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(LoadContext, "PLDRP_LOAD_CONTEXT")
+    PHNT_REFLECT_FIELD(ParentDllBase, "PVOID")
+    PHNT_REFLECT_FIELD(SwitchBackContext, "PVOID")
+    PHNT_REFLECT_FIELD(BaseAddressIndexNode, "RTL_BALANCED_NODE")
+    PHNT_REFLECT_FIELD(MappingInfoIndexNode, "RTL_BALANCED_NODE")
+    PHNT_REFLECT_FIELD(OriginalBase, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(LoadTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(BaseNameHashValue, "ULONG")
+    PHNT_REFLECT_FIELD(LoadReason, "LDR_DLL_LOAD_REASON")
+    PHNT_REFLECT_FIELD(ImplicitPathOptions, "ULONG")
+    PHNT_REFLECT_FIELD(ReferenceCount, "ULONG")
+    PHNT_REFLECT_FIELD(DependentLoadFlags, "ULONG")
+    PHNT_REFLECT_FIELD(SigningLevel, "UCHAR")
+    PHNT_REFLECT_FIELD(CheckSum, "ULONG")
+    PHNT_REFLECT_FIELD(ActivePatchImageBase, "PVOID")
+    PHNT_REFLECT_FIELD(HotPatchState, "LDR_HOT_PATCH_STATE")
+PHNT_REFLECT_END(LDR_DATA_TABLE_ENTRY)
+#endif
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+PHNT_REFLECT_BEGIN(LDR_IMPORT_CALLBACK_INFO)
+    PHNT_REFLECT_FIELD(ImportCallbackRoutine, "PLDR_IMPORT_MODULE_CALLBACK")
+    PHNT_REFLECT_FIELD(ImportCallbackParameter, "PVOID")
+PHNT_REFLECT_END(LDR_IMPORT_CALLBACK_INFO)
+PHNT_REFLECT_BEGIN(LDR_SECTION_INFO)
+    PHNT_REFLECT_FIELD(SectionHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(DesiredAccess, "ACCESS_MASK")
+    PHNT_REFLECT_FIELD(ObjA, "POBJECT_ATTRIBUTES")
+    PHNT_REFLECT_FIELD(SectionPageProtection, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationAttributes, "ULONG")
+PHNT_REFLECT_END(LDR_SECTION_INFO)
+PHNT_REFLECT_BEGIN(LDR_VERIFY_IMAGE_INFO)
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(CallbackInfo, "LDR_IMPORT_CALLBACK_INFO")
+    PHNT_REFLECT_FIELD(SectionInfo, "LDR_SECTION_INFO")
+    PHNT_REFLECT_FIELD(ImageCharacteristics, "USHORT")
+PHNT_REFLECT_END(LDR_VERIFY_IMAGE_INFO)
+PHNT_REFLECT_BEGIN(LDR_DLL_LOADED_NOTIFICATION_DATA)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(FullDllName, "PUNICODE_STRING")
+    PHNT_REFLECT_FIELD(BaseDllName, "PUNICODE_STRING")
+    PHNT_REFLECT_FIELD(DllBase, "PVOID")
+    PHNT_REFLECT_FIELD(SizeOfImage, "ULONG")
+PHNT_REFLECT_END(LDR_DLL_LOADED_NOTIFICATION_DATA)
+PHNT_REFLECT_BEGIN(LDR_DLL_UNLOADED_NOTIFICATION_DATA)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(FullDllName, "PCUNICODE_STRING")
+    PHNT_REFLECT_FIELD(BaseDllName, "PCUNICODE_STRING")
+    PHNT_REFLECT_FIELD(DllBase, "PVOID")
+    PHNT_REFLECT_FIELD(SizeOfImage, "ULONG")
+PHNT_REFLECT_END(LDR_DLL_UNLOADED_NOTIFICATION_DATA)
+PHNT_REFLECT_BEGIN(LDR_DLL_NOTIFICATION_DATA)
+    PHNT_REFLECT_FIELD(Loaded, "LDR_DLL_LOADED_NOTIFICATION_DATA")
+    PHNT_REFLECT_FIELD(Unloaded, "LDR_DLL_UNLOADED_NOTIFICATION_DATA")
+PHNT_REFLECT_END(LDR_DLL_NOTIFICATION_DATA)
+#if (PHNT_VERSION >= PHNT_WINBLUE)
+PHNT_REFLECT_BEGIN(LDR_FAILURE_DATA)
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+    PHNT_REFLECT_FIELD(DllName, "WCHAR")
+    PHNT_REFLECT_FIELD(AdditionalInfo, "WCHAR")
+PHNT_REFLECT_END(LDR_FAILURE_DATA)
+#endif
+PHNT_REFLECT_BEGIN(PS_MITIGATION_OPTIONS_MAP)
+    PHNT_REFLECT_FIELD(Map, "ULONG_PTR")
+PHNT_REFLECT_END(PS_MITIGATION_OPTIONS_MAP)
+PHNT_REFLECT_BEGIN(PS_MITIGATION_AUDIT_OPTIONS_MAP)
+    PHNT_REFLECT_FIELD(Map, "ULONG_PTR")
+PHNT_REFLECT_END(PS_MITIGATION_AUDIT_OPTIONS_MAP)
+PHNT_REFLECT_BEGIN(PS_SYSTEM_DLL_INIT_BLOCK)
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(SystemDllWowRelocation, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(SystemDllNativeRelocation, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Wow64SharedInformation, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(RngData, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_BITFIELD(CfgOverride, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(MitigationOptionsMap, "PS_MITIGATION_OPTIONS_MAP")
+    PHNT_REFLECT_FIELD(CfgBitMap, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(CfgBitMapSize, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Wow64CfgBitMap, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Wow64CfgBitMapSize, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(MitigationAuditOptionsMap, "PS_MITIGATION_AUDIT_OPTIONS_MAP")
+    PHNT_REFLECT_FIELD(ScpCfgCheckFunction, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ScpCfgCheckESFunction, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ScpCfgDispatchFunction, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ScpCfgDispatchESFunction, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ScpArm64EcCallCheck, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ScpArm64EcCfgCheckFunction, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ScpArm64EcCfgCheckESFunction, "ULONG_PTR")
+PHNT_REFLECT_END(PS_SYSTEM_DLL_INIT_BLOCK)
+PHNT_REFLECT_BEGIN(LDR_RESOURCE_INFO)
+    PHNT_REFLECT_FIELD(Type, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Name, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Language, "ULONG_PTR")
+PHNT_REFLECT_END(LDR_RESOURCE_INFO)
+PHNT_REFLECT_BEGIN(LDR_ENUM_RESOURCE_ENTRY)
+    PHNT_REFLECT_FIELD(Data, "PVOID")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(LDR_ENUM_RESOURCE_ENTRY)
+#endif
+PHNT_REFLECT_BEGIN(RTL_PROCESS_MODULE_INFORMATION)
+    PHNT_REFLECT_FIELD(Section, "PVOID")
+    PHNT_REFLECT_FIELD(MappedBase, "PVOID")
+    PHNT_REFLECT_FIELD(ImageBase, "PVOID")
+    PHNT_REFLECT_FIELD(ImageSize, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(LoadOrderIndex, "USHORT")
+    PHNT_REFLECT_FIELD(InitOrderIndex, "USHORT")
+    PHNT_REFLECT_FIELD(LoadCount, "USHORT")
+    PHNT_REFLECT_FIELD(OffsetToFileName, "USHORT")
+    PHNT_REFLECT_FIELD(FullPathName, "UCHAR")
+PHNT_REFLECT_END(RTL_PROCESS_MODULE_INFORMATION)
+PHNT_REFLECT_BEGIN(RTL_PROCESS_MODULES)
+    PHNT_REFLECT_FIELD(NumberOfModules, "ULONG")
+    PHNT_REFLECT_FIELD(Modules, "RTL_PROCESS_MODULE_INFORMATION")
+PHNT_REFLECT_END(RTL_PROCESS_MODULES)
+PHNT_REFLECT_BEGIN(RTL_PROCESS_MODULE_INFORMATION_EX)
+    PHNT_REFLECT_FIELD(NextOffset, "USHORT")
+    PHNT_REFLECT_FIELD(BaseInfo, "RTL_PROCESS_MODULE_INFORMATION")
+    PHNT_REFLECT_FIELD(Section, "PVOID")
+    PHNT_REFLECT_FIELD(MappedBase, "PVOID")
+    PHNT_REFLECT_FIELD(ImageBase, "PVOID")
+    PHNT_REFLECT_FIELD(ImageSize, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(LoadOrderIndex, "USHORT")
+    PHNT_REFLECT_FIELD(InitOrderIndex, "USHORT")
+    PHNT_REFLECT_FIELD(LoadCount, "USHORT")
+    PHNT_REFLECT_FIELD(OffsetToFileName, "USHORT")
+    PHNT_REFLECT_FIELD(FullPathName, "UCHAR")
+    PHNT_REFLECT_FIELD(ImageChecksum, "ULONG")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(DefaultBase, "PVOID")
+PHNT_REFLECT_END(RTL_PROCESS_MODULE_INFORMATION_EX)
+PHNT_REFLECT_BEGIN(SYSTEM_SINGLE_MODULE_INFORMATION)
+    PHNT_REFLECT_FIELD(TargetModuleAddress, "PVOID")
+    PHNT_REFLECT_FIELD(ExInfo, "RTL_PROCESS_MODULE_INFORMATION_EX")
+PHNT_REFLECT_END(SYSTEM_SINGLE_MODULE_INFORMATION)
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+PHNT_REFLECT_BEGIN(DELAYLOAD_PROC_DESCRIPTOR)
+    PHNT_REFLECT_FIELD(ImportDescribedByName, "ULONG")
+PHNT_REFLECT_END(DELAYLOAD_PROC_DESCRIPTOR)
+PHNT_REFLECT_BEGIN(DELAYLOAD_INFO)
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(DelayloadDescriptor, "PCIMAGE_DELAYLOAD_DESCRIPTOR")
+    PHNT_REFLECT_FIELD(ThunkAddress, "PIMAGE_THUNK_DATA")
+    PHNT_REFLECT_FIELD(TargetDllName, "PCSTR")
+    PHNT_REFLECT_FIELD(TargetApiDescriptor, "DELAYLOAD_PROC_DESCRIPTOR")
+    PHNT_REFLECT_FIELD(TargetModuleBase, "PVOID")
+    PHNT_REFLECT_FIELD(Unused, "PVOID")
+    PHNT_REFLECT_FIELD(LastError, "ULONG")
+PHNT_REFLECT_END(DELAYLOAD_INFO)
+#if (PHNT_VERSION >= PHNT_THRESHOLD)
+PHNT_REFLECT_BEGIN(LDR_SOFTWARE_ENCLAVE)
+    PHNT_REFLECT_FIELD(Links, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(CriticalSection, "RTL_CRITICAL_SECTION")
+    PHNT_REFLECT_FIELD(EnclaveType, "ULONG")
+    PHNT_REFLECT_FIELD(ReferenceCount, "LONG")
+    PHNT_REFLECT_FIELD(EnclaveState, "ULONG")
+    PHNT_REFLECT_FIELD(BaseAddress, "PVOID")
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+    PHNT_REFLECT_FIELD(PreviousBaseAddress, "PVOID")
+    PHNT_REFLECT_FIELD(Modules, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(PrimaryModule, "PLDR_DATA_TABLE_ENTRY")
+    PHNT_REFLECT_FIELD(BCryptModule, "PLDR_DATA_TABLE_ENTRY")
+    PHNT_REFLECT_FIELD(BCryptPrimitivesModule, "PLDR_DATA_TABLE_ENTRY")
+PHNT_REFLECT_END(LDR_SOFTWARE_ENCLAVE)
+#endif
+#endif
+#endif
+
+// win-polyfill-ldr-data-table-entry.h
+#ifdef _WIN_POLYFILL_LDR_DATA_TABLE_ENTRY_H
+PHNT_REFLECT_BEGIN(LDR_DATA_TABLE_ENTRY)
+    PHNT_REFLECT_FIELD(InLoadOrderLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(InMemoryOrderLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(InInitializationOrderLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(InProgressLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(DllBase, "PVOID")
+    PHNT_REFLECT_FIELD(EntryPoint, "PVOID")
+    PHNT_REFLECT_FIELD(SizeOfImage, "ULONG")
+    PHNT_REFLECT_FIELD(FullDllName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(BaseDllName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(FlagGroup, "UCHAR")
+    PHNT_REFLECT_BITFIELD(PackagedBinary, "ULONG")
+    PHNT_REFLECT_BITFIELD(MarkedForRemoval, "ULONG")
+    PHNT_REFLECT_BITFIELD(ImageDll, "ULONG")
+    PHNT_REFLECT_BITFIELD(LoadNotificationsSent, "ULONG")
+    PHNT_REFLECT_BITFIELD(TelemetryEntryProcessed, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessStaticImport, "ULONG")
+    PHNT_REFLECT_BITFIELD(InLegacyLists, "ULONG")
+    PHNT_REFLECT_BITFIELD(InIndexes, "ULONG")
+    PHNT_REFLECT_BITFIELD(ShimDll, "ULONG")
+    PHNT_REFLECT_BITFIELD(InExceptionTable, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags1, "ULONG")
+    PHNT_REFLECT_BITFIELD(LoadInProgress, "ULONG")
+    PHNT_REFLECT_BITFIELD(LoadConfigProcessed, "ULONG")
+    PHNT_REFLECT_BITFIELD(EntryProcessed, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProtectDelayLoad, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags3, "ULONG")
+    PHNT_REFLECT_BITFIELD(DontCallForThreads, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessAttachCalled, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessAttachFailed, "ULONG")
+    PHNT_REFLECT_BITFIELD(CorDeferredValidate, "ULONG")
+    PHNT_REFLECT_BITFIELD(CorImage, "ULONG")
+    PHNT_REFLECT_BITFIELD(DontRelocate, "ULONG")
+    PHNT_REFLECT_BITFIELD(CorILOnly, "ULONG")
+    PHNT_REFLECT_BITFIELD(ChpeImage, "ULONG")
+    PHNT_REFLECT_BITFIELD(ChpeEmulatorImage, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags5, "ULONG")
+    PHNT_REFLECT_BITFIELD(Redirected, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags6, "ULONG")
+    PHNT_REFLECT_BITFIELD(CompatDatabaseProcessed, "ULONG")
+    PHNT_REFLECT_FIELD(LoadCount, "USHORT")
+    PHNT_REFLECT_FIELD(ObsoleteLoadCount, "USHORT")
+    PHNT_REFLECT_FIELD(TlsIndex, "USHORT")
+    PHNT_REFLECT_FIELD(HashLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(EntryPointActivationContext, "PACTIVATION_CONTEXT")
+    PHNT_REFLECT_FIELD(PatchInformation, "PVOID")
+    PHNT_REFLECT_FIELD(Spare, "PVOID")
+    PHNT_REFLECT_FIELD(Lock, "PVOID")
+    PHNT_REFLECT_FIELD(DdagNode, "PLDR_DDAG_NODE")
+    PHNT_REFLECT_FIELD(NodeModuleLink, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(LoadContext, "PLDRP_LOAD_CONTEXT")
+    PHNT_REFLECT_FIELD(ParentDllBase, "PVOID")
+    PHNT_REFLECT_FIELD(SwitchBackContext, "PVOID")
+    PHNT_REFLECT_FIELD(BaseAddressIndexNode, "RTL_BALANCED_NODE")
+    PHNT_REFLECT_FIELD(MappingInfoIndexNode, "RTL_BALANCED_NODE")
+    PHNT_REFLECT_FIELD(OriginalBase, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LoadTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(BaseNameHashValue, "ULONG")
+    PHNT_REFLECT_FIELD(LoadReason, "LDR_DLL_LOAD_REASON")
+    PHNT_REFLECT_FIELD(ImplicitPathOptions, "ULONG")
+    PHNT_REFLECT_FIELD(ReferenceCount, "ULONG")
+    PHNT_REFLECT_FIELD(DependentLoadFlags, "ULONG")
+    PHNT_REFLECT_FIELD(SigningLevel, "UCHAR")
+    PHNT_REFLECT_FIELD(CheckSum, "ULONG")
+    PHNT_REFLECT_FIELD(ActivePatchImageBase, "PVOID")
+    PHNT_REFLECT_FIELD(HotPatchState, "LDR_HOT_PATCH_STATE")
+PHNT_REFLECT_END(LDR_DATA_TABLE_ENTRY)
+#endif
+
+// ntexapi.h
+#ifdef _NTEXAPI_H
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+PHNT_REFLECT_BEGIN(VARIABLE_NAME)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(VendorGuid, "GUID")
+    PHNT_REFLECT_FIELD(Name, "WCHAR")
+PHNT_REFLECT_END(VARIABLE_NAME)
+PHNT_REFLECT_BEGIN(VARIABLE_NAME_AND_VALUE)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(ValueOffset, "ULONG")
+    PHNT_REFLECT_FIELD(ValueLength, "ULONG")
+    PHNT_REFLECT_FIELD(Attributes, "ULONG")
+    PHNT_REFLECT_FIELD(VendorGuid, "GUID")
+    PHNT_REFLECT_FIELD(Name, "WCHAR")
+PHNT_REFLECT_END(VARIABLE_NAME_AND_VALUE)
+PHNT_REFLECT_BEGIN(BOOT_ENTRY)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(Id, "ULONG")
+    PHNT_REFLECT_FIELD(Attributes, "ULONG")
+    PHNT_REFLECT_FIELD(FriendlyNameOffset, "ULONG")
+    PHNT_REFLECT_FIELD(BootFilePathOffset, "ULONG")
+    PHNT_REFLECT_FIELD(OsOptionsLength, "ULONG")
+    PHNT_REFLECT_FIELD(OsOptions, "UCHAR")
+PHNT_REFLECT_END(BOOT_ENTRY)
+PHNT_REFLECT_BEGIN(BOOT_ENTRY_LIST)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(BootEntry, "BOOT_ENTRY")
+PHNT_REFLECT_END(BOOT_ENTRY_LIST)
+PHNT_REFLECT_BEGIN(BOOT_OPTIONS)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(Timeout, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentBootEntryId, "ULONG")
+    PHNT_REFLECT_FIELD(NextBootEntryId, "ULONG")
+    PHNT_REFLECT_FIELD(HeadlessRedirection, "WCHAR")
+PHNT_REFLECT_END(BOOT_OPTIONS)
+PHNT_REFLECT_BEGIN(FILE_PATH)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(Type, "ULONG")
+    PHNT_REFLECT_FIELD(FilePath, "UCHAR")
+PHNT_REFLECT_END(FILE_PATH)
+PHNT_REFLECT_BEGIN(EFI_DRIVER_ENTRY)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(Id, "ULONG")
+    PHNT_REFLECT_FIELD(FriendlyNameOffset, "ULONG")
+    PHNT_REFLECT_FIELD(DriverFilePathOffset, "ULONG")
+PHNT_REFLECT_END(EFI_DRIVER_ENTRY)
+PHNT_REFLECT_BEGIN(EFI_DRIVER_ENTRY_LIST)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(DriverEntry, "EFI_DRIVER_ENTRY")
+PHNT_REFLECT_END(EFI_DRIVER_ENTRY_LIST)
+PHNT_REFLECT_BEGIN(EVENT_BASIC_INFORMATION)
+    PHNT_REFLECT_FIELD(EventType, "EVENT_TYPE")
+    PHNT_REFLECT_FIELD(EventState, "LONG")
+PHNT_REFLECT_END(EVENT_BASIC_INFORMATION)
+PHNT_REFLECT_BEGIN(MUTANT_BASIC_INFORMATION)
+    PHNT_REFLECT_FIELD(CurrentCount, "LONG")
+    PHNT_REFLECT_FIELD(OwnedByCaller, "BOOLEAN")
+    PHNT_REFLECT_FIELD(AbandonedState, "BOOLEAN")
+PHNT_REFLECT_END(MUTANT_BASIC_INFORMATION)
+PHNT_REFLECT_BEGIN(MUTANT_OWNER_INFORMATION)
+    PHNT_REFLECT_FIELD(ClientId, "CLIENT_ID")
+PHNT_REFLECT_END(MUTANT_OWNER_INFORMATION)
+PHNT_REFLECT_BEGIN(SEMAPHORE_BASIC_INFORMATION)
+    PHNT_REFLECT_FIELD(CurrentCount, "LONG")
+    PHNT_REFLECT_FIELD(MaximumCount, "LONG")
+PHNT_REFLECT_END(SEMAPHORE_BASIC_INFORMATION)
+PHNT_REFLECT_BEGIN(TIMER_BASIC_INFORMATION)
+    PHNT_REFLECT_FIELD(RemainingTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(TimerState, "BOOLEAN")
+PHNT_REFLECT_END(TIMER_BASIC_INFORMATION)
+#if (PHNT_VERSION >= PHNT_WIN7)
+PHNT_REFLECT_BEGIN(TIMER_SET_COALESCABLE_TIMER_INFO)
+    PHNT_REFLECT_FIELD(DueTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(TimerApcRoutine, "PTIMER_APC_ROUTINE")
+    PHNT_REFLECT_FIELD(TimerContext, "PVOID")
+    PHNT_REFLECT_FIELD(WakeContext, "PCOUNTED_REASON_CONTEXT")
+    PHNT_REFLECT_FIELD(Period, "ULONG")
+    PHNT_REFLECT_FIELD(TolerableDelay, "ULONG")
+    PHNT_REFLECT_FIELD(PreviousState, "PBOOLEAN")
+PHNT_REFLECT_END(TIMER_SET_COALESCABLE_TIMER_INFO)
+#endif
+PHNT_REFLECT_BEGIN(T2_SET_PARAMETERS)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(NoWakeTolerance, "LONGLONG")
+PHNT_REFLECT_END(T2_SET_PARAMETERS)
+PHNT_REFLECT_BEGIN(WNF_STATE_NAME)
+    PHNT_REFLECT_FIELD(Data, "ULONG")
+PHNT_REFLECT_END(WNF_STATE_NAME)
+PHNT_REFLECT_BEGIN(WNF_TYPE_ID)
+    PHNT_REFLECT_FIELD(TypeId, "GUID")
+PHNT_REFLECT_END(WNF_TYPE_ID)
+PHNT_REFLECT_BEGIN(WNF_DELIVERY_DESCRIPTOR)
+    PHNT_REFLECT_FIELD(SubscriptionId, "ULONGLONG")
+    PHNT_REFLECT_FIELD(StateName, "WNF_STATE_NAME")
+    PHNT_REFLECT_FIELD(ChangeStamp, "WNF_CHANGE_STAMP")
+    PHNT_REFLECT_FIELD(StateDataSize, "ULONG")
+    PHNT_REFLECT_FIELD(EventMask, "ULONG")
+    PHNT_REFLECT_FIELD(TypeId, "WNF_TYPE_ID")
+    PHNT_REFLECT_FIELD(StateDataOffset, "ULONG")
+PHNT_REFLECT_END(WNF_DELIVERY_DESCRIPTOR)
+PHNT_REFLECT_BEGIN(WORKER_FACTORY_BASIC_INFORMATION)
+    PHNT_REFLECT_FIELD(Timeout, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(RetryTimeout, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(IdleTimeout, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Paused, "BOOLEAN")
+    PHNT_REFLECT_FIELD(TimerSet, "BOOLEAN")
+    PHNT_REFLECT_FIELD(QueuedToExWorker, "BOOLEAN")
+    PHNT_REFLECT_FIELD(MayCreate, "BOOLEAN")
+    PHNT_REFLECT_FIELD(CreateInProgress, "BOOLEAN")
+    PHNT_REFLECT_FIELD(InsertedIntoQueue, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Shutdown, "BOOLEAN")
+    PHNT_REFLECT_FIELD(BindingCount, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadMinimum, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadMaximum, "ULONG")
+    PHNT_REFLECT_FIELD(PendingWorkerCount, "ULONG")
+    PHNT_REFLECT_FIELD(WaitingWorkerCount, "ULONG")
+    PHNT_REFLECT_FIELD(TotalWorkerCount, "ULONG")
+    PHNT_REFLECT_FIELD(ReleaseCount, "ULONG")
+    PHNT_REFLECT_FIELD(InfiniteWaitGoal, "LONGLONG")
+    PHNT_REFLECT_FIELD(StartRoutine, "PVOID")
+    PHNT_REFLECT_FIELD(StartParameter, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessId, "HANDLE")
+    PHNT_REFLECT_FIELD(StackReserve, "SIZE_T")
+    PHNT_REFLECT_FIELD(StackCommit, "SIZE_T")
+    PHNT_REFLECT_FIELD(LastThreadCreationStatus, "NTSTATUS")
+PHNT_REFLECT_END(WORKER_FACTORY_BASIC_INFORMATION)
+#if (PHNT_VERSION >= PHNT_VISTA)
+#if (PHNT_VERSION >= PHNT_WIN8)
+PHNT_REFLECT_BEGIN(WORKER_FACTORY_DEFERRED_WORK)
+    PHNT_REFLECT_FIELD(AlpcSendMessage, "PPORT_MESSAGE")
+    PHNT_REFLECT_FIELD(AlpcSendMessagePort, "PVOID")
+    PHNT_REFLECT_FIELD(AlpcSendMessageFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(WORKER_FACTORY_DEFERRED_WORK)
+#endif
+#endif
+#endif
+PHNT_REFLECT_BEGIN(SYSTEM_BASIC_INFORMATION)
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(TimerResolution, "ULONG")
+    PHNT_REFLECT_FIELD(PageSize, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfPhysicalPages, "ULONG")
+    PHNT_REFLECT_FIELD(LowestPhysicalPageNumber, "ULONG")
+    PHNT_REFLECT_FIELD(HighestPhysicalPageNumber, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationGranularity, "ULONG")
+    PHNT_REFLECT_FIELD(MinimumUserModeAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(MaximumUserModeAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ActiveProcessorsAffinityMask, "KAFFINITY")
+    PHNT_REFLECT_FIELD(NumberOfProcessors, "CCHAR")
+PHNT_REFLECT_END(SYSTEM_BASIC_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_INFORMATION)
+    PHNT_REFLECT_FIELD(ProcessorArchitecture, "USHORT")
+    PHNT_REFLECT_FIELD(ProcessorLevel, "USHORT")
+    PHNT_REFLECT_FIELD(ProcessorRevision, "USHORT")
+    PHNT_REFLECT_FIELD(MaximumProcessors, "USHORT")
+    PHNT_REFLECT_FIELD(ProcessorFeatureBits, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PERFORMANCE_INFORMATION)
+    PHNT_REFLECT_FIELD(IdleProcessTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(IoReadTransferCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(IoWriteTransferCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(IoOtherTransferCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(IoReadOperationCount, "ULONG")
+    PHNT_REFLECT_FIELD(IoWriteOperationCount, "ULONG")
+    PHNT_REFLECT_FIELD(IoOtherOperationCount, "ULONG")
+    PHNT_REFLECT_FIELD(AvailablePages, "ULONG")
+    PHNT_REFLECT_FIELD(CommittedPages, "ULONG")
+    PHNT_REFLECT_FIELD(CommitLimit, "ULONG")
+    PHNT_REFLECT_FIELD(PeakCommitment, "ULONG")
+    PHNT_REFLECT_FIELD(PageFaultCount, "ULONG")
+    PHNT_REFLECT_FIELD(CopyOnWriteCount, "ULONG")
+    PHNT_REFLECT_FIELD(TransitionCount, "ULONG")
+    PHNT_REFLECT_FIELD(CacheTransitionCount, "ULONG")
+    PHNT_REFLECT_FIELD(DemandZeroCount, "ULONG")
+    PHNT_REFLECT_FIELD(PageReadCount, "ULONG")
+    PHNT_REFLECT_FIELD(PageReadIoCount, "ULONG")
+    PHNT_REFLECT_FIELD(CacheReadCount, "ULONG")
+    PHNT_REFLECT_FIELD(CacheIoCount, "ULONG")
+    PHNT_REFLECT_FIELD(DirtyPagesWriteCount, "ULONG")
+    PHNT_REFLECT_FIELD(DirtyWriteIoCount, "ULONG")
+    PHNT_REFLECT_FIELD(MappedPagesWriteCount, "ULONG")
+    PHNT_REFLECT_FIELD(MappedWriteIoCount, "ULONG")
+    PHNT_REFLECT_FIELD(PagedPoolPages, "ULONG")
+    PHNT_REFLECT_FIELD(NonPagedPoolPages, "ULONG")
+    PHNT_REFLECT_FIELD(PagedPoolAllocs, "ULONG")
+    PHNT_REFLECT_FIELD(PagedPoolFrees, "ULONG")
+    PHNT_REFLECT_FIELD(NonPagedPoolAllocs, "ULONG")
+    PHNT_REFLECT_FIELD(NonPagedPoolFrees, "ULONG")
+    PHNT_REFLECT_FIELD(FreeSystemPtes, "ULONG")
+    PHNT_REFLECT_FIELD(ResidentSystemCodePage, "ULONG")
+    PHNT_REFLECT_FIELD(TotalSystemDriverPages, "ULONG")
+    PHNT_REFLECT_FIELD(TotalSystemCodePages, "ULONG")
+    PHNT_REFLECT_FIELD(NonPagedPoolLookasideHits, "ULONG")
+    PHNT_REFLECT_FIELD(PagedPoolLookasideHits, "ULONG")
+    PHNT_REFLECT_FIELD(AvailablePagedPoolPages, "ULONG")
+    PHNT_REFLECT_FIELD(ResidentSystemCachePage, "ULONG")
+    PHNT_REFLECT_FIELD(ResidentPagedPoolPage, "ULONG")
+    PHNT_REFLECT_FIELD(ResidentSystemDriverPage, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastReadNoWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastReadWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastReadResourceMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastReadNotPossible, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastMdlReadNoWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastMdlReadWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastMdlReadResourceMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcFastMdlReadNotPossible, "ULONG")
+    PHNT_REFLECT_FIELD(CcMapDataNoWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcMapDataWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcMapDataNoWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcMapDataWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcPinMappedDataCount, "ULONG")
+    PHNT_REFLECT_FIELD(CcPinReadNoWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcPinReadWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcPinReadNoWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcPinReadWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcCopyReadNoWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcCopyReadWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcCopyReadNoWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcCopyReadWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcMdlReadNoWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcMdlReadWait, "ULONG")
+    PHNT_REFLECT_FIELD(CcMdlReadNoWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcMdlReadWaitMiss, "ULONG")
+    PHNT_REFLECT_FIELD(CcReadAheadIos, "ULONG")
+    PHNT_REFLECT_FIELD(CcLazyWriteIos, "ULONG")
+    PHNT_REFLECT_FIELD(CcLazyWritePages, "ULONG")
+    PHNT_REFLECT_FIELD(CcDataFlushes, "ULONG")
+    PHNT_REFLECT_FIELD(CcDataPages, "ULONG")
+    PHNT_REFLECT_FIELD(ContextSwitches, "ULONG")
+    PHNT_REFLECT_FIELD(FirstLevelTbFills, "ULONG")
+    PHNT_REFLECT_FIELD(SecondLevelTbFills, "ULONG")
+    PHNT_REFLECT_FIELD(SystemCalls, "ULONG")
+    PHNT_REFLECT_FIELD(CcTotalDirtyPages, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CcDirtyPageThreshold, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ResidentAvailablePages, "LONGLONG")
+    PHNT_REFLECT_FIELD(SharedCommittedPages, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_PERFORMANCE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_TIMEOFDAY_INFORMATION)
+    PHNT_REFLECT_FIELD(BootTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(CurrentTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(TimeZoneBias, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(TimeZoneId, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(BootTimeBias, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SleepTimeBias, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_TIMEOFDAY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_THREAD_INFORMATION)
+    PHNT_REFLECT_FIELD(KernelTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(UserTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(CreateTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(WaitTime, "ULONG")
+    PHNT_REFLECT_FIELD(StartAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ClientId, "CLIENT_ID")
+    PHNT_REFLECT_FIELD(Priority, "KPRIORITY")
+    PHNT_REFLECT_FIELD(BasePriority, "KPRIORITY")
+    PHNT_REFLECT_FIELD(ContextSwitches, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadState, "KTHREAD_STATE")
+    PHNT_REFLECT_FIELD(WaitReason, "KWAIT_REASON")
+PHNT_REFLECT_END(SYSTEM_THREAD_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_EXTENDED_THREAD_INFORMATION)
+    PHNT_REFLECT_FIELD(ThreadInfo, "SYSTEM_THREAD_INFORMATION")
+    PHNT_REFLECT_FIELD(StackBase, "PVOID")
+    PHNT_REFLECT_FIELD(StackLimit, "PVOID")
+    PHNT_REFLECT_FIELD(Win32StartAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(TebBase, "PTEB")
+    PHNT_REFLECT_FIELD(Reserved2, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Reserved3, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Reserved4, "ULONG_PTR")
+PHNT_REFLECT_END(SYSTEM_EXTENDED_THREAD_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESS_INFORMATION)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfThreads, "ULONG")
+    PHNT_REFLECT_FIELD(WorkingSetPrivateSize, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(HardFaultCount, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfThreadsHighWatermark, "ULONG")
+    PHNT_REFLECT_FIELD(CycleTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CreateTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(UserTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(KernelTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(ImageName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(BasePriority, "KPRIORITY")
+    PHNT_REFLECT_FIELD(UniqueProcessId, "HANDLE")
+    PHNT_REFLECT_FIELD(InheritedFromUniqueProcessId, "HANDLE")
+    PHNT_REFLECT_FIELD(HandleCount, "ULONG")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(UniqueProcessKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(PeakVirtualSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(VirtualSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PageFaultCount, "ULONG")
+    PHNT_REFLECT_FIELD(PeakWorkingSetSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(WorkingSetSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaPeakPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaPeakNonPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaNonPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(PagefileUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakPagefileUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(PrivatePageCount, "SIZE_T")
+    PHNT_REFLECT_FIELD(ReadOperationCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(WriteOperationCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(OtherOperationCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(ReadTransferCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(WriteTransferCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(OtherTransferCount, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Threads, "SYSTEM_THREAD_INFORMATION")
+PHNT_REFLECT_END(SYSTEM_PROCESS_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CALL_COUNT_INFORMATION)
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfTables, "ULONG")
+PHNT_REFLECT_END(SYSTEM_CALL_COUNT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_DEVICE_INFORMATION)
+    PHNT_REFLECT_FIELD(NumberOfDisks, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfFloppies, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfCdRoms, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfTapes, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfSerialPorts, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfParallelPorts, "ULONG")
+PHNT_REFLECT_END(SYSTEM_DEVICE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION)
+    PHNT_REFLECT_FIELD(IdleTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(KernelTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(UserTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(DpcTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(InterruptTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(InterruptCount, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_FLAGS_INFORMATION)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(SYSTEM_FLAGS_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CALL_TIME_INFORMATION)
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(TotalCalls, "ULONG")
+    PHNT_REFLECT_FIELD(TimeOfCalls, "LARGE_INTEGER")
+PHNT_REFLECT_END(SYSTEM_CALL_TIME_INFORMATION)
+PHNT_REFLECT_BEGIN(RTL_PROCESS_LOCK_INFORMATION)
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Type, "USHORT")
+    PHNT_REFLECT_FIELD(CreatorBackTraceIndex, "USHORT")
+    PHNT_REFLECT_FIELD(OwningThread, "HANDLE")
+    PHNT_REFLECT_FIELD(LockCount, "LONG")
+    PHNT_REFLECT_FIELD(ContentionCount, "ULONG")
+    PHNT_REFLECT_FIELD(EntryCount, "ULONG")
+    PHNT_REFLECT_FIELD(RecursionCount, "LONG")
+    PHNT_REFLECT_FIELD(NumberOfWaitingShared, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfWaitingExclusive, "ULONG")
+PHNT_REFLECT_END(RTL_PROCESS_LOCK_INFORMATION)
+PHNT_REFLECT_BEGIN(RTL_PROCESS_LOCKS)
+    PHNT_REFLECT_FIELD(NumberOfLocks, "ULONG")
+    PHNT_REFLECT_FIELD(Locks, "RTL_PROCESS_LOCK_INFORMATION")
+PHNT_REFLECT_END(RTL_PROCESS_LOCKS)
+PHNT_REFLECT_BEGIN(RTL_PROCESS_BACKTRACE_INFORMATION)
+    PHNT_REFLECT_FIELD(SymbolicBackTrace, "PCHAR")
+    PHNT_REFLECT_FIELD(TraceCount, "ULONG")
+    PHNT_REFLECT_FIELD(Index, "USHORT")
+    PHNT_REFLECT_FIELD(Depth, "USHORT")
+    PHNT_REFLECT_FIELD(BackTrace, "PVOID")
+PHNT_REFLECT_END(RTL_PROCESS_BACKTRACE_INFORMATION)
+PHNT_REFLECT_BEGIN(RTL_PROCESS_BACKTRACES)
+    PHNT_REFLECT_FIELD(CommittedMemory, "ULONG")
+    PHNT_REFLECT_FIELD(ReservedMemory, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfBackTraceLookups, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfBackTraces, "ULONG")
+    PHNT_REFLECT_FIELD(BackTraces, "RTL_PROCESS_BACKTRACE_INFORMATION")
+PHNT_REFLECT_END(RTL_PROCESS_BACKTRACES)
+PHNT_REFLECT_BEGIN(SYSTEM_HANDLE_TABLE_ENTRY_INFO)
+    PHNT_REFLECT_FIELD(UniqueProcessId, "USHORT")
+    PHNT_REFLECT_FIELD(CreatorBackTraceIndex, "USHORT")
+    PHNT_REFLECT_FIELD(ObjectTypeIndex, "UCHAR")
+    PHNT_REFLECT_FIELD(HandleAttributes, "UCHAR")
+    PHNT_REFLECT_FIELD(HandleValue, "USHORT")
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(GrantedAccess, "ULONG")
+PHNT_REFLECT_END(SYSTEM_HANDLE_TABLE_ENTRY_INFO)
+PHNT_REFLECT_BEGIN(SYSTEM_HANDLE_INFORMATION)
+    PHNT_REFLECT_FIELD(NumberOfHandles, "ULONG")
+    PHNT_REFLECT_FIELD(Handles, "SYSTEM_HANDLE_TABLE_ENTRY_INFO")
+PHNT_REFLECT_END(SYSTEM_HANDLE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_OBJECTTYPE_INFORMATION)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfObjects, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfHandles, "ULONG")
+    PHNT_REFLECT_FIELD(TypeIndex, "ULONG")
+    PHNT_REFLECT_FIELD(InvalidAttributes, "ULONG")
+    PHNT_REFLECT_FIELD(GenericMapping, "GENERIC_MAPPING")
+    PHNT_REFLECT_FIELD(ValidAccessMask, "ULONG")
+    PHNT_REFLECT_FIELD(PoolType, "ULONG")
+    PHNT_REFLECT_FIELD(SecurityRequired, "BOOLEAN")
+    PHNT_REFLECT_FIELD(WaitableObject, "BOOLEAN")
+    PHNT_REFLECT_FIELD(TypeName, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_OBJECTTYPE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_OBJECT_INFORMATION)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(CreatorUniqueProcess, "HANDLE")
+    PHNT_REFLECT_FIELD(CreatorBackTraceIndex, "USHORT")
+    PHNT_REFLECT_FIELD(Flags, "USHORT")
+    PHNT_REFLECT_FIELD(PointerCount, "LONG")
+    PHNT_REFLECT_FIELD(HandleCount, "LONG")
+    PHNT_REFLECT_FIELD(PagedPoolCharge, "ULONG")
+    PHNT_REFLECT_FIELD(NonPagedPoolCharge, "ULONG")
+    PHNT_REFLECT_FIELD(ExclusiveProcessId, "HANDLE")
+    PHNT_REFLECT_FIELD(SecurityDescriptor, "PVOID")
+    PHNT_REFLECT_FIELD(NameInfo, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_OBJECT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PAGEFILE_INFORMATION)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(TotalSize, "ULONG")
+    PHNT_REFLECT_FIELD(TotalInUse, "ULONG")
+    PHNT_REFLECT_FIELD(PeakUsage, "ULONG")
+    PHNT_REFLECT_FIELD(PageFileName, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_PAGEFILE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_VDM_INSTEMUL_INFO)
+    PHNT_REFLECT_FIELD(SegmentNotPresent, "ULONG")
+    PHNT_REFLECT_FIELD(VdmOpcode0F, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeESPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeCSPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeSSPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeDSPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeFSPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeGSPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeOPER32Prefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeADDR32Prefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINSB, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINSW, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeOUTSB, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeOUTSW, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodePUSHF, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodePOPF, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINTnn, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINTO, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeIRET, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINBimm, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINWimm, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeOUTBimm, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeOUTWimm, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINB, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeINW, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeOUTB, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeOUTW, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeLOCKPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeREPNEPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeREPPrefix, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeHLT, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeCLI, "ULONG")
+    PHNT_REFLECT_FIELD(OpcodeSTI, "ULONG")
+    PHNT_REFLECT_FIELD(BopCount, "ULONG")
+PHNT_REFLECT_END(SYSTEM_VDM_INSTEMUL_INFO)
+PHNT_REFLECT_BEGIN(SYSTEM_FILECACHE_INFORMATION)
+    PHNT_REFLECT_FIELD(CurrentSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PageFaultCount, "ULONG")
+    PHNT_REFLECT_FIELD(MinimumWorkingSet, "SIZE_T")
+    PHNT_REFLECT_FIELD(MaximumWorkingSet, "SIZE_T")
+    PHNT_REFLECT_FIELD(CurrentSizeIncludingTransitionInPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakSizeIncludingTransitionInPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(TransitionRePurposeCount, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(SYSTEM_FILECACHE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_BASIC_WORKING_SET_INFORMATION)
+    PHNT_REFLECT_FIELD(CurrentSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PageFaultCount, "ULONG")
+PHNT_REFLECT_END(SYSTEM_BASIC_WORKING_SET_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_POOLTAG)
+    PHNT_REFLECT_FIELD(Tag, "UCHAR")
+    PHNT_REFLECT_FIELD(TagUlong, "ULONG")
+    PHNT_REFLECT_FIELD(PagedAllocs, "ULONG")
+    PHNT_REFLECT_FIELD(PagedFrees, "ULONG")
+    PHNT_REFLECT_FIELD(PagedUsed, "SIZE_T")
+    PHNT_REFLECT_FIELD(NonPagedAllocs, "ULONG")
+    PHNT_REFLECT_FIELD(NonPagedFrees, "ULONG")
+    PHNT_REFLECT_FIELD(NonPagedUsed, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_POOLTAG)
+PHNT_REFLECT_BEGIN(SYSTEM_POOLTAG_INFORMATION)
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(TagInfo, "SYSTEM_POOLTAG")
+PHNT_REFLECT_END(SYSTEM_POOLTAG_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_INTERRUPT_INFORMATION)
+    PHNT_REFLECT_FIELD(ContextSwitches, "ULONG")
+    PHNT_REFLECT_FIELD(DpcCount, "ULONG")
+    PHNT_REFLECT_FIELD(DpcRate, "ULONG")
+    PHNT_REFLECT_FIELD(TimeIncrement, "ULONG")
+    PHNT_REFLECT_FIELD(DpcBypassCount, "ULONG")
+    PHNT_REFLECT_FIELD(ApcBypassCount, "ULONG")
+PHNT_REFLECT_END(SYSTEM_INTERRUPT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_DPC_BEHAVIOR_INFORMATION)
+    PHNT_REFLECT_FIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(DpcQueueDepth, "ULONG")
+    PHNT_REFLECT_FIELD(MinimumDpcRate, "ULONG")
+    PHNT_REFLECT_FIELD(AdjustDpcThreshold, "ULONG")
+    PHNT_REFLECT_FIELD(IdealDpcRate, "ULONG")
+PHNT_REFLECT_END(SYSTEM_DPC_BEHAVIOR_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_QUERY_TIME_ADJUST_INFORMATION)
+    PHNT_REFLECT_FIELD(TimeAdjustment, "ULONG")
+    PHNT_REFLECT_FIELD(TimeIncrement, "ULONG")
+    PHNT_REFLECT_FIELD(Enable, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_QUERY_TIME_ADJUST_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_QUERY_TIME_ADJUST_INFORMATION_PRECISE)
+    PHNT_REFLECT_FIELD(TimeAdjustment, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TimeIncrement, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Enable, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_QUERY_TIME_ADJUST_INFORMATION_PRECISE)
+PHNT_REFLECT_BEGIN(SYSTEM_SET_TIME_ADJUST_INFORMATION)
+    PHNT_REFLECT_FIELD(TimeAdjustment, "ULONG")
+    PHNT_REFLECT_FIELD(Enable, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_SET_TIME_ADJUST_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SET_TIME_ADJUST_INFORMATION_PRECISE)
+    PHNT_REFLECT_FIELD(TimeAdjustment, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Enable, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_SET_TIME_ADJUST_INFORMATION_PRECISE)
+PHNT_REFLECT_BEGIN(SYSTEM_EXCEPTION_INFORMATION)
+    PHNT_REFLECT_FIELD(AlignmentFixupCount, "ULONG")
+    PHNT_REFLECT_FIELD(ExceptionDispatchCount, "ULONG")
+    PHNT_REFLECT_FIELD(FloatingEmulationCount, "ULONG")
+    PHNT_REFLECT_FIELD(ByteWordEmulationCount, "ULONG")
+PHNT_REFLECT_END(SYSTEM_EXCEPTION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CRASH_DUMP_STATE_INFORMATION)
+    PHNT_REFLECT_FIELD(CrashDumpConfigurationClass, "SYSTEM_CRASH_DUMP_CONFIGURATION_CLASS")
+PHNT_REFLECT_END(SYSTEM_CRASH_DUMP_STATE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_KERNEL_DEBUGGER_INFORMATION)
+    PHNT_REFLECT_FIELD(KernelDebuggerEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(KernelDebuggerNotPresent, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_KERNEL_DEBUGGER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CONTEXT_SWITCH_INFORMATION)
+    PHNT_REFLECT_FIELD(ContextSwitches, "ULONG")
+    PHNT_REFLECT_FIELD(FindAny, "ULONG")
+    PHNT_REFLECT_FIELD(FindLast, "ULONG")
+    PHNT_REFLECT_FIELD(FindIdeal, "ULONG")
+    PHNT_REFLECT_FIELD(IdleAny, "ULONG")
+    PHNT_REFLECT_FIELD(IdleCurrent, "ULONG")
+    PHNT_REFLECT_FIELD(IdleLast, "ULONG")
+    PHNT_REFLECT_FIELD(IdleIdeal, "ULONG")
+    PHNT_REFLECT_FIELD(PreemptAny, "ULONG")
+    PHNT_REFLECT_FIELD(PreemptCurrent, "ULONG")
+    PHNT_REFLECT_FIELD(PreemptLast, "ULONG")
+    PHNT_REFLECT_FIELD(SwitchToIdle, "ULONG")
+PHNT_REFLECT_END(SYSTEM_CONTEXT_SWITCH_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_REGISTRY_QUOTA_INFORMATION)
+    PHNT_REFLECT_FIELD(RegistryQuotaAllowed, "ULONG")
+    PHNT_REFLECT_FIELD(RegistryQuotaUsed, "ULONG")
+    PHNT_REFLECT_FIELD(PagedPoolSize, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_REGISTRY_QUOTA_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_IDLE_INFORMATION)
+    PHNT_REFLECT_FIELD(IdleTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(C1Time, "ULONGLONG")
+    PHNT_REFLECT_FIELD(C2Time, "ULONGLONG")
+    PHNT_REFLECT_FIELD(C3Time, "ULONGLONG")
+    PHNT_REFLECT_FIELD(C1Transitions, "ULONG")
+    PHNT_REFLECT_FIELD(C2Transitions, "ULONG")
+    PHNT_REFLECT_FIELD(C3Transitions, "ULONG")
+    PHNT_REFLECT_FIELD(Padding, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_IDLE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_LEGACY_DRIVER_INFORMATION)
+    PHNT_REFLECT_FIELD(VetoType, "ULONG")
+    PHNT_REFLECT_FIELD(VetoList, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_LEGACY_DRIVER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_LOOKASIDE_INFORMATION)
+    PHNT_REFLECT_FIELD(CurrentDepth, "USHORT")
+    PHNT_REFLECT_FIELD(MaximumDepth, "USHORT")
+    PHNT_REFLECT_FIELD(TotalAllocates, "ULONG")
+    PHNT_REFLECT_FIELD(AllocateMisses, "ULONG")
+    PHNT_REFLECT_FIELD(TotalFrees, "ULONG")
+    PHNT_REFLECT_FIELD(FreeMisses, "ULONG")
+    PHNT_REFLECT_FIELD(Type, "ULONG")
+    PHNT_REFLECT_FIELD(Tag, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+PHNT_REFLECT_END(SYSTEM_LOOKASIDE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_RANGE_START_INFORMATION)
+    PHNT_REFLECT_FIELD(SystemRangeStart, "ULONG_PTR")
+PHNT_REFLECT_END(SYSTEM_RANGE_START_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_VERIFIER_INFORMATION_LEGACY)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(Level, "ULONG")
+    PHNT_REFLECT_FIELD(DriverName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(RaiseIrqls, "ULONG")
+    PHNT_REFLECT_FIELD(AcquireSpinLocks, "ULONG")
+    PHNT_REFLECT_FIELD(SynchronizeExecutions, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsAttempted, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsSucceeded, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsSucceededSpecialPool, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsWithNoTag, "ULONG")
+    PHNT_REFLECT_FIELD(TrimRequests, "ULONG")
+    PHNT_REFLECT_FIELD(Trims, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsFailed, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsFailedDeliberately, "ULONG")
+    PHNT_REFLECT_FIELD(Loads, "ULONG")
+    PHNT_REFLECT_FIELD(Unloads, "ULONG")
+    PHNT_REFLECT_FIELD(UnTrackedPool, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentNonPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(PeakPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(PeakNonPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(PagedPoolUsageInBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(NonPagedPoolUsageInBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakPagedPoolUsageInBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakNonPagedPoolUsageInBytes, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_VERIFIER_INFORMATION_LEGACY)
+PHNT_REFLECT_BEGIN(SYSTEM_VERIFIER_INFORMATION)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(Level, "ULONG")
+    PHNT_REFLECT_FIELD(RuleClasses, "ULONG")
+    PHNT_REFLECT_FIELD(TriageContext, "ULONG")
+    PHNT_REFLECT_FIELD(AreAllDriversBeingVerified, "ULONG")
+    PHNT_REFLECT_FIELD(DriverName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(RaiseIrqls, "ULONG")
+    PHNT_REFLECT_FIELD(AcquireSpinLocks, "ULONG")
+    PHNT_REFLECT_FIELD(SynchronizeExecutions, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsAttempted, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsSucceeded, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsSucceededSpecialPool, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsWithNoTag, "ULONG")
+    PHNT_REFLECT_FIELD(TrimRequests, "ULONG")
+    PHNT_REFLECT_FIELD(Trims, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsFailed, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsFailedDeliberately, "ULONG")
+    PHNT_REFLECT_FIELD(Loads, "ULONG")
+    PHNT_REFLECT_FIELD(Unloads, "ULONG")
+    PHNT_REFLECT_FIELD(UnTrackedPool, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentNonPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(PeakPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(PeakNonPagedPoolAllocations, "ULONG")
+    PHNT_REFLECT_FIELD(PagedPoolUsageInBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(NonPagedPoolUsageInBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakPagedPoolUsageInBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakNonPagedPoolUsageInBytes, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_VERIFIER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SESSION_PROCESS_INFORMATION)
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(SizeOfBuf, "ULONG")
+    PHNT_REFLECT_FIELD(Buffer, "PVOID")
+PHNT_REFLECT_END(SYSTEM_SESSION_PROCESS_INFORMATION)
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+PHNT_REFLECT_BEGIN(SYSTEM_GDI_DRIVER_INFORMATION)
+    PHNT_REFLECT_FIELD(DriverName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(ImageAddress, "PVOID")
+    PHNT_REFLECT_FIELD(SectionPointer, "PVOID")
+    PHNT_REFLECT_FIELD(EntryPoint, "PVOID")
+    PHNT_REFLECT_FIELD(ExportSectionPointer, "PIMAGE_EXPORT_DIRECTORY")
+    PHNT_REFLECT_FIELD(ImageLength, "ULONG")
+PHNT_REFLECT_END(SYSTEM_GDI_DRIVER_INFORMATION)
+#endif
+PHNT_REFLECT_BEGIN(SYSTEM_NUMA_INFORMATION)
+    PHNT_REFLECT_FIELD(HighestNodeNumber, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(ActiveProcessorsGroupAffinity, "GROUP_AFFINITY")
+    PHNT_REFLECT_FIELD(AvailableMemory, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Pad, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_NUMA_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_POWER_INFORMATION)
+    PHNT_REFLECT_FIELD(CurrentFrequency, "UCHAR")
+    PHNT_REFLECT_FIELD(ThermalLimitFrequency, "UCHAR")
+    PHNT_REFLECT_FIELD(ConstantThrottleFrequency, "UCHAR")
+    PHNT_REFLECT_FIELD(DegradedThrottleFrequency, "UCHAR")
+    PHNT_REFLECT_FIELD(LastBusyFrequency, "UCHAR")
+    PHNT_REFLECT_FIELD(LastC3Frequency, "UCHAR")
+    PHNT_REFLECT_FIELD(LastAdjustedBusyFrequency, "UCHAR")
+    PHNT_REFLECT_FIELD(ProcessorMinThrottle, "UCHAR")
+    PHNT_REFLECT_FIELD(ProcessorMaxThrottle, "UCHAR")
+    PHNT_REFLECT_FIELD(NumberOfFrequencies, "ULONG")
+    PHNT_REFLECT_FIELD(PromotionCount, "ULONG")
+    PHNT_REFLECT_FIELD(DemotionCount, "ULONG")
+    PHNT_REFLECT_FIELD(ErrorCount, "ULONG")
+    PHNT_REFLECT_FIELD(RetryCount, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentFrequencyTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CurrentProcessorTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CurrentProcessorIdleTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LastProcessorTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LastProcessorIdleTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Energy, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_POWER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(UniqueProcessId, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(HandleValue, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(GrantedAccess, "ULONG")
+    PHNT_REFLECT_FIELD(CreatorBackTraceIndex, "USHORT")
+    PHNT_REFLECT_FIELD(ObjectTypeIndex, "USHORT")
+    PHNT_REFLECT_FIELD(HandleAttributes, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX)
+PHNT_REFLECT_BEGIN(SYSTEM_HANDLE_INFORMATION_EX)
+    PHNT_REFLECT_FIELD(NumberOfHandles, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Handles, "SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX")
+PHNT_REFLECT_END(SYSTEM_HANDLE_INFORMATION_EX)
+PHNT_REFLECT_BEGIN(SYSTEM_BIGPOOL_ENTRY)
+    PHNT_REFLECT_FIELD(VirtualAddress, "PVOID")
+    PHNT_REFLECT_BITFIELD(NonPaged, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(SizeInBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(Tag, "UCHAR")
+    PHNT_REFLECT_FIELD(TagUlong, "ULONG")
+PHNT_REFLECT_END(SYSTEM_BIGPOOL_ENTRY)
+PHNT_REFLECT_BEGIN(SYSTEM_BIGPOOL_INFORMATION)
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(AllocatedInfo, "SYSTEM_BIGPOOL_ENTRY")
+PHNT_REFLECT_END(SYSTEM_BIGPOOL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_POOL_ENTRY)
+    PHNT_REFLECT_FIELD(Allocated, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Spare0, "BOOLEAN")
+    PHNT_REFLECT_FIELD(AllocatorBackTraceIndex, "USHORT")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Tag, "UCHAR")
+    PHNT_REFLECT_FIELD(TagUlong, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessChargedQuota, "PVOID")
+PHNT_REFLECT_END(SYSTEM_POOL_ENTRY)
+PHNT_REFLECT_BEGIN(SYSTEM_POOL_INFORMATION)
+    PHNT_REFLECT_FIELD(TotalSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(FirstEntry, "PVOID")
+    PHNT_REFLECT_FIELD(EntryOverhead, "USHORT")
+    PHNT_REFLECT_FIELD(PoolTagPresent, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Spare0, "BOOLEAN")
+    PHNT_REFLECT_FIELD(NumberOfEntries, "ULONG")
+    PHNT_REFLECT_FIELD(Entries, "SYSTEM_POOL_ENTRY")
+PHNT_REFLECT_END(SYSTEM_POOL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SESSION_POOLTAG_INFORMATION)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "SIZE_T")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(TagInfo, "SYSTEM_POOLTAG")
+PHNT_REFLECT_END(SYSTEM_SESSION_POOLTAG_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SESSION_MAPPED_VIEW_INFORMATION)
+    PHNT_REFLECT_FIELD(NextEntryOffset, "SIZE_T")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(ViewFailures, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfBytesAvailable, "SIZE_T")
+    PHNT_REFLECT_FIELD(NumberOfBytesAvailableContiguous, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_SESSION_MAPPED_VIEW_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_WATCHDOG_HANDLER_INFORMATION)
+    PHNT_REFLECT_FIELD(WdHandler, "PSYSTEM_WATCHDOG_HANDLER")
+    PHNT_REFLECT_FIELD(Context, "PVOID")
+PHNT_REFLECT_END(SYSTEM_WATCHDOG_HANDLER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_WATCHDOG_TIMER_INFORMATION)
+    PHNT_REFLECT_FIELD(WdInfoClass, "WATCHDOG_INFORMATION_CLASS")
+    PHNT_REFLECT_FIELD(DataValue, "ULONG")
+PHNT_REFLECT_END(SYSTEM_WATCHDOG_TIMER_INFORMATION)
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+PHNT_REFLECT_BEGIN(SYSTEM_FIRMWARE_TABLE_INFORMATION)
+    PHNT_REFLECT_FIELD(ProviderSignature, "ULONG")
+    PHNT_REFLECT_FIELD(Action, "SYSTEM_FIRMWARE_TABLE_ACTION")
+    PHNT_REFLECT_FIELD(TableID, "ULONG")
+    PHNT_REFLECT_FIELD(TableBufferLength, "ULONG")
+    PHNT_REFLECT_FIELD(TableBuffer, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_FIRMWARE_TABLE_INFORMATION)
+#endif
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+PHNT_REFLECT_BEGIN(SYSTEM_FIRMWARE_TABLE_HANDLER)
+    PHNT_REFLECT_FIELD(ProviderSignature, "ULONG")
+    PHNT_REFLECT_FIELD(Register, "BOOLEAN")
+    PHNT_REFLECT_FIELD(FirmwareTableHandler, "PFNFTH")
+    PHNT_REFLECT_FIELD(DriverObject, "PVOID")
+PHNT_REFLECT_END(SYSTEM_FIRMWARE_TABLE_HANDLER)
+#endif
+PHNT_REFLECT_BEGIN(SYSTEM_MEMORY_LIST_INFORMATION)
+    PHNT_REFLECT_FIELD(ZeroPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FreePageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ModifiedPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ModifiedNoWritePageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BadPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(PageCountByPriority, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(RepurposedPagesByPriority, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ModifiedPageCountPageFile, "ULONG_PTR")
+PHNT_REFLECT_END(SYSTEM_MEMORY_LIST_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_THREAD_CID_PRIORITY_INFORMATION)
+    PHNT_REFLECT_FIELD(ClientId, "CLIENT_ID")
+    PHNT_REFLECT_FIELD(Priority, "KPRIORITY")
+PHNT_REFLECT_END(SYSTEM_THREAD_CID_PRIORITY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_IDLE_CYCLE_TIME_INFORMATION)
+    PHNT_REFLECT_FIELD(CycleTime, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_IDLE_CYCLE_TIME_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_VERIFIER_ISSUE)
+    PHNT_REFLECT_FIELD(IssueType, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Parameters, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_VERIFIER_ISSUE)
+PHNT_REFLECT_BEGIN(SYSTEM_VERIFIER_CANCELLATION_INFORMATION)
+    PHNT_REFLECT_FIELD(CancelProbability, "ULONG")
+    PHNT_REFLECT_FIELD(CancelThreshold, "ULONG")
+    PHNT_REFLECT_FIELD(CompletionThreshold, "ULONG")
+    PHNT_REFLECT_FIELD(CancellationVerifierDisabled, "ULONG")
+    PHNT_REFLECT_FIELD(AvailableIssues, "ULONG")
+    PHNT_REFLECT_FIELD(Issues, "SYSTEM_VERIFIER_ISSUE")
+PHNT_REFLECT_END(SYSTEM_VERIFIER_CANCELLATION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_REF_TRACE_INFORMATION)
+    PHNT_REFLECT_FIELD(TraceEnable, "BOOLEAN")
+    PHNT_REFLECT_FIELD(TracePermanent, "BOOLEAN")
+    PHNT_REFLECT_FIELD(TraceProcessName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(TracePoolTags, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_REF_TRACE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SPECIAL_POOL_INFORMATION)
+    PHNT_REFLECT_FIELD(PoolTag, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(SYSTEM_SPECIAL_POOL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESS_ID_INFORMATION)
+    PHNT_REFLECT_FIELD(ProcessId, "HANDLE")
+    PHNT_REFLECT_FIELD(ImageName, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_PROCESS_ID_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_HYPERVISOR_QUERY_INFORMATION)
+    PHNT_REFLECT_FIELD(HypervisorConnected, "BOOLEAN")
+    PHNT_REFLECT_FIELD(HypervisorDebuggingEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(HypervisorPresent, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Spare0, "BOOLEAN")
+    PHNT_REFLECT_FIELD(EnabledEnlightenments, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_HYPERVISOR_QUERY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_BOOT_ENVIRONMENT_INFORMATION)
+    PHNT_REFLECT_FIELD(BootIdentifier, "GUID")
+    PHNT_REFLECT_FIELD(FirmwareType, "FIRMWARE_TYPE")
+    PHNT_REFLECT_FIELD(BootFlags, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgMenuOsSelection, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgHiberBoot, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgSoftBoot, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgMeasuredLaunch, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgMeasuredLaunchCapable, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgSystemHiveReplace, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgMeasuredLaunchSmmProtections, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgMeasuredLaunchSmmLevel, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgBugCheckRecovery, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgFASR, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(DbgUseCachedBcd, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_BOOT_ENVIRONMENT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_IMAGE_FILE_EXECUTION_OPTIONS_INFORMATION)
+    PHNT_REFLECT_FIELD(FlagsToEnable, "ULONG")
+    PHNT_REFLECT_FIELD(FlagsToDisable, "ULONG")
+PHNT_REFLECT_END(SYSTEM_IMAGE_FILE_EXECUTION_OPTIONS_INFORMATION)
+PHNT_REFLECT_BEGIN(COVERAGE_MODULE_REQUEST)
+    PHNT_REFLECT_FIELD(RequestType, "COVERAGE_REQUEST_CODES")
+PHNT_REFLECT_END(COVERAGE_MODULE_REQUEST)
+PHNT_REFLECT_BEGIN(COVERAGE_MODULE_INFO)
+    PHNT_REFLECT_FIELD(ModuleInfoSize, "ULONG")
+    PHNT_REFLECT_FIELD(IsBinaryLoaded, "ULONG")
+    PHNT_REFLECT_FIELD(ModulePathName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(CoverageSectionSize, "ULONG")
+    PHNT_REFLECT_FIELD(CoverageSection, "UCHAR")
+PHNT_REFLECT_END(COVERAGE_MODULE_INFO)
+PHNT_REFLECT_BEGIN(COVERAGE_MODULES)
+    PHNT_REFLECT_FIELD(ListAndReset, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfModules, "ULONG")
+    PHNT_REFLECT_FIELD(ModuleRequestInfo, "COVERAGE_MODULE_REQUEST")
+    PHNT_REFLECT_FIELD(Modules, "COVERAGE_MODULE_INFO")
+PHNT_REFLECT_END(COVERAGE_MODULES)
+PHNT_REFLECT_BEGIN(SYSTEM_PREFETCH_PATCH_INFORMATION)
+    PHNT_REFLECT_FIELD(PrefetchPatchCount, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PREFETCH_PATCH_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_VERIFIER_FAULTS_INFORMATION)
+    PHNT_REFLECT_FIELD(Probability, "ULONG")
+    PHNT_REFLECT_FIELD(MaxProbability, "ULONG")
+    PHNT_REFLECT_FIELD(PoolTags, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(Applications, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_VERIFIER_FAULTS_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_VERIFIER_INFORMATION_EX)
+    PHNT_REFLECT_FIELD(VerifyMode, "ULONG")
+    PHNT_REFLECT_FIELD(OptionChanges, "ULONG")
+    PHNT_REFLECT_FIELD(PreviousBucketName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(IrpCancelTimeoutMsec, "ULONG")
+    PHNT_REFLECT_FIELD(VerifierExtensionEnabled, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+#endif
+PHNT_REFLECT_END(SYSTEM_VERIFIER_INFORMATION_EX)
+PHNT_REFLECT_BEGIN(SYSTEM_SYSTEM_PARTITION_INFORMATION)
+    PHNT_REFLECT_FIELD(SystemPartition, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_SYSTEM_PARTITION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SYSTEM_DISK_INFORMATION)
+    PHNT_REFLECT_FIELD(SystemDisk, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_SYSTEM_DISK_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_NUMA_PROXIMITY_MAP)
+    PHNT_REFLECT_FIELD(NodeProximityId, "ULONG")
+    PHNT_REFLECT_FIELD(NodeNumber, "USHORT")
+PHNT_REFLECT_END(SYSTEM_NUMA_PROXIMITY_MAP)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_PERFORMANCE_HITCOUNT)
+    PHNT_REFLECT_FIELD(Hits, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PercentFrequency, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_PERFORMANCE_HITCOUNT)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_PERFORMANCE_HITCOUNT_WIN8)
+    PHNT_REFLECT_FIELD(Hits, "ULONG")
+    PHNT_REFLECT_FIELD(PercentFrequency, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_PERFORMANCE_HITCOUNT_WIN8)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_PERFORMANCE_STATE_DISTRIBUTION)
+    PHNT_REFLECT_FIELD(ProcessorNumber, "ULONG")
+    PHNT_REFLECT_FIELD(StateCount, "ULONG")
+    PHNT_REFLECT_FIELD(States, "SYSTEM_PROCESSOR_PERFORMANCE_HITCOUNT")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_PERFORMANCE_STATE_DISTRIBUTION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_PERFORMANCE_DISTRIBUTION)
+    PHNT_REFLECT_FIELD(ProcessorCount, "ULONG")
+    PHNT_REFLECT_FIELD(Offsets, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_PERFORMANCE_DISTRIBUTION)
+PHNT_REFLECT_BEGIN(SYSTEM_CODEINTEGRITY_INFORMATION)
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(CodeIntegrityOptions, "ULONG")
+PHNT_REFLECT_END(SYSTEM_CODEINTEGRITY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_MICROCODE_UPDATE_INFORMATION)
+    PHNT_REFLECT_FIELD(Operation, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_MICROCODE_UPDATE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_VA_LIST_INFORMATION)
+    PHNT_REFLECT_FIELD(VirtualSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(VirtualPeak, "SIZE_T")
+    PHNT_REFLECT_FIELD(VirtualLimit, "SIZE_T")
+    PHNT_REFLECT_FIELD(AllocationFailures, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_VA_LIST_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_STORE_INFORMATION)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(StoreInformationClass, "STORE_INFORMATION_CLASS")
+    PHNT_REFLECT_FIELD(Data, "PVOID")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+PHNT_REFLECT_END(SYSTEM_STORE_INFORMATION)
+PHNT_REFLECT_BEGIN(SM_STATS_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(DetailLevel, "ULONG")
+    PHNT_REFLECT_BITFIELD(StoreId, "ULONG")
+    PHNT_REFLECT_FIELD(BufferSize, "ULONG")
+    PHNT_REFLECT_FIELD(Buffer, "PVOID")
+PHNT_REFLECT_END(SM_STATS_REQUEST)
+PHNT_REFLECT_BEGIN(ST_DATA_MGR_STATS)
+    PHNT_REFLECT_FIELD(RegionCount, "ULONG")
+    PHNT_REFLECT_FIELD(PagesStored, "ULONG")
+    PHNT_REFLECT_FIELD(UniquePagesStored, "ULONG")
+    PHNT_REFLECT_FIELD(LazyCleanupRegionCount, "ULONG")
+PHNT_REFLECT_END(ST_DATA_MGR_STATS)
+PHNT_REFLECT_BEGIN(ST_IO_STATS_PERIOD)
+    PHNT_REFLECT_FIELD(PageCounts, "ULONG")
+PHNT_REFLECT_END(ST_IO_STATS_PERIOD)
+PHNT_REFLECT_BEGIN(ST_IO_STATS)
+    PHNT_REFLECT_FIELD(PeriodCount, "ULONG")
+    PHNT_REFLECT_FIELD(Periods, "ST_IO_STATS_PERIOD")
+PHNT_REFLECT_END(ST_IO_STATS)
+PHNT_REFLECT_BEGIN(ST_READ_LATENCY_BUCKET)
+    PHNT_REFLECT_FIELD(LatencyUs, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+PHNT_REFLECT_END(ST_READ_LATENCY_BUCKET)
+PHNT_REFLECT_BEGIN(ST_READ_LATENCY_STATS)
+    PHNT_REFLECT_FIELD(Buckets, "ST_READ_LATENCY_BUCKET")
+PHNT_REFLECT_END(ST_READ_LATENCY_STATS)
+PHNT_REFLECT_BEGIN(ST_STATS_REGION_INFO)
+    PHNT_REFLECT_FIELD(SpaceUsed, "USHORT")
+    PHNT_REFLECT_FIELD(Priority, "UCHAR")
+    PHNT_REFLECT_FIELD(Spare, "UCHAR")
+PHNT_REFLECT_END(ST_STATS_REGION_INFO)
+PHNT_REFLECT_BEGIN(ST_STATS_SPACE_BITMAP)
+    PHNT_REFLECT_FIELD(CompressedBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(BytesPerBit, "ULONG")
+    PHNT_REFLECT_FIELD(StoreBitmap, "UCHAR")
+PHNT_REFLECT_END(ST_STATS_SPACE_BITMAP)
+PHNT_REFLECT_BEGIN(ST_STATS)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Level, "ULONG")
+    PHNT_REFLECT_BITFIELD(StoreType, "ULONG")
+    PHNT_REFLECT_BITFIELD(NoDuplication, "ULONG")
+    PHNT_REFLECT_BITFIELD(NoCompression, "ULONG")
+    PHNT_REFLECT_BITFIELD(EncryptionStrength, "ULONG")
+    PHNT_REFLECT_BITFIELD(VirtualRegions, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare0, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(CompressionFormat, "USHORT")
+    PHNT_REFLECT_FIELD(Spare, "USHORT")
+PHNT_REFLECT_END(ST_STATS)
+PHNT_REFLECT_BEGIN(SM_STORE_BASIC_PARAMS)
+    PHNT_REFLECT_BITFIELD(StoreType, "ULONG")
+    PHNT_REFLECT_BITFIELD(NoDuplication, "ULONG")
+    PHNT_REFLECT_BITFIELD(FailNoCompression, "ULONG")
+    PHNT_REFLECT_BITFIELD(NoCompression, "ULONG")
+    PHNT_REFLECT_BITFIELD(NoEncryption, "ULONG")
+    PHNT_REFLECT_BITFIELD(NoEvictOnAdd, "ULONG")
+    PHNT_REFLECT_BITFIELD(PerformsFileIo, "ULONG")
+    PHNT_REFLECT_BITFIELD(VdlNotSet, "ULONG")
+    PHNT_REFLECT_BITFIELD(UseIntermediateAddBuffer, "ULONG")
+    PHNT_REFLECT_BITFIELD(CompressNoHuff, "ULONG")
+    PHNT_REFLECT_BITFIELD(LockActiveRegions, "ULONG")
+    PHNT_REFLECT_BITFIELD(VirtualRegions, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(StoreFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Granularity, "ULONG")
+    PHNT_REFLECT_FIELD(RegionSize, "ULONG")
+    PHNT_REFLECT_FIELD(RegionCountMax, "ULONG")
+PHNT_REFLECT_END(SM_STORE_BASIC_PARAMS)
+PHNT_REFLECT_BEGIN(SMKM_REGION_EXTENT)
+    PHNT_REFLECT_FIELD(RegionCount, "ULONG")
+    PHNT_REFLECT_FIELD(ByteOffset, "SIZE_T")
+PHNT_REFLECT_END(SMKM_REGION_EXTENT)
+PHNT_REFLECT_BEGIN(SMKM_FILE_INFO)
+    PHNT_REFLECT_FIELD(FileHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(FileObject, "PFILE_OBJECT")
+    PHNT_REFLECT_FIELD(VolumeFileObject, "PFILE_OBJECT")
+    PHNT_REFLECT_FIELD(VolumeDeviceObject, "PDEVICE_OBJECT")
+    PHNT_REFLECT_FIELD(VolumePnpHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(UsageNotificationIrp, "PIRP")
+    PHNT_REFLECT_FIELD(Extents, "PSMKM_REGION_EXTENT")
+    PHNT_REFLECT_FIELD(ExtentCount, "ULONG")
+PHNT_REFLECT_END(SMKM_FILE_INFO)
+PHNT_REFLECT_BEGIN(SM_STORE_CACHE_BACKED_PARAMS)
+    PHNT_REFLECT_FIELD(SectorSize, "ULONG")
+    PHNT_REFLECT_FIELD(EncryptionKey, "PCHAR")
+    PHNT_REFLECT_FIELD(EncryptionKeySize, "ULONG")
+    PHNT_REFLECT_FIELD(FileInfo, "PSMKM_FILE_INFO")
+    PHNT_REFLECT_FIELD(EtaContext, "PVOID")
+    PHNT_REFLECT_FIELD(StoreRegionBitmap, "PRTL_BITMAP")
+PHNT_REFLECT_END(SM_STORE_CACHE_BACKED_PARAMS)
+PHNT_REFLECT_BEGIN(SM_STORE_PARAMETERS)
+    PHNT_REFLECT_FIELD(Store, "SM_STORE_BASIC_PARAMS")
+    PHNT_REFLECT_FIELD(Priority, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(CacheBacked, "SM_STORE_CACHE_BACKED_PARAMS")
+PHNT_REFLECT_END(SM_STORE_PARAMETERS)
+PHNT_REFLECT_BEGIN(SM_CREATE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(AcquireReference, "ULONG")
+    PHNT_REFLECT_BITFIELD(KeyedStore, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(Params, "SM_STORE_PARAMETERS")
+    PHNT_REFLECT_FIELD(StoreId, "ULONG")
+PHNT_REFLECT_END(SM_CREATE_REQUEST)
+PHNT_REFLECT_BEGIN(SM_DELETE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(StoreId, "ULONG")
+PHNT_REFLECT_END(SM_DELETE_REQUEST)
+PHNT_REFLECT_BEGIN(SM_STORE_LIST_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(StoreCount, "ULONG")
+    PHNT_REFLECT_BITFIELD(ExtendedRequest, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(StoreId, "ULONG")
+PHNT_REFLECT_END(SM_STORE_LIST_REQUEST)
+PHNT_REFLECT_BEGIN(SM_STORE_LIST_REQUEST_EX)
+    PHNT_REFLECT_FIELD(Request, "SM_STORE_LIST_REQUEST")
+    PHNT_REFLECT_FIELD(NameBuffer, "WCHAR")
+PHNT_REFLECT_END(SM_STORE_LIST_REQUEST_EX)
+PHNT_REFLECT_BEGIN(SMC_CACHE_LIST_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(CacheCount, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CacheId, "ULONG")
+PHNT_REFLECT_END(SMC_CACHE_LIST_REQUEST)
+PHNT_REFLECT_BEGIN(SMC_CACHE_PARAMETERS)
+    PHNT_REFLECT_FIELD(CacheFileSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(StoreAlignment, "ULONG")
+    PHNT_REFLECT_BITFIELD(PerformsFileIo, "ULONG")
+    PHNT_REFLECT_BITFIELD(VdlNotSet, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CacheFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Priority, "ULONG")
+PHNT_REFLECT_END(SMC_CACHE_PARAMETERS)
+PHNT_REFLECT_BEGIN(SMC_CACHE_CREATE_PARAMETERS)
+    PHNT_REFLECT_FIELD(CacheParameters, "SMC_CACHE_PARAMETERS")
+    PHNT_REFLECT_FIELD(TemplateFilePath, "WCHAR")
+PHNT_REFLECT_END(SMC_CACHE_CREATE_PARAMETERS)
+PHNT_REFLECT_BEGIN(SMC_CACHE_CREATE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CacheId, "ULONG")
+    PHNT_REFLECT_FIELD(CacheCreateParams, "SMC_CACHE_CREATE_PARAMETERS")
+PHNT_REFLECT_END(SMC_CACHE_CREATE_REQUEST)
+PHNT_REFLECT_BEGIN(SMC_CACHE_DELETE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CacheId, "ULONG")
+PHNT_REFLECT_END(SMC_CACHE_DELETE_REQUEST)
+PHNT_REFLECT_BEGIN(SMC_STORE_CREATE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(StoreParams, "SM_STORE_BASIC_PARAMS")
+    PHNT_REFLECT_FIELD(CacheId, "ULONG")
+    PHNT_REFLECT_FIELD(StoreManagerType, "SM_STORE_MANAGER_TYPE")
+    PHNT_REFLECT_FIELD(StoreId, "ULONG")
+PHNT_REFLECT_END(SMC_STORE_CREATE_REQUEST)
+PHNT_REFLECT_BEGIN(SMC_STORE_DELETE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CacheId, "ULONG")
+    PHNT_REFLECT_FIELD(StoreManagerType, "SM_STORE_MANAGER_TYPE")
+    PHNT_REFLECT_FIELD(StoreId, "ULONG")
+PHNT_REFLECT_END(SMC_STORE_DELETE_REQUEST)
+PHNT_REFLECT_BEGIN(SMC_CACHE_STATS)
+    PHNT_REFLECT_FIELD(TotalFileSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(StoreCount, "ULONG")
+    PHNT_REFLECT_FIELD(RegionCount, "ULONG")
+    PHNT_REFLECT_FIELD(RegionSizeBytes, "ULONG")
+    PHNT_REFLECT_BITFIELD(FileCount, "ULONG")
+    PHNT_REFLECT_BITFIELD(PerformsFileIo, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(StoreIds, "ULONG")
+    PHNT_REFLECT_FIELD(PhysicalStoreBitmap, "ULONG")
+    PHNT_REFLECT_FIELD(Priority, "ULONG")
+    PHNT_REFLECT_FIELD(TemplateFilePath, "WCHAR")
+PHNT_REFLECT_END(SMC_CACHE_STATS)
+PHNT_REFLECT_BEGIN(SMC_CACHE_STATS_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(NoFilePath, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CacheId, "ULONG")
+    PHNT_REFLECT_FIELD(CacheStats, "SMC_CACHE_STATS")
+PHNT_REFLECT_END(SMC_CACHE_STATS_REQUEST)
+PHNT_REFLECT_BEGIN(SM_REGISTRATION_INFO)
+    PHNT_REFLECT_FIELD(CachesUpdatedEvent, "HANDLE")
+PHNT_REFLECT_END(SM_REGISTRATION_INFO)
+PHNT_REFLECT_BEGIN(SM_REGISTRATION_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(RegInfo, "SM_REGISTRATION_INFO")
+PHNT_REFLECT_END(SM_REGISTRATION_REQUEST)
+PHNT_REFLECT_BEGIN(SM_STORE_RESIZE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(AddRegions, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(StoreId, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfRegions, "ULONG")
+    PHNT_REFLECT_FIELD(RegionBitmap, "PRTL_BITMAP")
+PHNT_REFLECT_END(SM_STORE_RESIZE_REQUEST)
+PHNT_REFLECT_BEGIN(SMC_STORE_RESIZE_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(AddRegions, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CacheId, "ULONG")
+    PHNT_REFLECT_FIELD(StoreId, "ULONG")
+    PHNT_REFLECT_FIELD(StoreManagerType, "SM_STORE_MANAGER_TYPE")
+    PHNT_REFLECT_FIELD(RegionCount, "ULONG")
+PHNT_REFLECT_END(SMC_STORE_RESIZE_REQUEST)
+PHNT_REFLECT_BEGIN(SM_CONFIG_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_BITFIELD(ConfigType, "ULONG")
+    PHNT_REFLECT_FIELD(ConfigValue, "ULONG")
+PHNT_REFLECT_END(SM_CONFIG_REQUEST)
+PHNT_REFLECT_BEGIN(SM_STORE_HIGH_MEM_PRIORITY_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(SetHighMemoryPriority, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessHandle, "HANDLE")
+PHNT_REFLECT_END(SM_STORE_HIGH_MEM_PRIORITY_REQUEST)
+PHNT_REFLECT_BEGIN(SM_SYSTEM_STORE_TRIM_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(PagesToTrim, "SIZE_T")
+PHNT_REFLECT_END(SM_SYSTEM_STORE_TRIM_REQUEST)
+PHNT_REFLECT_BEGIN(SM_MEM_COMPRESSION_INFO_REQUEST)
+    PHNT_REFLECT_BITFIELD(Version, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CompressionPid, "ULONG")
+    PHNT_REFLECT_FIELD(WorkingSetSize, "ULONG")
+    PHNT_REFLECT_FIELD(TotalDataCompressed, "SIZE_T")
+    PHNT_REFLECT_FIELD(TotalCompressedSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(TotalUniqueDataCompressed, "SIZE_T")
+PHNT_REFLECT_END(SM_MEM_COMPRESSION_INFO_REQUEST)
+PHNT_REFLECT_BEGIN(SYSTEM_REGISTRY_APPEND_STRING_PARAMETERS)
+    PHNT_REFLECT_FIELD(KeyHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(ValueNamePointer, "PUNICODE_STRING")
+    PHNT_REFLECT_FIELD(RequiredLengthPointer, "PULONG")
+    PHNT_REFLECT_FIELD(Buffer, "PUCHAR")
+    PHNT_REFLECT_FIELD(BufferLength, "ULONG")
+    PHNT_REFLECT_FIELD(Type, "ULONG")
+    PHNT_REFLECT_FIELD(AppendBuffer, "PUCHAR")
+    PHNT_REFLECT_FIELD(AppendBufferLength, "ULONG")
+    PHNT_REFLECT_FIELD(CreateIfDoesntExist, "BOOLEAN")
+    PHNT_REFLECT_FIELD(TruncateExistingValue, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_REGISTRY_APPEND_STRING_PARAMETERS)
+PHNT_REFLECT_BEGIN(SYSTEM_VHD_BOOT_INFORMATION)
+    PHNT_REFLECT_FIELD(OsDiskIsVhd, "BOOLEAN")
+    PHNT_REFLECT_FIELD(OsVhdFilePathOffset, "ULONG")
+    PHNT_REFLECT_FIELD(OsVhdParentVolume, "WCHAR")
+PHNT_REFLECT_END(SYSTEM_VHD_BOOT_INFORMATION)
+PHNT_REFLECT_BEGIN(PS_CPU_QUOTA_QUERY_ENTRY)
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(Weight, "ULONG")
+PHNT_REFLECT_END(PS_CPU_QUOTA_QUERY_ENTRY)
+PHNT_REFLECT_BEGIN(PS_CPU_QUOTA_QUERY_INFORMATION)
+    PHNT_REFLECT_FIELD(SessionCount, "ULONG")
+    PHNT_REFLECT_FIELD(SessionInformation, "PS_CPU_QUOTA_QUERY_ENTRY")
+PHNT_REFLECT_END(PS_CPU_QUOTA_QUERY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ERROR_PORT_TIMEOUTS)
+    PHNT_REFLECT_FIELD(StartTimeout, "ULONG")
+    PHNT_REFLECT_FIELD(CommTimeout, "ULONG")
+PHNT_REFLECT_END(SYSTEM_ERROR_PORT_TIMEOUTS)
+PHNT_REFLECT_BEGIN(SYSTEM_LOW_PRIORITY_IO_INFORMATION)
+    PHNT_REFLECT_FIELD(LowPriReadOperations, "ULONG")
+    PHNT_REFLECT_FIELD(LowPriWriteOperations, "ULONG")
+    PHNT_REFLECT_FIELD(KernelBumpedToNormalOperations, "ULONG")
+    PHNT_REFLECT_FIELD(LowPriPagingReadOperations, "ULONG")
+    PHNT_REFLECT_FIELD(KernelPagingReadsBumpedToNormal, "ULONG")
+    PHNT_REFLECT_FIELD(LowPriPagingWriteOperations, "ULONG")
+    PHNT_REFLECT_FIELD(KernelPagingWritesBumpedToNormal, "ULONG")
+    PHNT_REFLECT_FIELD(BoostedIrpCount, "ULONG")
+    PHNT_REFLECT_FIELD(BoostedPagingIrpCount, "ULONG")
+    PHNT_REFLECT_FIELD(BlanketBoostCount, "ULONG")
+PHNT_REFLECT_END(SYSTEM_LOW_PRIORITY_IO_INFORMATION)
+PHNT_REFLECT_BEGIN(TPM_BOOT_ENTROPY_NT_RESULT)
+    PHNT_REFLECT_FIELD(Policy, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ResultCode, "TPM_BOOT_ENTROPY_RESULT_CODE")
+    PHNT_REFLECT_FIELD(ResultStatus, "NTSTATUS")
+    PHNT_REFLECT_FIELD(Time, "ULONGLONG")
+    PHNT_REFLECT_FIELD(EntropyLength, "ULONG")
+    PHNT_REFLECT_FIELD(EntropyData, "UCHAR")
+PHNT_REFLECT_END(TPM_BOOT_ENTROPY_NT_RESULT)
+PHNT_REFLECT_BEGIN(SYSTEM_VERIFIER_COUNTERS_INFORMATION)
+    PHNT_REFLECT_FIELD(Legacy, "SYSTEM_VERIFIER_INFORMATION")
+    PHNT_REFLECT_FIELD(RaiseIrqls, "ULONG")
+    PHNT_REFLECT_FIELD(AcquireSpinLocks, "ULONG")
+    PHNT_REFLECT_FIELD(SynchronizeExecutions, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsWithNoTag, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsFailed, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationsFailedDeliberately, "ULONG")
+    PHNT_REFLECT_FIELD(LockedBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakLockedBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(MappedLockedBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakMappedLockedBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(MappedIoSpaceBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakMappedIoSpaceBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PagesForMdlBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakPagesForMdlBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(ContiguousMemoryBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakContiguousMemoryBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(ExecutePoolTypes, "ULONG")
+    PHNT_REFLECT_FIELD(ExecutePageProtections, "ULONG")
+    PHNT_REFLECT_FIELD(ExecutePageMappings, "ULONG")
+    PHNT_REFLECT_FIELD(ExecuteWriteSections, "ULONG")
+    PHNT_REFLECT_FIELD(SectionAlignmentFailures, "ULONG")
+    PHNT_REFLECT_FIELD(UnsupportedRelocs, "ULONG")
+    PHNT_REFLECT_FIELD(IATInExecutableSection, "ULONG")
+PHNT_REFLECT_END(SYSTEM_VERIFIER_COUNTERS_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ACPI_AUDIT_INFORMATION)
+    PHNT_REFLECT_FIELD(RsdpCount, "ULONG")
+    PHNT_REFLECT_BITFIELD(SameRsdt, "ULONG")
+    PHNT_REFLECT_BITFIELD(SlicPresent, "ULONG")
+    PHNT_REFLECT_BITFIELD(SlicDifferent, "ULONG")
+PHNT_REFLECT_END(SYSTEM_ACPI_AUDIT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_BASIC_PERFORMANCE_INFORMATION)
+    PHNT_REFLECT_FIELD(AvailablePages, "SIZE_T")
+    PHNT_REFLECT_FIELD(CommittedPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(CommitLimit, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakCommitment, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_BASIC_PERFORMANCE_INFORMATION)
+PHNT_REFLECT_BEGIN(QUERY_PERFORMANCE_COUNTER_FLAGS)
+    PHNT_REFLECT_BITFIELD(KernelTransition, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(ul, "ULONG")
+PHNT_REFLECT_END(QUERY_PERFORMANCE_COUNTER_FLAGS)
+PHNT_REFLECT_BEGIN(SYSTEM_QUERY_PERFORMANCE_COUNTER_INFORMATION)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "QUERY_PERFORMANCE_COUNTER_FLAGS")
+    PHNT_REFLECT_FIELD(ValidFlags, "QUERY_PERFORMANCE_COUNTER_FLAGS")
+PHNT_REFLECT_END(SYSTEM_QUERY_PERFORMANCE_COUNTER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_BOOT_GRAPHICS_INFORMATION)
+    PHNT_REFLECT_FIELD(FrameBuffer, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Width, "ULONG")
+    PHNT_REFLECT_FIELD(Height, "ULONG")
+    PHNT_REFLECT_FIELD(PixelStride, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(Format, "SYSTEM_PIXEL_FORMAT")
+    PHNT_REFLECT_FIELD(DisplayRotation, "ULONG")
+PHNT_REFLECT_END(SYSTEM_BOOT_GRAPHICS_INFORMATION)
+PHNT_REFLECT_BEGIN(MEMORY_SCRUB_INFORMATION)
+    PHNT_REFLECT_FIELD(Handle, "HANDLE")
+    PHNT_REFLECT_FIELD(PagesScrubbed, "ULONG_PTR")
+PHNT_REFLECT_END(MEMORY_SCRUB_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_BAD_PAGE_INFORMATION)
+#ifdef _WIN64
+    PHNT_REFLECT_BITFIELD(PhysicalPageNumber, "ULONG_PTR")
+#else
+    PHNT_REFLECT_BITFIELD(PhysicalPageNumber, "ULONG")
+#endif
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG_PTR")
+    PHNT_REFLECT_BITFIELD(Pending, "ULONG_PTR")
+    PHNT_REFLECT_BITFIELD(Poisoned, "ULONG_PTR")
+PHNT_REFLECT_END(SYSTEM_BAD_PAGE_INFORMATION)
+PHNT_REFLECT_BEGIN(PEBS_DS_SAVE_AREA32)
+    PHNT_REFLECT_FIELD(BtsBufferBase, "ULONG")
+    PHNT_REFLECT_FIELD(BtsIndex, "ULONG")
+    PHNT_REFLECT_FIELD(BtsAbsoluteMaximum, "ULONG")
+    PHNT_REFLECT_FIELD(BtsInterruptThreshold, "ULONG")
+    PHNT_REFLECT_FIELD(PebsBufferBase, "ULONG")
+    PHNT_REFLECT_FIELD(PebsIndex, "ULONG")
+    PHNT_REFLECT_FIELD(PebsAbsoluteMaximum, "ULONG")
+    PHNT_REFLECT_FIELD(PebsInterruptThreshold, "ULONG")
+    PHNT_REFLECT_FIELD(PebsGpCounterReset, "ULONG")
+    PHNT_REFLECT_FIELD(PebsFixedCounterReset, "ULONG")
+PHNT_REFLECT_END(PEBS_DS_SAVE_AREA32)
+PHNT_REFLECT_BEGIN(PEBS_DS_SAVE_AREA64)
+    PHNT_REFLECT_FIELD(BtsBufferBase, "ULONGLONG")
+    PHNT_REFLECT_FIELD(BtsIndex, "ULONGLONG")
+    PHNT_REFLECT_FIELD(BtsAbsoluteMaximum, "ULONGLONG")
+    PHNT_REFLECT_FIELD(BtsInterruptThreshold, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PebsBufferBase, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PebsIndex, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PebsAbsoluteMaximum, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PebsInterruptThreshold, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PebsGpCounterReset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PebsFixedCounterReset, "ULONGLONG")
+PHNT_REFLECT_END(PEBS_DS_SAVE_AREA64)
+PHNT_REFLECT_BEGIN(PEBS_DS_SAVE_AREA)
+    PHNT_REFLECT_FIELD(As32Bit, "PEBS_DS_SAVE_AREA32")
+    PHNT_REFLECT_FIELD(As64Bit, "PEBS_DS_SAVE_AREA64")
+PHNT_REFLECT_END(PEBS_DS_SAVE_AREA)
+PHNT_REFLECT_BEGIN(PROCESSOR_PROFILE_CONTROL_AREA)
+    PHNT_REFLECT_FIELD(PebsDsSaveArea, "PEBS_DS_SAVE_AREA")
+PHNT_REFLECT_END(PROCESSOR_PROFILE_CONTROL_AREA)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_PROFILE_CONTROL_AREA)
+    PHNT_REFLECT_FIELD(ProcessorProfileControlArea, "PROCESSOR_PROFILE_CONTROL_AREA")
+    PHNT_REFLECT_FIELD(Allocate, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_PROFILE_CONTROL_AREA)
+PHNT_REFLECT_BEGIN(MEMORY_COMBINE_INFORMATION)
+    PHNT_REFLECT_FIELD(Handle, "HANDLE")
+    PHNT_REFLECT_FIELD(PagesCombined, "ULONG_PTR")
+PHNT_REFLECT_END(MEMORY_COMBINE_INFORMATION)
+PHNT_REFLECT_BEGIN(MEMORY_COMBINE_INFORMATION_EX)
+    PHNT_REFLECT_FIELD(Handle, "HANDLE")
+    PHNT_REFLECT_FIELD(PagesCombined, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(MEMORY_COMBINE_INFORMATION_EX)
+PHNT_REFLECT_BEGIN(MEMORY_COMBINE_INFORMATION_EX2)
+    PHNT_REFLECT_FIELD(Handle, "HANDLE")
+    PHNT_REFLECT_FIELD(PagesCombined, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessHandle, "HANDLE")
+PHNT_REFLECT_END(MEMORY_COMBINE_INFORMATION_EX2)
+PHNT_REFLECT_BEGIN(SYSTEM_ENTROPY_TIMING_INFORMATION)
+    PHNT_REFLECT_FIELD(EntropyRoutine, "VOID(*)")
+    PHNT_REFLECT_FIELD(InitializationRoutine, "VOID(*)")
+    PHNT_REFLECT_FIELD(InitializationContext, "PVOID")
+PHNT_REFLECT_END(SYSTEM_ENTROPY_TIMING_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CONSOLE_INFORMATION)
+    PHNT_REFLECT_BITFIELD(DriverLoaded, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+PHNT_REFLECT_END(SYSTEM_CONSOLE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PLATFORM_BINARY_INFORMATION)
+    PHNT_REFLECT_FIELD(PhysicalAddress, "ULONG64")
+    PHNT_REFLECT_FIELD(HandoffBuffer, "PVOID")
+    PHNT_REFLECT_FIELD(CommandLineBuffer, "PVOID")
+    PHNT_REFLECT_FIELD(HandoffBufferSize, "ULONG")
+    PHNT_REFLECT_FIELD(CommandLineBufferSize, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PLATFORM_BINARY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_POLICY_INFORMATION)
+    PHNT_REFLECT_FIELD(InputData, "PVOID")
+    PHNT_REFLECT_FIELD(OutputData, "PVOID")
+    PHNT_REFLECT_FIELD(InputDataSize, "ULONG")
+    PHNT_REFLECT_FIELD(OutputDataSize, "ULONG")
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+PHNT_REFLECT_END(SYSTEM_POLICY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_HYPERVISOR_PROCESSOR_COUNT_INFORMATION)
+    PHNT_REFLECT_FIELD(NumberOfLogicalProcessors, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfCores, "ULONG")
+PHNT_REFLECT_END(SYSTEM_HYPERVISOR_PROCESSOR_COUNT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_DEVICE_DATA_INFORMATION)
+    PHNT_REFLECT_FIELD(DeviceId, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(DataName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(DataType, "ULONG")
+    PHNT_REFLECT_FIELD(DataBufferLength, "ULONG")
+    PHNT_REFLECT_FIELD(DataBuffer, "PVOID")
+PHNT_REFLECT_END(SYSTEM_DEVICE_DATA_INFORMATION)
+PHNT_REFLECT_BEGIN(PHYSICAL_CHANNEL_RUN)
+    PHNT_REFLECT_FIELD(NodeNumber, "ULONG")
+    PHNT_REFLECT_FIELD(ChannelNumber, "ULONG")
+    PHNT_REFLECT_FIELD(BasePage, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PageCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(PHYSICAL_CHANNEL_RUN)
+PHNT_REFLECT_BEGIN(SYSTEM_MEMORY_TOPOLOGY_INFORMATION)
+    PHNT_REFLECT_FIELD(NumberOfRuns, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NumberOfNodes, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfChannels, "ULONG")
+    PHNT_REFLECT_FIELD(Run, "PHYSICAL_CHANNEL_RUN")
+PHNT_REFLECT_END(SYSTEM_MEMORY_TOPOLOGY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_MEMORY_CHANNEL_INFORMATION)
+    PHNT_REFLECT_FIELD(ChannelNumber, "ULONG")
+    PHNT_REFLECT_FIELD(ChannelHeatIndex, "ULONG")
+    PHNT_REFLECT_FIELD(TotalPageCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ZeroPageCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(FreePageCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(StandbyPageCount, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_MEMORY_CHANNEL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_BOOT_LOGO_INFORMATION)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(BitmapOffset, "ULONG")
+PHNT_REFLECT_END(SYSTEM_BOOT_LOGO_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION_EX)
+    PHNT_REFLECT_FIELD(IdleTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(KernelTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(UserTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(DpcTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(InterruptTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(InterruptCount, "ULONG")
+    PHNT_REFLECT_FIELD(Spare0, "ULONG")
+    PHNT_REFLECT_FIELD(AvailableTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Spare1, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Spare2, "LARGE_INTEGER")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_PERFORMANCE_INFORMATION_EX)
+PHNT_REFLECT_BEGIN(SYSTEM_SECUREBOOT_POLICY_INFORMATION)
+    PHNT_REFLECT_FIELD(PolicyPublisher, "GUID")
+    PHNT_REFLECT_FIELD(PolicyVersion, "ULONG")
+    PHNT_REFLECT_FIELD(PolicyOptions, "ULONG")
+PHNT_REFLECT_END(SYSTEM_SECUREBOOT_POLICY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PAGEFILE_INFORMATION_EX)
+    PHNT_REFLECT_FIELD(Info, "SYSTEM_PAGEFILE_INFORMATION")
+    PHNT_REFLECT_FIELD(NextEntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(TotalSize, "ULONG")
+    PHNT_REFLECT_FIELD(TotalInUse, "ULONG")
+    PHNT_REFLECT_FIELD(PeakUsage, "ULONG")
+    PHNT_REFLECT_FIELD(PageFileName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(MinimumSize, "ULONG")
+    PHNT_REFLECT_FIELD(MaximumSize, "ULONG")
+PHNT_REFLECT_END(SYSTEM_PAGEFILE_INFORMATION_EX)
+PHNT_REFLECT_BEGIN(SYSTEM_SECUREBOOT_INFORMATION)
+    PHNT_REFLECT_FIELD(SecureBootEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(SecureBootCapable, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_SECUREBOOT_INFORMATION)
+PHNT_REFLECT_BEGIN(PROCESS_DISK_COUNTERS)
+    PHNT_REFLECT_FIELD(BytesRead, "ULONGLONG")
+    PHNT_REFLECT_FIELD(BytesWritten, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ReadOperationCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(WriteOperationCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(FlushOperationCount, "ULONGLONG")
+PHNT_REFLECT_END(PROCESS_DISK_COUNTERS)
+PHNT_REFLECT_BEGIN(ENERGY_STATE_DURATION)
+    PHNT_REFLECT_FIELD(Value, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LastChangeTime, "ULONG")
+    PHNT_REFLECT_BITFIELD(Duration, "ULONG")
+    PHNT_REFLECT_BITFIELD(IsInState, "ULONG")
+PHNT_REFLECT_END(ENERGY_STATE_DURATION)
+PHNT_REFLECT_BEGIN(PROCESS_ENERGY_VALUES)
+    PHNT_REFLECT_FIELD(Cycles, "ULONGLONG")
+    PHNT_REFLECT_FIELD(DiskEnergy, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NetworkTailEnergy, "ULONGLONG")
+    PHNT_REFLECT_FIELD(MBBTailEnergy, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NetworkTxRxBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(MBBTxRxBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Durations, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(ForegroundDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(DesktopVisibleDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(PSMForegroundDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(CompositionRendered, "ULONG")
+    PHNT_REFLECT_FIELD(CompositionDirtyGenerated, "ULONG")
+    PHNT_REFLECT_FIELD(CompositionDirtyPropagated, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved1, "ULONG")
+    PHNT_REFLECT_FIELD(AttributedCycles, "ULONGLONG")
+    PHNT_REFLECT_FIELD(WorkOnBehalfCycles, "ULONGLONG")
+PHNT_REFLECT_END(PROCESS_ENERGY_VALUES)
+PHNT_REFLECT_BEGIN(TIMELINE_BITMAP)
+    PHNT_REFLECT_FIELD(Value, "ULONGLONG")
+    PHNT_REFLECT_FIELD(EndTime, "ULONG")
+    PHNT_REFLECT_FIELD(Bitmap, "ULONG")
+PHNT_REFLECT_END(TIMELINE_BITMAP)
+PHNT_REFLECT_BEGIN(PROCESS_ENERGY_VALUES_EXTENSION)
+    PHNT_REFLECT_FIELD(Timelines, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(CpuTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(DiskTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(NetworkTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(MBBTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(ForegroundTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(DesktopVisibleTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(CompositionRenderedTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(CompositionDirtyGeneratedTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(CompositionDirtyPropagatedTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(InputTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(AudioInTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(AudioOutTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(DisplayRequiredTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(KeyboardInputTimeline, "TIMELINE_BITMAP")
+    PHNT_REFLECT_FIELD(Durations, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(InputDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(AudioInDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(AudioOutDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(DisplayRequiredDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(PSMBackgroundDuration, "ENERGY_STATE_DURATION")
+    PHNT_REFLECT_FIELD(KeyboardInput, "ULONG")
+    PHNT_REFLECT_FIELD(MouseInput, "ULONG")
+PHNT_REFLECT_END(PROCESS_ENERGY_VALUES_EXTENSION)
+PHNT_REFLECT_BEGIN(PROCESS_EXTENDED_ENERGY_VALUES)
+    PHNT_REFLECT_FIELD(Base, "PROCESS_ENERGY_VALUES")
+    PHNT_REFLECT_FIELD(Extension, "PROCESS_ENERGY_VALUES_EXTENSION")
+PHNT_REFLECT_END(PROCESS_EXTENDED_ENERGY_VALUES)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESS_INFORMATION_EXTENSION)
+    PHNT_REFLECT_FIELD(DiskCounters, "PROCESS_DISK_COUNTERS")
+    PHNT_REFLECT_FIELD(ContextSwitches, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_BITFIELD(HasStrongId, "ULONG")
+    PHNT_REFLECT_BITFIELD(Classification, "ULONG")
+    PHNT_REFLECT_BITFIELD(BackgroundActivityModerated, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(UserSidOffset, "ULONG")
+    PHNT_REFLECT_FIELD(PackageFullNameOffset, "ULONG")
+    PHNT_REFLECT_FIELD(EnergyValues, "PROCESS_ENERGY_VALUES")
+    PHNT_REFLECT_FIELD(AppIdOffset, "ULONG")
+    PHNT_REFLECT_FIELD(SharedCommitCharge, "SIZE_T")
+    PHNT_REFLECT_FIELD(JobObjectId, "ULONG")
+    PHNT_REFLECT_FIELD(SpareUlong, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessSequenceNumber, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_PROCESS_INFORMATION_EXTENSION)
+PHNT_REFLECT_BEGIN(SYSTEM_PORTABLE_WORKSPACE_EFI_LAUNCHER_INFORMATION)
+    PHNT_REFLECT_FIELD(EfiLauncherEnabled, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_PORTABLE_WORKSPACE_EFI_LAUNCHER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_KERNEL_DEBUGGER_INFORMATION_EX)
+    PHNT_REFLECT_FIELD(DebuggerAllowed, "BOOLEAN")
+    PHNT_REFLECT_FIELD(DebuggerEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(DebuggerPresent, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_KERNEL_DEBUGGER_INFORMATION_EX)
+PHNT_REFLECT_BEGIN(SYSTEM_ELAM_CERTIFICATE_INFORMATION)
+    PHNT_REFLECT_FIELD(ElamDriverFile, "HANDLE")
+PHNT_REFLECT_END(SYSTEM_ELAM_CERTIFICATE_INFORMATION)
+PHNT_REFLECT_BEGIN(OFFLINE_CRASHDUMP_CONFIGURATION_TABLE_V2)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(AbnormalResetOccurred, "ULONG")
+    PHNT_REFLECT_FIELD(OfflineMemoryDumpCapable, "ULONG")
+    PHNT_REFLECT_FIELD(ResetDataAddress, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(ResetDataSize, "ULONG")
+PHNT_REFLECT_END(OFFLINE_CRASHDUMP_CONFIGURATION_TABLE_V2)
+PHNT_REFLECT_BEGIN(OFFLINE_CRASHDUMP_CONFIGURATION_TABLE_V1)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(AbnormalResetOccurred, "ULONG")
+    PHNT_REFLECT_FIELD(OfflineMemoryDumpCapable, "ULONG")
+PHNT_REFLECT_END(OFFLINE_CRASHDUMP_CONFIGURATION_TABLE_V1)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_FEATURES_INFORMATION)
+    PHNT_REFLECT_FIELD(ProcessorFeatureBits, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_FEATURES_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_EDID_INFORMATION)
+    PHNT_REFLECT_FIELD(Edid, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_EDID_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_MANUFACTURING_INFORMATION)
+    PHNT_REFLECT_FIELD(Options, "ULONG")
+    PHNT_REFLECT_FIELD(ProfileName, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_MANUFACTURING_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ENERGY_ESTIMATION_CONFIG_INFORMATION)
+    PHNT_REFLECT_FIELD(Enabled, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_ENERGY_ESTIMATION_CONFIG_INFORMATION)
+PHNT_REFLECT_BEGIN(HV_DETAILS)
+    PHNT_REFLECT_FIELD(Data, "ULONG")
+PHNT_REFLECT_END(HV_DETAILS)
+PHNT_REFLECT_BEGIN(SYSTEM_HYPERVISOR_DETAIL_INFORMATION)
+    PHNT_REFLECT_FIELD(HvVendorAndMaxFunction, "HV_DETAILS")
+    PHNT_REFLECT_FIELD(HypervisorInterface, "HV_DETAILS")
+    PHNT_REFLECT_FIELD(HypervisorVersion, "HV_DETAILS")
+    PHNT_REFLECT_FIELD(HvFeatures, "HV_DETAILS")
+    PHNT_REFLECT_FIELD(HwFeatures, "HV_DETAILS")
+    PHNT_REFLECT_FIELD(EnlightenmentInfo, "HV_DETAILS")
+    PHNT_REFLECT_FIELD(ImplementationLimits, "HV_DETAILS")
+PHNT_REFLECT_END(SYSTEM_HYPERVISOR_DETAIL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PROCESSOR_CYCLE_STATS_INFORMATION)
+    PHNT_REFLECT_FIELD(Cycles, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_PROCESSOR_CYCLE_STATS_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_TPM_INFORMATION)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(SYSTEM_TPM_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_VSM_PROTECTION_INFORMATION)
+    PHNT_REFLECT_FIELD(DmaProtectionsAvailable, "BOOLEAN")
+    PHNT_REFLECT_FIELD(DmaProtectionsInUse, "BOOLEAN")
+    PHNT_REFLECT_FIELD(HardwareMbecAvailable, "BOOLEAN")
+    PHNT_REFLECT_FIELD(ApicVirtualizationAvailable, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_VSM_PROTECTION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_KERNEL_DEBUGGER_FLAGS)
+    PHNT_REFLECT_FIELD(KernelDebuggerIgnoreUmExceptions, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_KERNEL_DEBUGGER_FLAGS)
+PHNT_REFLECT_BEGIN(SYSTEM_CODEINTEGRITYPOLICY_INFORMATION)
+    PHNT_REFLECT_FIELD(Options, "ULONG")
+    PHNT_REFLECT_FIELD(HVCIOptions, "ULONG")
+    PHNT_REFLECT_FIELD(Version, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PolicyGuid, "GUID")
+PHNT_REFLECT_END(SYSTEM_CODEINTEGRITYPOLICY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ISOLATED_USER_MODE_INFORMATION)
+    PHNT_REFLECT_BITFIELD(SecureKernelRunning, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(HvciEnabled, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(HvciStrictMode, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(DebugEnabled, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(FirmwarePageProtection, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(EncryptionKeyAvailable, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(SpareFlags, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(TrustletRunning, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(HvciDisableAllowed, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(HardwareEnforcedVbs, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(NoSecrets, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(EncryptionKeyPersistent, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(HardwareEnforcedHvpt, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(HardwareHvptAvailable, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(SpareFlags2, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Spare0, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Spare1, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_ISOLATED_USER_MODE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_INTERRUPT_CPU_SET_INFORMATION)
+    PHNT_REFLECT_FIELD(Gsiv, "ULONG")
+    PHNT_REFLECT_FIELD(Group, "USHORT")
+    PHNT_REFLECT_FIELD(CpuSets, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_INTERRUPT_CPU_SET_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SECUREBOOT_POLICY_FULL_INFORMATION)
+    PHNT_REFLECT_FIELD(PolicyInformation, "SYSTEM_SECUREBOOT_POLICY_INFORMATION")
+    PHNT_REFLECT_FIELD(PolicySize, "ULONG")
+    PHNT_REFLECT_FIELD(Policy, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_SECUREBOOT_POLICY_FULL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ROOT_SILO_INFORMATION)
+    PHNT_REFLECT_FIELD(NumberOfSilos, "ULONG")
+    PHNT_REFLECT_FIELD(SiloIdList, "ULONG")
+PHNT_REFLECT_END(SYSTEM_ROOT_SILO_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CPU_SET_TAG_INFORMATION)
+    PHNT_REFLECT_FIELD(Tag, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CpuSets, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_CPU_SET_TAG_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SECURE_KERNEL_HYPERGUARD_PROFILE_INFORMATION)
+    PHNT_REFLECT_FIELD(ExtentCount, "ULONG")
+    PHNT_REFLECT_FIELD(ValidStructureSize, "ULONG")
+    PHNT_REFLECT_FIELD(NextExtentIndex, "ULONG")
+    PHNT_REFLECT_FIELD(ExtentRestart, "ULONG")
+    PHNT_REFLECT_FIELD(CycleCount, "ULONG")
+    PHNT_REFLECT_FIELD(TimeoutCount, "ULONG")
+    PHNT_REFLECT_FIELD(CycleTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CycleTimeMax, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ExtentTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ExtentTimeIndex, "ULONG")
+    PHNT_REFLECT_FIELD(ExtentTimeMaxIndex, "ULONG")
+    PHNT_REFLECT_FIELD(ExtentTimeMax, "ULONGLONG")
+    PHNT_REFLECT_FIELD(HyperFlushTimeMax, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TranslateVaTimeMax, "ULONGLONG")
+    PHNT_REFLECT_FIELD(DebugExemptionCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TbHitCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TbMissCount, "ULONGLONG")
+    PHNT_REFLECT_FIELD(VinaPendingYield, "ULONGLONG")
+    PHNT_REFLECT_FIELD(HashCycles, "ULONGLONG")
+    PHNT_REFLECT_FIELD(HistogramOffset, "ULONG")
+    PHNT_REFLECT_FIELD(HistogramBuckets, "ULONG")
+    PHNT_REFLECT_FIELD(HistogramShift, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved1, "ULONG")
+    PHNT_REFLECT_FIELD(PageNotPresentCount, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_SECURE_KERNEL_HYPERGUARD_PROFILE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SECUREBOOT_PLATFORM_MANIFEST_INFORMATION)
+    PHNT_REFLECT_FIELD(PlatformManifestSize, "ULONG")
+    PHNT_REFLECT_FIELD(PlatformManifest, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_SECUREBOOT_PLATFORM_MANIFEST_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_INTERRUPT_STEERING_INFORMATION_INPUT)
+    PHNT_REFLECT_FIELD(Gsiv, "ULONG")
+    PHNT_REFLECT_FIELD(ControllerInterrupt, "UCHAR")
+    PHNT_REFLECT_FIELD(EdgeInterrupt, "UCHAR")
+    PHNT_REFLECT_FIELD(IsPrimaryInterrupt, "UCHAR")
+    PHNT_REFLECT_FIELD(TargetAffinity, "GROUP_AFFINITY")
+PHNT_REFLECT_END(SYSTEM_INTERRUPT_STEERING_INFORMATION_INPUT)
+PHNT_REFLECT_BEGIN(SYSTEM_INTERRUPT_STEERING_INFORMATION_OUTPUT)
+    PHNT_REFLECT_FIELD(AsULONG, "ULONG")
+    PHNT_REFLECT_BITFIELD(Enabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(SYSTEM_INTERRUPT_STEERING_INFORMATION_OUTPUT)
+#if !defined(NTDDI_WIN10_FE) || (NTDDI_VERSION < NTDDI_WIN10_FE)
+PHNT_REFLECT_BEGIN(SYSTEM_SUPPORTED_PROCESSOR_ARCHITECTURES_INFORMATION)
+    PHNT_REFLECT_BITFIELD(Machine, "ULONG")
+    PHNT_REFLECT_BITFIELD(KernelMode, "ULONG")
+    PHNT_REFLECT_BITFIELD(UserMode, "ULONG")
+    PHNT_REFLECT_BITFIELD(Native, "ULONG")
+    PHNT_REFLECT_BITFIELD(Process, "ULONG")
+    PHNT_REFLECT_BITFIELD(WoW64Container, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedZero0, "ULONG")
+PHNT_REFLECT_END(SYSTEM_SUPPORTED_PROCESSOR_ARCHITECTURES_INFORMATION)
+#endif
+PHNT_REFLECT_BEGIN(SYSTEM_MEMORY_USAGE_INFORMATION)
+    PHNT_REFLECT_FIELD(TotalPhysicalBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(AvailableBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ResidentAvailableBytes, "LONGLONG")
+    PHNT_REFLECT_FIELD(CommittedBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SharedCommittedBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CommitLimitBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PeakCommitmentBytes, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_MEMORY_USAGE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CODEINTEGRITY_CERTIFICATE_INFORMATION)
+    PHNT_REFLECT_FIELD(ImageFile, "HANDLE")
+    PHNT_REFLECT_FIELD(Type, "ULONG")
+PHNT_REFLECT_END(SYSTEM_CODEINTEGRITY_CERTIFICATE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_PHYSICAL_MEMORY_INFORMATION)
+    PHNT_REFLECT_FIELD(TotalPhysicalBytes, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LowestPhysicalAddress, "ULONGLONG")
+    PHNT_REFLECT_FIELD(HighestPhysicalAddress, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_PHYSICAL_MEMORY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ACTIVITY_MODERATION_EXE_STATE)
+    PHNT_REFLECT_FIELD(ExePathNt, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(ModerationState, "SYSTEM_ACTIVITY_MODERATION_STATE")
+PHNT_REFLECT_END(SYSTEM_ACTIVITY_MODERATION_EXE_STATE)
+PHNT_REFLECT_BEGIN(SYSTEM_ACTIVITY_MODERATION_INFO)
+    PHNT_REFLECT_FIELD(Identifier, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(ModerationState, "SYSTEM_ACTIVITY_MODERATION_STATE")
+    PHNT_REFLECT_FIELD(AppType, "SYSTEM_ACTIVITY_MODERATION_APP_TYPE")
+PHNT_REFLECT_END(SYSTEM_ACTIVITY_MODERATION_INFO)
+PHNT_REFLECT_BEGIN(SYSTEM_ACTIVITY_MODERATION_USER_SETTINGS)
+    PHNT_REFLECT_FIELD(UserKeyHandle, "HANDLE")
+PHNT_REFLECT_END(SYSTEM_ACTIVITY_MODERATION_USER_SETTINGS)
+PHNT_REFLECT_BEGIN(SYSTEM_CODEINTEGRITY_UNLOCK_INFORMATION)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_BITFIELD(Locked, "ULONG")
+    PHNT_REFLECT_BITFIELD(UnlockApplied, "ULONG")
+    PHNT_REFLECT_BITFIELD(UnlockIdValid, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(UnlockId, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_CODEINTEGRITY_UNLOCK_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_FLUSH_INFORMATION)
+    PHNT_REFLECT_FIELD(SupportedFlushMethods, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessorCacheFlushSize, "ULONG")
+    PHNT_REFLECT_FIELD(SystemFlushCapabilities, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_FLUSH_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_WRITE_CONSTRAINT_INFORMATION)
+    PHNT_REFLECT_FIELD(WriteConstraintPolicy, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(SYSTEM_WRITE_CONSTRAINT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_KERNEL_VA_SHADOW_INFORMATION)
+    PHNT_REFLECT_FIELD(KvaShadowFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowUserGlobal, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowPcid, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowInvpcid, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowRequired, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowRequiredAvailable, "ULONG")
+    PHNT_REFLECT_BITFIELD(InvalidPteBit, "ULONG")
+    PHNT_REFLECT_BITFIELD(L1DataCacheFlushSupported, "ULONG")
+    PHNT_REFLECT_BITFIELD(L1TerminalFaultMitigationPresent, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(SYSTEM_KERNEL_VA_SHADOW_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_CODEINTEGRITYVERIFICATION_INFORMATION)
+    PHNT_REFLECT_FIELD(FileHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(ImageSize, "ULONG")
+    PHNT_REFLECT_FIELD(Image, "PVOID")
+PHNT_REFLECT_END(SYSTEM_CODEINTEGRITYVERIFICATION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_HYPERVISOR_SHARED_PAGE_INFORMATION)
+    PHNT_REFLECT_FIELD(HypervisorSharedUserVa, "PVOID")
+PHNT_REFLECT_END(SYSTEM_HYPERVISOR_SHARED_PAGE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_FIRMWARE_PARTITION_INFORMATION)
+    PHNT_REFLECT_FIELD(FirmwarePartition, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSTEM_FIRMWARE_PARTITION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SPECULATION_CONTROL_INFORMATION)
+PHNT_REFLECT_END(SYSTEM_SPECULATION_CONTROL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_DMA_GUARD_POLICY_INFORMATION)
+    PHNT_REFLECT_FIELD(DmaGuardPolicyEnabled, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_DMA_GUARD_POLICY_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ENCLAVE_LAUNCH_CONTROL_INFORMATION)
+    PHNT_REFLECT_FIELD(EnclaveLaunchSigner, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_ENCLAVE_LAUNCH_CONTROL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_WORKLOAD_ALLOWED_CPU_SET_INFORMATION)
+    PHNT_REFLECT_FIELD(WorkloadClass, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CpuSets, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_WORKLOAD_ALLOWED_CPU_SET_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SECURITY_MODEL_INFORMATION)
+    PHNT_REFLECT_FIELD(SecurityModelFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlag, "ULONG")
+    PHNT_REFLECT_BITFIELD(AllowDeviceOwnerProtectionDowngrade, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(SYSTEM_SECURITY_MODEL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_FEATURE_CONFIGURATION_INFORMATION)
+    PHNT_REFLECT_FIELD(ChangeStamp, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Configuration, "PRTL_FEATURE_CONFIGURATION")
+PHNT_REFLECT_END(SYSTEM_FEATURE_CONFIGURATION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_FEATURE_CONFIGURATION_SECTIONS_INFORMATION_ENTRY)
+    PHNT_REFLECT_FIELD(ChangeStamp, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Section, "PVOID")
+    PHNT_REFLECT_FIELD(Size, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_FEATURE_CONFIGURATION_SECTIONS_INFORMATION_ENTRY)
+PHNT_REFLECT_BEGIN(SYSTEM_FEATURE_CONFIGURATION_SECTIONS_INFORMATION)
+    PHNT_REFLECT_FIELD(OverallChangeStamp, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Descriptors, "SYSTEM_FEATURE_CONFIGURATION_SECTIONS_INFORMATION_ENTRY")
+PHNT_REFLECT_END(SYSTEM_FEATURE_CONFIGURATION_SECTIONS_INFORMATION)
+PHNT_REFLECT_BEGIN(RTL_FEATURE_USAGE_SUBSCRIPTION_TARGET)
+    PHNT_REFLECT_FIELD(Data, "ULONG")
+PHNT_REFLECT_END(RTL_FEATURE_USAGE_SUBSCRIPTION_TARGET)
+PHNT_REFLECT_BEGIN(SYSTEM_FEATURE_USAGE_SUBSCRIPTION_DETAILS)
+    PHNT_REFLECT_FIELD(FeatureId, "ULONG")
+    PHNT_REFLECT_FIELD(ReportingKind, "USHORT")
+    PHNT_REFLECT_FIELD(ReportingOptions, "USHORT")
+    PHNT_REFLECT_FIELD(ReportingTarget, "RTL_FEATURE_USAGE_SUBSCRIPTION_TARGET")
+PHNT_REFLECT_END(SYSTEM_FEATURE_USAGE_SUBSCRIPTION_DETAILS)
+PHNT_REFLECT_BEGIN(SECURE_SPECULATION_CONTROL_INFORMATION)
+    PHNT_REFLECT_BITFIELD(KvaShadowSupported, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowUserGlobal, "ULONG")
+    PHNT_REFLECT_BITFIELD(KvaShadowPcid, "ULONG")
+    PHNT_REFLECT_BITFIELD(MbClearEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(L1TFMitigated, "ULONG")
+    PHNT_REFLECT_BITFIELD(BpbEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(IbrsPresent, "ULONG")
+    PHNT_REFLECT_BITFIELD(EnhancedIbrs, "ULONG")
+    PHNT_REFLECT_BITFIELD(StibpPresent, "ULONG")
+    PHNT_REFLECT_BITFIELD(SsbdSupported, "ULONG")
+    PHNT_REFLECT_BITFIELD(SsbdRequired, "ULONG")
+    PHNT_REFLECT_BITFIELD(BpbKernelToUser, "ULONG")
+    PHNT_REFLECT_BITFIELD(BpbUserToKernel, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReturnSpeculate, "ULONG")
+    PHNT_REFLECT_BITFIELD(BranchConfusionSafe, "ULONG")
+    PHNT_REFLECT_BITFIELD(SsbsEnabledAlways, "ULONG")
+    PHNT_REFLECT_BITFIELD(SsbsEnabledKernel, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(SECURE_SPECULATION_CONTROL_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_FIRMWARE_RAMDISK_INFORMATION)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(BlockSize, "ULONG")
+    PHNT_REFLECT_FIELD(BaseAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_FIRMWARE_RAMDISK_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_SHADOW_STACK_INFORMATION)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_BITFIELD(CetCapable, "ULONG")
+    PHNT_REFLECT_BITFIELD(UserCetAllowed, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedForUserCet, "ULONG")
+    PHNT_REFLECT_BITFIELD(KernelCetEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(KernelCetAuditModeEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedForKernelCet, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(SYSTEM_SHADOW_STACK_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_BUILD_VERSION_INFORMATION_FLAGS)
+    PHNT_REFLECT_FIELD(Value32, "ULONG")
+    PHNT_REFLECT_BITFIELD(IsTopLevel, "ULONG")
+    PHNT_REFLECT_BITFIELD(IsChecked, "ULONG")
+PHNT_REFLECT_END(SYSTEM_BUILD_VERSION_INFORMATION_FLAGS)
+PHNT_REFLECT_BEGIN(SYSTEM_BUILD_VERSION_INFORMATION)
+    PHNT_REFLECT_FIELD(LayerNumber, "USHORT")
+    PHNT_REFLECT_FIELD(LayerCount, "USHORT")
+    PHNT_REFLECT_FIELD(OsMajorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(OsMinorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(NtBuildNumber, "ULONG")
+    PHNT_REFLECT_FIELD(NtBuildQfe, "ULONG")
+    PHNT_REFLECT_FIELD(LayerName, "UCHAR")
+    PHNT_REFLECT_FIELD(NtBuildBranch, "UCHAR")
+    PHNT_REFLECT_FIELD(NtBuildLab, "UCHAR")
+    PHNT_REFLECT_FIELD(NtBuildLabEx, "UCHAR")
+    PHNT_REFLECT_FIELD(NtBuildStamp, "UCHAR")
+    PHNT_REFLECT_FIELD(NtBuildArch, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "SYSTEM_BUILD_VERSION_INFORMATION_FLAGS")
+PHNT_REFLECT_END(SYSTEM_BUILD_VERSION_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_POOL_LIMIT_MEM_INFO)
+    PHNT_REFLECT_FIELD(MemoryLimit, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NotificationLimit, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_POOL_LIMIT_MEM_INFO)
+PHNT_REFLECT_BEGIN(SYSTEM_POOL_LIMIT_INFO)
+    PHNT_REFLECT_FIELD(PoolTag, "ULONG")
+    PHNT_REFLECT_FIELD(MemLimits, "SYSTEM_POOL_LIMIT_MEM_INFO")
+    PHNT_REFLECT_FIELD(NotificationHandle, "WNF_STATE_NAME")
+PHNT_REFLECT_END(SYSTEM_POOL_LIMIT_INFO)
+PHNT_REFLECT_BEGIN(SYSTEM_POOL_LIMIT_INFORMATION)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(EntryCount, "ULONG")
+    PHNT_REFLECT_FIELD(LimitEntries, "SYSTEM_POOL_LIMIT_INFO")
+PHNT_REFLECT_END(SYSTEM_POOL_LIMIT_INFORMATION)
+PHNT_REFLECT_BEGIN(HV_MINROOT_NUMA_LPS)
+    PHNT_REFLECT_FIELD(NodeIndex, "ULONG")
+    PHNT_REFLECT_FIELD(Mask, "ULONG_PTR")
+PHNT_REFLECT_END(HV_MINROOT_NUMA_LPS)
+PHNT_REFLECT_BEGIN(SYSTEM_XFG_FAILURE_INFORMATION)
+    PHNT_REFLECT_FIELD(ReturnAddress, "PVOID")
+    PHNT_REFLECT_FIELD(TargetAddress, "PVOID")
+    PHNT_REFLECT_FIELD(DispatchMode, "ULONG")
+    PHNT_REFLECT_FIELD(XfgValue, "ULONGLONG")
+PHNT_REFLECT_END(SYSTEM_XFG_FAILURE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_IOMMU_STATE_INFORMATION)
+    PHNT_REFLECT_FIELD(State, "SYSTEM_IOMMU_STATE")
+    PHNT_REFLECT_FIELD(Pdo, "PVOID")
+PHNT_REFLECT_END(SYSTEM_IOMMU_STATE_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_HYPERVISOR_MINROOT_INFORMATION)
+    PHNT_REFLECT_FIELD(NumProc, "ULONG")
+    PHNT_REFLECT_FIELD(RootProc, "ULONG")
+    PHNT_REFLECT_FIELD(RootProcNumaNodesSpecified, "ULONG")
+    PHNT_REFLECT_FIELD(RootProcNumaNodes, "USHORT")
+    PHNT_REFLECT_FIELD(RootProcPerCore, "ULONG")
+    PHNT_REFLECT_FIELD(RootProcPerNode, "ULONG")
+    PHNT_REFLECT_FIELD(RootProcNumaNodesLpsSpecified, "ULONG")
+    PHNT_REFLECT_FIELD(RootProcNumaNodeLps, "HV_MINROOT_NUMA_LPS")
+PHNT_REFLECT_END(SYSTEM_HYPERVISOR_MINROOT_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_HYPERVISOR_BOOT_PAGES_INFORMATION)
+    PHNT_REFLECT_FIELD(RangeCount, "ULONG")
+    PHNT_REFLECT_FIELD(RangeArray, "ULONG_PTR")
+PHNT_REFLECT_END(SYSTEM_HYPERVISOR_BOOT_PAGES_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_POINTER_AUTH_INFORMATION)
+    PHNT_REFLECT_FIELD(SupportedFlags, "USHORT")
+    PHNT_REFLECT_BITFIELD(AddressAuthSupported, "USHORT")
+    PHNT_REFLECT_BITFIELD(AddressAuthQarma, "USHORT")
+    PHNT_REFLECT_BITFIELD(GenericAuthSupported, "USHORT")
+    PHNT_REFLECT_BITFIELD(GenericAuthQarma, "USHORT")
+    PHNT_REFLECT_BITFIELD(AddressAuthFaulting, "USHORT")
+    PHNT_REFLECT_BITFIELD(SupportedReserved, "USHORT")
+    PHNT_REFLECT_FIELD(EnabledFlags, "USHORT")
+    PHNT_REFLECT_BITFIELD(UserPerProcessIpAuthEnabled, "USHORT")
+    PHNT_REFLECT_BITFIELD(UserGlobalIpAuthEnabled, "USHORT")
+    PHNT_REFLECT_BITFIELD(UserEnabledReserved, "USHORT")
+    PHNT_REFLECT_BITFIELD(KernelIpAuthEnabled, "USHORT")
+    PHNT_REFLECT_BITFIELD(KernelEnabledReserved, "USHORT")
+PHNT_REFLECT_END(SYSTEM_POINTER_AUTH_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_ORIGINAL_IMAGE_FEATURE_INFORMATION_INPUT)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(FeatureName, "PWSTR")
+    PHNT_REFLECT_FIELD(BornOnVersion, "ULONG")
+PHNT_REFLECT_END(SYSTEM_ORIGINAL_IMAGE_FEATURE_INFORMATION_INPUT)
+PHNT_REFLECT_BEGIN(SYSTEM_ORIGINAL_IMAGE_FEATURE_INFORMATION_OUTPUT)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(FeatureIsEnabled, "BOOLEAN")
+PHNT_REFLECT_END(SYSTEM_ORIGINAL_IMAGE_FEATURE_INFORMATION_OUTPUT)
+PHNT_REFLECT_BEGIN(SYSTEM_OSL_RAMDISK_ENTRY)
+    PHNT_REFLECT_FIELD(BlockSize, "ULONG")
+    PHNT_REFLECT_FIELD(BaseAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+PHNT_REFLECT_END(SYSTEM_OSL_RAMDISK_ENTRY)
+PHNT_REFLECT_BEGIN(SYSTEM_OSL_RAMDISK_INFORMATION)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(Entries, "SYSTEM_OSL_RAMDISK_ENTRY")
+PHNT_REFLECT_END(SYSTEM_OSL_RAMDISK_INFORMATION)
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+PHNT_REFLECT_BEGIN(SYSDBG_VIRTUAL)
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Buffer, "PVOID")
+    PHNT_REFLECT_FIELD(Request, "ULONG")
+PHNT_REFLECT_END(SYSDBG_VIRTUAL)
+PHNT_REFLECT_BEGIN(SYSDBG_PHYSICAL)
+    PHNT_REFLECT_FIELD(Address, "PHYSICAL_ADDRESS")
+    PHNT_REFLECT_FIELD(Buffer, "PVOID")
+    PHNT_REFLECT_FIELD(Request, "ULONG")
+PHNT_REFLECT_END(SYSDBG_PHYSICAL)
+PHNT_REFLECT_BEGIN(SYSDBG_CONTROL_SPACE)
+    PHNT_REFLECT_FIELD(Address, "ULONG64")
+    PHNT_REFLECT_FIELD(Buffer, "PVOID")
+    PHNT_REFLECT_FIELD(Request, "ULONG")
+    PHNT_REFLECT_FIELD(Processor, "ULONG")
+PHNT_REFLECT_END(SYSDBG_CONTROL_SPACE)
+PHNT_REFLECT_BEGIN(SYSDBG_IO_SPACE)
+    PHNT_REFLECT_FIELD(Address, "ULONG64")
+    PHNT_REFLECT_FIELD(Buffer, "PVOID")
+    PHNT_REFLECT_FIELD(Request, "ULONG")
+    PHNT_REFLECT_FIELD(InterfaceType, "enum _INTERFACE_TYPE")
+    PHNT_REFLECT_FIELD(BusNumber, "ULONG")
+    PHNT_REFLECT_FIELD(AddressSpace, "ULONG")
+PHNT_REFLECT_END(SYSDBG_IO_SPACE)
+PHNT_REFLECT_BEGIN(SYSDBG_MSR)
+    PHNT_REFLECT_FIELD(Msr, "ULONG")
+    PHNT_REFLECT_FIELD(Data, "ULONG64")
+PHNT_REFLECT_END(SYSDBG_MSR)
+PHNT_REFLECT_BEGIN(SYSDBG_BUS_DATA)
+    PHNT_REFLECT_FIELD(Address, "ULONG")
+    PHNT_REFLECT_FIELD(Buffer, "PVOID")
+    PHNT_REFLECT_FIELD(Request, "ULONG")
+    PHNT_REFLECT_FIELD(BusDataType, "enum _BUS_DATA_TYPE")
+    PHNT_REFLECT_FIELD(BusNumber, "ULONG")
+    PHNT_REFLECT_FIELD(SlotNumber, "ULONG")
+PHNT_REFLECT_END(SYSDBG_BUS_DATA)
+PHNT_REFLECT_BEGIN(SYSDBG_TRIAGE_DUMP)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(BugCheckCode, "ULONG")
+    PHNT_REFLECT_FIELD(BugCheckParam1, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BugCheckParam2, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BugCheckParam3, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BugCheckParam4, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ProcessHandles, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadHandles, "ULONG")
+    PHNT_REFLECT_FIELD(Handles, "PHANDLE")
+PHNT_REFLECT_END(SYSDBG_TRIAGE_DUMP)
+PHNT_REFLECT_BEGIN(SYSDBG_LIVEDUMP_CONTROL_FLAGS)
+    PHNT_REFLECT_BITFIELD(UseDumpStorageStack, "ULONG")
+    PHNT_REFLECT_BITFIELD(CompressMemoryPagesData, "ULONG")
+    PHNT_REFLECT_BITFIELD(IncludeUserSpaceMemoryPages, "ULONG")
+    PHNT_REFLECT_BITFIELD(AbortIfMemoryPressure, "ULONG")
+    PHNT_REFLECT_BITFIELD(SelectiveDump, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(AsUlong, "ULONG")
+PHNT_REFLECT_END(SYSDBG_LIVEDUMP_CONTROL_FLAGS)
+PHNT_REFLECT_BEGIN(SYSDBG_LIVEDUMP_CONTROL_ADDPAGES)
+    PHNT_REFLECT_BITFIELD(HypervisorPages, "ULONG")
+    PHNT_REFLECT_BITFIELD(NonEssentialHypervisorPages, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(AsUlong, "ULONG")
+PHNT_REFLECT_END(SYSDBG_LIVEDUMP_CONTROL_ADDPAGES)
+PHNT_REFLECT_BEGIN(SYSDBG_LIVEDUMP_SELECTIVE_CONTROL)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(ThreadKernelStacks, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(ReservedFlags, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONGLONG")
+PHNT_REFLECT_END(SYSDBG_LIVEDUMP_SELECTIVE_CONTROL)
+PHNT_REFLECT_BEGIN(SYSDBG_LIVEDUMP_CONTROL)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(BugCheckCode, "ULONG")
+    PHNT_REFLECT_FIELD(BugCheckParam1, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BugCheckParam2, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BugCheckParam3, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BugCheckParam4, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DumpFileHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(CancelEventHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(Flags, "SYSDBG_LIVEDUMP_CONTROL_FLAGS")
+    PHNT_REFLECT_FIELD(AddPagesControl, "SYSDBG_LIVEDUMP_CONTROL_ADDPAGES")
+    PHNT_REFLECT_FIELD(SelectiveControl, "PSYSDBG_LIVEDUMP_SELECTIVE_CONTROL")
+PHNT_REFLECT_END(SYSDBG_LIVEDUMP_CONTROL)
+PHNT_REFLECT_BEGIN(SYSDBG_KD_PULL_REMOTE_FILE)
+    PHNT_REFLECT_FIELD(ImageFileName, "UNICODE_STRING")
+PHNT_REFLECT_END(SYSDBG_KD_PULL_REMOTE_FILE)
+PHNT_REFLECT_BEGIN(KUSER_SHARED_DATA)
+    PHNT_REFLECT_FIELD(TickCountLowDeprecated, "ULONG")
+    PHNT_REFLECT_FIELD(TickCountMultiplier, "ULONG")
+    PHNT_REFLECT_FIELD(InterruptTime, "volatile KSYSTEM_TIME")
+    PHNT_REFLECT_FIELD(SystemTime, "volatile KSYSTEM_TIME")
+    PHNT_REFLECT_FIELD(TimeZoneBias, "volatile KSYSTEM_TIME")
+    PHNT_REFLECT_FIELD(ImageNumberLow, "USHORT")
+    PHNT_REFLECT_FIELD(ImageNumberHigh, "USHORT")
+    PHNT_REFLECT_FIELD(NtSystemRoot, "WCHAR")
+    PHNT_REFLECT_FIELD(MaxStackTraceDepth, "ULONG")
+    PHNT_REFLECT_FIELD(CryptoExponent, "ULONG")
+    PHNT_REFLECT_FIELD(TimeZoneId, "ULONG")
+    PHNT_REFLECT_FIELD(LargePageMinimum, "ULONG")
+    PHNT_REFLECT_FIELD(AitSamplingValue, "ULONG")
+    PHNT_REFLECT_FIELD(AppCompatFlag, "ULONG")
+    PHNT_REFLECT_FIELD(RNGSeedVersion, "ULONGLONG")
+    PHNT_REFLECT_FIELD(GlobalValidationRunlevel, "ULONG")
+    PHNT_REFLECT_FIELD(TimeZoneBiasStamp, "volatile LONG")
+    PHNT_REFLECT_FIELD(NtBuildNumber, "ULONG")
+    PHNT_REFLECT_FIELD(NtProductType, "NT_PRODUCT_TYPE")
+    PHNT_REFLECT_FIELD(ProductTypeIsValid, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Reserved0, "BOOLEAN")
+    PHNT_REFLECT_FIELD(NativeProcessorArchitecture, "USHORT")
+    PHNT_REFLECT_FIELD(NtMajorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(NtMinorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessorFeatures, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Reserved1, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved3, "ULONG")
+    PHNT_REFLECT_FIELD(TimeSlip, "volatile ULONG")
+    PHNT_REFLECT_FIELD(AlternativeArchitecture, "ALTERNATIVE_ARCHITECTURE_TYPE")
+    PHNT_REFLECT_FIELD(BootId, "ULONG")
+    PHNT_REFLECT_FIELD(SystemExpirationDate, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(SuiteMask, "ULONG")
+    PHNT_REFLECT_FIELD(KdDebuggerEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(MitigationPolicies, "UCHAR")
+    PHNT_REFLECT_BITFIELD(NXSupportPolicy, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SEHValidationPolicy, "UCHAR")
+    PHNT_REFLECT_BITFIELD(CurDirDevicesSkippedForDlls, "UCHAR")
+    PHNT_REFLECT_BITFIELD(Reserved, "UCHAR")
+    PHNT_REFLECT_FIELD(CyclesPerYield, "USHORT")
+    PHNT_REFLECT_FIELD(ActiveConsoleId, "volatile ULONG")
+    PHNT_REFLECT_FIELD(DismountCount, "volatile ULONG")
+    PHNT_REFLECT_FIELD(ComPlusPackage, "ULONG")
+    PHNT_REFLECT_FIELD(LastSystemRITEventTickCount, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfPhysicalPages, "ULONG")
+    PHNT_REFLECT_FIELD(SafeBootMode, "BOOLEAN")
+    PHNT_REFLECT_FIELD(VirtualizationFlags, "UCHAR")
+#if defined(_ARM64_)
+    PHNT_REFLECT_BITFIELD(ArchStartedInEl2, "UCHAR")
+    PHNT_REFLECT_BITFIELD(QcSlIsSupported, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(Reserved12, "UCHAR")
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(SharedDataFlags, "ULONG")
+#ifdef DUMMYSTRUCTNAME2
+    PHNT_REFLECT_BITFIELD(DbgErrorPortPresent, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgElevationEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgVirtEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgInstallerDetectEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgLkgEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgDynProcessorEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgConsoleBrokerEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgSecureBootEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgMultiSessionSku, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgMultiUsersInSessionSku, "ULONG")
+    PHNT_REFLECT_BITFIELD(DbgStateSeparationEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(SpareBits, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME2, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+    PHNT_REFLECT_FIELD(DataFlagsPad, "ULONG")
+    PHNT_REFLECT_FIELD(TestRetInstruction, "ULONGLONG")
+    PHNT_REFLECT_FIELD(QpcFrequency, "LONGLONG")
+    PHNT_REFLECT_FIELD(SystemCall, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved2, "ULONG")
+    PHNT_REFLECT_FIELD(FullNumberOfPhysicalPages, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SystemCallPad, "ULONGLONG")
+#ifdef DUMMYUNIONNAME3
+    PHNT_REFLECT_FIELD(TickCount, "volatile KSYSTEM_TIME")
+    PHNT_REFLECT_FIELD(TickCountQuad, "volatile ULONG64")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(ReservedTickCountOverlay, "ULONG")
+    PHNT_REFLECT_FIELD(TickCountPad, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME3, "union")
+#endif
+    PHNT_REFLECT_FIELD(Cookie, "ULONG")
+    PHNT_REFLECT_FIELD(CookiePad, "ULONG")
+    PHNT_REFLECT_FIELD(ConsoleSessionForegroundProcessId, "LONGLONG")
+    PHNT_REFLECT_FIELD(TimeUpdateLock, "ULONGLONG")
+    PHNT_REFLECT_FIELD(BaselineSystemTimeQpc, "ULONGLONG")
+    PHNT_REFLECT_FIELD(BaselineInterruptTimeQpc, "ULONGLONG")
+    PHNT_REFLECT_FIELD(QpcSystemTimeIncrement, "ULONGLONG")
+    PHNT_REFLECT_FIELD(QpcInterruptTimeIncrement, "ULONGLONG")
+    PHNT_REFLECT_FIELD(QpcSystemTimeIncrementShift, "UCHAR")
+    PHNT_REFLECT_FIELD(QpcInterruptTimeIncrementShift, "UCHAR")
+    PHNT_REFLECT_FIELD(UnparkedProcessorCount, "USHORT")
+    PHNT_REFLECT_FIELD(EnclaveFeatureMask, "ULONG")
+    PHNT_REFLECT_FIELD(TelemetryCoverageRound, "ULONG")
+    PHNT_REFLECT_FIELD(UserModeGlobalLogger, "USHORT")
+    PHNT_REFLECT_FIELD(ImageFileExecutionOptions, "ULONG")
+    PHNT_REFLECT_FIELD(LangGenerationCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved4, "ULONGLONG")
+    PHNT_REFLECT_FIELD(InterruptTimeBias, "volatile ULONGLONG")
+    PHNT_REFLECT_FIELD(QpcBias, "volatile ULONGLONG")
+    PHNT_REFLECT_FIELD(ActiveProcessorCount, "ULONG")
+    PHNT_REFLECT_FIELD(ActiveGroupCount, "volatile UCHAR")
+    PHNT_REFLECT_FIELD(Reserved9, "UCHAR")
+    PHNT_REFLECT_FIELD(QpcData, "USHORT")
+    PHNT_REFLECT_FIELD(QpcBypassEnabled, "volatile UCHAR")
+    PHNT_REFLECT_FIELD(QpcShift, "UCHAR")
+    PHNT_REFLECT_FIELD(TimeZoneBiasEffectiveStart, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(TimeZoneBiasEffectiveEnd, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(XState, "XSTATE_CONFIGURATION")
+    PHNT_REFLECT_FIELD(FeatureConfigurationChangeStamp, "KSYSTEM_TIME")
+    PHNT_REFLECT_FIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(UserPointerAuthMask, "ULONG64")
+#if defined(NTDDI_WIN10_FE) && (NTDDI_VERSION >= NTDDI_WIN10_FE)
+    PHNT_REFLECT_FIELD(InternsReserved, "ULONG")
+#endif
+PHNT_REFLECT_END(KUSER_SHARED_DATA)
+PHNT_REFLECT_BEGIN(ATOM_BASIC_INFORMATION)
+    PHNT_REFLECT_FIELD(UsageCount, "USHORT")
+    PHNT_REFLECT_FIELD(Flags, "USHORT")
+    PHNT_REFLECT_FIELD(NameLength, "USHORT")
+    PHNT_REFLECT_FIELD(Name, "WCHAR")
+PHNT_REFLECT_END(ATOM_BASIC_INFORMATION)
+PHNT_REFLECT_BEGIN(ATOM_TABLE_INFORMATION)
+    PHNT_REFLECT_FIELD(NumberOfAtoms, "ULONG")
+    PHNT_REFLECT_FIELD(Atoms, "RTL_ATOM")
+PHNT_REFLECT_END(ATOM_TABLE_INFORMATION)
+#endif
+#endif
+
+// ntpoapi.h
+#ifdef _NTPOAPI_H
+PHNT_REFLECT_BEGIN(PROCESSOR_POWER_INFORMATION)
+    PHNT_REFLECT_FIELD(Number, "ULONG")
+    PHNT_REFLECT_FIELD(MaxMhz, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentMhz, "ULONG")
+    PHNT_REFLECT_FIELD(MhzLimit, "ULONG")
+    PHNT_REFLECT_FIELD(MaxIdleState, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentIdleState, "ULONG")
+PHNT_REFLECT_END(PROCESSOR_POWER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_POWER_INFORMATION)
+    PHNT_REFLECT_FIELD(MaxIdlenessAllowed, "ULONG")
+    PHNT_REFLECT_FIELD(Idleness, "ULONG")
+    PHNT_REFLECT_FIELD(TimeRemaining, "ULONG")
+    PHNT_REFLECT_FIELD(CoolingMode, "UCHAR")
+PHNT_REFLECT_END(SYSTEM_POWER_INFORMATION)
+PHNT_REFLECT_BEGIN(SYSTEM_HIBERFILE_INFORMATION)
+    PHNT_REFLECT_FIELD(NumberOfMcbPairs, "ULONG")
+    PHNT_REFLECT_FIELD(Mcb, "LARGE_INTEGER")
+PHNT_REFLECT_END(SYSTEM_HIBERFILE_INFORMATION)
+PHNT_REFLECT_BEGIN(COUNTED_REASON_CONTEXT)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(ResourceFileName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(ResourceReasonId, "USHORT")
+    PHNT_REFLECT_FIELD(StringCount, "ULONG")
+    PHNT_REFLECT_FIELD(ReasonStrings, "PUNICODE_STRING")
+    PHNT_REFLECT_FIELD(SimpleString, "UNICODE_STRING")
+PHNT_REFLECT_END(COUNTED_REASON_CONTEXT)
+PHNT_REFLECT_BEGIN(POWER_REQUEST_ACTION)
+    PHNT_REFLECT_FIELD(PowerRequestHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(RequestType, "POWER_REQUEST_TYPE_INTERNAL")
+    PHNT_REFLECT_FIELD(SetAction, "BOOLEAN")
+    PHNT_REFLECT_FIELD(ProcessHandle, "HANDLE")
+PHNT_REFLECT_END(POWER_REQUEST_ACTION)
+PHNT_REFLECT_BEGIN(POWER_STATE)
+    PHNT_REFLECT_FIELD(SystemState, "SYSTEM_POWER_STATE")
+    PHNT_REFLECT_FIELD(DeviceState, "DEVICE_POWER_STATE")
+PHNT_REFLECT_END(POWER_STATE)
+PHNT_REFLECT_BEGIN(SYSTEM_POWER_STATE_CONTEXT)
+    PHNT_REFLECT_BITFIELD(Reserved1, "ULONG")
+    PHNT_REFLECT_BITFIELD(TargetSystemState, "ULONG")
+    PHNT_REFLECT_BITFIELD(EffectiveSystemState, "ULONG")
+    PHNT_REFLECT_BITFIELD(CurrentSystemState, "ULONG")
+    PHNT_REFLECT_BITFIELD(IgnoreHibernationPath, "ULONG")
+    PHNT_REFLECT_BITFIELD(PseudoTransition, "ULONG")
+    PHNT_REFLECT_BITFIELD(KernelSoftReboot, "ULONG")
+    PHNT_REFLECT_BITFIELD(DirectedDripsTransition, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved2, "ULONG")
+    PHNT_REFLECT_FIELD(ContextAsUlong, "ULONG")
+PHNT_REFLECT_END(SYSTEM_POWER_STATE_CONTEXT)
+PHNT_REFLECT_BEGIN(COUNTED_REASON_CONTEXT_RELATIVE)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+#ifdef DUMMYUNIONNAME
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(ResourceFileNameOffset, "SIZE_T")
+    PHNT_REFLECT_FIELD(ResourceReasonId, "USHORT")
+    PHNT_REFLECT_FIELD(StringCount, "ULONG")
+    PHNT_REFLECT_FIELD(SubstitutionStringsOffset, "SIZE_T")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+    PHNT_REFLECT_FIELD(SimpleStringOffset, "SIZE_T")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+PHNT_REFLECT_END(COUNTED_REASON_CONTEXT_RELATIVE)
+PHNT_REFLECT_BEGIN(DIAGNOSTIC_BUFFER)
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+    PHNT_REFLECT_FIELD(CallerType, "REQUESTER_TYPE")
+#ifdef DUMMYUNIONNAME
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(ProcessImageNameOffset, "SIZE_T")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ServiceTag, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(DeviceDescriptionOffset, "SIZE_T")
+    PHNT_REFLECT_FIELD(DevicePathOffset, "SIZE_T")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(ReasonOffset, "SIZE_T")
+PHNT_REFLECT_END(DIAGNOSTIC_BUFFER)
+PHNT_REFLECT_BEGIN(WAKE_TIMER_INFO)
+    PHNT_REFLECT_FIELD(OffsetToNext, "SIZE_T")
+    PHNT_REFLECT_FIELD(DueTime, "ULARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Period, "ULONG")
+    PHNT_REFLECT_FIELD(ReasonContext, "DIAGNOSTIC_BUFFER")
+PHNT_REFLECT_END(WAKE_TIMER_INFO)
+PHNT_REFLECT_BEGIN(PROCESSOR_PERF_CAP_HV)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(InitialApicId, "ULONG")
+    PHNT_REFLECT_FIELD(Ppc, "ULONG")
+    PHNT_REFLECT_FIELD(Tpc, "ULONG")
+    PHNT_REFLECT_FIELD(ThermalCap, "ULONG")
+PHNT_REFLECT_END(PROCESSOR_PERF_CAP_HV)
+PHNT_REFLECT_BEGIN(PROCESSOR_IDLE_TIMES)
+    PHNT_REFLECT_FIELD(StartTime, "ULONG64")
+    PHNT_REFLECT_FIELD(EndTime, "ULONG64")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(PROCESSOR_IDLE_TIMES)
+PHNT_REFLECT_BEGIN(PROCESSOR_IDLE_STATE)
+    PHNT_REFLECT_FIELD(StateType, "UCHAR")
+    PHNT_REFLECT_FIELD(StateFlags, "ULONG")
+    PHNT_REFLECT_FIELD(HardwareLatency, "ULONG")
+    PHNT_REFLECT_FIELD(Power, "ULONG")
+    PHNT_REFLECT_FIELD(Context, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Handler, "PPROCESSOR_IDLE_HANDLER")
+PHNT_REFLECT_END(PROCESSOR_IDLE_STATE)
+PHNT_REFLECT_BEGIN(PROCESSOR_IDLE_STATES)
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Revision, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(Type, "ULONG")
+    PHNT_REFLECT_FIELD(TargetProcessors, "KAFFINITY")
+    PHNT_REFLECT_FIELD(State, "PROCESSOR_IDLE_STATE")
+PHNT_REFLECT_END(PROCESSOR_IDLE_STATES)
+PHNT_REFLECT_BEGIN(PROCESSOR_LOAD)
+    PHNT_REFLECT_FIELD(ProcessorNumber, "PROCESSOR_NUMBER")
+    PHNT_REFLECT_FIELD(BusyPercentage, "UCHAR")
+    PHNT_REFLECT_FIELD(FrequencyPercentage, "UCHAR")
+    PHNT_REFLECT_FIELD(Padding, "USHORT")
+PHNT_REFLECT_END(PROCESSOR_LOAD)
+PHNT_REFLECT_BEGIN(PROCESSOR_CAP)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessorNumber, "PROCESSOR_NUMBER")
+    PHNT_REFLECT_FIELD(PlatformCap, "ULONG")
+    PHNT_REFLECT_FIELD(ThermalCap, "ULONG")
+    PHNT_REFLECT_FIELD(LimitReasons, "ULONG")
+PHNT_REFLECT_END(PROCESSOR_CAP)
+PHNT_REFLECT_BEGIN(PO_WAKE_SOURCE_INFO)
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(Offsets, "ULONG")
+PHNT_REFLECT_END(PO_WAKE_SOURCE_INFO)
+PHNT_REFLECT_BEGIN(PO_WAKE_SOURCE_HISTORY)
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(Offsets, "ULONG")
+PHNT_REFLECT_END(PO_WAKE_SOURCE_HISTORY)
+PHNT_REFLECT_BEGIN(PO_WAKE_SOURCE_HEADER)
+    PHNT_REFLECT_FIELD(Type, "PO_WAKE_SOURCE_TYPE")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+PHNT_REFLECT_END(PO_WAKE_SOURCE_HEADER)
+PHNT_REFLECT_BEGIN(PO_WAKE_SOURCE_DEVICE)
+    PHNT_REFLECT_FIELD(Header, "PO_WAKE_SOURCE_HEADER")
+    PHNT_REFLECT_FIELD(InstancePath, "WCHAR")
+PHNT_REFLECT_END(PO_WAKE_SOURCE_DEVICE)
+PHNT_REFLECT_BEGIN(PO_WAKE_SOURCE_FIXED)
+    PHNT_REFLECT_FIELD(Header, "PO_WAKE_SOURCE_HEADER")
+    PHNT_REFLECT_FIELD(FixedWakeSourceType, "PO_FIXED_WAKE_SOURCE_TYPE")
+PHNT_REFLECT_END(PO_WAKE_SOURCE_FIXED)
+PHNT_REFLECT_BEGIN(PO_WAKE_SOURCE_INTERNAL)
+    PHNT_REFLECT_FIELD(Header, "PO_WAKE_SOURCE_HEADER")
+    PHNT_REFLECT_FIELD(InternalWakeSourceType, "PO_INTERNAL_WAKE_SOURCE_TYPE")
+PHNT_REFLECT_END(PO_WAKE_SOURCE_INTERNAL)
+PHNT_REFLECT_BEGIN(PO_WAKE_SOURCE_TIMER)
+    PHNT_REFLECT_FIELD(Header, "PO_WAKE_SOURCE_HEADER")
+    PHNT_REFLECT_FIELD(Reason, "DIAGNOSTIC_BUFFER")
+PHNT_REFLECT_END(PO_WAKE_SOURCE_TIMER)
+PHNT_REFLECT_BEGIN(POWER_REQUEST)
+PHNT_REFLECT_END(POWER_REQUEST)
+PHNT_REFLECT_BEGIN(POWER_REQUEST_LIST)
+    PHNT_REFLECT_FIELD(Count, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(PowerRequestOffsets, "ULONG_PTR")
+PHNT_REFLECT_END(POWER_REQUEST_LIST)
+PHNT_REFLECT_BEGIN(POWER_STATE_HANDLER)
+    PHNT_REFLECT_FIELD(Type, "POWER_STATE_HANDLER_TYPE")
+    PHNT_REFLECT_FIELD(RtcWake, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Spare, "UCHAR")
+    PHNT_REFLECT_FIELD(Handler, "PENTER_STATE_HANDLER")
+    PHNT_REFLECT_FIELD(Context, "PVOID")
+PHNT_REFLECT_END(POWER_STATE_HANDLER)
+PHNT_REFLECT_BEGIN(POWER_STATE_NOTIFY_HANDLER)
+    PHNT_REFLECT_FIELD(Handler, "PENTER_STATE_NOTIFY_HANDLER")
+    PHNT_REFLECT_FIELD(Context, "PVOID")
+PHNT_REFLECT_END(POWER_STATE_NOTIFY_HANDLER)
+PHNT_REFLECT_BEGIN(POWER_REQUEST_ACTION_INTERNAL)
+    PHNT_REFLECT_FIELD(PowerRequestPointer, "PVOID")
+    PHNT_REFLECT_FIELD(RequestType, "POWER_REQUEST_TYPE_INTERNAL")
+    PHNT_REFLECT_FIELD(SetAction, "BOOLEAN")
+PHNT_REFLECT_END(POWER_REQUEST_ACTION_INTERNAL)
+PHNT_REFLECT_BEGIN(POWER_S0_LOW_POWER_IDLE_INFO)
+    PHNT_REFLECT_FIELD(DisconnectedReason, "POWER_S0_DISCONNECTED_REASON")
+PHNT_REFLECT_END(POWER_S0_LOW_POWER_IDLE_INFO)
+PHNT_REFLECT_BEGIN(POWER_INFORMATION_INTERNAL_HEADER)
+    PHNT_REFLECT_FIELD(InternalType, "POWER_INFORMATION_LEVEL_INTERNAL")
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+PHNT_REFLECT_END(POWER_INFORMATION_INTERNAL_HEADER)
+PHNT_REFLECT_BEGIN(POWER_USER_ABSENCE_PREDICTION)
+    PHNT_REFLECT_FIELD(Header, "POWER_INFORMATION_INTERNAL_HEADER")
+    PHNT_REFLECT_FIELD(ReturnTime, "LARGE_INTEGER")
+PHNT_REFLECT_END(POWER_USER_ABSENCE_PREDICTION)
+PHNT_REFLECT_BEGIN(POWER_USER_ABSENCE_PREDICTION_CAPABILITY)
+    PHNT_REFLECT_FIELD(AbsencePredictionCapability, "BOOLEAN")
+PHNT_REFLECT_END(POWER_USER_ABSENCE_PREDICTION_CAPABILITY)
+PHNT_REFLECT_BEGIN(POWER_PROCESSOR_LATENCY_HINT)
+    PHNT_REFLECT_FIELD(PowerInformationInternalHeader, "POWER_INFORMATION_INTERNAL_HEADER")
+    PHNT_REFLECT_FIELD(Type, "ULONG")
+PHNT_REFLECT_END(POWER_PROCESSOR_LATENCY_HINT)
+PHNT_REFLECT_BEGIN(POWER_STANDBY_NETWORK_REQUEST)
+    PHNT_REFLECT_FIELD(PowerInformationInternalHeader, "POWER_INFORMATION_INTERNAL_HEADER")
+    PHNT_REFLECT_FIELD(Active, "BOOLEAN")
+PHNT_REFLECT_END(POWER_STANDBY_NETWORK_REQUEST)
+PHNT_REFLECT_BEGIN(POWER_SET_BACKGROUND_TASK_STATE)
+    PHNT_REFLECT_FIELD(PowerInformationInternalHeader, "POWER_INFORMATION_INTERNAL_HEADER")
+    PHNT_REFLECT_FIELD(Engaged, "BOOLEAN")
+PHNT_REFLECT_END(POWER_SET_BACKGROUND_TASK_STATE)
+PHNT_REFLECT_BEGIN(POWER_BOOT_SESSION_STANDBY_ACTIVATION_INFO)
+    PHNT_REFLECT_FIELD(StandbyTotalTime, "ULONG")
+    PHNT_REFLECT_FIELD(DripsTotalTime, "ULONG")
+    PHNT_REFLECT_FIELD(ActivatorClientTotalActiveTime, "ULONG")
+    PHNT_REFLECT_FIELD(PerActivatorClientTotalActiveTime, "ULONG")
+PHNT_REFLECT_END(POWER_BOOT_SESSION_STANDBY_ACTIVATION_INFO)
+PHNT_REFLECT_BEGIN(POWER_SESSION_POWER_STATE)
+    PHNT_REFLECT_FIELD(Header, "POWER_INFORMATION_INTERNAL_HEADER")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(On, "BOOLEAN")
+    PHNT_REFLECT_FIELD(IsConsole, "BOOLEAN")
+    PHNT_REFLECT_FIELD(RequestReason, "POWER_MONITOR_REQUEST_REASON")
+PHNT_REFLECT_END(POWER_SESSION_POWER_STATE)
+PHNT_REFLECT_BEGIN(POWER_INTERNAL_PROCESSOR_QOS_SUPPORT)
+    PHNT_REFLECT_FIELD(QosSupportedAndConfigured, "BOOLEAN")
+    PHNT_REFLECT_FIELD(SchedulerDirectedPerfStatesSupported, "BOOLEAN")
+    PHNT_REFLECT_FIELD(QosGroupPolicyDisable, "BOOLEAN")
+PHNT_REFLECT_END(POWER_INTERNAL_PROCESSOR_QOS_SUPPORT)
+PHNT_REFLECT_BEGIN(POWER_INTERNAL_HOST_ENERGY_SAVER_STATE)
+    PHNT_REFLECT_FIELD(Header, "POWER_INFORMATION_INTERNAL_HEADER")
+    PHNT_REFLECT_FIELD(EsEnabledOnHost, "BOOLEAN")
+PHNT_REFLECT_END(POWER_INTERNAL_HOST_ENERGY_SAVER_STATE)
+PHNT_REFLECT_BEGIN(POWER_INTERNAL_PROCESSOR_BRANDED_FREQENCY_INPUT)
+    PHNT_REFLECT_FIELD(InternalType, "POWER_INFORMATION_LEVEL_INTERNAL")
+    PHNT_REFLECT_FIELD(ProcessorNumber, "PROCESSOR_NUMBER")
+PHNT_REFLECT_END(POWER_INTERNAL_PROCESSOR_BRANDED_FREQENCY_INPUT)
+PHNT_REFLECT_BEGIN(POWER_INTERNAL_PROCESSOR_BRANDED_FREQENCY_OUTPUT)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(NominalFrequency, "ULONG")
+PHNT_REFLECT_END(POWER_INTERNAL_PROCESSOR_BRANDED_FREQENCY_OUTPUT)
+PHNT_REFLECT_BEGIN(POWER_INTERNAL_BOOTAPP_DIAGNOSTIC)
+    PHNT_REFLECT_FIELD(BootAppErrorDiagCode, "ULONG")
+    PHNT_REFLECT_FIELD(BootAppFailureStatus, "ULONG")
+PHNT_REFLECT_END(POWER_INTERNAL_BOOTAPP_DIAGNOSTIC)
+#endif
+
+// ntimage.h
+#ifdef _NTIMAGE_H
+PHNT_REFLECT_BEGIN(IMAGE_DEBUG_POGO_ENTRY)
+    PHNT_REFLECT_FIELD(Rva, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Name, "CHAR")
+PHNT_REFLECT_END(IMAGE_DEBUG_POGO_ENTRY)
+PHNT_REFLECT_BEGIN(IMAGE_DEBUG_POGO_SIGNATURE)
+    PHNT_REFLECT_FIELD(Signature, "ULONG")
+PHNT_REFLECT_END(IMAGE_DEBUG_POGO_SIGNATURE)
+PHNT_REFLECT_BEGIN(IMAGE_RELOCATION_RECORD)
+    PHNT_REFLECT_BITFIELD(Offset, "USHORT")
+    PHNT_REFLECT_BITFIELD(Type, "USHORT")
+PHNT_REFLECT_END(IMAGE_RELOCATION_RECORD)
+PHNT_REFLECT_BEGIN(IMAGE_CHPE_METADATA_X86)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(CHPECodeAddressRangeOffset, "ULONG")
+    PHNT_REFLECT_FIELD(CHPECodeAddressRangeCount, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64ExceptionHandlerFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64DispatchCallFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64DispatchIndirectCallFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64DispatchIndirectCallCfgFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64DispatchRetFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64DispatchRetLeafFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64DispatchJumpFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(CompilerIATPointer, "ULONG")
+    PHNT_REFLECT_FIELD(WowA64RdtscFunctionPointer, "ULONG")
+PHNT_REFLECT_END(IMAGE_CHPE_METADATA_X86)
+PHNT_REFLECT_BEGIN(IMAGE_CHPE_RANGE_ENTRY)
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(StartOffset, "ULONG")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_BITFIELD(NativeCode, "ULONG")
+    PHNT_REFLECT_BITFIELD(AddressBits, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+PHNT_REFLECT_END(IMAGE_CHPE_RANGE_ENTRY)
+PHNT_REFLECT_BEGIN(IMAGE_ARM64EC_METADATA)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(CodeMap, "ULONG")
+    PHNT_REFLECT_FIELD(CodeMapCount, "ULONG")
+    PHNT_REFLECT_FIELD(CodeRangesToEntryPoints, "ULONG")
+    PHNT_REFLECT_FIELD(RedirectionMetadata, "ULONG")
+    PHNT_REFLECT_FIELD(tbd__os_arm64x_dispatch_call_no_redirect, "ULONG")
+    PHNT_REFLECT_FIELD(tbd__os_arm64x_dispatch_ret, "ULONG")
+    PHNT_REFLECT_FIELD(tbd__os_arm64x_dispatch_call, "ULONG")
+    PHNT_REFLECT_FIELD(tbd__os_arm64x_dispatch_icall, "ULONG")
+    PHNT_REFLECT_FIELD(tbd__os_arm64x_dispatch_icall_cfg, "ULONG")
+    PHNT_REFLECT_FIELD(AlternateEntryPoint, "ULONG")
+    PHNT_REFLECT_FIELD(AuxiliaryIAT, "ULONG")
+    PHNT_REFLECT_FIELD(CodeRangesToEntryPointsCount, "ULONG")
+    PHNT_REFLECT_FIELD(RedirectionMetadataCount, "ULONG")
+    PHNT_REFLECT_FIELD(GetX64InformationFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(SetX64InformationFunctionPointer, "ULONG")
+    PHNT_REFLECT_FIELD(ExtraRFETable, "ULONG")
+    PHNT_REFLECT_FIELD(ExtraRFETableSize, "ULONG")
+    PHNT_REFLECT_FIELD(__os_arm64x_dispatch_fptr, "ULONG")
+    PHNT_REFLECT_FIELD(AuxiliaryIATCopy, "ULONG")
+PHNT_REFLECT_END(IMAGE_ARM64EC_METADATA)
+PHNT_REFLECT_BEGIN(IMAGE_ARM64EC_CODE_MAP_ENTRY)
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(StartOffset, "ULONG")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_BITFIELD(Type, "ULONG")
+    PHNT_REFLECT_BITFIELD(AddressBits, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+PHNT_REFLECT_END(IMAGE_ARM64EC_CODE_MAP_ENTRY)
+PHNT_REFLECT_BEGIN(IMAGE_ARM64EC_REDIRECTION_ENTRY)
+    PHNT_REFLECT_FIELD(Source, "ULONG")
+    PHNT_REFLECT_FIELD(Destination, "ULONG")
+PHNT_REFLECT_END(IMAGE_ARM64EC_REDIRECTION_ENTRY)
+PHNT_REFLECT_BEGIN(IMAGE_ARM64EC_CODE_RANGE_ENTRY_POINT)
+    PHNT_REFLECT_FIELD(StartRva, "ULONG")
+    PHNT_REFLECT_FIELD(EndRva, "ULONG")
+    PHNT_REFLECT_FIELD(EntryPoint, "ULONG")
+PHNT_REFLECT_END(IMAGE_ARM64EC_CODE_RANGE_ENTRY_POINT)
+PHNT_REFLECT_BEGIN(IMAGE_DVRT_ARM64X_FIXUP_RECORD)
+    PHNT_REFLECT_BITFIELD(Offset, "USHORT")
+    PHNT_REFLECT_BITFIELD(Type, "USHORT")
+    PHNT_REFLECT_BITFIELD(Size, "USHORT")
+PHNT_REFLECT_END(IMAGE_DVRT_ARM64X_FIXUP_RECORD)
+PHNT_REFLECT_BEGIN(IMAGE_DVRT_ARM64X_DELTA_FIXUP_RECORD)
+    PHNT_REFLECT_BITFIELD(Offset, "USHORT")
+    PHNT_REFLECT_BITFIELD(Type, "USHORT")
+    PHNT_REFLECT_BITFIELD(Sign, "USHORT")
+    PHNT_REFLECT_BITFIELD(Scale, "USHORT")
+PHNT_REFLECT_END(IMAGE_DVRT_ARM64X_DELTA_FIXUP_RECORD)
+#if !defined(NTDDI_WIN10_NI) || (NTDDI_VERSION < NTDDI_WIN10_NI)
+PHNT_REFLECT_BEGIN(IMAGE_FUNCTION_OVERRIDE_HEADER)
+    PHNT_REFLECT_FIELD(FuncOverrideSize, "ULONG")
+PHNT_REFLECT_END(IMAGE_FUNCTION_OVERRIDE_HEADER)
+PHNT_REFLECT_BEGIN(IMAGE_BDD_INFO)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(BDDSize, "ULONG")
+PHNT_REFLECT_END(IMAGE_BDD_INFO)
+PHNT_REFLECT_BEGIN(IMAGE_FUNCTION_OVERRIDE_DYNAMIC_RELOCATION)
+    PHNT_REFLECT_FIELD(OriginalRva, "ULONG")
+    PHNT_REFLECT_FIELD(BDDOffset, "ULONG")
+    PHNT_REFLECT_FIELD(RvaSize, "ULONG")
+    PHNT_REFLECT_FIELD(BaseRelocSize, "ULONG")
+PHNT_REFLECT_END(IMAGE_FUNCTION_OVERRIDE_DYNAMIC_RELOCATION)
+PHNT_REFLECT_BEGIN(IMAGE_BDD_DYNAMIC_RELOCATION)
+    PHNT_REFLECT_FIELD(Left, "USHORT")
+    PHNT_REFLECT_FIELD(Right, "USHORT")
+    PHNT_REFLECT_FIELD(Value, "ULONG")
+PHNT_REFLECT_END(IMAGE_BDD_DYNAMIC_RELOCATION)
+#endif
+#endif
+
+// ntpebteb.h
+#ifdef _NTPEBTEB_H
+PHNT_REFLECT_BEGIN(API_SET_NAMESPACE)
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(EntryOffset, "ULONG")
+    PHNT_REFLECT_FIELD(HashOffset, "ULONG")
+    PHNT_REFLECT_FIELD(HashFactor, "ULONG")
+PHNT_REFLECT_END(API_SET_NAMESPACE)
+PHNT_REFLECT_BEGIN(API_SET_HASH_ENTRY)
+    PHNT_REFLECT_FIELD(Hash, "ULONG")
+    PHNT_REFLECT_FIELD(Index, "ULONG")
+PHNT_REFLECT_END(API_SET_HASH_ENTRY)
+PHNT_REFLECT_BEGIN(API_SET_NAMESPACE_ENTRY)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(NameOffset, "ULONG")
+    PHNT_REFLECT_FIELD(NameLength, "ULONG")
+    PHNT_REFLECT_FIELD(HashedLength, "ULONG")
+    PHNT_REFLECT_FIELD(ValueOffset, "ULONG")
+    PHNT_REFLECT_FIELD(ValueCount, "ULONG")
+PHNT_REFLECT_END(API_SET_NAMESPACE_ENTRY)
+PHNT_REFLECT_BEGIN(API_SET_VALUE_ENTRY)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(NameOffset, "ULONG")
+    PHNT_REFLECT_FIELD(NameLength, "ULONG")
+    PHNT_REFLECT_FIELD(ValueOffset, "ULONG")
+    PHNT_REFLECT_FIELD(ValueLength, "ULONG")
+PHNT_REFLECT_END(API_SET_VALUE_ENTRY)
+PHNT_REFLECT_BEGIN(TELEMETRY_COVERAGE_HEADER)
+    PHNT_REFLECT_FIELD(MajorVersion, "UCHAR")
+    PHNT_REFLECT_FIELD(MinorVersion, "UCHAR")
+    PHNT_REFLECT_BITFIELD(TracingEnabled, "USHORT")
+    PHNT_REFLECT_BITFIELD(Reserved1, "USHORT")
+    PHNT_REFLECT_FIELD(HashTableEntries, "ULONG")
+    PHNT_REFLECT_FIELD(HashIndexMask, "ULONG")
+    PHNT_REFLECT_FIELD(TableUpdateVersion, "ULONG")
+    PHNT_REFLECT_FIELD(TableSizeInBytes, "ULONG")
+    PHNT_REFLECT_FIELD(LastResetTick, "ULONG")
+    PHNT_REFLECT_FIELD(ResetRound, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved2, "ULONG")
+    PHNT_REFLECT_FIELD(RecordedCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved3, "ULONG")
+    PHNT_REFLECT_FIELD(HashTable, "ULONG")
+PHNT_REFLECT_END(TELEMETRY_COVERAGE_HEADER)
+#if 1
+#else
+PHNT_REFLECT_BEGIN(PEB)
+    PHNT_REFLECT_FIELD(InheritedAddressSpace, "BOOLEAN")
+    PHNT_REFLECT_FIELD(ReadImageFileExecOptions, "BOOLEAN")
+    PHNT_REFLECT_FIELD(BeingDebugged, "BOOLEAN")
+    PHNT_REFLECT_FIELD(BitField, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(ImageUsesLargePages, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(IsProtectedProcess, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(IsImageDynamicallyRelocated, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(SkipPatchingUser32Forwarders, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(IsPackagedProcess, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(IsAppContainer, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(IsProtectedProcessLight, "BOOLEAN")
+    PHNT_REFLECT_BITFIELD(IsLongPathAwareProcess, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Mutant, "HANDLE")
+    PHNT_REFLECT_FIELD(ImageBaseAddress, "PVOID")
+    PHNT_REFLECT_FIELD(Ldr, "PPEB_LDR_DATA")
+    PHNT_REFLECT_FIELD(ProcessParameters, "PRTL_USER_PROCESS_PARAMETERS")
+    PHNT_REFLECT_FIELD(SubSystemData, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessHeap, "PVOID")
+    PHNT_REFLECT_FIELD(FastPebLock, "PRTL_CRITICAL_SECTION")
+    PHNT_REFLECT_FIELD(AtlThunkSListPtr, "PSLIST_HEADER")
+    PHNT_REFLECT_FIELD(IFEOKey, "PVOID")
+    PHNT_REFLECT_FIELD(CrossProcessFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessInJob, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessInitializing, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessUsingVEH, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessUsingVCH, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessUsingFTH, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessPreviouslyThrottled, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessCurrentlyThrottled, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessImagesHotPatched, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedBits0, "ULONG")
+    PHNT_REFLECT_FIELD(KernelCallbackTable, "PVOID")
+    PHNT_REFLECT_FIELD(UserSharedInfoPtr, "PVOID")
+    PHNT_REFLECT_FIELD(SystemReserved, "ULONG")
+    PHNT_REFLECT_FIELD(AtlThunkSListPtr32, "ULONG")
+    PHNT_REFLECT_FIELD(ApiSetMap, "PAPI_SET_NAMESPACE")
+    PHNT_REFLECT_FIELD(TlsExpansionCounter, "ULONG")
+    PHNT_REFLECT_FIELD(TlsBitmap, "PRTL_BITMAP")
+    PHNT_REFLECT_FIELD(TlsBitmapBits, "ULONG")
+    PHNT_REFLECT_FIELD(ReadOnlySharedMemoryBase, "PVOID")
+    PHNT_REFLECT_FIELD(SharedData, "PSILO_USER_SHARED_DATA")
+    PHNT_REFLECT_FIELD(ReadOnlyStaticServerData, "PVOID*")
+    PHNT_REFLECT_FIELD(AnsiCodePageData, "PVOID")
+    PHNT_REFLECT_FIELD(OemCodePageData, "PVOID")
+    PHNT_REFLECT_FIELD(UnicodeCaseTableData, "PVOID")
+    PHNT_REFLECT_FIELD(NumberOfProcessors, "ULONG")
+    PHNT_REFLECT_FIELD(NtGlobalFlag, "ULONG")
+    PHNT_REFLECT_FIELD(CriticalSectionTimeout, "ULARGE_INTEGER")
+    PHNT_REFLECT_FIELD(HeapSegmentReserve, "SIZE_T")
+    PHNT_REFLECT_FIELD(HeapSegmentCommit, "SIZE_T")
+    PHNT_REFLECT_FIELD(HeapDeCommitTotalFreeThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(HeapDeCommitFreeBlockThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(NumberOfHeaps, "ULONG")
+    PHNT_REFLECT_FIELD(MaximumNumberOfHeaps, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessHeaps, "PVOID*")
+    PHNT_REFLECT_FIELD(GdiSharedHandleTable, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessStarterHelper, "PVOID")
+    PHNT_REFLECT_FIELD(GdiDCAttributeList, "ULONG")
+    PHNT_REFLECT_FIELD(LoaderLock, "PRTL_CRITICAL_SECTION")
+    PHNT_REFLECT_FIELD(OSMajorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(OSMinorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(OSBuildNumber, "USHORT")
+    PHNT_REFLECT_FIELD(OSCSDVersion, "USHORT")
+    PHNT_REFLECT_FIELD(OSPlatformId, "ULONG")
+    PHNT_REFLECT_FIELD(ImageSubsystem, "ULONG")
+    PHNT_REFLECT_FIELD(ImageSubsystemMajorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(ImageSubsystemMinorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(ActiveProcessAffinityMask, "KAFFINITY")
+    PHNT_REFLECT_FIELD(GdiHandleBuffer, "GDI_HANDLE_BUFFER")
+    PHNT_REFLECT_FIELD(PostProcessInitRoutine, "PVOID")
+    PHNT_REFLECT_FIELD(TlsExpansionBitmap, "PRTL_BITMAP")
+    PHNT_REFLECT_FIELD(TlsExpansionBitmapBits, "ULONG")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(AppCompatFlags, "ULARGE_INTEGER")
+    PHNT_REFLECT_FIELD(AppCompatFlagsUser, "ULARGE_INTEGER")
+    PHNT_REFLECT_FIELD(pShimData, "PVOID")
+    PHNT_REFLECT_FIELD(AppCompatInfo, "PVOID")
+    PHNT_REFLECT_FIELD(CSDVersion, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(ActivationContextData, "PACTIVATION_CONTEXT_DATA")
+    PHNT_REFLECT_FIELD(ProcessAssemblyStorageMap, "PASSEMBLY_STORAGE_MAP")
+    PHNT_REFLECT_FIELD(SystemDefaultActivationContextData, "PACTIVATION_CONTEXT_DATA")
+    PHNT_REFLECT_FIELD(SystemAssemblyStorageMap, "PASSEMBLY_STORAGE_MAP")
+    PHNT_REFLECT_FIELD(MinimumStackCommit, "SIZE_T")
+    PHNT_REFLECT_FIELD(SparePointers, "PVOID")
+    PHNT_REFLECT_FIELD(PatchLoaderData, "PVOID")
+    PHNT_REFLECT_FIELD(ChpeV2ProcessInfo, "PVOID")
+    PHNT_REFLECT_FIELD(AppModelFeatureState, "ULONG")
+    PHNT_REFLECT_FIELD(SpareUlongs, "ULONG")
+    PHNT_REFLECT_FIELD(ActiveCodePage, "USHORT")
+    PHNT_REFLECT_FIELD(OemCodePage, "USHORT")
+    PHNT_REFLECT_FIELD(UseCaseMapping, "USHORT")
+    PHNT_REFLECT_FIELD(UnusedNlsField, "USHORT")
+    PHNT_REFLECT_FIELD(WerRegistrationData, "PVOID")
+    PHNT_REFLECT_FIELD(WerShipAssertPtr, "PVOID")
+    PHNT_REFLECT_FIELD(pContextData, "PVOID")
+    PHNT_REFLECT_FIELD(pUnused, "PVOID")
+    PHNT_REFLECT_FIELD(EcCodeBitMap, "PVOID")
+    PHNT_REFLECT_FIELD(pImageHeaderHash, "PVOID")
+    PHNT_REFLECT_FIELD(TracingFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(HeapTracingEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(CritSecTracingEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(LibLoaderTracingEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(SpareTracingBits, "ULONG")
+    PHNT_REFLECT_FIELD(CsrServerReadOnlySharedMemoryBase, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TppWorkerpListLock, "PRTL_CRITICAL_SECTION")
+    PHNT_REFLECT_FIELD(TppWorkerpList, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(WaitOnAddressHashTable, "PVOID")
+    PHNT_REFLECT_FIELD(TelemetryCoverageHeader, "PTELEMETRY_COVERAGE_HEADER")
+    PHNT_REFLECT_FIELD(CloudFileFlags, "ULONG")
+    PHNT_REFLECT_FIELD(CloudFileDiagFlags, "ULONG")
+    PHNT_REFLECT_FIELD(PlaceholderCompatibilityMode, "CHAR")
+    PHNT_REFLECT_FIELD(PlaceholderCompatibilityModeReserved, "CHAR")
+    PHNT_REFLECT_FIELD(LeapSecondData, "PLEAP_SECOND_DATA")
+    PHNT_REFLECT_FIELD(LeapSecondFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(SixtySecondEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(NtGlobalFlag2, "ULONG")
+    PHNT_REFLECT_FIELD(ExtendedFeatureDisableMask, "ULONGLONG")
+PHNT_REFLECT_END(PEB)
+#endif
+PHNT_REFLECT_BEGIN(GDI_TEB_BATCH)
+    PHNT_REFLECT_FIELD(Offset, "ULONG")
+    PHNT_REFLECT_FIELD(HDC, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Buffer, "ULONG")
+PHNT_REFLECT_END(GDI_TEB_BATCH)
+PHNT_REFLECT_BEGIN(TEB_ACTIVE_FRAME_CONTEXT)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(FrameName, "PSTR")
+PHNT_REFLECT_END(TEB_ACTIVE_FRAME_CONTEXT)
+PHNT_REFLECT_BEGIN(TEB_ACTIVE_FRAME_CONTEXT_EX)
+    PHNT_REFLECT_FIELD(BasicContext, "TEB_ACTIVE_FRAME_CONTEXT")
+    PHNT_REFLECT_FIELD(SourceLocation, "PSTR")
+PHNT_REFLECT_END(TEB_ACTIVE_FRAME_CONTEXT_EX)
+PHNT_REFLECT_BEGIN(TEB_ACTIVE_FRAME)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(Previous, "struct _TEB_ACTIVE_FRAME*")
+    PHNT_REFLECT_FIELD(Context, "PTEB_ACTIVE_FRAME_CONTEXT")
+PHNT_REFLECT_END(TEB_ACTIVE_FRAME)
+PHNT_REFLECT_BEGIN(TEB_ACTIVE_FRAME_EX)
+    PHNT_REFLECT_FIELD(BasicFrame, "TEB_ACTIVE_FRAME")
+    PHNT_REFLECT_FIELD(ExtensionIdentifier, "PVOID")
+PHNT_REFLECT_END(TEB_ACTIVE_FRAME_EX)
+#if 1
+#else
+PHNT_REFLECT_BEGIN(TEB)
+    PHNT_REFLECT_FIELD(NtTib, "NT_TIB")
+    PHNT_REFLECT_FIELD(EnvironmentPointer, "PVOID")
+    PHNT_REFLECT_FIELD(ClientId, "CLIENT_ID")
+    PHNT_REFLECT_FIELD(ActiveRpcHandle, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadLocalStoragePointer, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessEnvironmentBlock, "PPEB")
+    PHNT_REFLECT_FIELD(LastErrorValue, "ULONG")
+    PHNT_REFLECT_FIELD(CountOfOwnedCriticalSections, "ULONG")
+    PHNT_REFLECT_FIELD(CsrClientThread, "PVOID")
+    PHNT_REFLECT_FIELD(Win32ThreadInfo, "PVOID")
+    PHNT_REFLECT_FIELD(User32Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(UserReserved, "ULONG")
+    PHNT_REFLECT_FIELD(WOW32Reserved, "PVOID")
+    PHNT_REFLECT_FIELD(CurrentLocale, "LCID")
+    PHNT_REFLECT_FIELD(FpSoftwareStatusRegister, "ULONG")
+    PHNT_REFLECT_FIELD(ReservedForDebuggerInstrumentation, "PVOID")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(SystemReserved1, "PVOID")
+    PHNT_REFLECT_FIELD(HeapFlsData, "PVOID")
+    PHNT_REFLECT_FIELD(RngState, "ULONG_PTR")
+#else
+    PHNT_REFLECT_FIELD(SystemReserved1, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(PlaceholderCompatibilityMode, "CHAR")
+    PHNT_REFLECT_FIELD(PlaceholderHydrationAlwaysExplicit, "BOOLEAN")
+    PHNT_REFLECT_FIELD(PlaceholderReserved, "CHAR")
+    PHNT_REFLECT_FIELD(ProxiedProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ActivationStack, "ACTIVATION_CONTEXT_STACK")
+    PHNT_REFLECT_FIELD(WorkingOnBehalfTicket, "UCHAR")
+    PHNT_REFLECT_FIELD(ExceptionCode, "NTSTATUS")
+    PHNT_REFLECT_FIELD(ActivationContextStackPointer, "PACTIVATION_CONTEXT_STACK")
+    PHNT_REFLECT_FIELD(InstrumentationCallbackSp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(InstrumentationCallbackPreviousPc, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(InstrumentationCallbackPreviousSp, "ULONG_PTR")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(TxFsContext, "ULONG")
+#endif
+    PHNT_REFLECT_FIELD(InstrumentationCallbackDisabled, "BOOLEAN")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(UnalignedLoadStoreExceptions, "BOOLEAN")
+#endif
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(SpareBytes, "UCHAR")
+    PHNT_REFLECT_FIELD(TxFsContext, "ULONG")
+#endif
+    PHNT_REFLECT_FIELD(GdiTebBatch, "GDI_TEB_BATCH")
+    PHNT_REFLECT_FIELD(RealClientId, "CLIENT_ID")
+    PHNT_REFLECT_FIELD(GdiCachedProcessHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(GdiClientPID, "ULONG")
+    PHNT_REFLECT_FIELD(GdiClientTID, "ULONG")
+    PHNT_REFLECT_FIELD(GdiThreadLocalInfo, "PVOID")
+    PHNT_REFLECT_FIELD(Win32ClientInfo, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(glDispatchTable, "PVOID")
+    PHNT_REFLECT_FIELD(glReserved1, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(glReserved2, "PVOID")
+    PHNT_REFLECT_FIELD(glSectionInfo, "PVOID")
+    PHNT_REFLECT_FIELD(glSection, "PVOID")
+    PHNT_REFLECT_FIELD(glTable, "PVOID")
+    PHNT_REFLECT_FIELD(glCurrentRC, "PVOID")
+    PHNT_REFLECT_FIELD(glContext, "PVOID")
+    PHNT_REFLECT_FIELD(LastStatusValue, "NTSTATUS")
+    PHNT_REFLECT_FIELD(StaticUnicodeString, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(StaticUnicodeBuffer, "WCHAR")
+    PHNT_REFLECT_FIELD(DeallocationStack, "PVOID")
+    PHNT_REFLECT_FIELD(TlsSlots, "PVOID")
+    PHNT_REFLECT_FIELD(TlsLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(Vdm, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForNtRpc, "PVOID")
+    PHNT_REFLECT_FIELD(DbgSsReserved, "PVOID")
+    PHNT_REFLECT_FIELD(HardErrorMode, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Instrumentation, "PVOID")
+#else
+    PHNT_REFLECT_FIELD(Instrumentation, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(ActivityId, "GUID")
+    PHNT_REFLECT_FIELD(SubProcessTag, "PVOID")
+    PHNT_REFLECT_FIELD(PerflibData, "PVOID")
+    PHNT_REFLECT_FIELD(EtwTraceData, "PVOID")
+    PHNT_REFLECT_FIELD(WinSockData, "PVOID")
+    PHNT_REFLECT_FIELD(GdiBatchCount, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentIdealProcessor, "PROCESSOR_NUMBER")
+    PHNT_REFLECT_FIELD(IdealProcessorValue, "ULONG")
+    PHNT_REFLECT_FIELD(ReservedPad0, "UCHAR")
+    PHNT_REFLECT_FIELD(ReservedPad1, "UCHAR")
+    PHNT_REFLECT_FIELD(ReservedPad2, "UCHAR")
+    PHNT_REFLECT_FIELD(IdealProcessor, "UCHAR")
+    PHNT_REFLECT_FIELD(GuaranteedStackBytes, "ULONG")
+    PHNT_REFLECT_FIELD(ReservedForPerf, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForOle, "PVOID")
+    PHNT_REFLECT_FIELD(WaitingOnLoaderLock, "ULONG")
+    PHNT_REFLECT_FIELD(SavedPriorityState, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForCodeCoverage, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ThreadPoolData, "PVOID")
+    PHNT_REFLECT_FIELD(TlsExpansionSlots, "PVOID*")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(ChpeV2CpuAreaInfo, "PVOID")
+    PHNT_REFLECT_FIELD(Unused, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(MuiGeneration, "ULONG")
+    PHNT_REFLECT_FIELD(IsImpersonating, "ULONG")
+    PHNT_REFLECT_FIELD(NlsCache, "PVOID")
+    PHNT_REFLECT_FIELD(pShimData, "PVOID")
+    PHNT_REFLECT_FIELD(HeapData, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentTransactionHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(ActiveFrame, "PTEB_ACTIVE_FRAME")
+    PHNT_REFLECT_FIELD(FlsData, "PVOID")
+    PHNT_REFLECT_FIELD(PreferredLanguages, "PVOID")
+    PHNT_REFLECT_FIELD(UserPrefLanguages, "PVOID")
+    PHNT_REFLECT_FIELD(MergedPrefLanguages, "PVOID")
+    PHNT_REFLECT_FIELD(MuiImpersonation, "ULONG")
+    PHNT_REFLECT_FIELD(CrossTebFlags, "USHORT")
+    PHNT_REFLECT_BITFIELD(SpareCrossTebBits, "USHORT")
+    PHNT_REFLECT_FIELD(SameTebFlags, "USHORT")
+    PHNT_REFLECT_BITFIELD(SafeThunkCall, "USHORT")
+    PHNT_REFLECT_BITFIELD(InDebugPrint, "USHORT")
+    PHNT_REFLECT_BITFIELD(HasFiberData, "USHORT")
+    PHNT_REFLECT_BITFIELD(SkipThreadAttach, "USHORT")
+    PHNT_REFLECT_BITFIELD(WerInShipAssertCode, "USHORT")
+    PHNT_REFLECT_BITFIELD(RanProcessInit, "USHORT")
+    PHNT_REFLECT_BITFIELD(ClonedThread, "USHORT")
+    PHNT_REFLECT_BITFIELD(SuppressDebugMsg, "USHORT")
+    PHNT_REFLECT_BITFIELD(DisableUserStackWalk, "USHORT")
+    PHNT_REFLECT_BITFIELD(RtlExceptionAttached, "USHORT")
+    PHNT_REFLECT_BITFIELD(InitialThread, "USHORT")
+    PHNT_REFLECT_BITFIELD(SessionAware, "USHORT")
+    PHNT_REFLECT_BITFIELD(LoadOwner, "USHORT")
+    PHNT_REFLECT_BITFIELD(LoaderWorker, "USHORT")
+    PHNT_REFLECT_BITFIELD(SkipLoaderInit, "USHORT")
+    PHNT_REFLECT_BITFIELD(SkipFileAPIBrokering, "USHORT")
+    PHNT_REFLECT_FIELD(TxnScopeEnterCallback, "PVOID")
+    PHNT_REFLECT_FIELD(TxnScopeExitCallback, "PVOID")
+    PHNT_REFLECT_FIELD(TxnScopeContext, "PVOID")
+    PHNT_REFLECT_FIELD(LockCount, "ULONG")
+    PHNT_REFLECT_FIELD(WowTebOffset, "LONG")
+    PHNT_REFLECT_FIELD(ResourceRetValue, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForWdf, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForCrt, "ULONGLONG")
+    PHNT_REFLECT_FIELD(EffectiveContainerId, "GUID")
+    PHNT_REFLECT_FIELD(LastSleepCounter, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SpinCallCount, "ULONG")
+    PHNT_REFLECT_FIELD(ExtendedFeatureDisableMask, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SchedulerSharedDataSlot, "PVOID")
+    PHNT_REFLECT_FIELD(HeapWalkContext, "PVOID")
+    PHNT_REFLECT_FIELD(PrimaryGroupAffinity, "GROUP_AFFINITY")
+    PHNT_REFLECT_FIELD(Rcu, "ULONG")
+PHNT_REFLECT_END(TEB)
+#endif
+#endif
+
+// win-polyfill-peb.h
+#ifdef _WIN_POLYFILL_PEB_H
+#ifndef WIN_POLYFILL_BASIC_PASS
+PHNT_REFLECT_BEGIN(PEB_FREE_BLOCK)
+    PHNT_REFLECT_FIELD(Next, "struct _PEB_FREE_BLOCK*")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+PHNT_REFLECT_END(PEB_FREE_BLOCK)
+#endif
+PHNT_REFLECT_BEGIN(PEB)
+    PHNT_REFLECT_FIELD(InheritedAddressSpace, "BOOLEAN")
+    PHNT_REFLECT_FIELD(ReadImageFileExecOptions, "BOOLEAN")
+    PHNT_REFLECT_FIELD(BeingDebugged, "BOOLEAN")
+    PHNT_REFLECT_FIELD(SpareBool, "BOOLEAN")
+    PHNT_REFLECT_FIELD(BitField, "UCHAR")
+    PHNT_REFLECT_BITFIELD(ImageUsedLargePages, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_00, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_01, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsProtectedProcess, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_02, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_03, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsLegacyProcess, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_04, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_05, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsImageDynamicallyRelocated_6_3, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsImageDynamicallyRelocated_6_0, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_06, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_07, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SkipPatchingUser32Forwarders_6_3, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SkipPatchingUser32Forwarders_6_0_SPx, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_08, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_09, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsPackagedProcess_6_3, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsPackagedProcess_6_2, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_10, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_11, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsAppContainer_6_3, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsAppContainer_6_2, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_12, "UCHAR")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x03_13, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsProtectedProcessLight, "UCHAR")
+    PHNT_REFLECT_BITFIELD(IsLongPathAwareProcess, "UCHAR")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding0, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(Mutant, "HANDLE")
+    PHNT_REFLECT_FIELD(ImageBaseAddress, "PVOID")
+    PHNT_REFLECT_FIELD(Ldr, "PPEB_LDR_DATA")
+    PHNT_REFLECT_FIELD(ProcessParameters, "PRTL_USER_PROCESS_PARAMETERS")
+    PHNT_REFLECT_FIELD(SubSystemData, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessHeap, "PVOID")
+    PHNT_REFLECT_FIELD(FastPebLock, "PRTL_CRITICAL_SECTION")
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(FastPebLockRoutine, "PVOID")
+    PHNT_REFLECT_FIELD(SparePtr1, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(AtlThunkSListPtr, "PVOID")
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(FastPebUnlockRoutine, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(SparePtr2, "PVOID")
+    PHNT_REFLECT_FIELD(IFEOKey, "PVOID")
+    PHNT_REFLECT_FIELD(EnvironmentUpdateCount, "ULONG")
+    PHNT_REFLECT_FIELD(CrossProcessFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessInJob, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessInitializing, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessUsingVEH, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessUsingVCH, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessUsingFTH, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessPreviouslyThrottled, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessCurrentlyThrottled, "ULONG")
+    PHNT_REFLECT_BITFIELD(ProcessImagesHotPatched, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReservedBits0, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding1, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(KernelCallbackTable, "PVOID")
+    PHNT_REFLECT_FIELD(UserSharedInfoPtr, "PVOID")
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(EventLogSection, "HANDLE")
+#endif
+    PHNT_REFLECT_FIELD(SystemReserved0, "ULONG")
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(EventLog, "PVOID")
+    PHNT_REFLECT_FIELD(SystemReserved1, "ULONG")
+    PHNT_REFLECT_BITFIELD(ExecuteOptions, "ULONG")
+    PHNT_REFLECT_BITFIELD(SpareBits_0x34, "ULONG")
+#endif
+    PHNT_REFLECT_FIELD(SpareUlong, "ULONG")
+    PHNT_REFLECT_FIELD(AtlThunkSListPtr32, "ULONG")
+    PHNT_REFLECT_FIELD(FreeList, "PEB_FREE_BLOCK*")
+    PHNT_REFLECT_FIELD(SparePebPtr0, "ULONG")
+    PHNT_REFLECT_FIELD(ApiSetMap, "PVOID")
+    PHNT_REFLECT_FIELD(TlsExpansionCounter, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding2, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(TlsBitmap, "PVOID")
+    PHNT_REFLECT_FIELD(TlsBitmapBits, "ULONG")
+    PHNT_REFLECT_FIELD(ReadOnlySharedMemoryBase, "PVOID")
+    PHNT_REFLECT_FIELD(ReadOnlySharedMemoryHeap, "PVOID")
+    PHNT_REFLECT_FIELD(HotpatchInformation, "PVOID")
+    PHNT_REFLECT_FIELD(SparePvoid0, "PVOID")
+    PHNT_REFLECT_FIELD(SharedData, "PVOID")
+    PHNT_REFLECT_FIELD(ReadOnlyStaticServerData, "PVOID*")
+    PHNT_REFLECT_FIELD(AnsiCodePageData, "PVOID")
+    PHNT_REFLECT_FIELD(OemCodePageData, "PVOID")
+    PHNT_REFLECT_FIELD(UnicodeCaseTableData, "PVOID")
+    PHNT_REFLECT_FIELD(NumberOfProcessors, "ULONG")
+    PHNT_REFLECT_FIELD(NtGlobalFlag, "ULONG")
+    PHNT_REFLECT_FIELD(CriticalSectionTimeout, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(HeapSegmentReserve, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(HeapSegmentCommit, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(HeapDeCommitTotalFreeThreshold, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(HeapDeCommitFreeBlockThreshold, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(NumberOfHeaps, "ULONG")
+    PHNT_REFLECT_FIELD(MaximumNumberOfHeaps, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessHeaps, "PVOID*")
+    PHNT_REFLECT_FIELD(GdiSharedHandleTable, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessStarterHelper, "PVOID")
+    PHNT_REFLECT_FIELD(GdiDCAttributeList, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding3, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(LoaderLock, "RTL_CRITICAL_SECTION*")
+    PHNT_REFLECT_FIELD(OSMajorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(OSMinorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(OSBuildNumber, "USHORT")
+    PHNT_REFLECT_FIELD(OSCSDVersion, "USHORT")
+    PHNT_REFLECT_FIELD(OSPlatformId, "ULONG")
+    PHNT_REFLECT_FIELD(ImageSubsystem, "ULONG")
+    PHNT_REFLECT_FIELD(ImageSubsystemMajorVersion, "ULONG")
+    PHNT_REFLECT_FIELD(ImageSubsystemMinorVersion, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding4, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(ImageProcessAffinityMask, "KAFFINITY")
+    PHNT_REFLECT_FIELD(ActiveProcessAffinityMask, "KAFFINITY")
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(GdiHandleBuffer, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(GdiHandleBuffer, "ULONG")
+#endif
+    PHNT_REFLECT_FIELD(PostProcessInitRoutine, "PPEB_POST_PROCESS_INIT_ROUTINE")
+    PHNT_REFLECT_FIELD(TlsExpansionBitmap, "PVOID")
+    PHNT_REFLECT_FIELD(TlsExpansionBitmapBits, "ULONG")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding5, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(AppCompatFlags, "ULARGE_INTEGER")
+    PHNT_REFLECT_FIELD(AppCompatFlagsUser, "ULARGE_INTEGER")
+    PHNT_REFLECT_FIELD(pShimData, "PVOID")
+    PHNT_REFLECT_FIELD(AppCompatInfo, "PVOID")
+    PHNT_REFLECT_FIELD(CSDVersion, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(ActivationContextData, "ACTIVATION_CONTEXT_DATA const*")
+    PHNT_REFLECT_FIELD(ProcessAssemblyStorageMap, "ASSEMBLY_STORAGE_MAP*")
+    PHNT_REFLECT_FIELD(SystemDefaultActivationContextData, "ACTIVATION_CONTEXT_DATA const*")
+    PHNT_REFLECT_FIELD(SystemAssemblyStorageMap, "ASSEMBLY_STORAGE_MAP*")
+    PHNT_REFLECT_FIELD(MinimumStackCommit, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FlsCallback, "FLS_CALLBACK_INFO*")
+    PHNT_REFLECT_FIELD(FlsListHead, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(FlsBitmap, "PVOID")
+    PHNT_REFLECT_FIELD(FlsBitmapBits, "ULONG")
+    PHNT_REFLECT_FIELD(FlsHighIndex, "ULONG")
+    PHNT_REFLECT_FIELD(SparePointers, "PVOID")
+    PHNT_REFLECT_FIELD(SpareUlongs, "ULONG")
+    PHNT_REFLECT_FIELD(WerRegistrationData, "PVOID")
+    PHNT_REFLECT_FIELD(WerShipAssertPtr, "PVOID")
+    PHNT_REFLECT_FIELD(pContextData, "PVOID")
+    PHNT_REFLECT_FIELD(pUnused, "PVOID")
+    PHNT_REFLECT_FIELD(pImageHeaderHash, "PVOID")
+    PHNT_REFLECT_FIELD(TracingFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(HeapTracingEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(CritSecTracingEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(LibLoaderTracingEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(SpareTracingBits, "ULONG")
+    PHNT_REFLECT_FIELD(CsrServerReadOnlySharedMemoryBase, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TppWorkerpListLock, "ULONG")
+    PHNT_REFLECT_FIELD(TppWorkerpList, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(WaitOnAddressHashTable, "PVOID")
+    PHNT_REFLECT_FIELD(TelemetryCoverageHeader, "PVOID")
+    PHNT_REFLECT_FIELD(CloudFileFlags, "ULONG")
+    PHNT_REFLECT_FIELD(CloudFileDiagFlags, "ULONG")
+    PHNT_REFLECT_FIELD(PlaceholderCompatibiltyMode, "CHAR")
+    PHNT_REFLECT_FIELD(PlaceholderCompatibilityModeReserved, "CHAR")
+    PHNT_REFLECT_FIELD(LeapSecondData, "LEAP_SECOND_DATA*")
+    PHNT_REFLECT_FIELD(LeapSecondFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(SixtySecondEnabled, "ULONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(NtGlobalFlag2, "ULONG")
+    PHNT_REFLECT_FIELD(ExtendedFeatureDisableMask, "ULONGLONG")
+PHNT_REFLECT_END(PEB)
+#endif
+
+// win-polyfill-teb.h
+#ifdef _WIN_POLYFILL_TEB_H
+PHNT_REFLECT_BEGIN(TEB)
+    PHNT_REFLECT_FIELD(NtTib, "NT_TIB")
+    PHNT_REFLECT_FIELD(EnvironmentPointer, "PVOID")
+    PHNT_REFLECT_FIELD(ClientId, "CLIENT_ID")
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(UnknownPointerCsrQlpcTeb, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(ActiveRpcHandle, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadLocalStoragePointer, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessEnvironmentBlock, "PEB*")
+    PHNT_REFLECT_FIELD(LastErrorValue, "ULONG")
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(UnknowByte, "BYTE")
+#endif
+    PHNT_REFLECT_FIELD(CountOfOwnedCriticalSections, "ULONG")
+    PHNT_REFLECT_FIELD(CsrClientThread, "PVOID")
+    PHNT_REFLECT_FIELD(Win32ThreadInfo, "PVOID")
+    PHNT_REFLECT_FIELD(User32Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(UserReserved, "ULONG")
+    PHNT_REFLECT_FIELD(WOW32Reserved, "PVOID")
+    PHNT_REFLECT_FIELD(CurrentLocale, "ULONG")
+    PHNT_REFLECT_FIELD(FpSoftwareStatusRegister, "ULONG")
+    PHNT_REFLECT_FIELD(ReservedForDebuggerInstrumentation, "PVOID")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(SystemReserved1, "PVOID")
+    PHNT_REFLECT_FIELD(HeapFlsData, "PVOID")
+    PHNT_REFLECT_FIELD(RngState, "ULONG_PTR")
+#else
+    PHNT_REFLECT_FIELD(SystemReserved1, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(PlaceholderCompatibilityMode, "CHAR")
+    PHNT_REFLECT_FIELD(PlaceholderHydrationAlwaysExplicit, "BOOLEAN")
+    PHNT_REFLECT_FIELD(PlaceholderReserved, "CHAR")
+    PHNT_REFLECT_FIELD(ProxiedProcessId, "DWORD")
+    PHNT_REFLECT_FIELD(ActivationStack, "ACTIVATION_CONTEXT_STACK")
+    PHNT_REFLECT_FIELD(WorkingOnBehalfOfTicket, "UCHAR")
+    PHNT_REFLECT_FIELD(ExceptionCode, "LONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding0, "UCHAR")
+#endif
+#ifndef _WIN64
+    PHNT_REFLECT_FIELD(SpareBytes1, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(ActivationContextStackPointer, "ACTIVATION_CONTEXT_STACK*")
+    PHNT_REFLECT_FIELD(InstrumentationCallbackSp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(InstrumentationCallbackPreviousPc, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(InstrumentationCallbackPreviousSp, "ULONG_PTR")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(TxFsContext, "ULONG")
+#endif
+    PHNT_REFLECT_FIELD(InstrumentationCallbackDisabled, "BOOLEAN")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(UnalignedLoadStoreExceptions, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Padding1, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(SpareBytes, "UCHAR")
+    PHNT_REFLECT_FIELD(TxFsContext, "ULONG")
+#endif
+    PHNT_REFLECT_FIELD(GdiTebBatch, "GDI_TEB_BATCH")
+    PHNT_REFLECT_FIELD(RealClientId, "CLIENT_ID")
+    PHNT_REFLECT_FIELD(GdiCachedProcessHandle, "PVOID")
+    PHNT_REFLECT_FIELD(GdiClientPID, "ULONG")
+    PHNT_REFLECT_FIELD(GdiClientTID, "ULONG")
+    PHNT_REFLECT_FIELD(GdiThreadLocalInfo, "PVOID")
+    PHNT_REFLECT_FIELD(Win32ClientInfo, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(glDispatchTable, "PVOID")
+    PHNT_REFLECT_FIELD(glReserved1, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(glReserved2, "PVOID")
+    PHNT_REFLECT_FIELD(glSectionInfo, "PVOID")
+    PHNT_REFLECT_FIELD(glSection, "PVOID")
+    PHNT_REFLECT_FIELD(glTable, "PVOID")
+    PHNT_REFLECT_FIELD(glCurrentRC, "PVOID")
+    PHNT_REFLECT_FIELD(glContext, "PVOID")
+    PHNT_REFLECT_FIELD(LastStatusValue, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding2, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(StaticUnicodeString, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(StaticUnicodeBuffer, "WCHAR")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding3, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(DeallocationStack, "PVOID")
+    PHNT_REFLECT_FIELD(TlsSlots, "PVOID")
+    PHNT_REFLECT_FIELD(TlsLinks, "LIST_ENTRY")
+    PHNT_REFLECT_FIELD(Vdm, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForNtRpc, "PVOID")
+    PHNT_REFLECT_FIELD(DbgSsReserved, "PVOID")
+    PHNT_REFLECT_FIELD(HardErrorsAreDisabled, "ULONG")
+    PHNT_REFLECT_FIELD(HardErrorMode, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding4, "UCHAR")
+#endif
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Instrumentation, "PVOID")
+#else
+    PHNT_REFLECT_FIELD(Instrumentation, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(ActivityId, "GUID")
+    PHNT_REFLECT_FIELD(SubProcessTag, "PVOID")
+    PHNT_REFLECT_FIELD(EtwLocalData, "PVOID")
+    PHNT_REFLECT_FIELD(PerflibData, "PVOID")
+    PHNT_REFLECT_FIELD(EtwTraceData, "PVOID")
+    PHNT_REFLECT_FIELD(WinSockData, "PVOID")
+    PHNT_REFLECT_FIELD(GdiBatchCount, "ULONG")
+    PHNT_REFLECT_FIELD(Spare2, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentIdealProcessor, "PROCESSOR_NUMBER")
+    PHNT_REFLECT_FIELD(IdealProcessorValue, "ULONG")
+    PHNT_REFLECT_FIELD(InDbgPrint, "BOOLEAN")
+    PHNT_REFLECT_FIELD(FreeStackOnTermination, "BOOLEAN")
+    PHNT_REFLECT_FIELD(HasFiberData_5_1, "BOOLEAN")
+    PHNT_REFLECT_FIELD(IdealProcessor, "UCHAR")
+    PHNT_REFLECT_FIELD(Spare3, "ULONG")
+    PHNT_REFLECT_FIELD(GuaranteedStackBytes, "ULONG")
+    PHNT_REFLECT_FIELD(Spare4, "ULONG")
+    PHNT_REFLECT_FIELD(ReservedForPerf, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForOle, "PVOID")
+    PHNT_REFLECT_FIELD(WaitingOnLoaderLock, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding6, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(SparePointer1, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(SavedPriorityState, "PVOID")
+    PHNT_REFLECT_FIELD(SoftPatchPtr1, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ReservedForCodeCoverage, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(SoftPatchPtr2, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ThreadPoolData, "PVOID")
+    PHNT_REFLECT_FIELD(TlsExpansionSlots, "PVOID*")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(DeallocationBStore, "PVOID")
+    PHNT_REFLECT_FIELD(ChpeV2CpuAreaInfo, "PVOID")
+    PHNT_REFLECT_FIELD(BStoreLimit, "PVOID")
+    PHNT_REFLECT_FIELD(Unused, "PVOID")
+#endif
+    PHNT_REFLECT_FIELD(ImpersonationLocale, "ULONG")
+    PHNT_REFLECT_FIELD(MuiGeneration, "ULONG")
+    PHNT_REFLECT_FIELD(IsImpersonating, "ULONG")
+    PHNT_REFLECT_FIELD(NlsCache, "PVOID")
+    PHNT_REFLECT_FIELD(pShimData, "PVOID")
+    PHNT_REFLECT_FIELD(HeapVirtualAffinity_5_1, "ULONG")
+    PHNT_REFLECT_FIELD(HeapVirtualAffinity, "USHORT")
+    PHNT_REFLECT_FIELD(LowFragHeapDataSlot, "USHORT")
+    PHNT_REFLECT_FIELD(HeapData, "ULONG")
+#ifdef _WIN64
+    PHNT_REFLECT_FIELD(Padding7, "UCHAR")
+#endif
+    PHNT_REFLECT_FIELD(CurrentTransactionHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(ActiveFrame, "PTEB_ACTIVE_FRAME")
+    PHNT_REFLECT_FIELD(FlsData, "PVOID")
+    PHNT_REFLECT_FIELD(PreferredLanguages, "PVOID")
+    PHNT_REFLECT_FIELD(UserPrefLanguages, "PVOID")
+    PHNT_REFLECT_FIELD(MergedPrefLanguages, "PVOID")
+    PHNT_REFLECT_FIELD(MuiImpersonation, "ULONG")
+    PHNT_REFLECT_FIELD(CrossTebFlags, "USHORT")
+    PHNT_REFLECT_BITFIELD(SpareCrossTebBits, "USHORT")
+    PHNT_REFLECT_FIELD(SameTebFlags, "USHORT")
+    PHNT_REFLECT_BITFIELD(SafeThunkCall, "USHORT")
+    PHNT_REFLECT_BITFIELD(InDebugPrint, "USHORT")
+    PHNT_REFLECT_BITFIELD(HasFiberData, "USHORT")
+    PHNT_REFLECT_BITFIELD(SkipThreadAttach, "USHORT")
+    PHNT_REFLECT_BITFIELD(WerInShipAssertCode, "USHORT")
+    PHNT_REFLECT_BITFIELD(RanProcessInit, "USHORT")
+    PHNT_REFLECT_BITFIELD(ClonedThread, "USHORT")
+    PHNT_REFLECT_BITFIELD(SuppressDebugMsg, "USHORT")
+    PHNT_REFLECT_BITFIELD(DisableUserStackWalk, "USHORT")
+    PHNT_REFLECT_BITFIELD(RtlExceptionAttached, "USHORT")
+    PHNT_REFLECT_BITFIELD(InitialThread, "USHORT")
+    PHNT_REFLECT_BITFIELD(SessionAware, "USHORT")
+    PHNT_REFLECT_BITFIELD(LoadOwner, "USHORT")
+    PHNT_REFLECT_BITFIELD(LoaderWorker, "USHORT")
+    PHNT_REFLECT_BITFIELD(SkipLoaderInit, "USHORT")
+    PHNT_REFLECT_BITFIELD(SkipFileAPIBrokering, "USHORT")
+    PHNT_REFLECT_FIELD(TxnScopeEnterCallback, "PVOID")
+    PHNT_REFLECT_FIELD(TxnScopeExitCallback, "PVOID")
+    PHNT_REFLECT_FIELD(TxnScopeContext, "PVOID")
+    PHNT_REFLECT_FIELD(LockCount, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessRundown, "ULONG")
+    PHNT_REFLECT_FIELD(SpareUlong0, "ULONG")
+    PHNT_REFLECT_FIELD(WowTebOffset, "LONG")
+    PHNT_REFLECT_FIELD(LastSwitchTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TotalSwitchOutTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(WaitReasonBitMap, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(PaddingVista, "PVOID")
+    PHNT_REFLECT_FIELD(ResourceRetValue, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForWdf, "PVOID")
+    PHNT_REFLECT_FIELD(ReservedForCrt, "ULONGLONG")
+    PHNT_REFLECT_FIELD(EffectiveContainerId, "GUID")
+    PHNT_REFLECT_FIELD(LastSleepCounter, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SpinCallCount, "ULONG")
+    PHNT_REFLECT_FIELD(ExtendedFeatureDisableMask, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SchedulerSharedDataSlot, "PVOID")
+    PHNT_REFLECT_FIELD(HeapWalkContext, "PVOID")
+    PHNT_REFLECT_FIELD(PrimaryGroupAffinity, "GROUP_AFFINITY")
+    PHNT_REFLECT_FIELD(Rcu, "ULONG")
+PHNT_REFLECT_END(TEB)
+#endif
+
+// ntwmi.h
+#ifdef _NTWMI_H
+PHNT_REFLECT_BEGIN(WMI_TRACE_PACKET)
+    PHNT_REFLECT_FIELD(Size, "USHORT")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(HookId, "USHORT")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(Type, "UCHAR")
+    PHNT_REFLECT_FIELD(Group, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+PHNT_REFLECT_END(WMI_TRACE_PACKET)
+PHNT_REFLECT_BEGIN(EVENT_INSTANCE_GUID_HEADER)
+    PHNT_REFLECT_FIELD(Size, "USHORT")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(FieldTypeFlags, "USHORT")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(HeaderType, "UCHAR")
+    PHNT_REFLECT_FIELD(MarkerFlags, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TimeStamp, "LARGE_INTEGER")
+#ifdef DUMMYUNIONNAME3
+    PHNT_REFLECT_FIELD(Guid, "GUID")
+    PHNT_REFLECT_FIELD(GuidPtr, "ULONGLONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME3, "union")
+#endif
+#ifdef DUMMYUNIONNAME4
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(ClientContext, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#ifdef DUMMYSTRUCTNAME2
+    PHNT_REFLECT_FIELD(KernelTime, "ULONG")
+    PHNT_REFLECT_FIELD(UserTime, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME2, "struct")
+#endif
+    PHNT_REFLECT_FIELD(ProcessorTime, "ULONG64")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME4, "union")
+#endif
+    PHNT_REFLECT_FIELD(InstanceId, "ULONG")
+    PHNT_REFLECT_FIELD(ParentInstanceId, "ULONG")
+    PHNT_REFLECT_FIELD(ParentGuid, "GUID")
+PHNT_REFLECT_END(EVENT_INSTANCE_GUID_HEADER)
+PHNT_REFLECT_BEGIN(PERFINFO_TRACE_HEADER)
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(Marker, "ULONG")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(Version, "USHORT")
+    PHNT_REFLECT_FIELD(HeaderType, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(Header, "ULONG")
+    PHNT_REFLECT_FIELD(Packet, "WMI_TRACE_PACKET")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+#ifdef DUMMYUNIONNAME3
+    PHNT_REFLECT_FIELD(TS, "PERFINFO_TIMESTAMP")
+    PHNT_REFLECT_FIELD(SystemTime, "LARGE_INTEGER")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME3, "union")
+#endif
+    PHNT_REFLECT_FIELD(Data, "UCHAR")
+PHNT_REFLECT_END(PERFINFO_TRACE_HEADER)
+PHNT_REFLECT_BEGIN(SYSTEM_TRACE_HEADER)
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(Marker, "ULONG")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(Version, "USHORT")
+    PHNT_REFLECT_FIELD(HeaderType, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(Header, "ULONG")
+    PHNT_REFLECT_FIELD(Packet, "WMI_TRACE_PACKET")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(SystemTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(KernelTime, "ULONG")
+    PHNT_REFLECT_FIELD(UserTime, "ULONG")
+PHNT_REFLECT_END(SYSTEM_TRACE_HEADER)
+PHNT_REFLECT_BEGIN(WMI_TRACE_MESSAGE_PACKET)
+    PHNT_REFLECT_FIELD(MessageNumber, "USHORT")
+    PHNT_REFLECT_FIELD(OptionFlags, "USHORT")
+PHNT_REFLECT_END(WMI_TRACE_MESSAGE_PACKET)
+PHNT_REFLECT_BEGIN(MESSAGE_TRACE_HEADER)
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(Marker, "ULONG")
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_FIELD(Size, "USHORT")
+    PHNT_REFLECT_FIELD(Reserved, "UCHAR")
+    PHNT_REFLECT_FIELD(Version, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(Header, "ULONG")
+    PHNT_REFLECT_FIELD(Packet, "WMI_TRACE_MESSAGE_PACKET")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+PHNT_REFLECT_END(MESSAGE_TRACE_HEADER)
+PHNT_REFLECT_BEGIN(MESSAGE_TRACE)
+    PHNT_REFLECT_FIELD(MessageHeader, "MESSAGE_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Data, "UCHAR")
+PHNT_REFLECT_END(MESSAGE_TRACE)
+PHNT_REFLECT_BEGIN(MESSAGE_TRACE_USER)
+    PHNT_REFLECT_FIELD(MessageHeader, "MESSAGE_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(MessageGuid, "GUID")
+    PHNT_REFLECT_FIELD(MessageFlags, "ULONG")
+    PHNT_REFLECT_FIELD(DataSize, "ULONG")
+    PHNT_REFLECT_FIELD(Data, "ULONG64")
+PHNT_REFLECT_END(MESSAGE_TRACE_USER)
+PHNT_REFLECT_BEGIN(ETW_REF_CLOCK)
+    PHNT_REFLECT_FIELD(StartTime, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(StartPerfClock, "LARGE_INTEGER")
+PHNT_REFLECT_END(ETW_REF_CLOCK)
+#ifndef ETW_WOW6432
+PHNT_REFLECT_BEGIN(WMI_BUFFER_HEADER)
+    PHNT_REFLECT_FIELD(BufferSize, "ULONG")
+    PHNT_REFLECT_FIELD(SavedOffset, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentOffset, "volatile ULONG")
+    PHNT_REFLECT_FIELD(ReferenceCount, "volatile LONG")
+    PHNT_REFLECT_FIELD(TimeStamp, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(SequenceNumber, "LONGLONG")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(SlistEntry, "SINGLE_LIST_ENTRY")
+    PHNT_REFLECT_FIELD(NextBuffer, "PWMI_BUFFER_HEADER")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(ClientContext, "ETW_BUFFER_CONTEXT")
+    PHNT_REFLECT_FIELD(State, "ETW_BUFFER_STATE")
+    PHNT_REFLECT_FIELD(Offset, "ULONG")
+    PHNT_REFLECT_FIELD(BufferFlag, "USHORT")
+    PHNT_REFLECT_FIELD(BufferType, "USHORT")
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(Padding1, "ULONG")
+    PHNT_REFLECT_FIELD(ReferenceTime, "ETW_REF_CLOCK")
+    PHNT_REFLECT_FIELD(GlobalEntry, "LIST_ENTRY")
+#ifdef DUMMYSTRUCTNAME2
+    PHNT_REFLECT_FIELD(Pointer0, "PVOID")
+    PHNT_REFLECT_FIELD(Pointer1, "PVOID")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME2, "struct")
+#endif
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+PHNT_REFLECT_END(WMI_BUFFER_HEADER)
+PHNT_REFLECT_BEGIN(TRACE_ENABLE_FLAG_EXTENSION)
+    PHNT_REFLECT_FIELD(Offset, "USHORT")
+    PHNT_REFLECT_FIELD(Length, "UCHAR")
+    PHNT_REFLECT_FIELD(Flag, "UCHAR")
+PHNT_REFLECT_END(TRACE_ENABLE_FLAG_EXTENSION)
+PHNT_REFLECT_BEGIN(TRACE_ENABLE_FLAG_EXT_HEADER)
+    PHNT_REFLECT_FIELD(Length, "USHORT")
+    PHNT_REFLECT_FIELD(Items, "USHORT")
+PHNT_REFLECT_END(TRACE_ENABLE_FLAG_EXT_HEADER)
+PHNT_REFLECT_BEGIN(TRACE_ENABLE_FLAG_EXT_ITEM)
+    PHNT_REFLECT_FIELD(Offset, "USHORT")
+    PHNT_REFLECT_FIELD(Type, "USHORT")
+PHNT_REFLECT_END(TRACE_ENABLE_FLAG_EXT_ITEM)
+PHNT_REFLECT_BEGIN(ETW_STACK_CACHING_CONFIG)
+    PHNT_REFLECT_FIELD(CacheSize, "ULONG")
+    PHNT_REFLECT_FIELD(BucketCount, "ULONG")
+PHNT_REFLECT_END(ETW_STACK_CACHING_CONFIG)
+#endif
+PHNT_REFLECT_BEGIN(PERFINFO_GROUPMASK)
+    PHNT_REFLECT_FIELD(Masks, "ULONG")
+PHNT_REFLECT_END(PERFINFO_GROUPMASK)
+PHNT_REFLECT_BEGIN(CPU_CONFIG_RECORD)
+    PHNT_REFLECT_FIELD(ProcessorSpeed, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfProcessors, "ULONG")
+    PHNT_REFLECT_FIELD(MemorySize, "ULONG")
+    PHNT_REFLECT_FIELD(PageSize, "ULONG")
+    PHNT_REFLECT_FIELD(AllocationGranularity, "ULONG")
+    PHNT_REFLECT_FIELD(ComputerName, "WCHAR")
+    PHNT_REFLECT_FIELD(DomainName, "WCHAR")
+    PHNT_REFLECT_FIELD(HyperThreadingFlag, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(HighestUserAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ProcessorArchitecture, "USHORT")
+    PHNT_REFLECT_FIELD(ProcessorLevel, "USHORT")
+    PHNT_REFLECT_FIELD(ProcessorRevision, "USHORT")
+    PHNT_REFLECT_FIELD(NxEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(PaeEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(MemorySpeed, "ULONG")
+PHNT_REFLECT_END(CPU_CONFIG_RECORD)
+PHNT_REFLECT_BEGIN(PHYSICAL_DISK_RECORD)
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(BytesPerSector, "ULONG")
+    PHNT_REFLECT_FIELD(SectorsPerTrack, "ULONG")
+    PHNT_REFLECT_FIELD(TracksPerCylinder, "ULONG")
+    PHNT_REFLECT_FIELD(Cylinders, "ULONGLONG")
+    PHNT_REFLECT_FIELD(SCSIPortNumber, "ULONG")
+    PHNT_REFLECT_FIELD(SCSIPathId, "ULONG")
+    PHNT_REFLECT_FIELD(SCSITargetId, "ULONG")
+    PHNT_REFLECT_FIELD(SCSILun, "ULONG")
+    PHNT_REFLECT_FIELD(Manufacturer, "WCHAR")
+    PHNT_REFLECT_FIELD(PartitionCount, "ULONG")
+    PHNT_REFLECT_FIELD(WriteCacheEnabled, "BOOLEAN")
+    PHNT_REFLECT_FIELD(BootDriveLetter, "WCHAR")
+PHNT_REFLECT_END(PHYSICAL_DISK_RECORD)
+PHNT_REFLECT_BEGIN(LOGICAL_DISK_EXTENTS)
+    PHNT_REFLECT_FIELD(StartingOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PartitionSize, "ULONGLONG")
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(DriveType, "ULONG")
+    PHNT_REFLECT_FIELD(DriveLetterString, "WCHAR")
+    PHNT_REFLECT_FIELD(Pad, "ULONG")
+    PHNT_REFLECT_FIELD(PartitionNumber, "ULONG")
+    PHNT_REFLECT_FIELD(SectorsPerCluster, "ULONG")
+    PHNT_REFLECT_FIELD(BytesPerSector, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfFreeClusters, "LONGLONG")
+    PHNT_REFLECT_FIELD(TotalNumberOfClusters, "LONGLONG")
+    PHNT_REFLECT_FIELD(FileSystemType, "WCHAR")
+    PHNT_REFLECT_FIELD(VolumeExt, "ULONG")
+PHNT_REFLECT_END(LOGICAL_DISK_EXTENTS)
+PHNT_REFLECT_BEGIN(OPTICAL_MEDIA_RECORD)
+    PHNT_REFLECT_FIELD(DiskNumber, "USHORT")
+    PHNT_REFLECT_FIELD(BusType, "USHORT")
+    PHNT_REFLECT_FIELD(DeviceType, "USHORT")
+    PHNT_REFLECT_FIELD(MediaType, "USHORT")
+    PHNT_REFLECT_FIELD(StartingOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Size, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NumberOfFreeBlocks, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TotalNumberOfBlocks, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NextWritableAddress, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NumberOfSessions, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfTracks, "ULONG")
+    PHNT_REFLECT_FIELD(BytesPerSector, "ULONG")
+    PHNT_REFLECT_FIELD(DiscStatus, "USHORT")
+    PHNT_REFLECT_FIELD(LastSessionStatus, "USHORT")
+    PHNT_REFLECT_FIELD(Data, "WCHAR")
+PHNT_REFLECT_END(OPTICAL_MEDIA_RECORD)
+PHNT_REFLECT_BEGIN(NIC_RECORD)
+    PHNT_REFLECT_FIELD(NICName, "WCHAR")
+    PHNT_REFLECT_FIELD(Index, "ULONG")
+    PHNT_REFLECT_FIELD(PhysicalAddrLen, "ULONG")
+    PHNT_REFLECT_FIELD(PhysicalAddr, "WCHAR")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(IpAddress, "LONG")
+    PHNT_REFLECT_FIELD(SubnetMask, "LONG")
+    PHNT_REFLECT_FIELD(DhcpServer, "LONG")
+    PHNT_REFLECT_FIELD(Gateway, "LONG")
+    PHNT_REFLECT_FIELD(PrimaryWinsServer, "LONG")
+    PHNT_REFLECT_FIELD(SecondaryWinsServer, "LONG")
+    PHNT_REFLECT_FIELD(DnsServer, "LONG")
+    PHNT_REFLECT_FIELD(Data, "ULONG")
+PHNT_REFLECT_END(NIC_RECORD)
+PHNT_REFLECT_BEGIN(VIDEO_RECORD)
+    PHNT_REFLECT_FIELD(MemorySize, "ULONG")
+    PHNT_REFLECT_FIELD(XResolution, "ULONG")
+    PHNT_REFLECT_FIELD(YResolution, "ULONG")
+    PHNT_REFLECT_FIELD(BitsPerPixel, "ULONG")
+    PHNT_REFLECT_FIELD(VRefresh, "ULONG")
+    PHNT_REFLECT_FIELD(ChipType, "WCHAR")
+    PHNT_REFLECT_FIELD(DACType, "WCHAR")
+    PHNT_REFLECT_FIELD(AdapterString, "WCHAR")
+    PHNT_REFLECT_FIELD(BiosString, "WCHAR")
+    PHNT_REFLECT_FIELD(DeviceId, "WCHAR")
+    PHNT_REFLECT_FIELD(StateFlags, "ULONG")
+PHNT_REFLECT_END(VIDEO_RECORD)
+PHNT_REFLECT_BEGIN(WMI_DPI_RECORD)
+    PHNT_REFLECT_FIELD(MachineDPI, "ULONG")
+    PHNT_REFLECT_FIELD(UserDPI, "ULONG")
+PHNT_REFLECT_END(WMI_DPI_RECORD)
+PHNT_REFLECT_BEGIN(WMI_POWER_RECORD)
+    PHNT_REFLECT_FIELD(SystemS1, "BOOLEAN")
+    PHNT_REFLECT_FIELD(SystemS2, "BOOLEAN")
+    PHNT_REFLECT_FIELD(SystemS3, "BOOLEAN")
+    PHNT_REFLECT_FIELD(SystemS4, "BOOLEAN")
+    PHNT_REFLECT_FIELD(SystemS5, "BOOLEAN")
+    PHNT_REFLECT_FIELD(AoAc, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Pad2, "CHAR")
+    PHNT_REFLECT_FIELD(Pad3, "CHAR")
+PHNT_REFLECT_END(WMI_POWER_RECORD)
+PHNT_REFLECT_BEGIN(WMI_IRQ_RECORD)
+    PHNT_REFLECT_FIELD(IRQAffinity, "ULONG64")
+    PHNT_REFLECT_FIELD(IRQGroup, "USHORT")
+    PHNT_REFLECT_FIELD(Reserved, "USHORT")
+    PHNT_REFLECT_FIELD(IRQNum, "ULONG")
+    PHNT_REFLECT_FIELD(DeviceDescriptionLen, "ULONG")
+    PHNT_REFLECT_FIELD(DeviceDescription, "WCHAR")
+PHNT_REFLECT_END(WMI_IRQ_RECORD)
+PHNT_REFLECT_BEGIN(WMI_PNP_RECORD_V3)
+    PHNT_REFLECT_FIELD(IDLength, "ULONG")
+    PHNT_REFLECT_FIELD(DescriptionLength, "ULONG")
+    PHNT_REFLECT_FIELD(FriendlyNameLength, "ULONG")
+    PHNT_REFLECT_FIELD(Strings, "WCHAR")
+PHNT_REFLECT_END(WMI_PNP_RECORD_V3)
+PHNT_REFLECT_BEGIN(WMI_PNP_RECORD_V4)
+    PHNT_REFLECT_FIELD(ClassGuid, "GUID")
+    PHNT_REFLECT_FIELD(UpperFilterCount, "ULONG")
+    PHNT_REFLECT_FIELD(LowerFilterCount, "ULONG")
+    PHNT_REFLECT_FIELD(Strings, "WCHAR")
+PHNT_REFLECT_END(WMI_PNP_RECORD_V4)
+PHNT_REFLECT_BEGIN(WMI_PNP_RECORD_V5)
+    PHNT_REFLECT_FIELD(ClassGuid, "GUID")
+    PHNT_REFLECT_FIELD(UpperFilterCount, "ULONG")
+    PHNT_REFLECT_FIELD(LowerFilterCount, "ULONG")
+    PHNT_REFLECT_FIELD(DevStatus, "ULONG")
+    PHNT_REFLECT_FIELD(DevProblem, "ULONG")
+    PHNT_REFLECT_FIELD(Strings, "WCHAR")
+PHNT_REFLECT_END(WMI_PNP_RECORD_V5)
+PHNT_REFLECT_BEGIN(WMI_IDE_CHANNEL_RECORD)
+    PHNT_REFLECT_FIELD(TargetId, "ULONG")
+    PHNT_REFLECT_FIELD(DeviceType, "ULONG")
+    PHNT_REFLECT_FIELD(DeviceTimingMode, "ULONG")
+    PHNT_REFLECT_FIELD(LocationInformationLen, "ULONG")
+    PHNT_REFLECT_FIELD(LocationInformation, "WCHAR")
+PHNT_REFLECT_END(WMI_IDE_CHANNEL_RECORD)
+PHNT_REFLECT_BEGIN(WMI_JOB_INFORMATION)
+    PHNT_REFLECT_FIELD(JobId, "GUID")
+    PHNT_REFLECT_FIELD(JobHandle, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(WMI_JOB_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_JOB_ASSIGN_PROCESS)
+    PHNT_REFLECT_FIELD(JobId, "GUID")
+    PHNT_REFLECT_FIELD(JobHandle, "ULONG")
+    PHNT_REFLECT_FIELD(UniqueProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(WMI_JOB_ASSIGN_PROCESS)
+PHNT_REFLECT_BEGIN(WMI_JOB_REMOVE_PROCESS)
+    PHNT_REFLECT_FIELD(JobId, "GUID")
+    PHNT_REFLECT_FIELD(UniqueProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(RemovalFlags, "ULONG")
+    PHNT_REFLECT_FIELD(ExitStatus, "NTSTATUS")
+PHNT_REFLECT_END(WMI_JOB_REMOVE_PROCESS)
+PHNT_REFLECT_BEGIN(WMI_JOB_SET_QUERY_CPU_RATE)
+    PHNT_REFLECT_FIELD(AllFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Value, "ULONG")
+PHNT_REFLECT_END(WMI_JOB_SET_QUERY_CPU_RATE)
+PHNT_REFLECT_BEGIN(WMI_JOB_SET_QUERY_NET_RATE)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(MaxBandwidth, "ULONG64")
+    PHNT_REFLECT_FIELD(DscpTag, "UCHAR")
+PHNT_REFLECT_END(WMI_JOB_SET_QUERY_NET_RATE)
+PHNT_REFLECT_BEGIN(WMI_JOB_SET_QUERY_INFORMATION)
+    PHNT_REFLECT_FIELD(JobId, "GUID")
+    PHNT_REFLECT_FIELD(JobHandle, "ULONG")
+    PHNT_REFLECT_FIELD(JobObjectInformationClass, "ULONG")
+PHNT_REFLECT_END(WMI_JOB_SET_QUERY_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_JOB_SEND_NOTIFICATION_INFORMATION)
+    PHNT_REFLECT_FIELD(JobId, "GUID")
+    PHNT_REFLECT_FIELD(NotificationId, "ULONG")
+PHNT_REFLECT_END(WMI_JOB_SEND_NOTIFICATION_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_PROCESS_INFORMATION)
+    PHNT_REFLECT_FIELD(UniqueProcessKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ParentId, "ULONG")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(ExitStatus, "NTSTATUS")
+    PHNT_REFLECT_FIELD(DirectoryTableBase, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(Sid, "ULONG")
+PHNT_REFLECT_END(WMI_PROCESS_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_PROCESS_INFORMATION64)
+    PHNT_REFLECT_FIELD(UniqueProcessKey64, "ULONG64")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ParentId, "ULONG")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(ExitStatus, "NTSTATUS")
+    PHNT_REFLECT_FIELD(DirectoryTableBase, "ULONG64")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(Sid, "ULONG")
+PHNT_REFLECT_END(WMI_PROCESS_INFORMATION64)
+PHNT_REFLECT_BEGIN(WMI_THREAD_INFORMATION)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+PHNT_REFLECT_END(WMI_THREAD_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_EXTENDED_THREAD_INFORMATION)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(StackBase, "PVOID")
+    PHNT_REFLECT_FIELD(StackLimit, "PVOID")
+    PHNT_REFLECT_FIELD(UserStackBase, "PVOID")
+    PHNT_REFLECT_FIELD(UserStackLimit, "PVOID")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(StartAddress, "PVOID")
+    PHNT_REFLECT_FIELD(Affinity, "KAFFINITY")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(Win32StartAddress, "PVOID")
+    PHNT_REFLECT_FIELD(TebBase, "PVOID")
+    PHNT_REFLECT_FIELD(SubProcessTag, "ULONG")
+    PHNT_REFLECT_FIELD(BasePriority, "SCHAR")
+    PHNT_REFLECT_FIELD(PagePriority, "UCHAR")
+    PHNT_REFLECT_FIELD(IoPriority, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+PHNT_REFLECT_END(WMI_EXTENDED_THREAD_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_EXTENDED_THREAD_INFORMATION64)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(StackBase64, "ULONG64")
+    PHNT_REFLECT_FIELD(StackLimit64, "ULONG64")
+    PHNT_REFLECT_FIELD(UserStackBase64, "ULONG64")
+    PHNT_REFLECT_FIELD(UserStackLimit64, "ULONG64")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(StartAddress64, "ULONG64")
+    PHNT_REFLECT_FIELD(Affinity, "ULONG64")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(Win32StartAddress64, "ULONG64")
+    PHNT_REFLECT_FIELD(TebBase64, "ULONG64")
+    PHNT_REFLECT_FIELD(SubProcessTag, "ULONG")
+    PHNT_REFLECT_FIELD(BasePriority, "SCHAR")
+    PHNT_REFLECT_FIELD(PagePriority, "UCHAR")
+    PHNT_REFLECT_FIELD(IoPriority, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+PHNT_REFLECT_END(WMI_EXTENDED_THREAD_INFORMATION64)
+PHNT_REFLECT_BEGIN(WMI_IMAGELOAD_INFORMATION)
+    PHNT_REFLECT_FIELD(ImageBase, "PVOID")
+    PHNT_REFLECT_FIELD(ImageSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ImageChecksum, "ULONG")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(SignatureLevel, "UCHAR")
+    PHNT_REFLECT_FIELD(SignatureType, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved0, "USHORT")
+    PHNT_REFLECT_FIELD(DefaultBase, "PVOID")
+    PHNT_REFLECT_FIELD(Reserved1, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved2, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved3, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved4, "ULONG")
+    PHNT_REFLECT_FIELD(FileName, "WCHAR")
+PHNT_REFLECT_END(WMI_IMAGELOAD_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_IMAGELOAD_INFORMATION32)
+    PHNT_REFLECT_FIELD(ImageBase32, "ULONG32")
+    PHNT_REFLECT_FIELD(ImageSize32, "ULONG32")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ImageChecksum, "ULONG")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(SignatureLevel, "UCHAR")
+    PHNT_REFLECT_FIELD(SignatureType, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved0, "USHORT")
+    PHNT_REFLECT_FIELD(DefaultBase32, "ULONG32")
+    PHNT_REFLECT_FIELD(Reserved1, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved2, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved3, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved4, "ULONG")
+    PHNT_REFLECT_FIELD(FileName, "WCHAR")
+PHNT_REFLECT_END(WMI_IMAGELOAD_INFORMATION32)
+PHNT_REFLECT_BEGIN(WMI_IMAGELOAD_INFORMATION64)
+    PHNT_REFLECT_FIELD(ImageBase64, "ULONG64")
+    PHNT_REFLECT_FIELD(ImageSize64, "ULONG64")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ImageChecksum, "ULONG")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(SignatureLevel, "UCHAR")
+    PHNT_REFLECT_FIELD(SignatureType, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved0, "USHORT")
+    PHNT_REFLECT_FIELD(DefaultBase64, "ULONG64")
+    PHNT_REFLECT_FIELD(Reserved1, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved2, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved3, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved4, "ULONG")
+    PHNT_REFLECT_FIELD(FileName, "WCHAR")
+PHNT_REFLECT_END(WMI_IMAGELOAD_INFORMATION64)
+PHNT_REFLECT_BEGIN(WMI_IMAGEID_INFORMATION)
+    PHNT_REFLECT_FIELD(ImageBase, "PVOID")
+    PHNT_REFLECT_FIELD(ImageSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(OriginalFileName, "WCHAR")
+PHNT_REFLECT_END(WMI_IMAGEID_INFORMATION)
+PHNT_REFLECT_BEGIN(WMI_IMAGEID_INFORMATION32)
+    PHNT_REFLECT_FIELD(ImageBase32, "ULONG32")
+    PHNT_REFLECT_FIELD(ImageSize32, "ULONG32")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(OriginalFileName, "WCHAR")
+PHNT_REFLECT_END(WMI_IMAGEID_INFORMATION32)
+PHNT_REFLECT_BEGIN(WMI_IMAGEID_INFORMATION64)
+    PHNT_REFLECT_FIELD(ImageBase64, "ULONG64")
+    PHNT_REFLECT_FIELD(ImageSize64, "ULONG64")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TimeDateStamp, "ULONG")
+    PHNT_REFLECT_FIELD(OriginalFileName, "WCHAR")
+PHNT_REFLECT_END(WMI_IMAGEID_INFORMATION64)
+PHNT_REFLECT_BEGIN(ETW_DISKIO_READWRITE_V2)
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(IrpFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(ByteOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(IrpAddress, "PVOID")
+    PHNT_REFLECT_FIELD(HighResResponseTime, "ULONGLONG")
+PHNT_REFLECT_END(ETW_DISKIO_READWRITE_V2)
+PHNT_REFLECT_BEGIN(ETW_DISKIO_READWRITE_V3)
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(IrpFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(ByteOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(IrpAddress, "PVOID")
+    PHNT_REFLECT_FIELD(HighResResponseTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+PHNT_REFLECT_END(ETW_DISKIO_READWRITE_V3)
+PHNT_REFLECT_BEGIN(ETW_DISKIO_FLUSH_BUFFERS_V2)
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(IrpFlags, "ULONG")
+    PHNT_REFLECT_FIELD(HighResResponseTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(IrpAddress, "PVOID")
+PHNT_REFLECT_END(ETW_DISKIO_FLUSH_BUFFERS_V2)
+PHNT_REFLECT_BEGIN(ETW_DISKIO_FLUSH_BUFFERS_V3)
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(IrpFlags, "ULONG")
+    PHNT_REFLECT_FIELD(HighResResponseTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(IrpAddress, "PVOID")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+PHNT_REFLECT_END(ETW_DISKIO_FLUSH_BUFFERS_V3)
+PHNT_REFLECT_BEGIN(WMI_DISKIO_READWRITE_INIT)
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+PHNT_REFLECT_END(WMI_DISKIO_READWRITE_INIT)
+PHNT_REFLECT_BEGIN(WMI_DISKIO_IO_REDIRECTED_INIT)
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(FileKey, "PVOID")
+PHNT_REFLECT_END(WMI_DISKIO_IO_REDIRECTED_INIT)
+PHNT_REFLECT_BEGIN(ETW_OPTICALIO_READWRITE)
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(IrpFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(ByteOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(IrpAddress, "PVOID")
+    PHNT_REFLECT_FIELD(HighResResponseTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+PHNT_REFLECT_END(ETW_OPTICALIO_READWRITE)
+PHNT_REFLECT_BEGIN(ETW_OPTICALIO_FLUSH_BUFFERS)
+    PHNT_REFLECT_FIELD(DiskNumber, "ULONG")
+    PHNT_REFLECT_FIELD(IrpFlags, "ULONG")
+    PHNT_REFLECT_FIELD(HighResResponseTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(IrpAddress, "PVOID")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+PHNT_REFLECT_END(ETW_OPTICALIO_FLUSH_BUFFERS)
+PHNT_REFLECT_BEGIN(ETW_OPTICALIO_INIT)
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+PHNT_REFLECT_END(ETW_OPTICALIO_INIT)
+PHNT_REFLECT_BEGIN(WMI_REGISTRY)
+    PHNT_REFLECT_FIELD(InitialTime, "LONGLONG")
+    PHNT_REFLECT_FIELD(Status, "ULONG")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(Index, "ULONG")
+    PHNT_REFLECT_FIELD(InfoClass, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(Kcb, "PVOID")
+    PHNT_REFLECT_FIELD(Name, "WCHAR")
+PHNT_REFLECT_END(WMI_REGISTRY)
+PHNT_REFLECT_BEGIN(WMI_TXR)
+    PHNT_REFLECT_FIELD(InitialTime, "LONGLONG")
+    PHNT_REFLECT_FIELD(TxRGUID, "GUID")
+    PHNT_REFLECT_FIELD(Status, "ULONG")
+    PHNT_REFLECT_FIELD(UowCount, "ULONG")
+    PHNT_REFLECT_FIELD(Hive, "WCHAR")
+PHNT_REFLECT_END(WMI_TXR)
+PHNT_REFLECT_BEGIN(ETW_REGNOTIF_REGISTER)
+    PHNT_REFLECT_FIELD(Notification, "PVOID")
+    PHNT_REFLECT_FIELD(Kcb, "PVOID")
+    PHNT_REFLECT_FIELD(Type, "UCHAR")
+    PHNT_REFLECT_FIELD(WatchTree, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Primary, "BOOLEAN")
+PHNT_REFLECT_END(ETW_REGNOTIF_REGISTER)
+PHNT_REFLECT_BEGIN(WMI_FILE_IO)
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(FileName, "WCHAR")
+PHNT_REFLECT_END(WMI_FILE_IO)
+PHNT_REFLECT_BEGIN(WMI_TCPIP_V4)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TransferSize, "ULONG")
+    PHNT_REFLECT_FIELD(DestinationAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(SourceAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(DestinationPort, "USHORT")
+    PHNT_REFLECT_FIELD(SourcePort, "USHORT")
+PHNT_REFLECT_END(WMI_TCPIP_V4)
+PHNT_REFLECT_BEGIN(WMI_TCPIP_V6)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TransferSize, "ULONG")
+    PHNT_REFLECT_FIELD(DestinationAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(SourceAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(DestinationPort, "USHORT")
+    PHNT_REFLECT_FIELD(SourcePort, "USHORT")
+PHNT_REFLECT_END(WMI_TCPIP_V6)
+PHNT_REFLECT_BEGIN(WMI_UDP_V4)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TransferSize, "USHORT")
+    PHNT_REFLECT_FIELD(DestinationAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(SourceAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(DestinationPort, "USHORT")
+    PHNT_REFLECT_FIELD(SourcePort, "USHORT")
+PHNT_REFLECT_END(WMI_UDP_V4)
+PHNT_REFLECT_BEGIN(WMI_UDP_V6)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(TransferSize, "USHORT")
+    PHNT_REFLECT_FIELD(DestinationAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(SourceAddress, "UCHAR")
+    PHNT_REFLECT_FIELD(DestinationPort, "USHORT")
+    PHNT_REFLECT_FIELD(SourcePort, "USHORT")
+PHNT_REFLECT_END(WMI_UDP_V6)
+PHNT_REFLECT_BEGIN(WMI_PAGE_FAULT)
+    PHNT_REFLECT_FIELD(VirtualAddress, "PVOID")
+    PHNT_REFLECT_FIELD(ProgramCounter, "PVOID")
+PHNT_REFLECT_END(WMI_PAGE_FAULT)
+PHNT_REFLECT_BEGIN(WMI_CONTEXTSWAP)
+    PHNT_REFLECT_FIELD(NewThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(OldThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(NewThreadPriority, "CHAR")
+    PHNT_REFLECT_FIELD(OldThreadPriority, "CHAR")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(PreviousCState, "UCHAR")
+    PHNT_REFLECT_FIELD(OldThreadRank, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(NewThreadPriorityDecrement, "CHAR")
+    PHNT_REFLECT_FIELD(SpareByte, "CHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+    PHNT_REFLECT_FIELD(OldThreadWaitReason, "UCHAR")
+    PHNT_REFLECT_FIELD(OldThreadWaitMode, "CHAR")
+    PHNT_REFLECT_FIELD(OldThreadState, "UCHAR")
+    PHNT_REFLECT_FIELD(OldThreadIdealProcessor, "UCHAR")
+    PHNT_REFLECT_FIELD(NewThreadWaitTime, "ULONG")
+    PHNT_REFLECT_FIELD(OldThreadRemainingQuantum, "LONG")
+PHNT_REFLECT_END(WMI_CONTEXTSWAP)
+PHNT_REFLECT_BEGIN(WMI_SPINLOCK)
+    PHNT_REFLECT_FIELD(SpinLockAddress, "PVOID")
+    PHNT_REFLECT_FIELD(CallerAddress, "PVOID")
+    PHNT_REFLECT_FIELD(AcquireTime, "ULONG64")
+    PHNT_REFLECT_FIELD(ReleaseTime, "ULONG64")
+    PHNT_REFLECT_FIELD(WaitTimeInCycles, "ULONG")
+    PHNT_REFLECT_FIELD(SpinCount, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(InterruptCount, "ULONG")
+    PHNT_REFLECT_FIELD(Irql, "UCHAR")
+    PHNT_REFLECT_FIELD(AcquireDepth, "UCHAR")
+    PHNT_REFLECT_BITFIELD(AcquireMode, "UCHAR")
+    PHNT_REFLECT_BITFIELD(ExecuteDpc, "UCHAR")
+    PHNT_REFLECT_BITFIELD(ExecuteIsr, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved, "UCHAR")
+PHNT_REFLECT_END(WMI_SPINLOCK)
+PHNT_REFLECT_BEGIN(WMI_RESOURCE)
+    PHNT_REFLECT_FIELD(AcquireTime, "ULONG64")
+    PHNT_REFLECT_FIELD(HoldTime, "ULONG64")
+    PHNT_REFLECT_FIELD(WaitTime, "ULONG64")
+    PHNT_REFLECT_FIELD(MaxRecursionDepth, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Resource, "PVOID")
+    PHNT_REFLECT_FIELD(Action, "ULONG")
+    PHNT_REFLECT_FIELD(ContentionDelta, "ULONG")
+PHNT_REFLECT_END(WMI_RESOURCE)
+PHNT_REFLECT_BEGIN(WMI_QUEUE)
+    PHNT_REFLECT_FIELD(Queue, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Action, "UCHAR")
+PHNT_REFLECT_END(WMI_QUEUE)
+PHNT_REFLECT_BEGIN(WMI_PUSHLOCK)
+    PHNT_REFLECT_FIELD(PushLock, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Action, "UCHAR")
+PHNT_REFLECT_END(WMI_PUSHLOCK)
+PHNT_REFLECT_BEGIN(WMI_WAIT_SINGLE)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(ObjectType, "UCHAR")
+PHNT_REFLECT_END(WMI_WAIT_SINGLE)
+PHNT_REFLECT_BEGIN(WMI_WAIT_OBJECT_RECORD)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(ObjectType, "UCHAR")
+PHNT_REFLECT_END(WMI_WAIT_OBJECT_RECORD)
+PHNT_REFLECT_BEGIN(WMI_WAIT_MULTIPLE)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(WaitType, "UCHAR")
+    PHNT_REFLECT_FIELD(ObjectCount, "UCHAR")
+    PHNT_REFLECT_FIELD(ObjectRecord, "WMI_WAIT_OBJECT_RECORD")
+PHNT_REFLECT_END(WMI_WAIT_MULTIPLE)
+PHNT_REFLECT_BEGIN(WMI_DELAY_EXECUTION)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Delta, "ULONGLONG")
+PHNT_REFLECT_END(WMI_DELAY_EXECUTION)
+PHNT_REFLECT_BEGIN(ETW_READY_THREAD_EVENT)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(AdjustReason, "UCHAR")
+    PHNT_REFLECT_FIELD(AdjustIncrement, "SCHAR")
+#ifdef DUMMYUNIONNAME
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_BITFIELD(ExecutingDpc, "UCHAR")
+    PHNT_REFLECT_BITFIELD(KernelStackNotResident, "UCHAR")
+    PHNT_REFLECT_BITFIELD(ProcessOutOfMemory, "UCHAR")
+    PHNT_REFLECT_BITFIELD(DirectSwitchAttempt, "UCHAR")
+    PHNT_REFLECT_BITFIELD(Reserved, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(SpareByte, "UCHAR")
+PHNT_REFLECT_END(ETW_READY_THREAD_EVENT)
+PHNT_REFLECT_BEGIN(ETW_KQUEUE_ENQUEUE_EVENT)
+    PHNT_REFLECT_FIELD(Entry, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+PHNT_REFLECT_END(ETW_KQUEUE_ENQUEUE_EVENT)
+PHNT_REFLECT_BEGIN(ETW_KQUEUE_DEQUEUE_EVENT)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(EntryCount, "ULONG")
+    PHNT_REFLECT_FIELD(Entries, "PVOID")
+PHNT_REFLECT_END(ETW_KQUEUE_DEQUEUE_EVENT)
+PHNT_REFLECT_BEGIN(ETW_ANTI_STARVATION_BOOST_EVENT)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessorIndex, "USHORT")
+    PHNT_REFLECT_FIELD(OldPriority, "SCHAR")
+    PHNT_REFLECT_FIELD(SpareByte, "UCHAR")
+PHNT_REFLECT_END(ETW_ANTI_STARVATION_BOOST_EVENT)
+PHNT_REFLECT_BEGIN(ETW_AUTOBOOST_SET_PRIORITY_FLOOR_EVENT)
+    PHNT_REFLECT_FIELD(Lock, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(NewCpuPriorityFloor, "SCHAR")
+    PHNT_REFLECT_FIELD(OldCpuPriority, "SCHAR")
+    PHNT_REFLECT_BITFIELD(NewIoPriorityFloor, "SCHAR")
+    PHNT_REFLECT_BITFIELD(OldIoPriority, "SCHAR")
+    PHNT_REFLECT_FIELD(IoPriorities, "SCHAR")
+    PHNT_REFLECT_BITFIELD(ExecutingDpc, "UCHAR")
+    PHNT_REFLECT_BITFIELD(WakeupBoost, "UCHAR")
+    PHNT_REFLECT_BITFIELD(BoostedOutstandingIrps, "UCHAR")
+    PHNT_REFLECT_BITFIELD(Reserved, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+PHNT_REFLECT_END(ETW_AUTOBOOST_SET_PRIORITY_FLOOR_EVENT)
+PHNT_REFLECT_BEGIN(ETW_AUTOBOOST_CLEAR_PRIORITY_FLOOR_EVENT)
+    PHNT_REFLECT_FIELD(Lock, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_BITFIELD(IoBoost, "USHORT")
+    PHNT_REFLECT_BITFIELD(CpuBoostsBitmap, "USHORT")
+    PHNT_REFLECT_FIELD(BoostBitmap, "USHORT")
+    PHNT_REFLECT_FIELD(Reserved, "USHORT")
+PHNT_REFLECT_END(ETW_AUTOBOOST_CLEAR_PRIORITY_FLOOR_EVENT)
+PHNT_REFLECT_BEGIN(ETW_AUTOBOOST_NO_ENTRIES_EVENT)
+    PHNT_REFLECT_FIELD(Lock, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+PHNT_REFLECT_END(ETW_AUTOBOOST_NO_ENTRIES_EVENT)
+PHNT_REFLECT_BEGIN(ETW_PRIORITY_EVENT)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(OldPriority, "SCHAR")
+    PHNT_REFLECT_FIELD(NewPriority, "SCHAR")
+    PHNT_REFLECT_FIELD(DynamicPriority, "SCHAR")
+    PHNT_REFLECT_FIELD(Reserved, "SCHAR")
+PHNT_REFLECT_END(ETW_PRIORITY_EVENT)
+PHNT_REFLECT_BEGIN(ETW_THREAD_AFFINITY_EVENT)
+    PHNT_REFLECT_FIELD(Mask, "KAFFINITY")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Group, "USHORT")
+    PHNT_REFLECT_FIELD(Reserved, "USHORT")
+PHNT_REFLECT_END(ETW_THREAD_AFFINITY_EVENT)
+PHNT_REFLECT_BEGIN(ETW_DEBUG_PRINT_EVENT)
+    PHNT_REFLECT_FIELD(Component, "ULONG")
+    PHNT_REFLECT_FIELD(Level, "ULONG")
+    PHNT_REFLECT_FIELD(Message, "CHAR")
+PHNT_REFLECT_END(ETW_DEBUG_PRINT_EVENT)
+PHNT_REFLECT_BEGIN(ETW_POOL_EVENT)
+    PHNT_REFLECT_FIELD(PoolType, "ULONG")
+    PHNT_REFLECT_FIELD(Tag, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfBytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(Entry, "PVOID")
+PHNT_REFLECT_END(ETW_POOL_EVENT)
+PHNT_REFLECT_BEGIN(ETW_CREATE_HANDLE_EVENT)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(Handle, "ULONG")
+    PHNT_REFLECT_FIELD(ObjectType, "USHORT")
+PHNT_REFLECT_END(ETW_CREATE_HANDLE_EVENT)
+PHNT_REFLECT_BEGIN(ETW_DUPLICATE_HANDLE_EVENT)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(SourceHandle, "ULONG")
+    PHNT_REFLECT_FIELD(TargetHandle, "ULONG")
+    PHNT_REFLECT_FIELD(TargetProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ObjectType, "USHORT")
+    PHNT_REFLECT_FIELD(SourceProcessId, "ULONG")
+PHNT_REFLECT_END(ETW_DUPLICATE_HANDLE_EVENT)
+PHNT_REFLECT_BEGIN(ETW_OBJECT_TYPE_EVENT)
+    PHNT_REFLECT_FIELD(ObjectType, "USHORT")
+    PHNT_REFLECT_FIELD(Reserved, "USHORT")
+    PHNT_REFLECT_FIELD(Name, "WCHAR")
+PHNT_REFLECT_END(ETW_OBJECT_TYPE_EVENT)
+PHNT_REFLECT_BEGIN(ETW_OBJECT_HANDLE_EVENT)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(Handle, "ULONG")
+    PHNT_REFLECT_FIELD(ObjectType, "USHORT")
+PHNT_REFLECT_END(ETW_OBJECT_HANDLE_EVENT)
+PHNT_REFLECT_BEGIN(ETW_REFDEREF_OBJECT_EVENT)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(Tag, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+PHNT_REFLECT_END(ETW_REFDEREF_OBJECT_EVENT)
+PHNT_REFLECT_BEGIN(ETW_CREATEDELETE_OBJECT_EVENT)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(ObjectType, "USHORT")
+PHNT_REFLECT_END(ETW_CREATEDELETE_OBJECT_EVENT)
+PHNT_REFLECT_BEGIN(ETW_WAKE_COUNTER_EVENT)
+    PHNT_REFLECT_FIELD(Object, "PVOID")
+    PHNT_REFLECT_FIELD(Tag, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "LONG")
+PHNT_REFLECT_END(ETW_WAKE_COUNTER_EVENT)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_COMMON)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Handle, "PVOID")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_COMMON)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_ALLOC)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Source, "ULONG")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_ALLOC)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_FREE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Source, "ULONG")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_FREE)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_REALLOC)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(NewAddress, "PVOID")
+    PHNT_REFLECT_FIELD(OldAddress, "PVOID")
+    PHNT_REFLECT_FIELD(NewSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(OldSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(Source, "ULONG")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_REALLOC)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_EXPANSION)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(CommittedSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(FreeSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(CommittedSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(ReservedSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(NoOfUCRs, "ULONG")
+    PHNT_REFLECT_FIELD(AllocatedSpace, "SIZE_T")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_EXPANSION)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_CONTRACTION)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(DeCommitSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(DeCommitAddress, "PVOID")
+    PHNT_REFLECT_FIELD(FreeSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(CommittedSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(ReservedSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(NoOfUCRs, "ULONG")
+    PHNT_REFLECT_FIELD(AllocatedSpace, "SIZE_T")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_CONTRACTION)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_CREATE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(ReserveSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(CommitSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(AllocatedSize, "SIZE_T")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_CREATE)
+PHNT_REFLECT_BEGIN(HEAP_EVENT_COMMIT_DECOMMIT)
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(Block, "PVOID")
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+    PHNT_REFLECT_FIELD(Caller, "ULONG")
+PHNT_REFLECT_END(HEAP_EVENT_COMMIT_DECOMMIT)
+PHNT_REFLECT_BEGIN(HEAP_COMMIT_DECOMMIT)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Event, "HEAP_EVENT_COMMIT_DECOMMIT")
+PHNT_REFLECT_END(HEAP_COMMIT_DECOMMIT)
+PHNT_REFLECT_BEGIN(HEAP_EVENT_SUBSEGMENT_ALLOC_FREE)
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(SubSegment, "PVOID")
+    PHNT_REFLECT_FIELD(SubSegmentSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(BlockSize, "SIZE_T")
+PHNT_REFLECT_END(HEAP_EVENT_SUBSEGMENT_ALLOC_FREE)
+PHNT_REFLECT_BEGIN(HEAP_SUBSEGMENT_FREE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Event, "HEAP_EVENT_SUBSEGMENT_ALLOC_FREE")
+PHNT_REFLECT_END(HEAP_SUBSEGMENT_FREE)
+PHNT_REFLECT_BEGIN(HEAP_SUBSEGMENT_ALLOC)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Event, "HEAP_EVENT_SUBSEGMENT_ALLOC_FREE")
+PHNT_REFLECT_END(HEAP_SUBSEGMENT_ALLOC)
+PHNT_REFLECT_BEGIN(HEAP_SUBSEGMENT_INIT)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(SubSegment, "PVOID")
+    PHNT_REFLECT_FIELD(BlockSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(BlockCount, "SIZE_T")
+    PHNT_REFLECT_FIELD(AffinityIndex, "ULONG")
+PHNT_REFLECT_END(HEAP_SUBSEGMENT_INIT)
+PHNT_REFLECT_BEGIN(HEAP_AFFINITY_MANAGER_ENABLE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(BucketIndex, "ULONG")
+PHNT_REFLECT_END(HEAP_AFFINITY_MANAGER_ENABLE)
+PHNT_REFLECT_BEGIN(HEAP_AFFINITY_SLOT_ASSIGN)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(SubSegment, "PVOID")
+    PHNT_REFLECT_FIELD(SlotIndex, "ULONG")
+PHNT_REFLECT_END(HEAP_AFFINITY_SLOT_ASSIGN)
+PHNT_REFLECT_BEGIN(HEAP_REUSE_THRESHOLD_ACTIVATED)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(SubSegment, "PVOID")
+    PHNT_REFLECT_FIELD(BucketIndex, "ULONG")
+PHNT_REFLECT_END(HEAP_REUSE_THRESHOLD_ACTIVATED)
+PHNT_REFLECT_BEGIN(HEAP_SUBSEGMENT_ACTIVATED)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(SubSegment, "PVOID")
+PHNT_REFLECT_END(HEAP_SUBSEGMENT_ACTIVATED)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_SNAPSHOT)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(FreeSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(CommittedSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(ReservedSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(LargeUCRSpace, "SIZE_T")
+    PHNT_REFLECT_FIELD(FreeListLength, "ULONG")
+    PHNT_REFLECT_FIELD(UCRLength, "ULONG")
+    PHNT_REFLECT_FIELD(AllocatedSpace, "SIZE_T")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_SNAPSHOT)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_RUNDOWN_RANGE)
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_RUNDOWN_RANGE)
+PHNT_REFLECT_BEGIN(ETW_HEAP_EVENT_RUNDOWN)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(RangeCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(Ranges, "ETW_HEAP_EVENT_RUNDOWN_RANGE")
+PHNT_REFLECT_END(ETW_HEAP_EVENT_RUNDOWN)
+PHNT_REFLECT_BEGIN(HEAP_EVENT_RANGE_CREATE)
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(FirstRangeSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(HEAP_EVENT_RANGE_CREATE)
+PHNT_REFLECT_BEGIN(HEAP_EVENT_RANGE)
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Size, "SIZE_T")
+PHNT_REFLECT_END(HEAP_EVENT_RANGE)
+PHNT_REFLECT_BEGIN(HEAP_RANGE_CREATE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Event, "HEAP_EVENT_RANGE_CREATE")
+PHNT_REFLECT_END(HEAP_RANGE_CREATE)
+PHNT_REFLECT_BEGIN(HEAP_RANGE_DESTROY)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(HeapHandle, "PVOID")
+PHNT_REFLECT_END(HEAP_RANGE_DESTROY)
+PHNT_REFLECT_BEGIN(HEAP_RANGE_LOG)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Range, "HEAP_EVENT_RANGE")
+PHNT_REFLECT_END(HEAP_RANGE_LOG)
+PHNT_REFLECT_BEGIN(ETW_CRITSEC_EVENT_COLLISION)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(LockCount, "ULONG")
+    PHNT_REFLECT_FIELD(SpinCount, "ULONG")
+    PHNT_REFLECT_FIELD(OwningThread, "PVOID")
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+PHNT_REFLECT_END(ETW_CRITSEC_EVENT_COLLISION)
+PHNT_REFLECT_BEGIN(ETW_CRITSEC_EVENT_INIT)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(SpinCount, "PVOID")
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+PHNT_REFLECT_END(ETW_CRITSEC_EVENT_INIT)
+PHNT_REFLECT_BEGIN(STACK_WALK_EVENT_DATA)
+    PHNT_REFLECT_FIELD(TimeStamp, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Addresses, "PVOID")
+PHNT_REFLECT_END(STACK_WALK_EVENT_DATA)
+PHNT_REFLECT_BEGIN(LOAD_DLL_EVENT_DATA)
+    PHNT_REFLECT_FIELD(ImageName, "WCHAR")
+PHNT_REFLECT_END(LOAD_DLL_EVENT_DATA)
+PHNT_REFLECT_BEGIN(CM_PERF_COUNTERS)
+    PHNT_REFLECT_FIELD(OpenedKeys, "ULONGLONG")
+    PHNT_REFLECT_FIELD(DelayCloseKCBs, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PrivateAllocPages, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PrivateAllocFree, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PrivateAllocUsed, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LookupCacheHit, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LookupCacheMissFound, "ULONGLONG")
+    PHNT_REFLECT_FIELD(LookupCacheMissNotFound, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ViewMap, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ViewUnMap, "ULONGLONG")
+    PHNT_REFLECT_FIELD(HiveShrink, "ULONGLONG")
+PHNT_REFLECT_END(CM_PERF_COUNTERS)
+PHNT_REFLECT_BEGIN(CI_LOG_SCHEDULER_EVENT)
+    PHNT_REFLECT_FIELD(Header, "EVENT_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Priority, "ULONG")
+    PHNT_REFLECT_FIELD(TaskIndex, "ULONG")
+PHNT_REFLECT_END(CI_LOG_SCHEDULER_EVENT)
+PHNT_REFLECT_BEGIN(CI_LOG_SCHEDULER_WAKEUP)
+    PHNT_REFLECT_FIELD(Header, "EVENT_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(Reason, "ULONG")
+PHNT_REFLECT_END(CI_LOG_SCHEDULER_WAKEUP)
+PHNT_REFLECT_BEGIN(CI_LOG_SCHEDULER_SLEEP)
+    PHNT_REFLECT_FIELD(Header, "EVENT_TRACE_HEADER")
+PHNT_REFLECT_END(CI_LOG_SCHEDULER_SLEEP)
+PHNT_REFLECT_BEGIN(CI_LOG_SCHEDULER_SLEEP_RESPONSE)
+    PHNT_REFLECT_FIELD(Header, "EVENT_TRACE_HEADER")
+PHNT_REFLECT_END(CI_LOG_SCHEDULER_SLEEP_RESPONSE)
+PHNT_REFLECT_BEGIN(CI_LOG_MMCSS_START)
+    PHNT_REFLECT_FIELD(Header, "EVENT_TRACE_HEADER")
+PHNT_REFLECT_END(CI_LOG_MMCSS_START)
+PHNT_REFLECT_BEGIN(CI_LOG_MMCSS_STOP)
+    PHNT_REFLECT_FIELD(Header, "EVENT_TRACE_HEADER")
+PHNT_REFLECT_END(CI_LOG_MMCSS_STOP)
+PHNT_REFLECT_BEGIN(ETW_UMS_EVENT_DIRECTED_SWITCH_START)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ScheduledThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(PrimaryThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(SwitchFlags, "ULONG")
+PHNT_REFLECT_END(ETW_UMS_EVENT_DIRECTED_SWITCH_START)
+PHNT_REFLECT_BEGIN(ETW_UMS_EVENT_DIRECTED_SWITCH_END)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ScheduledThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(PrimaryThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(SwitchFlags, "ULONG")
+PHNT_REFLECT_END(ETW_UMS_EVENT_DIRECTED_SWITCH_END)
+PHNT_REFLECT_BEGIN(ETW_UMS_EVENT_PARK)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ScheduledThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(ParkFlags, "ULONG")
+PHNT_REFLECT_END(ETW_UMS_EVENT_PARK)
+PHNT_REFLECT_BEGIN(ETW_UMS_EVENT_DISASSOCIATE)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ScheduledThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(PrimaryThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(UmsApcControlFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(ETW_UMS_EVENT_DISASSOCIATE)
+PHNT_REFLECT_BEGIN(ETW_UMS_EVENT_CONTEXT_SWITCH)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(ScheduledThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(SwitchCount, "ULONG")
+    PHNT_REFLECT_FIELD(KernelYieldCount, "ULONG")
+    PHNT_REFLECT_FIELD(MixedYieldCount, "ULONG")
+    PHNT_REFLECT_FIELD(YieldCount, "ULONG")
+PHNT_REFLECT_END(ETW_UMS_EVENT_CONTEXT_SWITCH)
+PHNT_REFLECT_BEGIN(ETW_SET_TIMER_EVENT)
+    PHNT_REFLECT_FIELD(ExpectedDueTime, "ULONG64")
+    PHNT_REFLECT_FIELD(TimerAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(TargetProcessorGroup, "USHORT")
+    PHNT_REFLECT_FIELD(TargetProcessorIndex, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+    PHNT_REFLECT_FIELD(Period, "ULONG")
+    PHNT_REFLECT_FIELD(EncodedDelay, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved0, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved1, "USHORT")
+PHNT_REFLECT_END(ETW_SET_TIMER_EVENT)
+PHNT_REFLECT_BEGIN(ETW_CANCEL_TIMER_EVENT)
+    PHNT_REFLECT_FIELD(TimerAddress, "ULONG_PTR")
+PHNT_REFLECT_END(ETW_CANCEL_TIMER_EVENT)
+PHNT_REFLECT_BEGIN(ETW_TIMER_EXPIRATION_EVENT)
+    PHNT_REFLECT_FIELD(ExpectedDueTime, "ULONG64")
+    PHNT_REFLECT_FIELD(TimerAddress, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DeferredRoutine, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(EncodedDelay, "UCHAR")
+PHNT_REFLECT_END(ETW_TIMER_EXPIRATION_EVENT)
+PHNT_REFLECT_BEGIN(ETW_TIMER_EXPIRATION_START_EVENT)
+    PHNT_REFLECT_FIELD(InterruptTime, "ULONG64")
+PHNT_REFLECT_END(ETW_TIMER_EXPIRATION_START_EVENT)
+PHNT_REFLECT_BEGIN(ETW_SET_KTIMER2_EVENT)
+    PHNT_REFLECT_FIELD(DueTime, "ULONG64")
+    PHNT_REFLECT_FIELD(MaximumDueTime, "ULONG64")
+    PHNT_REFLECT_FIELD(Period, "ULONG64")
+    PHNT_REFLECT_FIELD(TimerKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Callback, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(CallbackContextKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+PHNT_REFLECT_END(ETW_SET_KTIMER2_EVENT)
+PHNT_REFLECT_BEGIN(ETW_CANCEL_KTIMER2_EVENT)
+    PHNT_REFLECT_FIELD(TimerKey, "ULONG_PTR")
+PHNT_REFLECT_END(ETW_CANCEL_KTIMER2_EVENT)
+PHNT_REFLECT_BEGIN(ETW_DISABLE_KTIMER2_EVENT)
+    PHNT_REFLECT_FIELD(TimerKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DisableCallback, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DisableContextKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+PHNT_REFLECT_END(ETW_DISABLE_KTIMER2_EVENT)
+PHNT_REFLECT_BEGIN(ETW_FINALIZE_KTIMER2_EVENT)
+    PHNT_REFLECT_FIELD(TimerKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DisableCallback, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DisableContextKey, "ULONG_PTR")
+PHNT_REFLECT_END(ETW_FINALIZE_KTIMER2_EVENT)
+PHNT_REFLECT_BEGIN(ETW_CLOCK_CONFIGURATION_EVENT)
+    PHNT_REFLECT_FIELD(KnownType, "ULONG")
+    PHNT_REFLECT_FIELD(Capabilities, "ULONG")
+    PHNT_REFLECT_FIELD(DisableReason, "PERFINFO_DYNAMIC_TICK_DISABLE_REASON")
+PHNT_REFLECT_END(ETW_CLOCK_CONFIGURATION_EVENT)
+PHNT_REFLECT_BEGIN(ETW_CLOCK_TIME_UPDATE)
+    PHNT_REFLECT_FIELD(InterruptTime, "ULONG64")
+    PHNT_REFLECT_FIELD(ClockOwner, "ULONG")
+PHNT_REFLECT_END(ETW_CLOCK_TIME_UPDATE)
+PHNT_REFLECT_BEGIN(ETW_CLOCK_STATE_CHANGE_EVENT)
+    PHNT_REFLECT_FIELD(NewState, "UCHAR")
+    PHNT_REFLECT_FIELD(PrevState, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved, "UCHAR")
+    PHNT_REFLECT_FIELD(DeliveredIncrement, "ULONG64")
+    PHNT_REFLECT_FIELD(RequestedIncrement, "ULONG64")
+    PHNT_REFLECT_FIELD(NextClockUpdateTime, "ULONG64")
+PHNT_REFLECT_END(ETW_CLOCK_STATE_CHANGE_EVENT)
+PHNT_REFLECT_BEGIN(ETW_PER_SESSION_QUOTA)
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(CpuShareWeight, "ULONG")
+    PHNT_REFLECT_FIELD(CapturedWeightData, "LONGLONG")
+    PHNT_REFLECT_FIELD(CyclesAccumulated, "ULONG64")
+PHNT_REFLECT_END(ETW_PER_SESSION_QUOTA)
+PHNT_REFLECT_BEGIN(ETW_DFSS_START_NEW_INTERVAL)
+    PHNT_REFLECT_FIELD(CurrentGeneration, "ULONG")
+    PHNT_REFLECT_FIELD(SessionCount, "ULONG")
+    PHNT_REFLECT_FIELD(TotalCycleCredit, "ULONG64")
+    PHNT_REFLECT_FIELD(TotalCyclesAccumulated, "ULONG64")
+    PHNT_REFLECT_FIELD(SessionQuota, "ETW_PER_SESSION_QUOTA")
+PHNT_REFLECT_END(ETW_DFSS_START_NEW_INTERVAL)
+PHNT_REFLECT_BEGIN(ETW_DFSS_RELEASE_THREAD_ON_IDLE)
+    PHNT_REFLECT_FIELD(CurrentGeneration, "ULONG")
+    PHNT_REFLECT_FIELD(SessionSelectedToRun, "ULONG")
+    PHNT_REFLECT_FIELD(CycleBaseAllowance, "ULONG64")
+    PHNT_REFLECT_FIELD(CyclesRemaining, "LONG64")
+PHNT_REFLECT_END(ETW_DFSS_RELEASE_THREAD_ON_IDLE)
+PHNT_REFLECT_BEGIN(ETW_CPU_CACHE_FLUSH_EVENT)
+    PHNT_REFLECT_FIELD(Address, "PVOID")
+    PHNT_REFLECT_FIELD(Bytes, "SIZE_T")
+    PHNT_REFLECT_FIELD(Clean, "BOOLEAN")
+    PHNT_REFLECT_FIELD(FullFlush, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Rectangle, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Reserved0, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Reserved1, "ULONG")
+PHNT_REFLECT_END(ETW_CPU_CACHE_FLUSH_EVENT)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_CALLBACK_ENQUEUE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+    PHNT_REFLECT_FIELD(TaskId, "PVOID")
+    PHNT_REFLECT_FIELD(Callback, "PVOID")
+    PHNT_REFLECT_FIELD(Context, "PVOID")
+    PHNT_REFLECT_FIELD(SubProcessTag, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_CALLBACK_ENQUEUE)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_CALLBACK_START)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+    PHNT_REFLECT_FIELD(TaskId, "PVOID")
+    PHNT_REFLECT_FIELD(Callback, "PVOID")
+    PHNT_REFLECT_FIELD(Context, "PVOID")
+    PHNT_REFLECT_FIELD(SubProcessTag, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_CALLBACK_START)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_CALLBACK_CANCEL)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+    PHNT_REFLECT_FIELD(TaskId, "PVOID")
+    PHNT_REFLECT_FIELD(Callback, "PVOID")
+    PHNT_REFLECT_FIELD(Context, "PVOID")
+    PHNT_REFLECT_FIELD(SubProcessTag, "PVOID")
+    PHNT_REFLECT_FIELD(CancelCount, "ULONG")
+PHNT_REFLECT_END(ETW_TP_EVENT_CALLBACK_CANCEL)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_POOL_CREATE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_POOL_CREATE)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_POOL_CLOSE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_POOL_CLOSE)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_POOL_TH_MIN_SET)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadNum, "ULONG")
+PHNT_REFLECT_END(ETW_TP_EVENT_POOL_TH_MIN_SET)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_POOL_TH_MAX_SET)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadNum, "ULONG")
+PHNT_REFLECT_END(ETW_TP_EVENT_POOL_TH_MAX_SET)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_WORKER_NUMANODE_SWITCH)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(PoolId, "PVOID")
+    PHNT_REFLECT_FIELD(CurrentNode, "ULONG")
+    PHNT_REFLECT_FIELD(NextNode, "ULONG")
+    PHNT_REFLECT_FIELD(CurrentGroup, "USHORT")
+    PHNT_REFLECT_FIELD(NextGroup, "USHORT")
+    PHNT_REFLECT_FIELD(CurrentWorkerCount, "ULONG")
+    PHNT_REFLECT_FIELD(NextWorkerCount, "ULONG")
+PHNT_REFLECT_END(ETW_TP_EVENT_WORKER_NUMANODE_SWITCH)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_TIMER_SET)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(DueTime, "LONG64")
+    PHNT_REFLECT_FIELD(SubQueue, "PVOID")
+    PHNT_REFLECT_FIELD(Timer, "PVOID")
+    PHNT_REFLECT_FIELD(Period, "ULONG")
+    PHNT_REFLECT_FIELD(WindowLength, "ULONG")
+    PHNT_REFLECT_FIELD(Absolute, "ULONG")
+PHNT_REFLECT_END(ETW_TP_EVENT_TIMER_SET)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_TIMER_CANCELLED)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(SubQueue, "PVOID")
+    PHNT_REFLECT_FIELD(Timer, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_TIMER_CANCELLED)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_TIMER_SET_NTTIMER)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(DueTime, "LONG64")
+    PHNT_REFLECT_FIELD(SubQueue, "PVOID")
+    PHNT_REFLECT_FIELD(TolerableDelay, "ULONG")
+PHNT_REFLECT_END(ETW_TP_EVENT_TIMER_SET_NTTIMER)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_TIMER_CANCEL_NTTIMER)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(SubQueue, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_TIMER_CANCEL_NTTIMER)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_TIMER_EXPIRATION_BEGIN)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(SubQueue, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_TIMER_EXPIRATION_BEGIN)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_TIMER_EXPIRATION_END)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(SubQueue, "PVOID")
+PHNT_REFLECT_END(ETW_TP_EVENT_TIMER_EXPIRATION_END)
+PHNT_REFLECT_BEGIN(ETW_TP_EVENT_TIMER_EXPIRATION)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(DueTime, "LONG64")
+    PHNT_REFLECT_FIELD(SubQueue, "PVOID")
+    PHNT_REFLECT_FIELD(Timer, "PVOID")
+    PHNT_REFLECT_FIELD(Period, "ULONG")
+    PHNT_REFLECT_FIELD(WindowLength, "ULONG")
+PHNT_REFLECT_END(ETW_TP_EVENT_TIMER_EXPIRATION)
+PHNT_REFLECT_BEGIN(ETW_THREAD_EVENT_SUBPROCESSTAG)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(OldTag, "ULONG")
+    PHNT_REFLECT_FIELD(NewTag, "ULONG")
+PHNT_REFLECT_END(ETW_THREAD_EVENT_SUBPROCESSTAG)
+PHNT_REFLECT_BEGIN(ETW_WNF_EVENT_SUBSCRIBE)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(StateName, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Subscription, "PVOID")
+    PHNT_REFLECT_FIELD(NameSub, "PVOID")
+    PHNT_REFLECT_FIELD(Callback, "PVOID")
+    PHNT_REFLECT_FIELD(RefCount, "ULONG")
+    PHNT_REFLECT_FIELD(DeliveryFlags, "ULONG")
+PHNT_REFLECT_END(ETW_WNF_EVENT_SUBSCRIBE)
+PHNT_REFLECT_BEGIN(ETW_WNF_EVENT_CALLBACK)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(StateName, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(Subscription, "PVOID")
+    PHNT_REFLECT_FIELD(NameSub, "PVOID")
+    PHNT_REFLECT_FIELD(Callback, "PVOID")
+    PHNT_REFLECT_FIELD(ChangeStamp, "ULONG")
+    PHNT_REFLECT_FIELD(DeliveryFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Return, "ULONG")
+PHNT_REFLECT_END(ETW_WNF_EVENT_CALLBACK)
+PHNT_REFLECT_BEGIN(ETW_WNF_EVENT_PUBLISH)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(StateName, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(DataLength, "ULONG")
+PHNT_REFLECT_END(ETW_WNF_EVENT_PUBLISH)
+PHNT_REFLECT_BEGIN(ETW_WNF_EVENT_NAME_SUB_RUNDOWN)
+    PHNT_REFLECT_FIELD(Header, "SYSTEM_TRACE_HEADER")
+    PHNT_REFLECT_FIELD(StateName, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(NameSub, "PVOID")
+PHNT_REFLECT_END(ETW_WNF_EVENT_NAME_SUB_RUNDOWN)
+PHNT_REFLECT_BEGIN(PERFINFO_MARK_EVENT)
+    PHNT_REFLECT_FIELD(TranId, "ULONG")
+    PHNT_REFLECT_FIELD(Level, "UCHAR")
+    PHNT_REFLECT_FIELD(AppId, "UCHAR")
+    PHNT_REFLECT_FIELD(OpId, "USHORT")
+    PHNT_REFLECT_FIELD(Text, "WCHAR")
+PHNT_REFLECT_END(PERFINFO_MARK_EVENT)
+PHNT_REFLECT_BEGIN(PERFINFO_DRIVER_MAJORFUNCTION)
+    PHNT_REFLECT_FIELD(MajorFunction, "ULONG")
+    PHNT_REFLECT_FIELD(MinorFunction, "ULONG")
+    PHNT_REFLECT_FIELD(RoutineAddr, "PVOID")
+    PHNT_REFLECT_FIELD(FileNamePointer, "PVOID")
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(UniqMatchId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_DRIVER_MAJORFUNCTION)
+PHNT_REFLECT_BEGIN(PERFINFO_DRIVER_MAJORFUNCTION_RET)
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(UniqMatchId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_DRIVER_MAJORFUNCTION_RET)
+PHNT_REFLECT_BEGIN(PERFINFO_DRIVER_COMPLETE_REQUEST)
+    PHNT_REFLECT_FIELD(RoutineAddr, "PVOID")
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(UniqMatchId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_DRIVER_COMPLETE_REQUEST)
+PHNT_REFLECT_BEGIN(PERFINFO_DRIVER_COMPLETE_REQUEST_RET)
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(UniqMatchId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_DRIVER_COMPLETE_REQUEST_RET)
+PHNT_REFLECT_BEGIN(PERFINFO_DRIVER_COMPLETIONROUTINE)
+    PHNT_REFLECT_FIELD(Routine, "PVOID")
+    PHNT_REFLECT_FIELD(IrpPtr, "PVOID")
+    PHNT_REFLECT_FIELD(UniqMatchId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_DRIVER_COMPLETIONROUTINE)
+PHNT_REFLECT_BEGIN(PERFINFO_BATTERY_LIFE_INFO)
+    PHNT_REFLECT_FIELD(RemainingCapacity, "ULONG")
+    PHNT_REFLECT_FIELD(Rate, "ULONG")
+PHNT_REFLECT_END(PERFINFO_BATTERY_LIFE_INFO)
+PHNT_REFLECT_BEGIN(PERFINFO_IDLE_STATE_CHANGE)
+    PHNT_REFLECT_FIELD(State, "ULONG")
+    PHNT_REFLECT_FIELD(Throttle, "ULONG")
+    PHNT_REFLECT_FIELD(Direction, "ULONG")
+PHNT_REFLECT_END(PERFINFO_IDLE_STATE_CHANGE)
+PHNT_REFLECT_BEGIN(PERFINFO_SET_POWER_ACTION)
+    PHNT_REFLECT_FIELD(Trigger, "PVOID")
+    PHNT_REFLECT_FIELD(PowerAction, "ULONG")
+    PHNT_REFLECT_FIELD(LightestState, "ULONG")
+PHNT_REFLECT_END(PERFINFO_SET_POWER_ACTION)
+PHNT_REFLECT_BEGIN(PERFINFO_SET_POWER_ACTION_RET)
+    PHNT_REFLECT_FIELD(Trigger, "PVOID")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(PERFINFO_SET_POWER_ACTION_RET)
+PHNT_REFLECT_BEGIN(PERFINFO_SET_DEVICES_STATE)
+    PHNT_REFLECT_FIELD(SystemState, "ULONG")
+    PHNT_REFLECT_FIELD(Waking, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Shutdown, "BOOLEAN")
+    PHNT_REFLECT_FIELD(IrpMinor, "UCHAR")
+PHNT_REFLECT_END(PERFINFO_SET_DEVICES_STATE)
+PHNT_REFLECT_BEGIN(PERFINFO_SET_DEVICES_STATE_RET)
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(PERFINFO_SET_DEVICES_STATE_RET)
+PHNT_REFLECT_BEGIN(PERFINFO_PO_NOTIFY_DEVICE)
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(DriverStart, "PVOID")
+    PHNT_REFLECT_FIELD(OrderLevel, "UCHAR")
+    PHNT_REFLECT_FIELD(MajorFunction, "UCHAR")
+    PHNT_REFLECT_FIELD(MinorFunction, "UCHAR")
+    PHNT_REFLECT_FIELD(Type, "POWER_STATE_TYPE")
+    PHNT_REFLECT_FIELD(State, "POWER_STATE")
+    PHNT_REFLECT_FIELD(DeviceNameLength, "ULONG")
+    PHNT_REFLECT_FIELD(DeviceName, "WCHAR")
+PHNT_REFLECT_END(PERFINFO_PO_NOTIFY_DEVICE)
+PHNT_REFLECT_BEGIN(PERFINFO_PO_NOTIFY_DEVICE_COMPLETE)
+    PHNT_REFLECT_FIELD(Irp, "PVOID")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(PERFINFO_PO_NOTIFY_DEVICE_COMPLETE)
+PHNT_REFLECT_BEGIN(PERFINFO_PO_SESSION_CALLOUT)
+    PHNT_REFLECT_FIELD(SystemAction, "POWER_ACTION")
+    PHNT_REFLECT_FIELD(MinSystemState, "SYSTEM_POWER_STATE")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(PowerStateTask, "ULONG")
+PHNT_REFLECT_END(PERFINFO_PO_SESSION_CALLOUT)
+PHNT_REFLECT_BEGIN(PERFINFO_PO_PRESLEEP)
+    PHNT_REFLECT_FIELD(PerformanceCounter, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(PerformanceFrequency, "LARGE_INTEGER")
+PHNT_REFLECT_END(PERFINFO_PO_PRESLEEP)
+PHNT_REFLECT_BEGIN(PERFINFO_PO_POSTSLEEP)
+    PHNT_REFLECT_FIELD(PerformanceCounter, "LARGE_INTEGER")
+PHNT_REFLECT_END(PERFINFO_PO_POSTSLEEP)
+PHNT_REFLECT_BEGIN(PERFINFO_PO_CALIBRATED_PERFCOUNTER)
+    PHNT_REFLECT_FIELD(PerformanceCounter, "LARGE_INTEGER")
+PHNT_REFLECT_END(PERFINFO_PO_CALIBRATED_PERFCOUNTER)
+PHNT_REFLECT_BEGIN(PERFINFO_BOOT_PHASE_START)
+    PHNT_REFLECT_FIELD(Phase, "LONG")
+PHNT_REFLECT_END(PERFINFO_BOOT_PHASE_START)
+PHNT_REFLECT_BEGIN(PERFINFO_BOOT_PREFETCH_INFORMATION)
+    PHNT_REFLECT_FIELD(Action, "LONG")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+    PHNT_REFLECT_FIELD(Pages, "LONG")
+PHNT_REFLECT_END(PERFINFO_BOOT_PREFETCH_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_PO_SESSION_CALLOUT_RET)
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(PERFINFO_PO_SESSION_CALLOUT_RET)
+PHNT_REFLECT_BEGIN(PERFINFO_PPM_IDLE_STATE_CHANGE)
+    PHNT_REFLECT_FIELD(NewState, "ULONG")
+    PHNT_REFLECT_FIELD(OldState, "ULONG")
+    PHNT_REFLECT_FIELD(Processors, "ULONG64")
+PHNT_REFLECT_END(PERFINFO_PPM_IDLE_STATE_CHANGE)
+PHNT_REFLECT_BEGIN(PERFINFO_PPM_IDLE_STATE_ENTER)
+    PHNT_REFLECT_FIELD(State, "ULONG")
+    PHNT_REFLECT_FIELD(Properties, "USHORT")
+    PHNT_REFLECT_FIELD(ExpectedWakeReason, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(ExpectedDuration, "ULONG64")
+PHNT_REFLECT_END(PERFINFO_PPM_IDLE_STATE_ENTER)
+PHNT_REFLECT_BEGIN(PERFINFO_PPM_IDLE_STATE_EXIT)
+    PHNT_REFLECT_FIELD(State, "ULONG")
+    PHNT_REFLECT_FIELD(Status, "ULONG")
+PHNT_REFLECT_END(PERFINFO_PPM_IDLE_STATE_EXIT)
+PHNT_REFLECT_BEGIN(PERFINFO_PPM_STATE_SELECTION)
+    PHNT_REFLECT_FIELD(SelectedState, "ULONG")
+    PHNT_REFLECT_FIELD(VetoedStates, "ULONG")
+    PHNT_REFLECT_FIELD(VetoReason, "ULONG")
+PHNT_REFLECT_END(PERFINFO_PPM_STATE_SELECTION)
+PHNT_REFLECT_BEGIN(PERFINFO_PPM_IDLE_EXIT_LATENCY)
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(PlatformState, "ULONG")
+    PHNT_REFLECT_FIELD(ProcessorState, "ULONG")
+    PHNT_REFLECT_FIELD(ReturnLatency, "ULONG")
+    PHNT_REFLECT_FIELD(TotalLatency, "ULONG")
+PHNT_REFLECT_END(PERFINFO_PPM_IDLE_EXIT_LATENCY)
+PHNT_REFLECT_BEGIN(PERFINFO_PPM_PERF_STATE_CHANGE)
+    PHNT_REFLECT_FIELD(Type, "ULONG")
+    PHNT_REFLECT_FIELD(NewState, "ULONG")
+    PHNT_REFLECT_FIELD(OldState, "ULONG")
+    PHNT_REFLECT_FIELD(Result, "NTSTATUS")
+    PHNT_REFLECT_FIELD(Processors, "ULONG64")
+PHNT_REFLECT_END(PERFINFO_PPM_PERF_STATE_CHANGE)
+PHNT_REFLECT_BEGIN(PERFINFO_PPM_THERMAL_CONSTRAINT)
+    PHNT_REFLECT_FIELD(Constraint, "ULONG")
+    PHNT_REFLECT_FIELD(Processors, "ULONG64")
+PHNT_REFLECT_END(PERFINFO_PPM_THERMAL_CONSTRAINT)
+PHNT_REFLECT_BEGIN(PERFINFO_FILEOBJECT_INFORMATION)
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+PHNT_REFLECT_END(PERFINFO_FILEOBJECT_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_FILENAME_SAME_INFORMATION)
+    PHNT_REFLECT_FIELD(OldFile, "PVOID")
+    PHNT_REFLECT_FIELD(NewFile, "PVOID")
+PHNT_REFLECT_END(PERFINFO_FILENAME_SAME_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_PFMAPPED_SECTION_INFORMATION)
+    PHNT_REFLECT_FIELD(RangeBase, "PVOID")
+    PHNT_REFLECT_FIELD(RangeEnd, "PVOID")
+    PHNT_REFLECT_FIELD(CreatingProcessId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_PFMAPPED_SECTION_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_PFMAPPED_SECTION_OBJECT_INFORMATION)
+    PHNT_REFLECT_FIELD(SectionObject, "PVOID")
+    PHNT_REFLECT_FIELD(RangeBase, "PVOID")
+PHNT_REFLECT_END(PERFINFO_PFMAPPED_SECTION_OBJECT_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_SAMPLED_PROFILE_INFORMATION)
+    PHNT_REFLECT_FIELD(InstructionPointer, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Count, "USHORT")
+#ifdef DUMMYUNIONNAME
+#ifdef DUMMYSTRUCTNAME
+    PHNT_REFLECT_BITFIELD(ExecutingDpc, "UCHAR")
+    PHNT_REFLECT_BITFIELD(ExecutingIsr, "UCHAR")
+    PHNT_REFLECT_BITFIELD(Reserved, "UCHAR")
+    PHNT_REFLECT_BITFIELD(Priority, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYSTRUCTNAME, "struct")
+#endif
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(Rank, "UCHAR")
+PHNT_REFLECT_END(PERFINFO_SAMPLED_PROFILE_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_SAMPLED_PROFILE_CACHE)
+    PHNT_REFLECT_FIELD(Entries, "ULONG")
+    PHNT_REFLECT_FIELD(Sample, "PERFINFO_SAMPLED_PROFILE_INFORMATION")
+PHNT_REFLECT_END(PERFINFO_SAMPLED_PROFILE_CACHE)
+PHNT_REFLECT_BEGIN(PERFINFO_SAMPLED_PROFILE_CONFIG)
+    PHNT_REFLECT_FIELD(Source, "ULONG")
+    PHNT_REFLECT_FIELD(NewInterval, "ULONG")
+    PHNT_REFLECT_FIELD(OldInterval, "ULONG")
+PHNT_REFLECT_END(PERFINFO_SAMPLED_PROFILE_CONFIG)
+PHNT_REFLECT_BEGIN(PERFINFO_PMC_SAMPLE_INFORMATION)
+    PHNT_REFLECT_FIELD(InstructionPointer, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(ProfileSource, "USHORT")
+    PHNT_REFLECT_FIELD(Reserved, "USHORT")
+PHNT_REFLECT_END(PERFINFO_PMC_SAMPLE_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_DPC_INFORMATION)
+    PHNT_REFLECT_FIELD(InitialTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(DpcRoutine, "PVOID")
+PHNT_REFLECT_END(PERFINFO_DPC_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_DPC_ENQUEUE_INFORMATION)
+    PHNT_REFLECT_FIELD(Key, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(DpcQueueDepth, "LONG")
+    PHNT_REFLECT_FIELD(DpcCount, "ULONG")
+    PHNT_REFLECT_FIELD(TargetProcessorIndex, "ULONG")
+    PHNT_REFLECT_FIELD(Importance, "UCHAR")
+    PHNT_REFLECT_FIELD(Reserved, "UCHAR")
+PHNT_REFLECT_END(PERFINFO_DPC_ENQUEUE_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_DPC_EXECUTION_INFORMATION)
+    PHNT_REFLECT_FIELD(DpcRoutine, "PVOID")
+    PHNT_REFLECT_FIELD(Key, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_DPC_EXECUTION_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_YIELD_PROCESSOR_INFORMATION)
+    PHNT_REFLECT_FIELD(YieldReason, "ULONG")
+    PHNT_REFLECT_FIELD(DpcWatchdogCount, "ULONG")
+    PHNT_REFLECT_FIELD(DpcTimeCount, "ULONG")
+PHNT_REFLECT_END(PERFINFO_YIELD_PROCESSOR_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_INTERRUPT_INFORMATION)
+    PHNT_REFLECT_FIELD(InitialTime, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ServiceRoutine, "PVOID")
+    PHNT_REFLECT_FIELD(ReturnValue, "UCHAR")
+    PHNT_REFLECT_FIELD(Vector, "USHORT")
+    PHNT_REFLECT_FIELD(Reserved, "UCHAR")
+PHNT_REFLECT_END(PERFINFO_INTERRUPT_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_CLOCK_INTERRUPT_INFORMATION)
+    PHNT_REFLECT_FIELD(InterruptTime, "ULONG64")
+    PHNT_REFLECT_FIELD(Flags, "SHORT")
+PHNT_REFLECT_END(PERFINFO_CLOCK_INTERRUPT_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_SPINLOCK_CONFIG)
+    PHNT_REFLECT_FIELD(SpinLockSpinThreshold, "ULONG")
+    PHNT_REFLECT_FIELD(SpinLockContentionSampleRate, "ULONG")
+    PHNT_REFLECT_FIELD(SpinLockAcquireSampleRate, "ULONG")
+    PHNT_REFLECT_FIELD(SpinLockHoldThreshold, "ULONG")
+PHNT_REFLECT_END(PERFINFO_SPINLOCK_CONFIG)
+PHNT_REFLECT_BEGIN(PERFINFO_EXECUTIVE_RESOURCE_CONFIG)
+    PHNT_REFLECT_FIELD(ReleaseSamplingRate, "ULONG")
+    PHNT_REFLECT_FIELD(ContentionSamplingRate, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfExcessiveTimeouts, "ULONG")
+PHNT_REFLECT_END(PERFINFO_EXECUTIVE_RESOURCE_CONFIG)
+PHNT_REFLECT_BEGIN(PERFINFO_SESSIONCREATE_INFORMATION)
+    PHNT_REFLECT_FIELD(UniqueSessionId, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_SESSIONCREATE_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_PAGE_RANGE_IDENTITY)
+    PHNT_REFLECT_BITFIELD(UseDescription, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(UniqueKey, "ULONGLONG")
+    PHNT_REFLECT_BITFIELD(Reserved, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ProtoPteAddress, "PVOID")
+    PHNT_REFLECT_FIELD(PageFrameIndex, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(VirtualAddress, "PVOID")
+    PHNT_REFLECT_FIELD(PageCount, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_PAGE_RANGE_IDENTITY)
+PHNT_REFLECT_BEGIN(PERFINFO_KERNELMEMORY_RANGE_USAGE)
+    PHNT_REFLECT_BITFIELD(UsageType, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(VirtualAddress, "PVOID")
+    PHNT_REFLECT_FIELD(PageCount, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_KERNELMEMORY_RANGE_USAGE)
+PHNT_REFLECT_BEGIN(PERFINFO_PAGECOMBINE_AGGREGATE_STAT)
+    PHNT_REFLECT_BITFIELD(StatType, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(CombineScanCount, "ULONG")
+    PHNT_REFLECT_FIELD(PagesScanned, "ULONGLONG")
+    PHNT_REFLECT_FIELD(PagesCombined, "ULONGLONG")
+    PHNT_REFLECT_FIELD(CombinedBlocksInUse, "LONG")
+    PHNT_REFLECT_FIELD(SumCombinedBlocksReferenceCount, "LONG")
+PHNT_REFLECT_END(PERFINFO_PAGECOMBINE_AGGREGATE_STAT)
+PHNT_REFLECT_BEGIN(PERFINFO_PAGECOMBINE_ITERATION_STAT)
+    PHNT_REFLECT_BITFIELD(StatType, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(PagesScanned, "ULONG")
+    PHNT_REFLECT_FIELD(PagesCombined, "ULONG")
+PHNT_REFLECT_END(PERFINFO_PAGECOMBINE_ITERATION_STAT)
+PHNT_REFLECT_BEGIN(PERFINFO_HARDPAGEFAULT_INFORMATION)
+    PHNT_REFLECT_FIELD(ReadOffset, "LARGE_INTEGER")
+    PHNT_REFLECT_FIELD(VirtualAddress, "PVOID")
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(ByteCount, "ULONG")
+PHNT_REFLECT_END(PERFINFO_HARDPAGEFAULT_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_VIRTUAL_ALLOC)
+    PHNT_REFLECT_FIELD(CapturedBase, "PVOID")
+    PHNT_REFLECT_FIELD(CapturedRegionSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(PERFINFO_VIRTUAL_ALLOC)
+PHNT_REFLECT_BEGIN(PERFINFO_VAD_ROTATE_INFO)
+    PHNT_REFLECT_FIELD(BaseAddress, "PVOID")
+    PHNT_REFLECT_FIELD(SizeInBytes, "SIZE_T")
+    PHNT_REFLECT_BITFIELD(Direction, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(PERFINFO_VAD_ROTATE_INFO)
+PHNT_REFLECT_BEGIN(PERFINFO_MEM_RESET_INFO)
+    PHNT_REFLECT_FIELD(BaseAddress, "PVOID")
+    PHNT_REFLECT_FIELD(SizeInBytes, "SIZE_T")
+    PHNT_REFLECT_BITFIELD(TypeInfo, "ULONG")
+    PHNT_REFLECT_BITFIELD(Spare, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(PERFINFO_MEM_RESET_INFO)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_WORKITEM_ENQUEUE)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObjectKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(QueueType, "UCHAR")
+    PHNT_REFLECT_FIELD(WorkItemType, "UCHAR")
+    PHNT_REFLECT_FIELD(Requeue, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Reserved, "UCHAR")
+PHNT_REFLECT_END(PERFINFO_CC_WORKITEM_ENQUEUE)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_WORKITEM_DEQUEUE)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_CC_WORKITEM_DEQUEUE)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_WORKITEM_COMPLETE)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_CC_WORKITEM_COMPLETE)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_READ_AHEAD_COMPLETE)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(PagePriority, "ULONG")
+    PHNT_REFLECT_FIELD(DetectedPattern, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CC_READ_AHEAD_COMPLETE)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_SCHEDULE_READ_AHEAD)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObjectKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(ReadAheadUnit, "ULONG")
+    PHNT_REFLECT_FIELD(ReadAheadLength, "ULONG")
+    PHNT_REFLECT_FIELD(ReadAheadOffset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ReadAheadBeyondLastByte, "ULONGLONG")
+    PHNT_REFLECT_FIELD(ReadPattern, "UCHAR")
+    PHNT_REFLECT_FIELD(SequentialReadCount, "ULONG")
+    PHNT_REFLECT_FIELD(SharedCacheMapFlags, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReadAheadSettingsChanged, "ULONG")
+    PHNT_REFLECT_BITFIELD(ReadAheadActive, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CC_SCHEDULE_READ_AHEAD)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_LAZY_WRITE_SCAN)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ReasonForFlush, "ULONG")
+    PHNT_REFLECT_FIELD(PagesToWrite, "ULONG")
+    PHNT_REFLECT_FIELD(TotalDirtyPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(AvailablePages, "SIZE_T")
+    PHNT_REFLECT_FIELD(DirtyPageThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(NumberOfMappedVacbs, "SIZE_T")
+    PHNT_REFLECT_FIELD(TopDirtyPageThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(BottomDirtyPageThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(AverageAvailablePages, "SIZE_T")
+    PHNT_REFLECT_FIELD(AverageDirtyPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(ConsecutiveWorklessLazywriteScans, "SIZE_T")
+PHNT_REFLECT_END(PERFINFO_CC_LAZY_WRITE_SCAN)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_CAN_WRITE_FAIL)
+    PHNT_REFLECT_FIELD(FileObjectKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(TotalDirtyPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(DirtyPageThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(BytesToWrite, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CC_CAN_WRITE_FAIL)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_FLUSH_SECTION)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObjectKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Offset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(MmFlushFlags, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CC_FLUSH_SECTION)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_FLUSH_CACHE)
+    PHNT_REFLECT_FIELD(WorkItemKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObjectKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Offset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(SharedCacheMapFlags, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CC_FLUSH_CACHE)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_LOGGED_STREAM_INFO)
+    PHNT_REFLECT_FIELD(FileObjectKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ReasonForFlush, "ULONG")
+    PHNT_REFLECT_FIELD(PagesToWrite, "ULONG")
+    PHNT_REFLECT_FIELD(DirtyLoggedPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(DirtyLoggedPageThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(LargestLsnForLWS, "LARGE_INTEGER")
+PHNT_REFLECT_END(PERFINFO_CC_LOGGED_STREAM_INFO)
+PHNT_REFLECT_BEGIN(PERFINFO_CC_EXTRA_WB_THREAD_INFO)
+    PHNT_REFLECT_FIELD(ThreadAction, "ULONG")
+    PHNT_REFLECT_FIELD(ActiveExtraWBThreads, "ULONG")
+    PHNT_REFLECT_FIELD(TotalDirtyPages, "SIZE_T")
+    PHNT_REFLECT_FIELD(DirtyPageThreshold, "SIZE_T")
+    PHNT_REFLECT_FIELD(AvailablePages, "SIZE_T")
+PHNT_REFLECT_END(PERFINFO_CC_EXTRA_WB_THREAD_INFO)
+PHNT_REFLECT_BEGIN(PERFINFO_IMAGELOAD_IN_PAGEFILE_INFO)
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(DeviceCharacteristics, "ULONG")
+    PHNT_REFLECT_FIELD(FileCharacteristics, "USHORT")
+PHNT_REFLECT_END(PERFINFO_IMAGELOAD_IN_PAGEFILE_INFO)
+PHNT_REFLECT_BEGIN(PERFINFO_SYSCALL_ENTER_DATA)
+    PHNT_REFLECT_FIELD(SysCallAddr, "PVOID")
+PHNT_REFLECT_END(PERFINFO_SYSCALL_ENTER_DATA)
+PHNT_REFLECT_BEGIN(PERFINFO_SYSCALL_EXIT_DATA)
+    PHNT_REFLECT_FIELD(ReturnValue, "NTSTATUS")
+PHNT_REFLECT_END(PERFINFO_SYSCALL_EXIT_DATA)
+PHNT_REFLECT_BEGIN(PERFINFO_MARK_INFORMATION)
+    PHNT_REFLECT_FIELD(Name, "char")
+PHNT_REFLECT_END(PERFINFO_MARK_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_FILE_CREATE)
+    PHNT_REFLECT_FIELD(Irp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObject, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Options, "ULONG")
+    PHNT_REFLECT_FIELD(Attributes, "ULONG")
+    PHNT_REFLECT_FIELD(ShareAccess, "ULONG")
+    PHNT_REFLECT_FIELD(OpenPath, "WCHAR")
+PHNT_REFLECT_END(PERFINFO_FILE_CREATE)
+PHNT_REFLECT_BEGIN(PERFINFO_FILE_INFORMATION)
+    PHNT_REFLECT_FIELD(Irp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObject, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ExtraInformation, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(InfoClass, "ULONG")
+PHNT_REFLECT_END(PERFINFO_FILE_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_FILE_DIRENUM)
+    PHNT_REFLECT_FIELD(Irp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObject, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Length, "ULONG")
+    PHNT_REFLECT_FIELD(InfoClass, "ULONG")
+    PHNT_REFLECT_FIELD(FileIndex, "ULONG")
+    PHNT_REFLECT_FIELD(FileName, "WCHAR")
+PHNT_REFLECT_END(PERFINFO_FILE_DIRENUM)
+PHNT_REFLECT_BEGIN(PERFINFO_FILE_PATH_OPERATION)
+    PHNT_REFLECT_FIELD(Irp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObject, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ExtraInformation, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(InfoClass, "ULONG")
+    PHNT_REFLECT_FIELD(Path, "WCHAR")
+PHNT_REFLECT_END(PERFINFO_FILE_PATH_OPERATION)
+PHNT_REFLECT_BEGIN(PERFINFO_FILE_READ_WRITE)
+    PHNT_REFLECT_FIELD(Offset, "ULONGLONG")
+    PHNT_REFLECT_FIELD(Irp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObject, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Size, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+    PHNT_REFLECT_FIELD(ExtraFlags, "ULONG")
+PHNT_REFLECT_END(PERFINFO_FILE_READ_WRITE)
+PHNT_REFLECT_BEGIN(PERFINFO_FILE_SIMPLE_OPERATION)
+    PHNT_REFLECT_FIELD(Irp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileObject, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FileKey, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(IssuingThreadId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_FILE_SIMPLE_OPERATION)
+PHNT_REFLECT_BEGIN(PERFINFO_FILE_OPERATION_END)
+    PHNT_REFLECT_FIELD(Irp, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ExtraInformation, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(PERFINFO_FILE_OPERATION_END)
+PHNT_REFLECT_BEGIN(PERFINFO_FLT_OPERATION)
+    PHNT_REFLECT_FIELD(RoutineAddr, "PVOID")
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(FsContext, "PVOID")
+    PHNT_REFLECT_FIELD(IrpPtr, "PVOID")
+    PHNT_REFLECT_FIELD(CbdPtr, "PVOID")
+    PHNT_REFLECT_FIELD(MajorFunction, "LONG")
+PHNT_REFLECT_END(PERFINFO_FLT_OPERATION)
+PHNT_REFLECT_BEGIN(PERFINFO_FLT_OPERATION_STATUS)
+    PHNT_REFLECT_FIELD(RoutineAddr, "PVOID")
+    PHNT_REFLECT_FIELD(FileObject, "PVOID")
+    PHNT_REFLECT_FIELD(FsContext, "PVOID")
+    PHNT_REFLECT_FIELD(IrpPtr, "PVOID")
+    PHNT_REFLECT_FIELD(CbdPtr, "PVOID")
+    PHNT_REFLECT_FIELD(MajorFunction, "LONG")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+PHNT_REFLECT_END(PERFINFO_FLT_OPERATION_STATUS)
+PHNT_REFLECT_BEGIN(PERFINFO_MEMORY_INFORMATION)
+    PHNT_REFLECT_FIELD(ZeroPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(FreePageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ModifiedPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ModifiedNoWritePageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(BadPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(PageCountByPriority, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(RepurposedPagesByPriority, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ModifiedPageCountPageFile, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_MEMORY_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_SYSTEM_MEMORY_INFORMATION)
+    PHNT_REFLECT_FIELD(PagedPoolCommitPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(NonPagedPoolPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(MdlPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(CommitPageCount, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_SYSTEM_MEMORY_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_WORKINGSET_ENTRY)
+    PHNT_REFLECT_FIELD(UniqueProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(SessionId, "ULONG")
+    PHNT_REFLECT_FIELD(WorkingSetPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(CommitPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(PagedPoolPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(VirtualSizeInPages, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(PrivateWorkingSetPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(StoreSizeInPages, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(StoredPageCount, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(CommitDebtInPages, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(SharedCommitInPages, "ULONG_PTR")
+PHNT_REFLECT_END(PERFINFO_WORKINGSET_ENTRY)
+PHNT_REFLECT_BEGIN(PERFINFO_WORKINGSET_INFORMATION)
+    PHNT_REFLECT_FIELD(Count, "ULONG")
+    PHNT_REFLECT_FIELD(WsEntry, "PERFINFO_WORKINGSET_ENTRY")
+PHNT_REFLECT_END(PERFINFO_WORKINGSET_INFORMATION)
+PHNT_REFLECT_BEGIN(PERFINFO_CONTIGUOUS_PAGE_GENERATE)
+    PHNT_REFLECT_FIELD(ThreadId, "ULONGLONG")
+    PHNT_REFLECT_FIELD(NumberOfBytes, "ULONGLONG")
+PHNT_REFLECT_END(PERFINFO_CONTIGUOUS_PAGE_GENERATE)
+PHNT_REFLECT_BEGIN(PERFINFO_DEBUG_EVENT)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadId, "ULONG")
+    PHNT_REFLECT_FIELD(Reason, "PERFINFO_DEBUG_EVENT_REASON")
+PHNT_REFLECT_END(PERFINFO_DEBUG_EVENT)
+PHNT_REFLECT_BEGIN(PERFINFO_CCSWAP_BUFFER)
+    PHNT_REFLECT_FIELD(FirstTimeStamp, "LONGLONG")
+    PHNT_REFLECT_FIELD(TidTable, "ULONG")
+    PHNT_REFLECT_FIELD(ThreadBasePriority, "SCHAR")
+PHNT_REFLECT_END(PERFINFO_CCSWAP_BUFFER)
+PHNT_REFLECT_BEGIN(PERFINFO_CCSWAP_IDLE_SHORT)
+    PHNT_REFLECT_BITFIELD(DataType, "USHORT")
+    PHNT_REFLECT_BITFIELD(TimeDelta, "USHORT")
+PHNT_REFLECT_END(PERFINFO_CCSWAP_IDLE_SHORT)
+PHNT_REFLECT_BEGIN(PERFINFO_CCSWAP_IDLE)
+    PHNT_REFLECT_BITFIELD(DataType, "ULONG")
+    PHNT_REFLECT_BITFIELD(TimeDelta, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CCSWAP_IDLE)
+PHNT_REFLECT_BEGIN(PERFINFO_CCSWAP_LITE)
+    PHNT_REFLECT_BITFIELD(DataType, "ULONG")
+    PHNT_REFLECT_BITFIELD(OldThreadIdIndex, "ULONG")
+    PHNT_REFLECT_BITFIELD(OldThreadPriInc, "ULONG")
+    PHNT_REFLECT_BITFIELD(OldThreadStateWr, "ULONG")
+    PHNT_REFLECT_BITFIELD(TimeDelta, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CCSWAP_LITE)
+PHNT_REFLECT_BEGIN(PERFINFO_CCSWAP)
+    PHNT_REFLECT_BITFIELD(DataType, "ULONG")
+    PHNT_REFLECT_BITFIELD(TimeDelta, "ULONG")
+    PHNT_REFLECT_BITFIELD(OldThreadIdIndex, "ULONG")
+    PHNT_REFLECT_BITFIELD(OldThreadStateWr, "ULONG")
+    PHNT_REFLECT_BITFIELD(OldThreadPriority, "ULONG")
+    PHNT_REFLECT_BITFIELD(NewThreadWaitTime, "ULONG")
+PHNT_REFLECT_END(PERFINFO_CCSWAP)
+PHNT_REFLECT_BEGIN(PERFINFO_PROCESS_PERFCTR)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(PageFaultCount, "ULONG")
+    PHNT_REFLECT_FIELD(HandleCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(PeakVirtualSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakWorkingSetSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PeakPagefileUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaPeakPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaPeakNonPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(VirtualSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(WorkingSetSize, "SIZE_T")
+    PHNT_REFLECT_FIELD(PagefileUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(QuotaNonPagedPoolUsage, "SIZE_T")
+    PHNT_REFLECT_FIELD(PrivatePageCount, "SIZE_T")
+PHNT_REFLECT_END(PERFINFO_PROCESS_PERFCTR)
+PHNT_REFLECT_BEGIN(PERFINFO_PROCESS_PERFCTR32)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(PageFaultCount, "ULONG")
+    PHNT_REFLECT_FIELD(HandleCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(PeakVirtualSize, "ULONG32")
+    PHNT_REFLECT_FIELD(PeakWorkingSetSize, "ULONG32")
+    PHNT_REFLECT_FIELD(PeakPagefileUsage, "ULONG32")
+    PHNT_REFLECT_FIELD(QuotaPeakPagedPoolUsage, "ULONG32")
+    PHNT_REFLECT_FIELD(QuotaPeakNonPagedPoolUsage, "ULONG32")
+    PHNT_REFLECT_FIELD(VirtualSize, "ULONG32")
+    PHNT_REFLECT_FIELD(WorkingSetSize, "ULONG32")
+    PHNT_REFLECT_FIELD(PagefileUsage, "ULONG32")
+    PHNT_REFLECT_FIELD(QuotaPagedPoolUsage, "ULONG32")
+    PHNT_REFLECT_FIELD(QuotaNonPagedPoolUsage, "ULONG32")
+    PHNT_REFLECT_FIELD(PrivatePageCount, "ULONG32")
+PHNT_REFLECT_END(PERFINFO_PROCESS_PERFCTR32)
+PHNT_REFLECT_BEGIN(PERFINFO_PROCESS_PERFCTR64)
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+    PHNT_REFLECT_FIELD(PageFaultCount, "ULONG")
+    PHNT_REFLECT_FIELD(HandleCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+    PHNT_REFLECT_FIELD(PeakVirtualSize, "ULONG64")
+    PHNT_REFLECT_FIELD(PeakWorkingSetSize, "ULONG64")
+    PHNT_REFLECT_FIELD(PeakPagefileUsage, "ULONG64")
+    PHNT_REFLECT_FIELD(QuotaPeakPagedPoolUsage, "ULONG64")
+    PHNT_REFLECT_FIELD(QuotaPeakNonPagedPoolUsage, "ULONG64")
+    PHNT_REFLECT_FIELD(VirtualSize, "ULONG64")
+    PHNT_REFLECT_FIELD(WorkingSetSize, "ULONG64")
+    PHNT_REFLECT_FIELD(PagefileUsage, "ULONG64")
+    PHNT_REFLECT_FIELD(QuotaPagedPoolUsage, "ULONG64")
+    PHNT_REFLECT_FIELD(QuotaNonPagedPoolUsage, "ULONG64")
+    PHNT_REFLECT_FIELD(PrivatePageCount, "ULONG64")
+PHNT_REFLECT_END(PERFINFO_PROCESS_PERFCTR64)
+PHNT_REFLECT_BEGIN(PERFINFO_PROCESS_INSWAP)
+    PHNT_REFLECT_FIELD(DirectoryTableBase, "ULONG_PTR")
+    PHNT_REFLECT_FIELD(ProcessId, "ULONG")
+PHNT_REFLECT_END(PERFINFO_PROCESS_INSWAP)
+PHNT_REFLECT_BEGIN(PERFINFO_IO_TIMER)
+    PHNT_REFLECT_FIELD(DeviceObject, "PVOID")
+    PHNT_REFLECT_FIELD(RoutineAddress, "PVOID")
+PHNT_REFLECT_END(PERFINFO_IO_TIMER)
+PHNT_REFLECT_BEGIN(WMI_LOGGER_INFORMATION)
+    PHNT_REFLECT_FIELD(Wnode, "WNODE_HEADER")
+    PHNT_REFLECT_FIELD(BufferSize, "ULONG")
+    PHNT_REFLECT_FIELD(MinimumBuffers, "ULONG")
+    PHNT_REFLECT_FIELD(MaximumBuffers, "ULONG")
+    PHNT_REFLECT_FIELD(MaximumFileSize, "ULONG")
+    PHNT_REFLECT_FIELD(LogFileMode, "ULONG")
+    PHNT_REFLECT_FIELD(FlushTimer, "ULONG")
+    PHNT_REFLECT_FIELD(EnableFlags, "ULONG")
+#ifdef DUMMYUNIONNAME
+    PHNT_REFLECT_FIELD(AgeLimit, "LONG")
+    PHNT_REFLECT_FIELD(FlushThreshold, "LONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME, "union")
+#endif
+    PHNT_REFLECT_FIELD(Wow, "ULONG")
+#ifdef DUMMYUNIONNAME2
+    PHNT_REFLECT_FIELD(LogFileHandle, "HANDLE")
+    PHNT_REFLECT_FIELD(LogFileHandle64, "ULONG64")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME2, "union")
+#endif
+#ifdef DUMMYUNIONNAME3
+    PHNT_REFLECT_FIELD(NumberOfBuffers, "ULONG")
+    PHNT_REFLECT_FIELD(InstanceCount, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME3, "union")
+#endif
+#ifdef DUMMYUNIONNAME4
+    PHNT_REFLECT_FIELD(FreeBuffers, "ULONG")
+    PHNT_REFLECT_FIELD(InstanceId, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME4, "union")
+#endif
+#ifdef DUMMYUNIONNAME5
+    PHNT_REFLECT_FIELD(EventsLost, "ULONG")
+    PHNT_REFLECT_FIELD(NumberOfProcessors, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME5, "union")
+#endif
+    PHNT_REFLECT_FIELD(BuffersWritten, "ULONG")
+#ifdef DUMMYUNIONNAME6
+    PHNT_REFLECT_FIELD(LogBuffersLost, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME6, "union")
+#endif
+    PHNT_REFLECT_FIELD(RealTimeBuffersLost, "ULONG")
+#ifdef DUMMYUNIONNAME7
+    PHNT_REFLECT_FIELD(LoggerThreadId, "HANDLE")
+    PHNT_REFLECT_FIELD(LoggerThreadId64, "ULONG64")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME7, "union")
+#endif
+#ifdef DUMMYUNIONNAME8
+    PHNT_REFLECT_FIELD(LogFileName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(LogFileName64, "UNICODE_STRING64")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME8, "union")
+#endif
+#ifdef DUMMYUNIONNAME9
+    PHNT_REFLECT_FIELD(LoggerName, "UNICODE_STRING")
+    PHNT_REFLECT_FIELD(LoggerName64, "UNICODE_STRING64")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME9, "union")
+#endif
+    PHNT_REFLECT_FIELD(RealTimeConsumerCount, "ULONG")
+    PHNT_REFLECT_FIELD(SpareUlong, "ULONG")
+#ifdef DUMMYUNIONNAME10
+    PHNT_REFLECT_FIELD(LoggerExtension, "PVOID")
+    PHNT_REFLECT_FIELD(LoggerExtension64, "ULONG64")
+#else
+    PHNT_REFLECT_FIELD(DUMMYUNIONNAME10, "union")
+#endif
+PHNT_REFLECT_END(WMI_LOGGER_INFORMATION)
+PHNT_REFLECT_BEGIN(ETW_UMGL_KEY)
+    PHNT_REFLECT_FIELD(LoggerId, "UCHAR")
+    PHNT_REFLECT_FIELD(Flags, "UCHAR")
+PHNT_REFLECT_END(ETW_UMGL_KEY)
+PHNT_REFLECT_BEGIN(ETW_KERNEL_HEADER_EXTENSION)
+    PHNT_REFLECT_FIELD(GroupMasks, "PERFINFO_GROUPMASK")
+    PHNT_REFLECT_FIELD(Version, "ULONG")
+PHNT_REFLECT_END(ETW_KERNEL_HEADER_EXTENSION)
+PHNT_REFLECT_BEGIN(ETW_SET_MARK_INFORMATION)
+    PHNT_REFLECT_FIELD(Flag, "ULONG")
+    PHNT_REFLECT_FIELD(Mark, "WCHAR")
+PHNT_REFLECT_END(ETW_SET_MARK_INFORMATION)
+PHNT_REFLECT_BEGIN(ETW_NOTIFICATION_HEADER)
+    PHNT_REFLECT_FIELD(NotificationType, "ETW_NOTIFICATION_TYPE")
+    PHNT_REFLECT_FIELD(NotificationSize, "ULONG")
+    PHNT_REFLECT_FIELD(Offset, "ULONG")
+    PHNT_REFLECT_FIELD(ReplyRequested, "BOOLEAN")
+    PHNT_REFLECT_FIELD(Timeout, "ULONG")
+    PHNT_REFLECT_FIELD(ReplyCount, "ULONG")
+    PHNT_REFLECT_FIELD(NotifyeeCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved2, "ULONGLONG")
+    PHNT_REFLECT_FIELD(TargetPID, "ULONG")
+    PHNT_REFLECT_FIELD(SourcePID, "ULONG")
+    PHNT_REFLECT_FIELD(DestinationGuid, "GUID")
+    PHNT_REFLECT_FIELD(SourceGuid, "GUID")
+PHNT_REFLECT_END(ETW_NOTIFICATION_HEADER)
+PHNT_REFLECT_BEGIN(ETW_SESSION_NOTIFICATION_PACKET)
+    PHNT_REFLECT_FIELD(NotificationHeader, "ETW_NOTIFICATION_HEADER")
+    PHNT_REFLECT_FIELD(Type, "ETW_SESSION_NOTIFICATION_TYPE")
+    PHNT_REFLECT_FIELD(Status, "NTSTATUS")
+    PHNT_REFLECT_FIELD(TraceHandle, "TRACEHANDLE")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(ETW_SESSION_NOTIFICATION_PACKET)
+#if (PHNT_MODE != PHNT_MODE_KERNEL)
+#ifdef EVENT_DESCRIPTOR_DEF
+PHNT_REFLECT_BEGIN(EVENT_DESCRIPTOR)
+    PHNT_REFLECT_FIELD(Id, "USHORT")
+    PHNT_REFLECT_FIELD(Version, "UCHAR")
+    PHNT_REFLECT_FIELD(Channel, "UCHAR")
+    PHNT_REFLECT_FIELD(Level, "UCHAR")
+    PHNT_REFLECT_FIELD(Opcode, "UCHAR")
+    PHNT_REFLECT_FIELD(Task, "USHORT")
+    PHNT_REFLECT_FIELD(Keyword, "ULONGLONG")
+PHNT_REFLECT_END(EVENT_DESCRIPTOR)
+#endif
+#endif
+PHNT_REFLECT_BEGIN(ETW_TRACE_PROVIDER_INSTANCE_INFO)
+    PHNT_REFLECT_FIELD(NextOffset, "ULONG")
+    PHNT_REFLECT_FIELD(EnableCount, "ULONG")
+    PHNT_REFLECT_FIELD(Pid, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(ETW_TRACE_PROVIDER_INSTANCE_INFO)
+PHNT_REFLECT_BEGIN(ETW_TRACE_GUID_INFO)
+    PHNT_REFLECT_FIELD(InstanceCount, "ULONG")
+    PHNT_REFLECT_FIELD(Reserved, "ULONG")
+PHNT_REFLECT_END(ETW_TRACE_GUID_INFO)
+PHNT_REFLECT_BEGIN(TELEMETRY_COVERAGE_POINT)
+    PHNT_REFLECT_FIELD(Name, "PWSTR")
+    PHNT_REFLECT_FIELD(Hash, "ULONG")
+    PHNT_REFLECT_FIELD(LastCoveredRound, "ULONG")
+    PHNT_REFLECT_FIELD(Flags, "ULONG")
+PHNT_REFLECT_END(TELEMETRY_COVERAGE_POINT)
+#endif
@@ -0,0 +1,163 @@
+﻿/*
+ * Copyright 2024 Yonggang Luo
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// ==Structure reflection==
+//
+// phnt::struct_info<T> lists the members of every structure defined in the headers
+// below: name, type as spelled in the header, offset and size. Only the names come
+// from the table in win-polyfill-reflection-table.h, generated by
+// cmake/generate_reflection_table.cmake (build the win-polyfill-reflection target
+// after changing the headers); offsets and sizes are computed by the compiler, so a
+// build for x86, x64 or arm64, in PHNT_MODE_LAYOUT or not, gets the table of that ABI.
+//
+//   struct_info<T>::fields       field_info array, field_count entries
+//   struct_info<T>::visit(s, f)  calls f(field, value) for each member of s in order
+//   for_each_struct(f)           calls f(struct_info<T>()) for each structure
+//   field_bits<T>(field)         bit offset and width of a member, bit-fields included
+//
+// Bit-fields have no offset or size in C++, field_bits() finds them at run time.
+
+#ifndef __cplusplus
+#error "win-polyfill-reflection.h requires C++"
+#endif
+
+#include <stddef.h>
+
+#include "phnt_ntdef.h"
+#include "ntkeapi.h"
+#include "ntldr.h"
+#include "ntexapi.h"
+#include "ntpoapi.h"
+#include "ntimage.h"
+#include "ntpebteb.h"
+#include "ntwmi.h"
+
+namespace phnt
+{
+
+    struct field_info
+    {
+        const char *Name;
+        const char *Type;
+        // 0 for bit-fields, see field_bits()
+        ULONG Offset;
+        // Size of the declared type for bit-fields
+        ULONG Size;
+        // Sets a bit-field to all ones, nullptr for other members
+        void (*SetBits)(void *Struct);
+    };
+
+    struct field_bits_info
+    {
+        ULONG BitOffset;
+        ULONG BitWidth;
+    };
+
+    template <class T> struct struct_info;
+
+#define PHNT_REFLECT_BEGIN(T)                                                            \
+    template <> struct struct_info<T>                                                    \
+    {                                                                                    \
+        typedef T type;                                                                  \
+        static constexpr const char name[] = #T;                                         \
+        static constexpr field_info fields[] = {
+#define PHNT_REFLECT_FIELD(Name, Type)                                                   \
+    {#Name, Type, offsetof(type, Name), RTL_FIELD_SIZE(type, Name), nullptr},
+#define PHNT_REFLECT_FLEXIBLE_FIELD(Name, Type)                                          \
+    {#Name, Type, offsetof(type, Name), 0, nullptr},
+#define PHNT_REFLECT_BITFIELD(Name, Type)                                                \
+    {#Name, Type, 0, sizeof(decltype(((type *)0)->Name)), [](void *Struct) {             \
+         type &s = *static_cast<type *>(Struct);                                         \
+         auto ones = static_cast<decltype(s.Name)>(~0ull);                               \
+         s.Name = ones;                                                                  \
+     }},
+#define PHNT_REFLECT_END(T)                                                              \
+    {                                                                                    \
+        nullptr, nullptr, 0, 0, nullptr                                                  \
+    }                                                                                    \
+    }                                                                                    \
+    ;                                                                                    \
+    static constexpr ULONG field_count = RTL_NUMBER_OF(fields) - 1;                      \
+    template <class F> static void visit(const type &s, F &&f);                          \
+    }                                                                                    \
+    ;
+#include "win-polyfill-reflection-table.h"
+#undef PHNT_REFLECT_BEGIN
+#undef PHNT_REFLECT_FIELD
+#undef PHNT_REFLECT_FLEXIBLE_FIELD
+#undef PHNT_REFLECT_BITFIELD
+#undef PHNT_REFLECT_END
+
+// Bit-fields are passed by value as ULONGLONG, other members by reference.
+#define PHNT_REFLECT_BEGIN(T)                                                            \
+    template <class F> void struct_info<T>::visit(const type &s, F &&f)                  \
+    {                                                                                    \
+        const field_info *field = fields;
+#define PHNT_REFLECT_FIELD(Name, Type) f(*field++, s.Name);
+#define PHNT_REFLECT_FLEXIBLE_FIELD(Name, Type) f(*field++, s.Name);
+#define PHNT_REFLECT_BITFIELD(Name, Type) f(*field++, static_cast<ULONGLONG>(s.Name));
+#define PHNT_REFLECT_END(T)                                                              \
+    (void)field;                                                                         \
+    (void)s;                                                                             \
+    (void)f;                                                                             \
+    }
+#include "win-polyfill-reflection-table.h"
+#undef PHNT_REFLECT_BEGIN
+#undef PHNT_REFLECT_FIELD
+#undef PHNT_REFLECT_FLEXIBLE_FIELD
+#undef PHNT_REFLECT_BITFIELD
+#undef PHNT_REFLECT_END
+
+    template <class F> void for_each_struct(F &&f)
+    {
+#define PHNT_REFLECT_BEGIN(T) f(struct_info<T>());
+#define PHNT_REFLECT_FIELD(Name, Type)
+#define PHNT_REFLECT_FLEXIBLE_FIELD(Name, Type)
+#define PHNT_REFLECT_BITFIELD(Name, Type)
+#define PHNT_REFLECT_END(T)
+#include "win-polyfill-reflection-table.h"
+#undef PHNT_REFLECT_BEGIN
+#undef PHNT_REFLECT_FIELD
+#undef PHNT_REFLECT_FLEXIBLE_FIELD
+#undef PHNT_REFLECT_BITFIELD
+#undef PHNT_REFLECT_END
+    }
+
+    template <class T> field_bits_info field_bits(const field_info &field)
+    {
+        if (!field.SetBits)
+        {
+            return {field.Offset * 8, field.Size * 8};
+        }
+
+        union
+        {
+            T Struct;
+            UCHAR Bytes[sizeof(T)];
+        } probe;
+        for (ULONG i = 0; i < sizeof(T); ++i)
+        {
+            probe.Bytes[i] = 0;
+        }
+        field.SetBits(&probe.Struct);
+
+        field_bits_info bits = {0, 0};
+        for (ULONG i = 0; i < sizeof(T) * 8; ++i)
+        {
+            if (probe.Bytes[i / 8] & (1 << (i % 8)))
+            {
+                if (bits.BitWidth == 0)
+                {
+                    bits.BitOffset = i;
+                }
+                bits.BitWidth = i + 1 - bits.BitOffset;
+            }
+        }
+        return bits;
+    }
+
+} // namespace phnt
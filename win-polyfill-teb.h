@@ -3,7 +3,9 @@
  * SPDX-License-Identifier: MIT
  */
 
-#pragma once
+#if !defined(_WIN_POLYFILL_TEB_H) || defined(WIN_POLYFILL_BASIC_PASS)
+#ifndef WIN_POLYFILL_BASIC_PASS
+#define _WIN_POLYFILL_TEB_H
 
 #include "ntpebteb.h"
 
@@ -11,7 +13,13 @@
 extern "C" {
 #endif
 
+// Re-included by win-polyfill-basic-pebteb.h, see win-polyfill-peb.h.
+#ifndef WIN_POLYFILL_POINTER
+#define WIN_POLYFILL_POINTER(Type) Type
+#endif
+
 typedef struct _PEB PEB;
+#endif // WIN_POLYFILL_BASIC_PASS
 
 // ==TEB==
 // https://www.geoffchappell.com/studies/windows/km/ntoskrnl/inc/api/pebteb/teb/index.htm
@@ -278,7 +286,7 @@ typedef struct _TEB
     // 0x2C 0x58 (all)
     PVOID ThreadLocalStoragePointer;
     // 0x30 0x60 (all)
-    PEB *ProcessEnvironmentBlock;
+    WIN_POLYFILL_POINTER(PEB *) ProcessEnvironmentBlock;
     // 0x34 0x68 (all)
     ULONG LastErrorValue;
     union
@@ -797,7 +805,7 @@ typedef struct _TEB
                         struct
                         {
                             // 0x01A8 0x02C8 (late 5.2 and higher)
-                            ACTIVATION_CONTEXT_STACK *ActivationContextStackPointer;
+                            WIN_POLYFILL_POINTER(ACTIVATION_CONTEXT_STACK *) ActivationContextStackPointer;
                             // 0x01AC 0x02D0 (10.0 and higher)
                             ULONG_PTR InstrumentationCallbackSp;
                             // 0x01B0 0x02D8 (10.0 and higher)
@@ -1100,7 +1108,7 @@ typedef struct _TEB
         // 0x0F88 (5.0 to early 5.2)
         struct
         {
-            ULONG *CallBx86Eip;
+            WIN_POLYFILL_POINTER(ULONG *) CallBx86Eip;
             PVOID DeallocationCpu;
             UCHAR UseKnownWx86Dll;
             CHAR OleStubInvoked;
@@ -1140,7 +1148,7 @@ typedef struct _TEB
     // 64-bit builds.
     //
     // 0x0F94 0x1780 (5.0 and higher)
-    PVOID *TlsExpansionSlots;
+    WIN_POLYFILL_POINTER(PVOID *) TlsExpansionSlots;
 #ifdef _WIN64
     // none 0x1788 (late 5.2 and higher)
     union
@@ -1197,7 +1205,7 @@ typedef struct _TEB
     // 0x0FAC 0x17B8 (5.1 and higher)
     HANDLE CurrentTransactionHandle;
     // 0x0FB0 0x17C0 (5.1 and higher) (last member in early 5.1)
-    PTEB_ACTIVE_FRAME ActiveFrame;
+    WIN_POLYFILL_POINTER(PTEB_ACTIVE_FRAME) ActiveFrame;
     // 0x0FB4 0x17C8 (late 5.1 and higher)
     union
     {
@@ -1323,6 +1331,9 @@ typedef struct _TEB
     ULONG Rcu[2];
 } TEB, *PTEB;
 
+#ifndef WIN_POLYFILL_BASIC_PASS
 #ifdef __cplusplus
 }
 #endif
+#endif // WIN_POLYFILL_BASIC_PASS
+#endif